@@ -8,6 +8,8 @@
 #include "VehicleSimApiBase.hpp"
 #include "WorldSimApiBase.hpp"
 #include <map>
+#include <mutex>
+#include <vector>
 #include "common/common_utils/UniqueValueMap.hpp"
 
 
@@ -25,6 +27,7 @@ public:
     //vehicle API
     virtual VehicleApiBase* getVehicleApi(const std::string& vehicle_name)
     {
+        std::lock_guard<std::mutex> locker(mutex_);
         return vehicle_apis_.findOrDefault(vehicle_name, nullptr);
     }
 
@@ -37,16 +40,39 @@ public:
     //vehicle simulation API
     virtual VehicleSimApiBase* getVehicleSimApi(const std::string& vehicle_name) const
     {
+        std::lock_guard<std::mutex> locker(mutex_);
         return vehicle_sim_apis_.findOrDefault(vehicle_name, nullptr);
     }
 
+    //batch versions resolve all names under single lock, missing vehicles are returned as nullptr
+    virtual std::vector<VehicleApiBase*> findVehicleApis(const std::vector<std::string>& vehicle_names)
+    {
+        std::lock_guard<std::mutex> locker(mutex_);
+        std::vector<VehicleApiBase*> apis;
+        apis.reserve(vehicle_names.size());
+        for (const auto& vehicle_name : vehicle_names)
+            apis.push_back(vehicle_apis_.findOrDefault(vehicle_name, nullptr));
+        return apis;
+    }
+    virtual std::vector<VehicleSimApiBase*> findVehicleSimApis(const std::vector<std::string>& vehicle_names) const
+    {
+        std::lock_guard<std::mutex> locker(mutex_);
+        std::vector<VehicleSimApiBase*> apis;
+        apis.reserve(vehicle_names.size());
+        for (const auto& vehicle_name : vehicle_names)
+            apis.push_back(vehicle_sim_apis_.findOrDefault(vehicle_name, nullptr));
+        return apis;
+    }
+
     size_t getVehicleCount() const
     {
+        std::lock_guard<std::mutex> locker(mutex_);
         return vehicle_apis_.valsSize();
     }
     void insert_or_assign(const std::string& vehicle_name, VehicleApiBase* vehicle_api, 
         VehicleSimApiBase* vehicle_sim_api)
     {
+        std::lock_guard<std::mutex> locker(mutex_);
         vehicle_apis_.insert_or_assign(vehicle_name, vehicle_api);
         vehicle_sim_apis_.insert_or_assign(vehicle_name, vehicle_sim_api);
     }
@@ -60,12 +86,14 @@ public:
     } 
     bool hasDefaultVehicle() const
     {
+        std::lock_guard<std::mutex> locker(mutex_);
         return !(vehicle_apis_.findOrDefault("", nullptr) == nullptr &&
             vehicle_sim_apis_.findOrDefault("", nullptr) == nullptr);
     }
 
     void makeDefaultVehicle(const std::string& vehicle_name)
     {
+        std::lock_guard<std::mutex> locker(mutex_);
         vehicle_apis_.insert_or_assign("", vehicle_apis_.at(vehicle_name));
         vehicle_sim_apis_.insert_or_assign("", vehicle_sim_apis_.at(vehicle_name));
     }
@@ -75,6 +103,8 @@ private:
 
     common_utils::UniqueValueMap<std::string, VehicleApiBase*> vehicle_apis_;
     common_utils::UniqueValueMap<std::string, VehicleSimApiBase*> vehicle_sim_apis_;
+    //guards lookups against vehicles being added while API server is running
+    mutable std::mutex mutex_;
 };
 
 }} //namespace
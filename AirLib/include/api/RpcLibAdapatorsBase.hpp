@@ -5,12 +5,18 @@
 #define air_RpcLibAdapatorsBase_hpp
 
 #include "common/Common.hpp"
+#include <cstring>
 #include "common/CommonStructs.hpp"
 #include "physics/Kinematics.hpp"
 #include "physics/Environment.hpp"
 #include "common/ImageCaptureBase.hpp"
 #include "safety/SafetyEval.hpp"
 #include "api/WorldSimApiBase.hpp"
+#include "common/TickProfiler.hpp"
+#include "common/SharedImageRing.hpp"
+#include "api/TopicSubscription.hpp"
+#include "sensors/imu/ImuBase.hpp"
+#include "sensors/gps/GpsBase.hpp"
 
 #include "common/common_utils/WindowsApisCommonPre.hpp"
 #include "rpc/msgpack.hpp"
@@ -466,26 +472,109 @@ public:
         }
     };
 
+    struct SharedImageRingInfo {
+        std::string name;
+        uint32_t slot_count = 0;
+        uint64_t slot_size = 0;
+        uint64_t instance_id = 0;
+
+        MSGPACK_DEFINE_MAP(name, slot_count, slot_size, instance_id);
+    };
+
+    //same as ImageResponse but pixels stay in SharedImageRing and only their location is sent
+    struct SharedImageResponse {
+        uint32_t slot;
+        uint64_t offset;
+        uint64_t size;
+        uint64_t sequence;
+        uint64_t instance_id;
+
+        std::string camera_name;
+        Vector3r camera_position;
+        Quaternionr camera_orientation;
+        msr::airlib::TTimePoint time_stamp;
+        std::string message;
+        bool pixels_as_float;
+        bool compress;
+        int width, height;
+        msr::airlib::ImageCaptureBase::ImageType image_type;
+
+        MSGPACK_DEFINE_MAP(slot, offset, size, sequence, instance_id, camera_position, camera_name,
+            camera_orientation, time_stamp, message, pixels_as_float, compress, width, height, image_type);
+
+        SharedImageResponse()
+        {}
+
+        SharedImageResponse(const msr::airlib::ImageCaptureBase::ImageResponse& s, const msr::airlib::SharedImageRing::Descriptor& descriptor)
+        {
+            slot = descriptor.slot;
+            offset = descriptor.offset;
+            size = descriptor.size;
+            sequence = descriptor.sequence;
+            instance_id = descriptor.instance_id;
+
+            camera_name = s.camera_name;
+            camera_position = Vector3r(s.camera_position);
+            camera_orientation = Quaternionr(s.camera_orientation);
+            time_stamp = s.time_stamp;
+            message = s.message;
+            pixels_as_float = s.pixels_as_float;
+            compress = s.compress;
+            width = s.width;
+            height = s.height;
+            image_type = s.image_type;
+        }
+
+        msr::airlib::SharedImageResponse to(const msr::airlib::SharedImageRing& ring) const
+        {
+            msr::airlib::SharedImageResponse d;
+
+            d.descriptor.slot = slot;
+            d.descriptor.offset = offset;
+            d.descriptor.size = size;
+            d.descriptor.sequence = sequence;
+            d.descriptor.instance_id = instance_id;
+            d.data = ring.getData(d.descriptor);
+
+            d.response.pixels_as_float = pixels_as_float;
+            d.response.camera_name = camera_name;
+            d.response.camera_position = camera_position.to();
+            d.response.camera_orientation = camera_orientation.to();
+            d.response.time_stamp = time_stamp;
+            d.response.message = message;
+            d.response.compress = compress;
+            d.response.width = width;
+            d.response.height = height;
+            d.response.image_type = image_type;
+
+            return d;
+        }
+    };
+
+    //point cloud and optional channels travel as packed binary blobs in host byte order
+    //(little-endian on all supported platforms) instead of msgpack arrays so each float
+    //doesn't carry its own type tag; empty channels are sent as single byte blob
     struct LidarData {
 
         msr::airlib::TTimePoint time_stamp;    // timestamp
-        std::vector<float> point_cloud;        // data
+        std::vector<uint8_t> point_cloud;      // float32 x, y, z per point
+        std::vector<uint8_t> ring;             // uint16 per point
+        std::vector<uint8_t> time_offset;      // float32 per point
         Pose pose;
 
-        MSGPACK_DEFINE_MAP(time_stamp, point_cloud, pose);
+        MSGPACK_DEFINE_MAP(time_stamp, point_cloud, ring, time_offset, pose);
 
         LidarData()
         {}
 
         LidarData(const msr::airlib::LidarData& s)
         {
-            time_stamp = s.time_stamp;
-            point_cloud = s.point_cloud;
-
-            //TODO: remove bug workaround for https://github.com/rpclib/rpclib/issues/152
-            if (point_cloud.size() == 0)
-                point_cloud.push_back(0);
+            static_assert(sizeof(msr::airlib::real_T) == sizeof(float), "point cloud is sent as float32");
 
+            time_stamp = s.time_stamp;
+            pack(s.point_cloud, point_cloud);
+            pack(s.ring, ring);
+            pack(s.time_offset, time_offset);
             pose = s.pose;
         }
 
@@ -494,11 +583,202 @@ public:
             msr::airlib::LidarData d;
 
             d.time_stamp = time_stamp;
-            d.point_cloud = point_cloud;
+            unpack(point_cloud, d.point_cloud);
+            unpack(ring, d.ring);
+            unpack(time_offset, d.time_offset);
             d.pose = pose.to();
 
             return d;
         }
+
+        template<typename T>
+        static void pack(const std::vector<T>& values, std::vector<uint8_t>& packed)
+        {
+            packed.resize(values.size() * sizeof(T));
+            if (packed.size() > 0)
+                std::memcpy(packed.data(), values.data(), packed.size());
+            else //TODO: remove bug workaround for https://github.com/rpclib/rpclib/issues/152
+                packed.push_back(0);
+        }
+
+        template<typename T>
+        static void unpack(const std::vector<uint8_t>& packed, std::vector<T>& values)
+        {
+            //partial trailing element (including the 1 byte empty marker) is ignored
+            values.resize(packed.size() / sizeof(T));
+            if (values.size() > 0)
+                std::memcpy(values.data(), packed.data(), values.size() * sizeof(T));
+        }
+    };
+
+    struct ImuData {
+        Quaternionr orientation;
+        Vector3r angular_velocity;
+        Vector3r linear_acceleration;
+
+        MSGPACK_DEFINE_MAP(orientation, angular_velocity, linear_acceleration);
+
+        ImuData()
+        {}
+
+        ImuData(const msr::airlib::ImuBase::Output& s)
+        {
+            orientation = s.orientation;
+            angular_velocity = s.angular_velocity;
+            linear_acceleration = s.linear_acceleration;
+        }
+
+        msr::airlib::ImuBase::Output to() const
+        {
+            msr::airlib::ImuBase::Output d;
+            d.orientation = orientation.to();
+            d.angular_velocity = angular_velocity.to();
+            d.linear_acceleration = linear_acceleration.to();
+
+            return d;
+        }
+    };
+
+    struct GpsData {
+        GeoPoint geo_point;
+        msr::airlib::real_T eph = 0, epv = 0;
+        Vector3r velocity;
+        unsigned char fix_type = 0;
+        uint64_t time_utc = 0;
+        bool is_valid = false;
+
+        MSGPACK_DEFINE_MAP(geo_point, eph, epv, velocity, fix_type, time_utc, is_valid);
+
+        GpsData()
+        {}
+
+        GpsData(const msr::airlib::GpsBase::Output& s)
+        {
+            geo_point = s.gnss.geo_point;
+            eph = s.gnss.eph;
+            epv = s.gnss.epv;
+            velocity = s.gnss.velocity;
+            fix_type = static_cast<unsigned char>(s.gnss.fix_type);
+            time_utc = s.gnss.time_utc;
+            is_valid = s.is_valid;
+        }
+
+        msr::airlib::GpsBase::Output to() const
+        {
+            msr::airlib::GpsBase::Output d;
+            d.gnss.geo_point = geo_point.to();
+            d.gnss.eph = eph;
+            d.gnss.epv = epv;
+            d.gnss.velocity = velocity.to();
+            d.gnss.fix_type = static_cast<msr::airlib::GpsBase::GnssFixType>(fix_type);
+            d.gnss.time_utc = time_utc;
+            d.is_valid = is_valid;
+
+            return d;
+        }
+    };
+
+    struct TopicOptions {
+        float rate_hz = 100;
+        int overflow_policy = 0;
+        unsigned int queue_size = 64;
+        unsigned int max_batch = 32;
+        std::string vehicle_name;
+        std::string sensor_name;
+
+        MSGPACK_DEFINE_MAP(rate_hz, overflow_policy, queue_size, max_batch, vehicle_name, sensor_name);
+
+        TopicOptions()
+        {}
+
+        TopicOptions(const msr::airlib::TopicOptions& s)
+        {
+            rate_hz = s.rate_hz;
+            overflow_policy = static_cast<int>(s.overflow_policy);
+            queue_size = s.queue_size;
+            max_batch = s.max_batch;
+            vehicle_name = s.vehicle_name;
+            sensor_name = s.sensor_name;
+        }
+
+        msr::airlib::TopicOptions to() const
+        {
+            msr::airlib::TopicOptions d;
+            d.rate_hz = rate_hz;
+            d.overflow_policy = static_cast<common_utils::QueueOverflowPolicy>(overflow_policy);
+            d.queue_size = queue_size;
+            d.max_batch = max_batch;
+            d.vehicle_name = vehicle_name;
+            d.sensor_name = sensor_name;
+
+            return d;
+        }
+    };
+
+    //one timestamped sample of a topic, TData is adaptor type of the payload
+    template<typename TData>
+    struct TopicSample {
+        msr::airlib::TTimePoint time_stamp = 0;
+        TData data;
+
+        MSGPACK_DEFINE_MAP(time_stamp, data);
+
+        TopicSample()
+        {}
+
+        TopicSample(msr::airlib::TTimePoint time_stamp_val, const TData& data_val)
+            : time_stamp(time_stamp_val), data(data_val)
+        {}
+    };
+
+    struct TickPhaseStats {
+        std::string name;
+        uint64_t count = 0;
+        double mean = 0;
+        double p50 = 0;
+        double p90 = 0;
+        double p99 = 0;
+        double max = 0;
+
+        MSGPACK_DEFINE_MAP(name, count, mean, p50, p90, p99, max);
+
+        TickPhaseStats()
+        {}
+
+        TickPhaseStats(const msr::airlib::TickProfiler::PhaseStats& s)
+        {
+            name = s.name;
+            count = s.count;
+            mean = s.mean;
+            p50 = s.p50;
+            p90 = s.p90;
+            p99 = s.p99;
+            max = s.max;
+        }
+
+        msr::airlib::TickProfiler::PhaseStats to() const
+        {
+            msr::airlib::TickProfiler::PhaseStats d;
+            d.name = name;
+            d.count = count;
+            d.mean = mean;
+            d.p50 = p50;
+            d.p90 = p90;
+            d.p99 = p99;
+            d.max = max;
+
+            return d;
+        }
+
+        static std::vector<TickPhaseStats> from(
+            const std::vector<msr::airlib::TickProfiler::PhaseStats>& stats)
+        {
+            std::vector<TickPhaseStats> stats_adaptor;
+            for (const auto& item : stats)
+                stats_adaptor.push_back(TickPhaseStats(item));
+
+            return stats_adaptor;
+        }
     };
 };
 
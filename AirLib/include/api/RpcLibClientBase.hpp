@@ -10,6 +10,11 @@
 #include "physics/Kinematics.hpp"
 #include "physics/Environment.hpp"
 #include "api/WorldSimApiBase.hpp"
+#include "common/TickProfiler.hpp"
+#include "common/SharedImageRing.hpp"
+#include "api/TopicSubscription.hpp"
+#include "sensors/imu/ImuBase.hpp"
+#include "sensors/gps/GpsBase.hpp"
 
 namespace msr { namespace airlib {
 
@@ -36,6 +41,13 @@ public:
     bool simIsPaused() const;
     void simPause(bool is_paused);
     void simContinueForTime(double seconds);
+    void simStep(unsigned int steps = 1);
+
+    std::vector<TickProfiler::PhaseStats> simGetTickProfile() const;
+    void simResetTickProfile();
+    std::string simGetTickTrace() const;
+    //saves simGetTickTrace() to a file on the client machine
+    bool simDumpTickTrace(const std::string& file_path) const;
 
     void simSetTimeOfDay(bool is_enabled, const string& start_datetime = "", bool is_start_datetime_dst = false,
         float celestial_clock_speed = 1, float update_interval_secs = 60, bool move_sun = true);
@@ -65,9 +77,15 @@ public:
 
     Pose simGetVehiclePose(const std::string& vehicle_name = "") const;
     void simSetVehiclePose(const Pose& pose, bool ignore_collision, const std::string& vehicle_name = "");
+    //one round trip for all listed vehicles
+    vector<Pose> simGetVehiclePoseBatch(const vector<std::string>& vehicle_names) const;
 
     vector<ImageCaptureBase::ImageResponse> simGetImages(vector<ImageCaptureBase::ImageRequest> request, const std::string& vehicle_name = "");
     vector<uint8_t> simGetImage(const std::string& camera_name, ImageCaptureBase::ImageType type, const std::string& vehicle_name = "");
+    //pixels are not copied but accessed in shared memory written by simulator, only works on same machine
+    vector<SharedImageResponse> simGetImagesShared(vector<ImageCaptureBase::ImageRequest> request, const std::string& vehicle_name = "");
+    //false if simulator has reused the slot since response was returned, check after using the data
+    bool isSharedImageCurrent(const SharedImageResponse& response) const;
 
     CollisionInfo simGetCollisionInfo(const std::string& vehicle_name = "") const;
 
@@ -75,8 +93,23 @@ public:
     void simSetCameraOrientation(const std::string& camera_name, const Quaternionr& orientation, const std::string& vehicle_name = "");
 
     msr::airlib::Kinematics::State simGetGroundTruthKinematics(const std::string& vehicle_name = "") const;
+    vector<msr::airlib::Kinematics::State> simGetGroundTruthKinematicsBatch(const vector<std::string>& vehicle_names) const;
     msr::airlib::Environment::State simGetGroundTruthEnvironment(const std::string& vehicle_name = "") const;
 
+    //----------- streaming topic subscriptions ----------/
+    //Server pushes samples to callback server started by this client on first subscription.
+    //Returned id is passed to unsubscribe(); callback may still be invoked once after unsubscribe returns.
+    int subscribeKinematics(const TopicCallback<Kinematics::State>& callback, const TopicOptions& options = TopicOptions());
+    int subscribeImu(const TopicCallback<ImuBase::Output>& callback, const TopicOptions& options = TopicOptions());
+    int subscribeGps(const TopicCallback<GpsBase::Output>& callback, const TopicOptions& options = TopicOptions());
+    int subscribeLidar(const TopicCallback<LidarData>& callback, const TopicOptions& options = TopicOptions());
+    int subscribeImages(const vector<ImageCaptureBase::ImageRequest>& request, 
+        const TopicCallback<vector<ImageCaptureBase::ImageResponse>>& callback, const TopicOptions& options = TopicOptions());
+    bool unsubscribe(int subscription_id);
+    //address simulator uses to reach this client, needed when client is on another machine;
+    //port 0 picks first free port starting at 41551. Must be called before first subscription.
+    void setTopicCallbackEndpoint(const std::string& host, uint16_t port = 0);
+
     //----------- APIs to control ACharacter in scene ----------/
     void simCharSetFaceExpression(const std::string& expression_name, float value, const std::string& character_name = "");
     float simCharGetFaceExpression(const std::string& expression_name, const std::string& character_name = "") const;
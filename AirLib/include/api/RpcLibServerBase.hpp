@@ -49,6 +49,28 @@ protected:
             throw ApiNotSupported("Vehicle Sim-API for '" + vehicle_name +
                 "' is not available. This could either because this is not a simulation or this vehicle does not exist");
     }
+    //batch calls resolve all vehicles before doing anything so call either applies to
+    //every listed vehicle or fails as whole
+    virtual std::vector<VehicleApiBase*> getVehicleApis(const std::vector<std::string>& vehicle_names)
+    {
+        auto apis = api_provider_->findVehicleApis(vehicle_names);
+        for (size_t i = 0; i < apis.size(); ++i) {
+            if (!apis[i])
+                throw ApiNotSupported("Vehicle API for '" + vehicle_names[i] +
+                    "' is not available. This could either because this is simulation-only API or this vehicle does not exist");
+        }
+        return apis;
+    }
+    virtual std::vector<VehicleSimApiBase*> getVehicleSimApis(const std::vector<std::string>& vehicle_names)
+    {
+        auto apis = api_provider_->findVehicleSimApis(vehicle_names);
+        for (size_t i = 0; i < apis.size(); ++i) {
+            if (!apis[i])
+                throw ApiNotSupported("Vehicle Sim-API for '" + vehicle_names[i] +
+                    "' is not available. This could either because this is not a simulation or this vehicle does not exist");
+        }
+        return apis;
+    }
     virtual WorldSimApiBase* getWorldSimApi()
     {
         auto* api = api_provider_->getWorldSimApi();
@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef air_TopicSubscription_hpp
+#define air_TopicSubscription_hpp
+
+#include "common/Common.hpp"
+#include "common/common_utils/BoundedQueue.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace msr { namespace airlib {
+
+/*
+Topic subscriptions let client receive stream of samples pushed by server instead of polling
+with one RPC round trip per sample. Server samples the topic at requested rate, puts samples
+in a bounded queue and a separate sender thread delivers them to client in batches. If client
+can't keep up, queue_size and overflow_policy decide whether old samples are dropped or
+sampling is slowed down.
+*/
+struct TopicOptions {
+    //how often server takes a sample, in Hz
+    float rate_hz = 100;
+    //what server does when samples are produced faster than client consumes them
+    common_utils::QueueOverflowPolicy overflow_policy = common_utils::QueueOverflowPolicy::DropOldest;
+    //number of samples server buffers for this subscription
+    unsigned int queue_size = 64;
+    //max samples delivered in one callback
+    unsigned int max_batch = 32;
+    std::string vehicle_name = "";
+    //sensor name for IMU, GPS and lidar topics, empty picks first sensor of that type
+    std::string sensor_name = "";
+
+    TopicOptions()
+    {}
+
+    TopicOptions(float rate_hz_val, const std::string& vehicle_name_val = "", const std::string& sensor_name_val = "")
+        : rate_hz(rate_hz_val), vehicle_name(vehicle_name_val), sensor_name(sensor_name_val)
+    {}
+};
+
+template <typename T>
+struct TopicSample {
+    //sim clock time when server took the sample
+    TTimePoint time_stamp = 0;
+    T data;
+};
+
+//callbacks are invoked on client's callback server thread
+template <typename T>
+using TopicCallback = std::function<void(const std::vector<TopicSample<T>>&)>;
+
+/*
+Client side queue for applications that prefer to pull samples from their own thread instead
+of handling them in callback. Pass callback() when subscribing; the queue must outlive the
+subscription. With Block policy a full queue stalls delivery which in turn makes server apply
+its own overflow policy for the subscription.
+*/
+template <typename T>
+class TopicQueue {
+public:
+    TopicQueue(size_t capacity = 256, common_utils::QueueOverflowPolicy policy = common_utils::QueueOverflowPolicy::DropOldest)
+        : queue_(capacity, policy)
+    {}
+
+    TopicCallback<T> callback()
+    {
+        return [this](const std::vector<TopicSample<T>>& samples) {
+            for (const auto& sample : samples)
+                queue_.push(sample);
+        };
+    }
+
+    bool pop(TopicSample<T>& sample)
+    {
+        return queue_.pop(sample);
+    }
+
+    bool pop(TopicSample<T>& sample, float timeout_sec)
+    {
+        return queue_.pop(sample, std::chrono::duration<float>(timeout_sec));
+    }
+
+    bool tryPop(TopicSample<T>& sample)
+    {
+        return queue_.tryPop(sample);
+    }
+
+    size_t size() const
+    {
+        return queue_.size();
+    }
+
+    uint64_t getDroppedCount() const
+    {
+        return queue_.getDroppedCount();
+    }
+
+    //wakes up any thread blocked in pop()
+    void close()
+    {
+        queue_.close();
+    }
+
+private:
+    common_utils::BoundedQueue<TopicSample<T>> queue_;
+};
+
+}} //namespace
+#endif
@@ -13,6 +13,8 @@
 #include "common/ImageCaptureBase.hpp"
 #include "sensors/SensorCollection.hpp"
 #include "sensors/lidar/LidarBase.hpp"
+#include "sensors/imu/ImuBase.hpp"
+#include "sensors/gps/GpsBase.hpp"
 #include <exception>
 #include <string>
 
@@ -103,7 +105,8 @@ public:
     }
 
     // Lidar APIs
-    virtual LidarData getLidarData(const std::string& lidar_name) const
+    //shares lidar's published scan so the point cloud isn't copied
+    virtual std::shared_ptr<const LidarData> getLidarData(const std::string& lidar_name) const
     {
         const LidarBase* lidar = nullptr;
 
@@ -125,6 +128,49 @@ public:
         return lidar->getOutput();
     }
 
+    // IMU and GPS APIs, mainly used by topic subscriptions
+    virtual ImuBase::Output getImuData(const std::string& imu_name) const
+    {
+        const ImuBase* imu = nullptr;
+
+        // Find IMU with the given name (for empty input name, return the first one found)
+        uint count_imus = getSensors().size(SensorBase::SensorType::Imu);
+        for (uint i = 0; i < count_imus; i++)
+        {
+            const ImuBase* current_imu = static_cast<const ImuBase*>(getSensors().getByType(SensorBase::SensorType::Imu, i));
+            if (current_imu != nullptr && (current_imu->getName() == imu_name || imu_name == ""))
+            {
+                imu = current_imu;
+                break;
+            }
+        }
+        if (imu == nullptr)
+            throw VehicleControllerException(Utils::stringf("No IMU with name %s exist on vehicle", imu_name.c_str()));
+
+        return imu->getOutput();
+    }
+
+    virtual GpsBase::Output getGpsData(const std::string& gps_name) const
+    {
+        const GpsBase* gps = nullptr;
+
+        // Find GPS with the given name (for empty input name, return the first one found)
+        uint count_gps = getSensors().size(SensorBase::SensorType::Gps);
+        for (uint i = 0; i < count_gps; i++)
+        {
+            const GpsBase* current_gps = static_cast<const GpsBase*>(getSensors().getByType(SensorBase::SensorType::Gps, i));
+            if (current_gps != nullptr && (current_gps->getName() == gps_name || gps_name == ""))
+            {
+                gps = current_gps;
+                break;
+            }
+        }
+        if (gps == nullptr)
+            throw VehicleControllerException(Utils::stringf("No GPS with name %s exist on vehicle", gps_name.c_str()));
+
+        return gps->getOutput();
+    }
+
     virtual ~VehicleApiBase() = default;
 
     //exceptions
@@ -23,12 +23,17 @@ public:
         Enabled = 8
     };
 
+    //step() holds the RPC thread (and the world) until it is done, so one simStep call may ask for
+    //at most this many steps; clients split bigger requests in to several calls
+    static constexpr unsigned int kMaxStepsPerCall = 1000;
+
     virtual ~WorldSimApiBase() = default;
 
     virtual bool isPaused() const = 0;
     virtual void reset() = 0;
     virtual void pause(bool is_paused) = 0;
     virtual void continueForTime(double seconds) = 0;
+    virtual void step(unsigned int steps) = 0;
 
     virtual void setTimeOfDay(bool is_enabled, const std::string& start_datetime, bool is_start_datetime_dst,
         float celestial_clock_speed, float update_interval_secs, bool move_sun) = 0;
@@ -218,6 +218,10 @@ public: //types
 
         bool draw_debug_points = false;
         std::string data_frame = AirSimSettings::kVehicleInertialFrame;
+
+        //optional per point channels in LidarData
+        bool include_ring = false;
+        bool include_time_offset = false;
     };
 
     struct VehicleSetting {
@@ -257,6 +261,22 @@ public: //types
         std::string ip_address = "127.0.0.1";
         int ip_port = 14560;
 
+        //Used instead of UDP when the SITL build runs on the same machine and can talk over shared memory,
+        //the simulator creates the named segment and SITL opens it. Needed only if use_serial = false
+        bool use_shared_memory = false;
+        std::string shared_memory_name = "airsim_hil";
+
+        //In lock-step mode every physics update waits until the firmware has answered the sensor messages it just
+        //sent (HIL_ACTUATOR_CONTROLS carrying the same time_usec) instead of using whatever controls arrived last.
+        //Sensor timestamps then come from the simulation clock so the firmware can run faster than real time.
+        //The wait gives up after lock_step_timeout_ms and the update goes on with the last controls.
+        bool lock_step = false;
+        int lock_step_timeout_ms = 100;
+
+        //Send the HIL messages of a physics update with one batched write instead of one write each.
+        //Off by default: on loopback it saves syscalls but did not reliably improve throughput or tail latency.
+        bool batch_hil_sends = false;
+
         // The PX4 SITL app requires receiving drone commands over a different mavlink channel.
         // So set this to empty string to disable this separate command channel.
         std::string sitl_ip_address = "127.0.0.1";
@@ -650,6 +670,11 @@ private:
         connection_info.use_serial = settings_json.getBool("UseSerial", connection_info.use_serial);
         connection_info.ip_address = settings_json.getString("UdpIp", connection_info.ip_address);
         connection_info.ip_port = settings_json.getInt("UdpPort", connection_info.ip_port);
+        connection_info.use_shared_memory = settings_json.getBool("UseSharedMemory", connection_info.use_shared_memory);
+        connection_info.shared_memory_name = settings_json.getString("SharedMemoryName", connection_info.shared_memory_name);
+        connection_info.lock_step = settings_json.getBool("LockStep", connection_info.lock_step);
+        connection_info.lock_step_timeout_ms = settings_json.getInt("LockStepTimeoutMs", connection_info.lock_step_timeout_ms);
+        connection_info.batch_hil_sends = settings_json.getBool("BatchHilSends", connection_info.batch_hil_sends);
         connection_info.serial_port = settings_json.getString("SerialPort", connection_info.serial_port);
         connection_info.baud_rate = settings_json.getInt("SerialBaudRate", connection_info.baud_rate);
         connection_info.model = settings_json.getString("Model", connection_info.model);
@@ -1074,12 +1099,13 @@ private:
                 //TODO: this won't work if simple_flight and PX4 is combined together!
 
                 //for multirotors we select steppable fixed interval clock unless we have
-                //PX4 enabled vehicle
+                //PX4 enabled vehicle that is not running in lock-step with us
                 clock_type = "SteppableClock";
                 for (auto const& vehicle : vehicles)
                 {
                     if (vehicle.second->auto_create && 
-                        vehicle.second->vehicle_type == kVehicleTypePX4) {
+                        vehicle.second->vehicle_type == kVehicleTypePX4 &&
+                        !static_cast<const MavLinkVehicleSetting*>(vehicle.second.get())->connection_info.lock_step) {
                         clock_type = "ScalableClock";
                         break;
                     }
@@ -1138,6 +1164,8 @@ private:
         lidar_setting.horizontal_rotation_frequency = settings_json.getInt("RotationsPerSecond", lidar_setting.horizontal_rotation_frequency);
         lidar_setting.draw_debug_points = settings_json.getBool("DrawDebugPoints", lidar_setting.draw_debug_points);
         lidar_setting.data_frame = settings_json.getString("DataFrame", lidar_setting.data_frame);
+        lidar_setting.include_ring = settings_json.getBool("IncludeRing", lidar_setting.include_ring);
+        lidar_setting.include_time_offset = settings_json.getBool("IncludeTimeOffset", lidar_setting.include_time_offset);
 
         lidar_setting.vertical_FOV_upper = settings_json.getFloat("VerticalFOVUpper", lidar_setting.vertical_FOV_upper);
         lidar_setting.vertical_FOV_lower = settings_json.getFloat("VerticalFOVLower", lidar_setting.vertical_FOV_lower);
@@ -301,6 +301,10 @@ struct LidarData {
     vector<real_T> point_cloud;
     Pose pose;
 
+    //optional per point channels, each is either empty or has one entry per point in point_cloud
+    vector<uint16_t> ring;          //index of laser/channel that produced the point
+    vector<float> time_offset;      //seconds relative to time_stamp when point was measured (<= 0)
+
     LidarData()
     {}
 };
@@ -0,0 +1,303 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef air_SharedImageRing_hpp
+#define air_SharedImageRing_hpp
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <string>
+#include "common/ImageCaptureBase.hpp"
+
+#if defined(__linux__) || defined(__APPLE__)
+#define AIRLIB_SHARED_IMAGE_RING_POSIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace msr { namespace airlib {
+
+/*
+SharedImageRing is a fixed number of fixed size slots in named shared memory used to pass
+image payloads from simulator to clients on the same machine without serializing them.
+
+Server creates the ring and writes each image in to next slot, the RPC call then returns only
+Descriptor for the slot. Client opens same ring read-only and accesses payload in place. Each
+slot carries sequence number of the image it holds; writer zeroes it while slot is being
+overwritten so client can call isCurrent() after it is done with the data to detect if ring
+wrapped around in the meantime. With N slots client must consume images before N more are written.
+
+Every create() picks new instance id which is stored in header and in each Descriptor. Sequence
+numbers restart when simulator restarts, so getData() and isCurrent() also compare instance ids;
+client should reopen ring when descriptors stop matching getInstanceId() of its mapping.
+
+Currently implemented with POSIX shared memory; create() and open() return false on other platforms.
+*/
+class SharedImageRing {
+public:
+    static constexpr uint32_t kDefaultSlotCount = 8;
+    static constexpr uint64_t kDefaultSlotSize = 16 * 1024 * 1024;
+
+    struct Descriptor {
+        uint32_t slot = 0;
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        uint64_t sequence = 0;
+        uint64_t instance_id = 0;
+    };
+
+public:
+    SharedImageRing()
+    {}
+    ~SharedImageRing()
+    {
+        close();
+    }
+
+    SharedImageRing(const SharedImageRing&) = delete;
+    SharedImageRing& operator=(const SharedImageRing&) = delete;
+
+    //creates or takes over ring with given name (like "/airsim_images_41451") for writing
+    bool create(const std::string& name, uint32_t slot_count = kDefaultSlotCount, uint64_t slot_size = kDefaultSlotSize)
+    {
+        close();
+
+#ifdef AIRLIB_SHARED_IMAGE_RING_POSIX
+        if (slot_count == 0 || slot_size == 0)
+            return false;
+
+        const uint64_t data_offset = alignUp(sizeof(Header) + slot_count * sizeof(std::atomic<uint64_t>), kPageSize);
+        const uint64_t total_size = data_offset + slot_count * alignUp(slot_size, kPageSize);
+
+        int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+        if (fd < 0)
+            return false;
+        if (ftruncate(fd, static_cast<off_t>(total_size)) != 0) {
+            ::close(fd);
+            shm_unlink(name.c_str());
+            return false;
+        }
+        void* base = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            shm_unlink(name.c_str());
+            return false;
+        }
+
+        base_ = static_cast<uint8_t*>(base);
+        mapped_size_ = total_size;
+        name_ = name;
+        is_owner_ = true;
+
+        header_ = reinterpret_cast<Header*>(base_);
+        //if we took over ring of crashed server, readers still mapping it stop accepting its slots now
+        header_->instance_id.store(0, std::memory_order_relaxed);
+        header_->magic = 0;
+        header_->version = kVersion;
+        header_->slot_count = slot_count;
+        header_->slot_size = alignUp(slot_size, kPageSize);
+        header_->data_offset = data_offset;
+        for (uint32_t slot = 0; slot < slot_count; ++slot)
+            slotSequence(slot).store(0, std::memory_order_relaxed);
+        next_sequence_ = 1;
+        //magic is written last so clients never see partially initialized header
+        std::atomic_thread_fence(std::memory_order_release);
+        header_->instance_id.store(newInstanceId(), std::memory_order_relaxed);
+        header_->magic = kMagic;
+
+        return true;
+#else
+        unused(name);
+        unused(slot_count);
+        unused(slot_size);
+        return false;
+#endif
+    }
+
+    //maps ring created by another process for reading
+    bool open(const std::string& name)
+    {
+        close();
+
+#ifdef AIRLIB_SHARED_IMAGE_RING_POSIX
+        int fd = shm_open(name.c_str(), O_RDONLY, 0);
+        if (fd < 0)
+            return false;
+        struct stat file_stat;
+        if (fstat(fd, &file_stat) != 0 || static_cast<uint64_t>(file_stat.st_size) < sizeof(Header)) {
+            ::close(fd);
+            return false;
+        }
+        const uint64_t total_size = static_cast<uint64_t>(file_stat.st_size);
+        void* base = mmap(nullptr, total_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED)
+            return false;
+
+        base_ = static_cast<uint8_t*>(base);
+        mapped_size_ = total_size;
+        name_ = name;
+        is_owner_ = false;
+        header_ = reinterpret_cast<Header*>(base_);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (header_->magic != kMagic || header_->version != kVersion ||
+            header_->data_offset + header_->slot_count * header_->slot_size > total_size) {
+            close();
+            return false;
+        }
+
+        return true;
+#else
+        unused(name);
+        return false;
+#endif
+    }
+
+    void close()
+    {
+#ifdef AIRLIB_SHARED_IMAGE_RING_POSIX
+        if (base_ != nullptr) {
+            munmap(base_, mapped_size_);
+            if (is_owner_)
+                shm_unlink(name_.c_str());
+        }
+#endif
+        base_ = nullptr;
+        header_ = nullptr;
+        mapped_size_ = 0;
+        is_owner_ = false;
+        name_ = "";
+    }
+
+    bool isOpen() const
+    {
+        return header_ != nullptr;
+    }
+    const std::string& getName() const
+    {
+        return name_;
+    }
+    uint32_t getSlotCount() const
+    {
+        return header_ ? header_->slot_count : 0;
+    }
+    uint64_t getSlotSize() const
+    {
+        return header_ ? header_->slot_size : 0;
+    }
+    //changes every time ring is created, 0 if not open
+    uint64_t getInstanceId() const
+    {
+        return header_ ? header_->instance_id.load(std::memory_order_acquire) : 0;
+    }
+
+    //copies payload in to next slot; returns false if ring is not writable or payload doesn't fit
+    bool write(const void* data, uint64_t size, Descriptor& descriptor)
+    {
+        if (!isOpen() || !is_owner_ || size > header_->slot_size)
+            return false;
+
+        std::lock_guard<std::mutex> locker(write_mutex_);
+
+        const uint64_t sequence = next_sequence_++;
+        const uint32_t slot = static_cast<uint32_t>(sequence % header_->slot_count);
+        const uint64_t offset = header_->data_offset + slot * header_->slot_size;
+
+        std::atomic<uint64_t>& slot_sequence = slotSequence(slot);
+        slot_sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        if (size > 0)
+            std::memcpy(base_ + offset, data, static_cast<size_t>(size));
+        slot_sequence.store(sequence, std::memory_order_release);
+
+        descriptor.slot = slot;
+        descriptor.offset = offset;
+        descriptor.size = size;
+        descriptor.sequence = sequence;
+        descriptor.instance_id = header_->instance_id.load(std::memory_order_relaxed);
+        return true;
+    }
+
+    //pointer to payload inside mapping or nullptr if descriptor doesn't belong to this ring
+    const uint8_t* getData(const Descriptor& descriptor) const
+    {
+        if (!isOpen() || descriptor.instance_id != getInstanceId() ||
+            descriptor.slot >= header_->slot_count || descriptor.size > header_->slot_size ||
+            descriptor.offset != header_->data_offset + descriptor.slot * header_->slot_size)
+            return nullptr;
+
+        return base_ + descriptor.offset;
+    }
+
+    //true if slot still holds the image this descriptor was issued for
+    bool isCurrent(const Descriptor& descriptor) const
+    {
+        if (!isOpen() || descriptor.slot >= header_->slot_count)
+            return false;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slotSequence(descriptor.slot).load(std::memory_order_relaxed) == descriptor.sequence &&
+            descriptor.instance_id == getInstanceId();
+    }
+
+private:
+    static constexpr uint32_t kMagic = 0x474d4941; //"AIMG"
+    static constexpr uint32_t kVersion = 2;
+    static constexpr uint64_t kPageSize = 4096;
+
+    struct Header {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t slot_count;
+        uint32_t reserved;
+        uint64_t slot_size;
+        uint64_t data_offset;
+        std::atomic<uint64_t> instance_id;
+        //followed by slot_count atomic sequence numbers
+    };
+
+    static uint64_t newInstanceId()
+    {
+        std::random_device random;
+        uint64_t id = (static_cast<uint64_t>(random()) << 32) ^ random() ^
+            static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        return id != 0 ? id : 1;
+    }
+
+    static uint64_t alignUp(uint64_t value, uint64_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    std::atomic<uint64_t>& slotSequence(uint32_t slot) const
+    {
+        return reinterpret_cast<std::atomic<uint64_t>*>(base_ + sizeof(Header))[slot];
+    }
+
+private:
+    uint8_t* base_ = nullptr;
+    Header* header_ = nullptr;
+    uint64_t mapped_size_ = 0;
+    std::string name_;
+    bool is_owner_ = false;
+    uint64_t next_sequence_ = 1;
+    std::mutex write_mutex_;
+};
+
+//image metadata plus location of its pixels in SharedImageRing, pixel vectors in response are left empty
+struct SharedImageResponse {
+    ImageCaptureBase::ImageResponse response;
+    SharedImageRing::Descriptor descriptor;
+    //points in to client's mapping of the ring, valid while ring.isCurrent(descriptor)
+    const uint8_t* data = nullptr;
+};
+
+}} //namespace
+#endif
@@ -0,0 +1,360 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef airsim_core_TickProfiler_hpp
+#define airsim_core_TickProfiler_hpp
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+
+namespace msr { namespace airlib {
+
+/*
+TickProfiler records wall-clock duration of named phases of the simulation tick so we can see
+which part of the loop (physics, sensors, firmware of a given vehicle etc) is using the tick budget.
+
+Instrumented code uses AIRLIB_PROFILE_SCOPE("name") or, for names only known at runtime,
+registers phase once with registerPhase() and then uses AIRLIB_PROFILE_SCOPE_ID(phase_id).
+Each thread writes events in to its own fixed size ring buffer so recording doesn't take
+any locks; old events are overwritten when buffer is full. Aggregation and trace dumps
+read all buffers from another thread and are meant for occasional use. Buffers of exited
+threads are kept for their events but only the most recent kMaxRetiredBuffers of them.
+
+Define AIRLIB_NO_TICK_PROFILER to compile out all instrumentation.
+*/
+class TickProfiler {
+public:
+    typedef uint32_t PhaseId;
+    static constexpr size_t kMaxRetiredBuffers = 16;
+
+    struct PhaseStats {
+        std::string name;
+        uint64_t count = 0;
+        //all durations in milliseconds
+        double mean = 0;
+        double p50 = 0;
+        double p90 = 0;
+        double p99 = 0;
+        double max = 0;
+    };
+
+    class Scope {
+    public:
+        Scope(PhaseId phase)
+            : phase_(phase), start_(TickProfiler::nanos())
+        {}
+        ~Scope()
+        {
+            TickProfiler::singleton().record(phase_, start_, TickProfiler::nanos());
+        }
+
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+    private:
+        PhaseId phase_;
+        uint64_t start_;
+    };
+
+public:
+    static TickProfiler& singleton()
+    {
+        static TickProfiler instance;
+        return instance;
+    }
+
+    static uint64_t nanos()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    //returns same id if phase with this name already exists
+    PhaseId registerPhase(const std::string& name)
+    {
+        std::lock_guard<std::mutex> locker(mutex_);
+
+        auto it = phase_ids_.find(name);
+        if (it != phase_ids_.end())
+            return it->second;
+
+        PhaseId id = static_cast<PhaseId>(phase_names_.size());
+        phase_names_.push_back(name);
+        phase_ids_[name] = id;
+        return id;
+    }
+
+    void record(PhaseId phase, uint64_t start_nanos, uint64_t end_nanos)
+    {
+        getThreadBuffer().push(Event{ phase, start_nanos, end_nanos });
+    }
+
+    //events recorded before this call are ignored by getPhaseStats and writeChromeTrace
+    void clear()
+    {
+        since_nanos_ = nanos();
+    }
+
+    std::vector<PhaseStats> getPhaseStats() const
+    {
+        std::vector<std::vector<uint64_t>> durations;
+        std::vector<Event> events;
+        collectEvents(events);
+
+        for (const Event& event : events) {
+            if (event.phase >= durations.size())
+                durations.resize(event.phase + 1);
+            durations[event.phase].push_back(event.end - event.start);
+        }
+
+        std::vector<PhaseStats> stats;
+        std::vector<std::string> names = getPhaseNames();
+        for (PhaseId phase = 0; phase < durations.size(); ++phase) {
+            std::vector<uint64_t>& phase_durations = durations[phase];
+            if (phase_durations.size() == 0)
+                continue;
+
+            std::sort(phase_durations.begin(), phase_durations.end());
+            double sum = 0;
+            for (uint64_t duration : phase_durations)
+                sum += duration;
+
+            PhaseStats phase_stats;
+            phase_stats.name = phase < names.size() ? names[phase] : "";
+            phase_stats.count = phase_durations.size();
+            phase_stats.mean = sum / phase_durations.size() / 1.0E6;
+            phase_stats.p50 = percentile(phase_durations, 50) / 1.0E6;
+            phase_stats.p90 = percentile(phase_durations, 90) / 1.0E6;
+            phase_stats.p99 = percentile(phase_durations, 99) / 1.0E6;
+            phase_stats.max = phase_durations.back() / 1.0E6;
+            stats.push_back(phase_stats);
+        }
+
+        return stats;
+    }
+
+    //events currently in buffers in Chrome trace event format which can be
+    //opened in chrome://tracing or Perfetto UI
+    std::string getChromeTrace() const
+    {
+        std::ostringstream trace;
+        std::vector<Event> events;
+        std::vector<unsigned int> thread_ids;
+        collectEvents(events, &thread_ids);
+        std::vector<std::string> names = getPhaseNames();
+
+        trace << "{\"traceEvents\":[";
+        for (size_t i = 0; i < events.size(); ++i) {
+            const Event& event = events[i];
+            if (i > 0)
+                trace << ",";
+            trace << "\n{\"name\":\"" << jsonEscape(event.phase < names.size() ? names[event.phase] : "")
+                << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << thread_ids[i]
+                << ",\"ts\":" << (event.start / 1000) << "." << (event.start % 1000) / 100
+                << ",\"dur\":" << ((event.end - event.start) / 1000) << "." << ((event.end - event.start) % 1000) / 100
+                << "}";
+        }
+        trace << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+        return trace.str();
+    }
+
+    bool writeChromeTrace(const std::string& file_path) const
+    {
+        std::ofstream file(file_path);
+        if (!file.is_open())
+            return false;
+        file << getChromeTrace();
+        return file.good();
+    }
+
+private:
+    struct Event {
+        PhaseId phase;
+        uint64_t start;
+        uint64_t end;
+    };
+
+    /*
+    Single producer ring, only owning thread writes. Every slot is a small seqlock: sequence is
+    odd while writer fills the slot and 2 * (event index + 1) once event is complete, readers
+    keep an event only if sequence was the same before and after copying it. Slot fields are
+    atomics (relaxed) so concurrent copy is not a data race, torn copies are just dropped.
+    */
+    class ThreadBuffer {
+    public:
+        static constexpr uint64_t kCapacity = 1 << 13;
+
+        ThreadBuffer(unsigned int thread_index)
+            : thread_index_(thread_index), slots_(new Slot[kCapacity])
+        {}
+
+        void push(const Event& event)
+        {
+            uint64_t head = head_.load(std::memory_order_relaxed);
+            Slot& slot = slots_[head & (kCapacity - 1)];
+            slot.sequence.store(2 * head + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.phase.store(event.phase, std::memory_order_relaxed);
+            slot.start.store(event.start, std::memory_order_relaxed);
+            slot.end.store(event.end, std::memory_order_relaxed);
+            slot.sequence.store(2 * head + 2, std::memory_order_release);
+            head_.store(head + 1, std::memory_order_release);
+        }
+
+        void copyTo(std::vector<Event>& events, uint64_t since_nanos) const
+        {
+            uint64_t head = head_.load(std::memory_order_acquire);
+            uint64_t tail = head > kCapacity ? head - kCapacity : 0;
+            for (uint64_t i = tail; i < head; ++i) {
+                const Slot& slot = slots_[i & (kCapacity - 1)];
+                //writer may have lapped us and be filling this slot with a newer event
+                uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+                if (sequence != 2 * i + 2)
+                    continue;
+                Event event{ slot.phase.load(std::memory_order_relaxed), slot.start.load(std::memory_order_relaxed),
+                    slot.end.load(std::memory_order_relaxed) };
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence.load(std::memory_order_relaxed) != sequence)
+                    continue;
+
+                if (event.start >= since_nanos)
+                    events.push_back(event);
+            }
+        }
+
+        unsigned int getThreadIndex() const
+        {
+            return thread_index_;
+        }
+
+    private:
+        struct Slot {
+            std::atomic<uint64_t> sequence { 0 };
+            std::atomic<PhaseId> phase { 0 };
+            std::atomic<uint64_t> start { 0 };
+            std::atomic<uint64_t> end { 0 };
+        };
+
+        unsigned int thread_index_;
+        std::unique_ptr<Slot[]> slots_;
+        std::atomic<uint64_t> head_ { 0 };
+    };
+
+    //owned by thread_local, hands buffer back to registry when its thread exits
+    struct ThreadBufferOwner {
+        TickProfiler* profiler = nullptr;
+        std::shared_ptr<ThreadBuffer> buffer;
+
+        ~ThreadBufferOwner()
+        {
+            if (profiler)
+                profiler->retireBuffer(buffer);
+        }
+    };
+
+private:
+    ThreadBuffer& getThreadBuffer()
+    {
+        //buffer is shared with registry so events survive thread exit
+        thread_local ThreadBufferOwner owner;
+        if (!owner.buffer) {
+            std::lock_guard<std::mutex> locker(mutex_);
+            owner.buffer = std::make_shared<ThreadBuffer>(next_thread_index_++);
+            owner.profiler = this;
+            buffers_.push_back(owner.buffer);
+        }
+        return *owner.buffer;
+    }
+
+    //keeps events of exited thread around, dropping buffer of oldest exited thread when there are too many
+    void retireBuffer(const std::shared_ptr<ThreadBuffer>& buffer)
+    {
+        std::lock_guard<std::mutex> locker(mutex_);
+        retired_buffers_.push_back(buffer);
+        if (retired_buffers_.size() > kMaxRetiredBuffers) {
+            const ThreadBuffer* oldest = retired_buffers_.front().get();
+            retired_buffers_.erase(retired_buffers_.begin());
+            buffers_.erase(std::remove_if(buffers_.begin(), buffers_.end(),
+                [oldest](const std::shared_ptr<ThreadBuffer>& item) { return item.get() == oldest; }), buffers_.end());
+        }
+    }
+
+    void collectEvents(std::vector<Event>& events, std::vector<unsigned int>* thread_ids = nullptr) const
+    {
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+        {
+            std::lock_guard<std::mutex> locker(mutex_);
+            buffers = buffers_;
+        }
+
+        uint64_t since_nanos = since_nanos_;
+        for (const auto& buffer : buffers) {
+            buffer->copyTo(events, since_nanos);
+            if (thread_ids)
+                thread_ids->resize(events.size(), buffer->getThreadIndex());
+        }
+    }
+
+    std::vector<std::string> getPhaseNames() const
+    {
+        std::lock_guard<std::mutex> locker(mutex_);
+        return phase_names_;
+    }
+
+    static uint64_t percentile(const std::vector<uint64_t>& sorted, unsigned int pct)
+    {
+        //nearest rank
+        size_t rank = (sorted.size() * pct + 99) / 100;
+        return sorted[rank > 0 ? rank - 1 : 0];
+    }
+
+    static std::string jsonEscape(const std::string& s)
+    {
+        std::string escaped;
+        for (char c : s) {
+            if (c == '"' || c == '\\')
+                escaped += '\\';
+            if (static_cast<unsigned char>(c) >= 0x20)
+                escaped += c;
+        }
+        return escaped;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<std::string> phase_names_;
+    std::unordered_map<std::string, PhaseId> phase_ids_;
+    std::vector<std::shared_ptr<ThreadBuffer>> buffers_;
+    std::vector<std::shared_ptr<ThreadBuffer>> retired_buffers_;
+    unsigned int next_thread_index_ = 0;
+    std::atomic<uint64_t> since_nanos_ { 0 };
+};
+
+}} //namespace
+
+#define AIRLIB_PROFILE_CONCAT_INNER(a, b) a##b
+#define AIRLIB_PROFILE_CONCAT(a, b) AIRLIB_PROFILE_CONCAT_INNER(a, b)
+
+#ifndef AIRLIB_NO_TICK_PROFILER
+#define AIRLIB_PROFILE_SCOPE(phase_name) \
+    static const msr::airlib::TickProfiler::PhaseId AIRLIB_PROFILE_CONCAT(airlib_profile_phase_, __LINE__) = \
+        msr::airlib::TickProfiler::singleton().registerPhase(phase_name); \
+    msr::airlib::TickProfiler::Scope AIRLIB_PROFILE_CONCAT(airlib_profile_scope_, __LINE__)(AIRLIB_PROFILE_CONCAT(airlib_profile_phase_, __LINE__))
+#define AIRLIB_PROFILE_SCOPE_ID(phase_id) \
+    msr::airlib::TickProfiler::Scope AIRLIB_PROFILE_CONCAT(airlib_profile_scope_, __LINE__)(phase_id)
+#else
+#define AIRLIB_PROFILE_SCOPE(phase_name)
+#define AIRLIB_PROFILE_SCOPE_ID(phase_id)
+#endif
+
+#endif
@@ -0,0 +1,167 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef commn_utils_BoundedQueue_hpp
+#define commn_utils_BoundedQueue_hpp
+
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+
+namespace common_utils {
+
+//what push() does when queue is full
+enum class QueueOverflowPolicy : int {
+    DropOldest = 0, //discard oldest item and never block producer
+    Block = 1       //wait until consumer makes room
+};
+
+/*
+    Fixed capacity multi-producer multi-consumer queue for streaming data between threads
+    where consumer may be slower than producer. Unlike ProsumerQueue, memory use is bounded
+    and overflow is handled according to QueueOverflowPolicy. After close(), push() fails and
+    pop calls return remaining items and then fail so threads blocked on queue can exit.
+*/
+template <typename T>
+class BoundedQueue
+{
+public:
+    BoundedQueue(size_t capacity, QueueOverflowPolicy policy = QueueOverflowPolicy::DropOldest)
+        : capacity_(capacity > 0 ? capacity : 1), policy_(policy)
+    {
+    }
+
+    //returns false if queue was closed
+    bool push(T item)
+    {
+        std::unique_lock<std::mutex> global_lock(mutex_);
+
+        if (policy_ == QueueOverflowPolicy::Block) {
+            while (!is_closed_ && queue_.size() >= capacity_)
+                not_full_cond_.wait(global_lock);
+        }
+        if (is_closed_)
+            return false;
+
+        if (queue_.size() >= capacity_) {
+            queue_.pop_front();
+            ++dropped_count_;
+        }
+        queue_.push_back(std::move(item));
+
+        global_lock.unlock();
+        not_empty_cond_.notify_one();
+        return true;
+    }
+
+    //waits until item is available, returns false if queue is closed and empty
+    bool pop(T& item)
+    {
+        std::unique_lock<std::mutex> global_lock(mutex_);
+        while (queue_.empty() && !is_closed_)
+            not_empty_cond_.wait(global_lock);
+
+        return popLocked(item, global_lock);
+    }
+
+    //same as pop() but gives up after timeout
+    template <typename TRep, typename TPeriod>
+    bool pop(T& item, const std::chrono::duration<TRep, TPeriod>& timeout)
+    {
+        std::unique_lock<std::mutex> global_lock(mutex_);
+        not_empty_cond_.wait_for(global_lock, timeout, [this]() { return !queue_.empty() || is_closed_; });
+
+        return popLocked(item, global_lock);
+    }
+
+    bool tryPop(T& item)
+    {
+        std::unique_lock<std::mutex> global_lock(mutex_);
+        return popLocked(item, global_lock);
+    }
+
+    //waits until at least one item is available and then moves up to max_items in to batch,
+    //returns false if queue is closed and empty
+    bool popBatch(std::vector<T>& batch, size_t max_items)
+    {
+        batch.clear();
+
+        std::unique_lock<std::mutex> global_lock(mutex_);
+        while (queue_.empty() && !is_closed_)
+            not_empty_cond_.wait(global_lock);
+
+        while (!queue_.empty() && batch.size() < max_items) {
+            batch.push_back(std::move(queue_.front()));
+            queue_.pop_front();
+        }
+
+        global_lock.unlock();
+        not_full_cond_.notify_all();
+        return batch.size() > 0;
+    }
+
+    void close()
+    {
+        {
+            std::lock_guard<std::mutex> global_lock(mutex_);
+            is_closed_ = true;
+        }
+        not_empty_cond_.notify_all();
+        not_full_cond_.notify_all();
+    }
+
+    bool isClosed() const
+    {
+        std::lock_guard<std::mutex> global_lock(mutex_);
+        return is_closed_;
+    }
+
+    size_t size() const
+    {
+        std::lock_guard<std::mutex> global_lock(mutex_);
+        return queue_.size();
+    }
+
+    size_t capacity() const
+    {
+        return capacity_;
+    }
+
+    //number of items discarded by DropOldest policy
+    uint64_t getDroppedCount() const
+    {
+        std::lock_guard<std::mutex> global_lock(mutex_);
+        return dropped_count_;
+    }
+
+private:
+    bool popLocked(T& item, std::unique_lock<std::mutex>& global_lock)
+    {
+        if (queue_.empty())
+            return false;
+
+        item = std::move(queue_.front());
+        queue_.pop_front();
+
+        global_lock.unlock();
+        not_full_cond_.notify_one();
+        return true;
+    }
+
+private:
+    std::deque<T> queue_;
+    const size_t capacity_;
+    const QueueOverflowPolicy policy_;
+    bool is_closed_ = false;
+    uint64_t dropped_count_ = 0;
+
+    mutable std::mutex mutex_;
+    std::condition_variable not_empty_cond_;
+    std::condition_variable not_full_cond_;
+};
+
+}
+#endif
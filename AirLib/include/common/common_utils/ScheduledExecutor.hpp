@@ -11,25 +11,61 @@
 #include <system_error>
 #include <mutex>
 #include <cstdint>
+#include <cerrno>
+#include <algorithm>
+#ifdef __linux__
+#include <time.h>
+#endif
 
 namespace common_utils {
 
 class ScheduledExecutor {
+public:
+    //how close to deadline we stop sleeping and start spinning; OS sleep on
+    //Windows has coarse granularity so we need much larger window there.
+    //Window used is never more than half the period, see getSpinWindowNanos
+#ifdef _WIN32
+    static constexpr uint64_t kDefaultSpinWindowNanos = 5000000LL;
+#else
+    static constexpr uint64_t kDefaultSpinWindowNanos = 200000LL;
+#endif
+
+    //tick-to-tick jitter histogram: bucket i counts ticks with jitter below
+    //jitterBucketBound(i) nanoseconds, last bucket counts everything above 5ms
+    static constexpr unsigned int kJitterBuckets = 8;
+    static uint64_t jitterBucketBound(unsigned int bucket)
+    {
+        static const uint64_t bounds[kJitterBuckets - 1] = {
+            10000LL, 50000LL, 100000LL, 250000LL, 500000LL, 1000000LL, 5000000LL };
+        return bounds[bucket];
+    }
+
+    struct TickStats {
+        uint64_t ticks = 0;
+        uint64_t overruns = 0;
+        uint64_t spin_nanos = 0;
+        uint64_t max_jitter_nanos = 0;
+        uint64_t jitter_histogram[kJitterBuckets] = {};
+    };
+
 public:
     ScheduledExecutor()
     {}
-    ScheduledExecutor(const std::function<bool(uint64_t)>& callback, uint64_t period_nanos)
+    ScheduledExecutor(const std::function<bool(uint64_t)>& callback, uint64_t period_nanos,
+        uint64_t spin_window_nanos = kDefaultSpinWindowNanos)
     {
-        initialize(callback, period_nanos);
+        initialize(callback, period_nanos, spin_window_nanos);
     }
     ~ScheduledExecutor()
     {
         stop();
     }
-    void initialize(const std::function<bool(uint64_t)>& callback, uint64_t period_nanos)
+    void initialize(const std::function<bool(uint64_t)>& callback, uint64_t period_nanos,
+        uint64_t spin_window_nanos = kDefaultSpinWindowNanos)
     {
         callback_ = callback;
         period_nanos_ = period_nanos;
+        spin_window_nanos_ = spin_window_nanos;
         started_ = false;
 
     }
@@ -40,8 +76,9 @@ public:
         is_first_period_ = true;
 
         initializePauseState();
-        
+
         sleep_time_avg_ = 0;
+        resetStats();
         Utils::cleanupThread(th_);
         th_ = std::thread(&ScheduledExecutor::executorLoop, this);
     }
@@ -92,6 +129,41 @@ public:
         return sleep_time_avg_;
     }
 
+    //window actually used: a window as long as the period, such as the Windows
+    //default at the 3ms physics period, would spin through every tick
+    uint64_t getSpinWindowNanos() const
+    {
+        return std::min<uint64_t>(spin_window_nanos_, period_nanos_ / 2);
+    }
+    void setSpinWindowNanos(uint64_t spin_window_nanos)
+    {
+        spin_window_nanos_ = spin_window_nanos;
+    }
+
+    //counters are updated by executor thread with relaxed ordering so
+    //snapshot may be slightly inconsistent across fields
+    TickStats getStats() const
+    {
+        TickStats stats;
+        stats.ticks = ticks_.load(std::memory_order_relaxed);
+        stats.overruns = overruns_.load(std::memory_order_relaxed);
+        stats.spin_nanos = spin_nanos_.load(std::memory_order_relaxed);
+        stats.max_jitter_nanos = max_jitter_nanos_.load(std::memory_order_relaxed);
+        for (unsigned int i = 0; i < kJitterBuckets; ++i)
+            stats.jitter_histogram[i] = jitter_histogram_[i].load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    void resetStats()
+    {
+        ticks_ = 0;
+        overruns_ = 0;
+        spin_nanos_ = 0;
+        max_jitter_nanos_ = 0;
+        for (unsigned int i = 0; i < kJitterBuckets; ++i)
+            jitter_histogram_[i] = 0;
+    }
+
     void lock()
     {
         mutex_.lock();
@@ -110,7 +182,7 @@ private:
     }
 
 private:
-    typedef std::chrono::high_resolution_clock clock;
+    typedef std::chrono::steady_clock clock;
     typedef uint64_t TTimePoint;
     typedef uint64_t TTimeDelta;
     template <typename T>
@@ -118,39 +190,78 @@ private:
 
     static TTimePoint nanos()
     {
-        return clock::now().time_since_epoch().count();
+#ifdef __linux__
+        //must be same clock as used by clock_nanosleep below
+        struct timespec ts;
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return static_cast<TTimePoint>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+#else
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now().time_since_epoch()).count();
+#endif
     }
 
-    static void sleep_for(TTimePoint delay_nanos)
+    static void sleepUntilCoarse(TTimePoint wake_nanos)
     {
-        /*
-        This is spin loop implementation which may be suitable for sub-millisecond resolution.
-        //TODO: investigate below alternatives
-        On Windows we can use multimedia timers however this requires including entire Win32 header.
-        On Linux we can use nanosleep however below 2ms delays in real-time scheduler settings this 
-        probbaly does spin loop anyway.
+#ifdef __linux__
+        //absolute deadline so time spent in this call or early wakeups don't accumulate drift
+        struct timespec ts;
+        ts.tv_sec = static_cast<time_t>(wake_nanos / 1000000000LL);
+        ts.tv_nsec = static_cast<long>(wake_nanos % 1000000000LL);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+            ;
+#else
+        std::this_thread::sleep_until(clock::time_point(std::chrono::nanoseconds(wake_nanos)));
+#endif
+    }
 
+    void sleepUntil(TTimePoint deadline)
+    {
+        /*
+        Let OS put thread to sleep until we are within spin window of deadline and then
+        spin for the remainder. OS wakeup latency is typically tens of microseconds on Linux
+        but can be several milliseconds on Windows which is why spin window is configurable.
         */
 
-        if (delay_nanos >= 5000000LL) { //put thread to sleep
-            std::this_thread::sleep_for(std::chrono::duration<double>(delay_nanos / 1.0E9));
-        }
-        else { //for more precise timing, do spinning
-            auto start = nanos();
-            while ((nanos() - start) < delay_nanos) {
-                std::this_thread::yield();
-                //std::this_thread::sleep_for(std::chrono::duration<double>(0));
-            }
+        TTimePoint now = nanos();
+        TTimeDelta spin_window = getSpinWindowNanos();
+        if (deadline > now + spin_window)
+            sleepUntilCoarse(deadline - spin_window);
+
+        TTimePoint spin_start = nanos();
+        while (nanos() < deadline) {
+            std::this_thread::yield();
         }
+        spin_nanos_.fetch_add(nanos() - spin_start, std::memory_order_relaxed);
+    }
+
+    void recordTick(TTimePoint tick_start, TTimePoint last_tick_start)
+    {
+        ticks_.fetch_add(1, std::memory_order_relaxed);
+
+        if (last_tick_start == 0)
+            return;
+
+        TTimeDelta interval = tick_start - last_tick_start;
+        TTimeDelta jitter = interval > period_nanos_ ? interval - period_nanos_ : period_nanos_ - interval;
+
+        unsigned int bucket = 0;
+        while (bucket < kJitterBuckets - 1 && jitter >= jitterBucketBound(bucket))
+            ++bucket;
+        jitter_histogram_[bucket].fetch_add(1, std::memory_order_relaxed);
+
+        if (jitter > max_jitter_nanos_.load(std::memory_order_relaxed))
+            max_jitter_nanos_.store(jitter, std::memory_order_relaxed);
     }
 
     void executorLoop()
     {
         TTimePoint call_end = nanos();
+        TTimePoint last_tick_start = 0;
+        TTimePoint next_deadline = call_end;
         while (started_) {
             TTimePoint period_start = nanos();
             TTimeDelta since_last_call = period_start - call_end;
-            
+
             if (pause_period_start_ > 0) {
                 if (nanos() - pause_period_start_ >= pause_period_) {
                     if (! isPaused())
@@ -162,6 +273,9 @@ private:
 
             //is this first loop?
             if (!is_first_period_) {
+                recordTick(period_start, last_tick_start);
+                last_tick_start = period_start;
+
                 if (!paused_) {
                     //when we are doing work, don't let other thread to cause contention
                     std::lock_guard<std::mutex> locker(mutex_);
@@ -171,24 +285,33 @@ private:
                         started_ = result;
                     }
                 }
-            } 
+            }
             else
                 is_first_period_ = false;
-            
+
             call_end = nanos();
 
-            TTimeDelta elapsed_period = nanos() - period_start;
+            //next deadline is on absolute schedule so sleep inaccuracies don't accumulate
+            next_deadline += period_nanos_;
+            if (call_end >= next_deadline) {
+                overruns_.fetch_add(1, std::memory_order_relaxed);
+                //if we fell behind by more than a period, drop missed ticks instead of bursting to catch up
+                if (call_end - next_deadline >= period_nanos_)
+                    next_deadline = call_end;
+            }
+
             //prevent underflow: https://github.com/Microsoft/AirSim/issues/617
-            TTimeDelta delay_nanos = period_nanos_ > elapsed_period ? period_nanos_ - elapsed_period : 0;
+            TTimeDelta delay_nanos = next_deadline > call_end ? next_deadline - call_end : 0;
             //moving average of how much we are sleeping
             sleep_time_avg_ = 0.25f * sleep_time_avg_ + 0.75f * delay_nanos;
             if (delay_nanos > 0 && started_)
-                sleep_for(delay_nanos);
+                sleepUntil(next_deadline);
         }
     }
 
 private:
-    uint64_t period_nanos_;
+    uint64_t period_nanos_ = 0;
+    std::atomic<uint64_t> spin_window_nanos_ { kDefaultSpinWindowNanos };
     std::thread th_;
     std::function<bool(uint64_t)> callback_;
     bool is_first_period_;
@@ -196,9 +319,15 @@ private:
     std::atomic_bool paused_;
     std::atomic<TTimeDelta> pause_period_;
     std::atomic<TTimePoint> pause_period_start_;
-    
+
     double sleep_time_avg_;
 
+    std::atomic<uint64_t> ticks_ { 0 };
+    std::atomic<uint64_t> overruns_ { 0 };
+    std::atomic<uint64_t> spin_nanos_ { 0 };
+    std::atomic<uint64_t> max_jitter_nanos_ { 0 };
+    std::atomic<uint64_t> jitter_histogram_[kJitterBuckets] = {};
+
     std::mutex mutex_;
 };
 
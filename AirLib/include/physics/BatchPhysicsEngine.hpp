@@ -0,0 +1,371 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef airsim_core_BatchPhysicsEngine_hpp
+#define airsim_core_BatchPhysicsEngine_hpp
+
+#include "common/Common.hpp"
+#include "physics/FastPhysicsEngine.hpp"
+#include <cmath>
+
+namespace msr { namespace airlib {
+
+/*
+Same model as FastPhysicsEngine but designed for large number of bodies. Instead of
+integrating one Kinematics::State at a time with small Eigen types, state of all bodies
+is kept in contiguous structure-of-arrays buffers and integrated in plain loops
+over those buffers which compilers can auto-vectorize.
+
+Each tick has three phases:
+    - gather: per body, copy kinematics in to buffers and sum up forces from vertices
+              (this needs virtual calls so it can't be batched)
+    - integrate: batched loops over buffers for accelerations, twist and pose
+    - scatter: per body, apply collision response if any and feed next state from
+               buffers to PhysicsBody::updateKinematics
+Kinematics is re-read every tick so external changes like setPose still work.
+*/
+class BatchPhysicsEngine : public FastPhysicsEngine {
+public:
+    BatchPhysicsEngine(bool enable_ground_lock = true)
+        : FastPhysicsEngine(enable_ground_lock)
+    {
+    }
+
+    //*** Start: UpdatableState implementation ***//
+    virtual void update() override
+    {
+        PhysicsEngineBase::update();
+
+        resizeBuffers(size());
+        if (size() == 0)
+            return;
+
+        gatherState();
+        computeAverageTwist();
+        gatherDrag();
+        integrateTwist();
+        integrateOrientation();
+        scatterState();
+    }
+    //*** End: UpdatableState implementation ***//
+
+private:
+    struct Vector3Buffer {
+        vector<real_T> x, y, z;
+
+        void resize(size_t n)
+        {
+            x.resize(n); y.resize(n); z.resize(n);
+        }
+        void set(size_t i, const Vector3r& v)
+        {
+            x[i] = v.x(); y[i] = v.y(); z[i] = v.z();
+        }
+        Vector3r get(size_t i) const
+        {
+            return Vector3r(x[i], y[i], z[i]);
+        }
+    };
+
+    struct QuaternionBuffer {
+        vector<real_T> w, x, y, z;
+
+        void resize(size_t n)
+        {
+            w.resize(n); x.resize(n); y.resize(n); z.resize(n);
+        }
+        void set(size_t i, const Quaternionr& q)
+        {
+            w[i] = q.w(); x[i] = q.x(); y[i] = q.y(); z[i] = q.z();
+        }
+        Quaternionr get(size_t i) const
+        {
+            return Quaternionr(w[i], x[i], y[i], z[i]);
+        }
+    };
+
+    //row major 3x3 matrix per body
+    struct Matrix3x3Buffer {
+        vector<real_T> m[9];
+
+        void resize(size_t n)
+        {
+            for (auto& element : m)
+                element.resize(n);
+        }
+        void set(size_t i, const Matrix3x3r& mat)
+        {
+            for (uint r = 0; r < 3; ++r)
+                for (uint c = 0; c < 3; ++c)
+                    m[r * 3 + c][i] = mat(r, c);
+        }
+    };
+
+    void resizeBuffers(uint n)
+    {
+        if (dt_.size() == n)
+            return;
+
+        dt_.resize(n);
+        mass_.resize(n);
+        is_free_.resize(n);
+        is_moving_.resize(n);
+        inertia_.resize(n);
+        inertia_inv_.resize(n);
+        gravity_.resize(n);
+
+        position_.resize(n);
+        orientation_.resize(n);
+        linear_vel_.resize(n);
+        angular_vel_.resize(n);
+        linear_acc_.resize(n);
+        angular_acc_.resize(n);
+
+        force_.resize(n);
+        torque_.resize(n);
+        avg_linear_.resize(n);
+        avg_angular_.resize(n);
+
+        next_position_.resize(n);
+        next_orientation_.resize(n);
+        next_linear_vel_.resize(n);
+        next_angular_vel_.resize(n);
+        next_linear_acc_.resize(n);
+        next_angular_acc_.resize(n);
+    }
+
+    void gatherState()
+    {
+        for (uint i = 0; i < size(); ++i) {
+            PhysicsBody& body = *at(i);
+
+            dt_[i] = static_cast<real_T>(clock()->updateSince(body.last_kinematics_time));
+
+            const Kinematics::State& current = body.getKinematics();
+            position_.set(i, current.pose.position);
+            orientation_.set(i, current.pose.orientation);
+            linear_vel_.set(i, current.twist.linear);
+            angular_vel_.set(i, current.twist.angular);
+            linear_acc_.set(i, current.accelerations.linear);
+            angular_acc_.set(i, current.accelerations.angular);
+
+            mass_[i] = body.getMass();
+            inertia_.set(i, body.getInertia());
+            inertia_inv_.set(i, body.getInertiaInv());
+            const Vector3r& gravity = body.getEnvironment().getState().gravity;
+            gravity_.set(i, gravity);
+
+            const Wrench body_wrench = getBodyWrench(body, current.pose.orientation);
+
+            //free bodies get drag and acceleration, grounded ones get nothing this tick
+            is_free_[i] = !body.isGrounded();
+            if (body.isGrounded()) {
+                //make it stick to the ground until we see body wrench force greater than gravity
+                if (body_wrench.force.squaredNorm() >= gravity.squaredNorm())
+                    body.setGrounded(false);
+
+                force_.set(i, Vector3r::Zero());
+                torque_.set(i, Vector3r::Zero());
+            }
+            else {
+                force_.set(i, body_wrench.force);
+                torque_.set(i, body_wrench.torque);
+            }
+            //bodies that lost ground lock this tick are integrated with zero wrench
+            is_moving_[i] = !body.isGrounded();
+        }
+    }
+
+    void computeAverageTwist()
+    {
+        const uint n = size();
+        for (uint i = 0; i < n; ++i) {
+            const real_T half_dt = is_free_[i] ? 0.5f * dt_[i] : 0;
+            const real_T keep = is_free_[i] ? 1.0f : 0;
+            avg_linear_.x[i] = keep * linear_vel_.x[i] + linear_acc_.x[i] * half_dt;
+            avg_linear_.y[i] = keep * linear_vel_.y[i] + linear_acc_.y[i] * half_dt;
+            avg_linear_.z[i] = keep * linear_vel_.z[i] + linear_acc_.z[i] * half_dt;
+            avg_angular_.x[i] = keep * angular_vel_.x[i] + angular_acc_.x[i] * half_dt;
+            avg_angular_.y[i] = keep * angular_vel_.y[i] + angular_acc_.y[i] * half_dt;
+            avg_angular_.z[i] = keep * angular_vel_.z[i] + angular_acc_.z[i] * half_dt;
+        }
+    }
+
+    void gatherDrag()
+    {
+        for (uint i = 0; i < size(); ++i) {
+            if (!is_free_[i])
+                continue;
+
+            const Wrench drag_wrench = getDragWrench(*at(i), orientation_.get(i),
+                avg_linear_.get(i), avg_angular_.get(i));
+
+            force_.set(i, force_.get(i) + drag_wrench.force);
+            torque_.set(i, torque_.get(i) + drag_wrench.torque);
+        }
+    }
+
+    void integrateTwist()
+    {
+        const uint n = size();
+        const real_T max_speed_sq = EarthUtils::SpeedOfLight * EarthUtils::SpeedOfLight;
+
+        for (uint i = 0; i < n; ++i) {
+            const real_T dt = dt_[i];
+            const real_T half_dt = 0.5f * dt;
+
+            //linear acceleration due to force, we'll use this in next time step
+            if (is_free_[i]) {
+                next_linear_acc_.x[i] = force_.x[i] / mass_[i] + gravity_.x[i];
+                next_linear_acc_.y[i] = force_.y[i] / mass_[i] + gravity_.y[i];
+                next_linear_acc_.z[i] = force_.z[i] / mass_[i] + gravity_.z[i];
+            }
+            else {
+                next_linear_acc_.x[i] = next_linear_acc_.y[i] = next_linear_acc_.z[i] = 0;
+            }
+
+            //position only moves by average velocity which is zero for bodies that were grounded
+            next_position_.x[i] = position_.x[i] + avg_linear_.x[i] * dt;
+            next_position_.y[i] = position_.y[i] + avg_linear_.y[i] * dt;
+            next_position_.z[i] = position_.z[i] + avg_linear_.z[i] * dt;
+
+            if (!is_moving_[i]) {
+                //this stops vehicle from vibrating while it is on the ground doing nothing
+                next_angular_acc_.x[i] = next_angular_acc_.y[i] = next_angular_acc_.z[i] = 0;
+                next_linear_vel_.x[i] = next_linear_vel_.y[i] = next_linear_vel_.z[i] = 0;
+                next_angular_vel_.x[i] = next_angular_vel_.y[i] = next_angular_vel_.z[i] = 0;
+                continue;
+            }
+
+            //Euler's rotation equation: angular momentum L = I * omega
+            const real_T wx = avg_angular_.x[i], wy = avg_angular_.y[i], wz = avg_angular_.z[i];
+            const real_T lx = inertia_.m[0][i] * wx + inertia_.m[1][i] * wy + inertia_.m[2][i] * wz;
+            const real_T ly = inertia_.m[3][i] * wx + inertia_.m[4][i] * wy + inertia_.m[5][i] * wz;
+            const real_T lz = inertia_.m[6][i] * wx + inertia_.m[7][i] * wy + inertia_.m[8][i] * wz;
+            const real_T rx = torque_.x[i] - (wy * lz - wz * ly);
+            const real_T ry = torque_.y[i] - (wz * lx - wx * lz);
+            const real_T rz = torque_.z[i] - (wx * ly - wy * lx);
+            next_angular_acc_.x[i] = inertia_inv_.m[0][i] * rx + inertia_inv_.m[1][i] * ry + inertia_inv_.m[2][i] * rz;
+            next_angular_acc_.y[i] = inertia_inv_.m[3][i] * rx + inertia_inv_.m[4][i] * ry + inertia_inv_.m[5][i] * rz;
+            next_angular_acc_.z[i] = inertia_inv_.m[6][i] * rx + inertia_inv_.m[7][i] * ry + inertia_inv_.m[8][i] * rz;
+
+            //Verlet integration
+            next_linear_vel_.x[i] = linear_vel_.x[i] + (linear_acc_.x[i] + next_linear_acc_.x[i]) * half_dt;
+            next_linear_vel_.y[i] = linear_vel_.y[i] + (linear_acc_.y[i] + next_linear_acc_.y[i]) * half_dt;
+            next_linear_vel_.z[i] = linear_vel_.z[i] + (linear_acc_.z[i] + next_linear_acc_.z[i]) * half_dt;
+            next_angular_vel_.x[i] = angular_vel_.x[i] + (angular_acc_.x[i] + next_angular_acc_.x[i]) * half_dt;
+            next_angular_vel_.y[i] = angular_vel_.y[i] + (angular_acc_.y[i] + next_angular_acc_.y[i]) * half_dt;
+            next_angular_vel_.z[i] = angular_vel_.z[i] + (angular_acc_.z[i] + next_angular_acc_.z[i]) * half_dt;
+
+            //if controller has bug, velocities can increase idenfinitely
+            //so we need to clip this or everything will turn in to infinity/nans
+            clipToSpeedOfLight(next_linear_vel_, next_linear_acc_, i, max_speed_sq);
+            clipToSpeedOfLight(next_angular_vel_, next_angular_acc_, i, max_speed_sq);
+        }
+    }
+
+    void integrateOrientation()
+    {
+        const uint n = size();
+        for (uint i = 0; i < n; ++i) {
+            const real_T wx = avg_angular_.x[i], wy = avg_angular_.y[i], wz = avg_angular_.z[i];
+            const real_T angle_per_unit = std::sqrt(wx * wx + wy * wy + wz * wz);
+
+            const real_T qw = orientation_.w[i], qx = orientation_.x[i], qy = orientation_.y[i], qz = orientation_.z[i];
+            if (!Utils::isDefinitelyGreaterThan(angle_per_unit, 0.0f)) {
+                //no change in angle, because angular velocity is zero (normalized vector is undefined)
+                next_orientation_.w[i] = qw; next_orientation_.x[i] = qx;
+                next_orientation_.y[i] = qy; next_orientation_.z[i] = qz;
+                continue;
+            }
+
+            //angular displacement in last dt seconds as unit quaternion, added to previous orientation
+            const real_T half_angle = 0.5f * (angle_per_unit * dt_[i]);
+            const real_T dw = std::cos(half_angle);
+            const real_T s = std::sin(half_angle);
+            const real_T dx = s * (wx / angle_per_unit), dy = s * (wy / angle_per_unit), dz = s * (wz / angle_per_unit);
+
+            real_T rw = qw * dw - qx * dx - qy * dy - qz * dz;
+            real_T rx = qw * dx + qx * dw + qy * dz - qz * dy;
+            real_T ry = qw * dy + qy * dw + qz * dx - qx * dz;
+            real_T rz = qw * dz + qz * dw + qx * dy - qy * dx;
+            //checked before normalizing, same as FastPhysicsEngine
+            if (std::isnan(rw) || std::isnan(rx) || std::isnan(ry) || std::isnan(rz))
+                Utils::log("orientation had NaN!", Utils::kLogLevelError);
+
+            //re-normalize quaternion to avoid accumulating error
+            const real_T norm = std::sqrt(rw * rw + rx * rx + ry * ry + rz * rz);
+            next_orientation_.w[i] = rw / norm; next_orientation_.x[i] = rx / norm;
+            next_orientation_.y[i] = ry / norm; next_orientation_.z[i] = rz / norm;
+        }
+    }
+
+    void scatterState()
+    {
+        for (uint i = 0; i < size(); ++i) {
+            PhysicsBody& body = *at(i);
+
+            Kinematics::State next;
+            next.pose.position = next_position_.get(i);
+            next.pose.orientation = next_orientation_.get(i);
+            next.twist.linear = next_linear_vel_.get(i);
+            next.twist.angular = next_angular_vel_.get(i);
+            next.accelerations.linear = next_linear_acc_.get(i);
+            next.accelerations.angular = next_angular_acc_.get(i);
+
+            Wrench next_wrench;
+            if (is_free_[i]) {
+                next_wrench.force = force_.get(i);
+                next_wrench.torque = torque_.get(i);
+            }
+            else
+                next_wrench = Wrench::zero();
+
+            //collisions are rare so they are handled per body exactly as in FastPhysicsEngine
+            const CollisionInfo collision_info = body.getCollisionInfo();
+            CollisionResponse& collision_response = body.getCollisionResponseInfo();
+            if (body.isGrounded() || (collision_info.has_collided && collision_response.collision_time_stamp != collision_info.time_stamp)) {
+                bool is_collision_response = getNextKinematicsOnCollision(dt_[i], collision_info, body,
+                    body.getKinematics(), next, next_wrench, enable_ground_lock_);
+                updateCollisionResponseInfo(collision_info, next, is_collision_response, collision_response);
+            }
+
+            body.setWrench(next_wrench);
+            body.updateKinematics(next);
+        }
+    }
+
+    static void clipToSpeedOfLight(Vector3Buffer& vel, Vector3Buffer& acc, uint i, real_T max_speed_sq)
+    {
+        const real_T speed_sq = vel.x[i] * vel.x[i] + vel.y[i] * vel.y[i] + vel.z[i] * vel.z[i];
+        if (speed_sq > max_speed_sq) {
+            const real_T scale = std::sqrt(speed_sq) / EarthUtils::SpeedOfLight;
+            vel.x[i] /= scale; vel.y[i] /= scale; vel.z[i] /= scale;
+            acc.x[i] = acc.y[i] = acc.z[i] = 0;
+        }
+    }
+
+private:
+    //per body constants and flags
+    vector<real_T> dt_, mass_;
+    vector<unsigned char> is_free_, is_moving_;
+    Matrix3x3Buffer inertia_, inertia_inv_;
+    Vector3Buffer gravity_;
+
+    //current state
+    Vector3Buffer position_;
+    QuaternionBuffer orientation_;
+    Vector3Buffer linear_vel_, angular_vel_, linear_acc_, angular_acc_;
+
+    //wrench (force in world frame, torque in body frame) and average twist over dt
+    Vector3Buffer force_, torque_;
+    Vector3Buffer avg_linear_, avg_angular_;
+
+    //next state
+    Vector3Buffer next_position_;
+    QuaternionBuffer next_orientation_;
+    Vector3Buffer next_linear_vel_, next_angular_vel_, next_linear_acc_, next_angular_acc_;
+};
+
+}} //namespace
+#endif
@@ -12,15 +12,37 @@
 #include <memory>
 #include "common/CommonStructs.hpp"
 #include "common/SteppableClock.hpp"
+#include "common/TickProfiler.hpp"
+#include "common/common_utils/ctpl_stl.h"
 #include <cinttypes>
+#include <future>
+#include <exception>
 
 namespace msr { namespace airlib {
 
 class FastPhysicsEngine : public PhysicsEngineBase {
 public:
-    FastPhysicsEngine(bool enable_ground_lock = true)
+    FastPhysicsEngine(bool enable_ground_lock = true, uint thread_count = 1)
         : enable_ground_lock_(enable_ground_lock)
     { 
+        setThreadCount(thread_count);
+    }
+
+    //Bodies don't interact with each other in updatePhysics so they can be
+    //updated in parallel. Calling thread takes one partition and persistent
+    //pool of (thread_count - 1) workers takes the rest.
+    void setThreadCount(uint thread_count)
+    {
+        thread_count_ = std::max(thread_count, 1u);
+        if (thread_count_ > 1)
+            thread_pool_.reset(new ctpl::thread_pool(static_cast<int>(thread_count_ - 1)));
+        else
+            thread_pool_.reset();
+    }
+
+    uint getThreadCount() const
+    {
+        return thread_count_;
     }
 
     //*** Start: UpdatableState implementation ***//
@@ -44,9 +66,13 @@ public:
     {
         PhysicsEngineBase::update();
 
-        for (PhysicsBody* body_ptr : *this) {
-            updatePhysics(*body_ptr);
+        if (thread_pool_ == nullptr || size() < 2) {
+            for (PhysicsBody* body_ptr : *this) {
+                updatePhysics(*body_ptr);
+            }
         }
+        else
+            updatePhysicsParallel();
     }
     virtual void reportState(StateReporter& reporter) override
     {
@@ -62,6 +88,54 @@ public:
     //*** End: UpdatableState implementation ***//
 
 private:
+    void updatePhysicsParallel()
+    {
+        //each body always lands in exactly one contiguous partition so results
+        //per body are same as serial update regardless of thread count
+        const uint body_count = size();
+        const uint partition_count = std::min(thread_count_, body_count);
+
+        partition_futures_.clear();
+        for (uint partition = 1; partition < partition_count; ++partition) {
+            partition_futures_.push_back(thread_pool_->push([this, partition, partition_count, body_count](int thread_id) {
+                unused(thread_id);
+                updatePartition(partition, partition_count, body_count);
+            }));
+        }
+
+        std::exception_ptr error;
+        try {
+            updatePartition(0, partition_count, body_count);
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        //barrier: no body may be touched by workers once this tick returns
+        for (auto& partition_future : partition_futures_) {
+            try {
+                partition_future.get();
+            }
+            catch (...) {
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    void updatePartition(uint partition, uint partition_count, uint body_count)
+    {
+        const uint begin = body_count * partition / partition_count;
+        const uint end = body_count * (partition + 1) / partition_count;
+        AIRLIB_PROFILE_SCOPE("FastPhysicsEngine/partition");
+        for (uint body_index = begin; body_index < end; ++body_index)
+            updatePhysics(*at(body_index));
+    }
+
+protected:
     void initPhysicsBody(PhysicsBody* body_ptr)
     {
         body_ptr->last_kinematics_time = clock()->nowNanos();
@@ -441,14 +515,20 @@ private:
             next.pose.orientation = current_pose.orientation;
     }
 
-private:
+protected:
     static constexpr uint kCollisionResponseCycles = 1;
     static constexpr float kAxisTolerance = 0.25f;
     static constexpr float kRestingVelocityMax = 0.1f;
     static constexpr float kDragMinVelocity = 0.1f;
 
-    std::stringstream debug_string_;
     bool enable_ground_lock_;
+
+private:
+    std::stringstream debug_string_;
+
+    uint thread_count_;
+    std::unique_ptr<ctpl::thread_pool> thread_pool_;
+    std::vector<std::future<void>> partition_futures_;
     TTimePoint last_message_time;
 };
 
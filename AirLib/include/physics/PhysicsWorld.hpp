@@ -17,12 +17,14 @@ class PhysicsWorld {
 public:
     PhysicsWorld(std::unique_ptr<PhysicsEngineBase> physics_engine, const std::vector<UpdatableObject*>& bodies,
             uint64_t update_period_nanos = 3000000LL, bool state_reporter_enabled = false,
-            bool start_async_updator = true
+            bool start_async_updator = true,
+            uint64_t spin_window_nanos = common_utils::ScheduledExecutor::kDefaultSpinWindowNanos
         )
         : world_(std::move(physics_engine))
     {
         enableStateReport(state_reporter_enabled);
         update_period_nanos_ = update_period_nanos;
+        spin_window_nanos_ = spin_window_nanos;
         initializeWorld(bodies, start_async_updator);
     }
 
@@ -50,7 +52,7 @@ public:
 
     void startAsyncUpdator()
     {
-        world_.startAsyncUpdator(update_period_nanos_);
+        world_.startAsyncUpdator(update_period_nanos_, spin_window_nanos_);
     }
     void stopAsyncUpdator()
     {
@@ -91,6 +93,16 @@ public:
         world_.continueForTime(seconds);
     }
 
+    void step(unsigned int steps)
+    {
+        world_.step(steps);
+    }
+
+    common_utils::ScheduledExecutor::TickStats getTickStats() const
+    {
+        return world_.getTickStats();
+    }
+
 private:
     void initializeWorld(const std::vector<UpdatableObject*>& bodies, bool start_async_updator)
     {
@@ -103,7 +115,7 @@ private:
         world_.reset();
 
         if (start_async_updator)
-            world_.startAsyncUpdator(update_period_nanos_);
+            world_.startAsyncUpdator(update_period_nanos_, spin_window_nanos_);
     }
 
 private:
@@ -111,6 +123,7 @@ private:
     StateReporterWrapper reporter_;
     World world_;
     uint64_t update_period_nanos_;
+    uint64_t spin_window_nanos_;
 };
 
 
@@ -11,6 +11,7 @@
 #include "PhysicsBody.hpp"
 #include "common/common_utils/ScheduledExecutor.hpp"
 #include "common/ClockFactory.hpp"
+#include "common/TickProfiler.hpp"
 
 namespace msr { namespace airlib {
 
@@ -37,19 +38,43 @@ public:
 
     virtual void update() override
     {
+        AIRLIB_PROFILE_SCOPE("World/update");
+
         ClockFactory::get()->step();
 
         //first update our objects
-        UpdatableContainer::update();
+        {
+            AIRLIB_PROFILE_SCOPE("World/updatables");
+            UpdatableContainer::update();
+        }
 
         //now update kinematics state
-        if (physics_engine_)
+        if (physics_engine_) {
+            AIRLIB_PROFILE_SCOPE("World/physics");
             physics_engine_->update();
+        }
     }
 
     virtual void reportState(StateReporter& reporter) override
     {
         reporter.writeValue("Sleep", 1.0f / executor_.getSleepTimeAvg());
+
+        const common_utils::ScheduledExecutor::TickStats stats = executor_.getStats();
+        reporter.writeValue("Ticks", stats.ticks);
+        reporter.writeValue("Overruns", stats.overruns);
+        reporter.writeValue("Spin (ms)", stats.spin_nanos / 1.0E6);
+        reporter.writeValue("Max Jitter (us)", stats.max_jitter_nanos / 1.0E3);
+        reporter.writeNameOnly("Jitter (us)");
+        for (unsigned int i = 0; i < common_utils::ScheduledExecutor::kJitterBuckets; ++i) {
+            if (i < common_utils::ScheduledExecutor::kJitterBuckets - 1)
+                reporter.writeValueOnly(Utils::stringf("<%d:%llu",
+                    static_cast<int>(common_utils::ScheduledExecutor::jitterBucketBound(i) / 1000),
+                    static_cast<unsigned long long>(stats.jitter_histogram[i])));
+            else
+                reporter.writeValueOnly(Utils::stringf("more:%llu",
+                    static_cast<unsigned long long>(stats.jitter_histogram[i])), true);
+        }
+
         if (physics_engine_)
             physics_engine_->reportState(reporter);
 
@@ -84,10 +109,12 @@ public:
     }
 
     //async updater thread
-    void startAsyncUpdator(uint64_t period)
+    void startAsyncUpdator(uint64_t period,
+        uint64_t spin_window_nanos = common_utils::ScheduledExecutor::kDefaultSpinWindowNanos)
     {
         //TODO: probably we shouldn't be passing around fixed period
-        executor_.initialize(std::bind(&World::worldUpdatorAsync, this, std::placeholders::_1), period);
+        executor_.initialize(std::bind(&World::worldUpdatorAsync, this, std::placeholders::_1),
+            period, spin_window_nanos);
         executor_.start();
     }
     void stopAsyncUpdator()
@@ -118,16 +145,39 @@ public:
         return executor_.isPaused();
     }
 
+    common_utils::ScheduledExecutor::TickStats getTickStats() const
+    {
+        return executor_.getStats();
+    }
+
     void continueForTime(double seconds)
     {
         executor_.continueForTime(seconds);
     }
 
+    //Run given number of updates back-to-back without sleeping in between. With
+    //SteppableClock each update advances time by fixed dt so this runs faster
+    //than real-time, limited only by CPU. Async updator is held off while we run.
+    void step(unsigned int steps)
+    {
+        executor_.lock();
+        for (unsigned int i = 0; i < steps; ++i)
+            updateNoThrow();
+        executor_.unlock();
+    }
+
 private:
     bool worldUpdatorAsync(uint64_t dt_nanos)
     {
         unused(dt_nanos);
 
+        updateNoThrow();
+
+        return true;
+    }
+
+    void updateNoThrow()
+    {
         try {
             update();
         }
@@ -139,8 +189,6 @@ private:
             //Utils::DebugBreak();
             Utils::log("Exception occurred while updating world", Utils::kLogLevelError);
         }
-
-        return true;
     }
 
 private:
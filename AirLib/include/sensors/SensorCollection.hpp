@@ -8,6 +8,7 @@
 #include "sensors/SensorBase.hpp"
 #include "common/UpdatableContainer.hpp"
 #include "common/Common.hpp"
+#include "common/TickProfiler.hpp"
 
 
 namespace msr { namespace airlib {
@@ -82,6 +83,7 @@ public:
         UpdatableObject::update();
 
         for (auto& pair : sensors_) {
+            AIRLIB_PROFILE_SCOPE_ID(getProfilerPhase(pair.first));
             pair.second->update();
         }
     }
@@ -94,6 +96,22 @@ public:
     }
     //*** End: UpdatableState implementation ***//
 
+private:
+    static TickProfiler::PhaseId getProfilerPhase(uint type_int)
+    {
+        //indexed by SensorBase::SensorType
+        static const std::vector<TickProfiler::PhaseId> phases = []() {
+            const char* names[] = { "Sensor/Unknown", "Sensor/Barometer", "Sensor/Imu", "Sensor/Gps",
+                "Sensor/Magnetometer", "Sensor/Distance", "Sensor/Lidar" };
+            std::vector<TickProfiler::PhaseId> ids;
+            for (const char* name : names)
+                ids.push_back(TickProfiler::singleton().registerPhase(name));
+            return ids;
+        }();
+
+        return phases.at(type_int < phases.size() ? type_int : 0);
+    }
+
 private:
     typedef UpdatableContainer<SensorBasePtr> SensorBaseContainer;
     unordered_map<uint, unique_ptr<SensorBaseContainer>> sensors_;
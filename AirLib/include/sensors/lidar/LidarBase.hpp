@@ -4,6 +4,9 @@
 #ifndef msr_airlib_LidarBase_hpp
 #define msr_airlib_LidarBase_hpp
 
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include "sensors/SensorBase.hpp"
 
 namespace msr { namespace airlib {
@@ -11,7 +14,7 @@ namespace msr { namespace airlib {
 class LidarBase : public SensorBase {
 public:
     LidarBase(const std::string& sensor_name = "")
-        : SensorBase(sensor_name)
+        : SensorBase(sensor_name), output_(std::make_shared<LidarData>())
     {}
 
 public: //types
@@ -36,23 +39,52 @@ public:
         //call base
         UpdatableObject::reportState(reporter);
 
-        reporter.writeValue("Lidar-Timestamp", output_.time_stamp);
-        reporter.writeValue("Lidar-NumPoints", static_cast<int>(output_.point_cloud.size() / 3));
+        std::shared_ptr<const LidarData> output = getOutput();
+        reporter.writeValue("Lidar-Timestamp", output->time_stamp);
+        reporter.writeValue("Lidar-NumPoints", static_cast<int>(output->point_cloud.size() / 3));
     }
 
-    const LidarData& getOutput() const
+    //latest published scan without copying it; it is never modified after publishing so caller
+    //may hold on to it from any thread while sensor keeps producing new scans
+    std::shared_ptr<const LidarData> getOutput() const
     {
+        std::lock_guard<std::mutex> locker(output_mutex_);
         return output_;
     }
 
 protected:
+    /*
+    Output is double buffered: producer fills back buffer returned by beginOutput() and then
+    publishOutput() swaps it with front buffer, so scans are never copied. Buffer that was
+    swapped out is reused for next scan (keeping its capacity) unless some reader still holds
+    it through getOutput(), in which case new buffer is allocated.
+    */
+    LidarData& beginOutput()
+    {
+        if (!back_ || back_.use_count() != 1)
+            back_ = std::make_shared<LidarData>();
+        else //pairs with release done by reader when it dropped its reference
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+        return *back_;
+    }
+
+    void publishOutput()
+    {
+        std::lock_guard<std::mutex> locker(output_mutex_);
+        output_.swap(back_);
+    }
+
     void setOutput(const LidarData& output)
     {
-        output_ = output;
+        beginOutput() = output;
+        publishOutput();
     }
 
 private:
-    LidarData output_;
+    std::shared_ptr<LidarData> output_;
+    std::shared_ptr<LidarData> back_;
+    mutable std::mutex output_mutex_;
 };
 
 }} //namespace
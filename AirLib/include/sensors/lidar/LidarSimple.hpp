@@ -67,8 +67,9 @@ public:
     }
 
 protected:
+    //fills point_cloud and any optional channels enabled in params, output is cleared by caller
     virtual void getPointCloud(const Pose& lidar_pose, const Pose& vehicle_pose, 
-        TTimeDelta delta_time, vector<real_T>& point_cloud) = 0;
+        TTimeDelta delta_time, LidarData& output) = 0;
 
     
 private: //methods
@@ -76,7 +77,11 @@ private: //methods
     {
         TTimeDelta delta_time = clock()->updateSince(last_time_);
 
-        point_cloud_.clear();
+        //back buffer keeps its capacity from earlier scans so this doesn't free memory
+        LidarData& output = beginOutput();
+        output.point_cloud.clear();
+        output.ring.clear();
+        output.time_offset.clear();
 
         const GroundTruth& ground_truth = getGroundTruth();
 
@@ -92,21 +97,18 @@ private: //methods
         getPointCloud(params_.relative_pose, // relative lidar pose
             ground_truth.kinematics->pose,   // relative vehicle pose
             delta_time, 
-            point_cloud_);
+            output);
 
-        LidarData output;
-        output.point_cloud = point_cloud_;
         output.time_stamp = clock()->nowNanos();
         output.pose = lidar_pose;            
 
         last_time_ = output.time_stamp;
 
-        setOutput(output);
+        publishOutput();
     }
 
 private:
     LidarSimpleParams params_;
-    vector<real_T> point_cloud_;
 
     FrequencyLimiter freq_limiter_;
     TTimePoint last_time_;
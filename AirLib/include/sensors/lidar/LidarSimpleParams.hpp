@@ -33,6 +33,8 @@ struct LidarSimpleParams {
 
     bool draw_debug_points = false;
     std::string data_frame = AirSimSettings::kVehicleInertialFrame;
+    bool include_ring = false;
+    bool include_time_offset = false;
 
     real_T update_frequency = 10;             // Hz
     real_T startup_delay = 0;                 // sec
@@ -90,6 +92,8 @@ struct LidarSimpleParams {
            
         draw_debug_points = settings.draw_debug_points;
         data_frame = settings.data_frame;
+        include_ring = settings.include_ring;
+        include_time_offset = settings.include_time_offset;
     }
 };
 
@@ -12,6 +12,7 @@
 #include "MultiRotorParams.hpp"
 #include <vector>
 #include "physics/PhysicsBody.hpp"
+#include "common/TickProfiler.hpp"
 
 
 namespace msr { namespace airlib {
@@ -23,6 +24,14 @@ public:
         : params_(params), vehicle_api_(vehicle_api)
     {
         initialize(kinematics, environment);
+        setProfilerName("MultiRotor");
+    }
+
+    //phases of this vehicle are reported by tick profiler as name/sensors and name/firmware
+    void setProfilerName(const std::string& name)
+    {
+        sensors_phase_ = TickProfiler::singleton().registerPhase(name + "/sensors");
+        firmware_phase_ = TickProfiler::singleton().registerPhase(name + "/firmware");
     }
 
     //*** Start: UpdatableState implementation ***//
@@ -67,10 +76,16 @@ public:
     {
         PhysicsBody::updateKinematics(kinematics);
 
-        updateSensors(*params_, getKinematics(), getEnvironment());
+        {
+            AIRLIB_PROFILE_SCOPE_ID(sensors_phase_);
+            updateSensors(*params_, getKinematics(), getEnvironment());
+        }
 
         //update controller which will update actuator control signal
-        vehicle_api_->update();
+        {
+            AIRLIB_PROFILE_SCOPE_ID(firmware_phase_);
+            vehicle_api_->update();
+        }
 
         //transfer new input values from controller to rotors
         for (uint rotor_index = 0; rotor_index < rotors_.size(); ++rotor_index) {
@@ -210,6 +225,9 @@ private: //fields
 
     std::unique_ptr<Environment> environment_;
     VehicleApiBase* vehicle_api_;
+
+    TickProfiler::PhaseId sensors_phase_;
+    TickProfiler::PhaseId firmware_phase_;
 };
 
 }} //namespace
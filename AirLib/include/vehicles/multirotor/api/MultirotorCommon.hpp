@@ -43,6 +43,38 @@ struct YawMode {
     }
 };
 
+//per vehicle arguments of batched move commands, see moveByVelocityBatchAsync etc
+struct VelocityCommand {
+    float vx = 0, vy = 0, vz = 0;
+    YawMode yaw_mode;
+
+    VelocityCommand()
+    {}
+    VelocityCommand(float vx_val, float vy_val, float vz_val, const YawMode& yaw_mode_val = YawMode())
+        : vx(vx_val), vy(vy_val), vz(vz_val), yaw_mode(yaw_mode_val)
+    {}
+};
+
+struct AngleZCommand {
+    float pitch = 0, roll = 0, z = 0, yaw = 0;
+
+    AngleZCommand()
+    {}
+    AngleZCommand(float pitch_val, float roll_val, float z_val, float yaw_val)
+        : pitch(pitch_val), roll(roll_val), z(z_val), yaw(yaw_val)
+    {}
+};
+
+struct AngleThrottleCommand {
+    float pitch = 0, roll = 0, throttle = 0, yaw_rate = 0;
+
+    AngleThrottleCommand()
+    {}
+    AngleThrottleCommand(float pitch_val, float roll_val, float throttle_val, float yaw_rate_val)
+        : pitch(pitch_val), roll(roll_val), throttle(throttle_val), yaw_rate(yaw_rate_val)
+    {}
+};
+
 //properties of vehicle
 struct MultirotorApiParams {
     MultirotorApiParams() {};
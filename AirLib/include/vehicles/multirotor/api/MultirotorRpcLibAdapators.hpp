@@ -39,6 +39,67 @@ public:
         }
     };
 
+    struct VelocityCommand {
+        float vx = 0, vy = 0, vz = 0;
+        YawMode yaw_mode;
+        MSGPACK_DEFINE_MAP(vx, vy, vz, yaw_mode);
+
+        VelocityCommand()
+        {}
+
+        VelocityCommand(const msr::airlib::VelocityCommand& s)
+        {
+            vx = s.vx;
+            vy = s.vy;
+            vz = s.vz;
+            yaw_mode = s.yaw_mode;
+        }
+        msr::airlib::VelocityCommand to() const
+        {
+            return msr::airlib::VelocityCommand(vx, vy, vz, yaw_mode.to());
+        }
+    };
+
+    struct AngleZCommand {
+        float pitch = 0, roll = 0, z = 0, yaw = 0;
+        MSGPACK_DEFINE_MAP(pitch, roll, z, yaw);
+
+        AngleZCommand()
+        {}
+
+        AngleZCommand(const msr::airlib::AngleZCommand& s)
+        {
+            pitch = s.pitch;
+            roll = s.roll;
+            z = s.z;
+            yaw = s.yaw;
+        }
+        msr::airlib::AngleZCommand to() const
+        {
+            return msr::airlib::AngleZCommand(pitch, roll, z, yaw);
+        }
+    };
+
+    struct AngleThrottleCommand {
+        float pitch = 0, roll = 0, throttle = 0, yaw_rate = 0;
+        MSGPACK_DEFINE_MAP(pitch, roll, throttle, yaw_rate);
+
+        AngleThrottleCommand()
+        {}
+
+        AngleThrottleCommand(const msr::airlib::AngleThrottleCommand& s)
+        {
+            pitch = s.pitch;
+            roll = s.roll;
+            throttle = s.throttle;
+            yaw_rate = s.yaw_rate;
+        }
+        msr::airlib::AngleThrottleCommand to() const
+        {
+            return msr::airlib::AngleThrottleCommand(pitch, roll, throttle, yaw_rate);
+        }
+    };
+
     struct MultirotorState {
         CollisionInfo collision;
         KinematicsState kinematics_estimated;
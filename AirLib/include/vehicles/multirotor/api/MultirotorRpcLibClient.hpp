@@ -44,8 +44,18 @@ public:
 
     void moveByRC(const RCData& rc_data, const std::string& vehicle_name = "");
 
+    //batch versions send one command per vehicle in single call, commands run in parallel
+    //on server and waitOnLastTask result is true only if all of them succeeded
+    MultirotorRpcLibClient* moveByVelocityBatchAsync(const vector<VelocityCommand>& commands, float duration,
+        DrivetrainType drivetrain, const vector<std::string>& vehicle_names);
+    MultirotorRpcLibClient* moveByAngleZBatchAsync(const vector<AngleZCommand>& commands, float duration,
+        const vector<std::string>& vehicle_names);
+    MultirotorRpcLibClient* moveByAngleThrottleBatchAsync(const vector<AngleThrottleCommand>& commands, float duration,
+        const vector<std::string>& vehicle_names);
+
 
     MultirotorState getMultirotorState(const std::string& vehicle_name = "");
+    vector<MultirotorState> getMultirotorStateBatch(const vector<std::string>& vehicle_names);
 
     bool setSafety(SafetyEval::SafetyViolationType enable_reasons, float obs_clearance, SafetyEval::ObsAvoidanceStrategy obs_startegy,
         float obs_avoidance_vel, const Vector3r& origin, float xy_length, float max_z, float min_z, const std::string& vehicle_name = "");
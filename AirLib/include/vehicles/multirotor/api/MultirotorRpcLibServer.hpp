@@ -23,6 +23,17 @@ protected:
         return static_cast<MultirotorApiBase*>(RpcLibServerBase::getVehicleApi(vehicle_name));
     }
 
+    std::vector<MultirotorApiBase*> getMultirotorApis(const std::vector<std::string>& vehicle_names)
+    {
+        std::vector<MultirotorApiBase*> apis;
+        for (auto* api : RpcLibServerBase::getVehicleApis(vehicle_names))
+            apis.push_back(static_cast<MultirotorApiBase*>(api));
+        return apis;
+    }
+
+private:
+    struct impl;
+    std::unique_ptr<impl> pimpl_;
 };
 
 }} //namespace
@@ -12,6 +12,8 @@
 
 #include <queue>
 #include <mutex>
+#include <condition_variable>
+#include <chrono>
 #include <string>
 #include <vector>
 #include <memory>
@@ -90,7 +92,14 @@ public: //methods
         if (sensors_ == nullptr || connection_ == nullptr || !connection_->isOpen())
             return;
 
-        //send sensor updates
+        //in lock-step the firmware runs on our clock, otherwise it gets wall clock time as before
+        if (connection_info_.lock_step)
+            hil_time_usec_ = static_cast<uint64_t>(clock()->nowNanos() / 1000);
+        else
+            hil_time_usec_ = static_cast<uint64_t>(Utils::getTimeSinceEpochNanos() / 1000.0);
+
+        //send sensor updates, all messages of this step go out at the end (in one batch with BatchHilSends)
+        hil_messages_.clear();
         const auto& imu_output = getImu()->getOutput();
         const auto& mag_output = getMagnetometer()->getOutput();
         const auto& baro_output = getBarometer()->getOutput();
@@ -137,6 +146,17 @@ public: //methods
                     gps_output.gnss.eph, gps_output.gnss.epv, gps_output.gnss.fix_type, 10);
             }
         }
+        if (hil_node_ != nullptr) {
+            if (connection_info_.batch_hil_sends)
+                hil_node_->sendMessages(hil_messages_);
+            else {
+                for (auto& msg : hil_messages_)
+                    hil_node_->sendMessage(msg);
+            }
+        }
+
+        if (connection_info_.lock_step)
+            waitForControls(hil_time_usec_);
 
         //must be done at the end
         if (was_reset_)
@@ -234,6 +254,41 @@ public: //methods
         return RotorControlsCount;
     }
 
+    struct LockStepStats {
+        uint64_t steps = 0; //sensor updates sent in lock-step
+        uint64_t stalls = 0; //updates where the controls did not come back before the timeout
+        uint64_t lagged_steps = 0; //updates that went on with controls computed from older sensor data
+        uint64_t max_lag_usec = 0; //largest gap between the sensor time sent and the time of the controls used
+        uint64_t wait_usec = 0; //total time spent waiting for controls
+        uint64_t max_wait_usec = 0;
+    };
+
+    //counters for lock-step mode since the last reset
+    LockStepStats getLockStepStats() const
+    {
+        std::lock_guard<std::mutex> guard(hil_controls_mutex_);
+        return lock_step_stats_;
+    }
+
+    //the HIL messages sent by the last update
+    mavlinkcom::MavLinkHilSensor getLastSensorMessage()
+    {
+        std::lock_guard<std::mutex> guard(last_message_mutex_);
+        return last_sensor_message_;
+    }
+
+    mavlinkcom::MavLinkDistanceSensor getLastDistanceMessage()
+    {
+        std::lock_guard<std::mutex> guard(last_message_mutex_);
+        return last_distance_message_;
+    }
+
+    mavlinkcom::MavLinkHilGps getLastGpsMessage()
+    {
+        std::lock_guard<std::mutex> guard(last_message_mutex_);
+        return last_gps_message_;
+    }
+
     virtual bool armDisarm(bool arm) override
     {
         SingleCall lock(this);
@@ -874,6 +929,9 @@ private: //methods
         if (connection_info.use_serial) {
             createMavSerialConnection(connection_info.serial_port, connection_info.baud_rate);
         }
+        else if (connection_info.use_shared_memory) {
+            createMavSharedMemoryConnection(connection_info.shared_memory_name);
+        }
         else {
             createMavUdpConnection(connection_info.ip_address, connection_info.ip_port);
         }
@@ -920,6 +978,40 @@ private: //methods
         mav_vehicle_->startHeartbeat();
     }
 
+    void createMavSharedMemoryConnection(const std::string& name)
+    {
+        close();
+
+        if (name == "") {
+            throw std::invalid_argument("SharedMemoryName setting is invalid.");
+        }
+
+        addStatusMessage(Utils::stringf("Creating shared memory segment %s for HIL...", name.c_str()));
+        connection_ = mavlinkcom::MavLinkConnection::connectSharedMemory("hil", name, true);
+        hil_node_ = std::make_shared<mavlinkcom::MavLinkNode>(connection_info_.sim_sysid, connection_info_.sim_compid);
+        hil_node_->connect(connection_);
+        addStatusMessage(std::string("Waiting for SITL on shared memory."));
+
+        mav_vehicle_ = std::make_shared<mavlinkcom::MavLinkVehicle>(connection_info_.vehicle_sysid, connection_info_.vehicle_compid);
+
+        if (connection_info_.sitl_ip_address != "" && connection_info_.sitl_ip_port != 0) {
+            // same as UDP, the PX4 SITL app takes commands on a separate mavlink channel.
+            addStatusMessage(Utils::stringf("Connecting to PX4 SITL UDP port %d, local IP %s, remote IP %s...",
+                connection_info_.sitl_ip_port, connection_info_.local_host_ip.c_str(), connection_info_.sitl_ip_address.c_str()));
+
+            auto sitlconnection = mavlinkcom::MavLinkConnection::connectRemoteUdp("sitl",
+                connection_info_.local_host_ip, connection_info_.sitl_ip_address, connection_info_.sitl_ip_port);
+            mav_vehicle_->connect(sitlconnection);
+
+            addStatusMessage(std::string("Connected to SITL over UDP."));
+        }
+        else {
+            mav_vehicle_->connect(connection_);
+        }
+
+        mav_vehicle_->startHeartbeat();
+    }
+
     void createMavSerialConnection(const std::string& port_name, int baud_rate)
     {
         close();
@@ -952,24 +1044,6 @@ private: //methods
         mav_vehicle_->startHeartbeat();
     }
 
-    mavlinkcom::MavLinkHilSensor getLastSensorMessage()
-    {
-        std::lock_guard<std::mutex> guard(last_message_mutex_);
-        return last_sensor_message_;
-    }
-
-    mavlinkcom::MavLinkDistanceSensor getLastDistanceMessage()
-    {
-        std::lock_guard<std::mutex> guard(last_message_mutex_);
-        return last_distance_message_;
-    }
-
-    mavlinkcom::MavLinkHilGps getLastGpsMessage()
-    {
-        std::lock_guard<std::mutex> guard(last_message_mutex_);
-        return last_gps_message_;
-    }
-
     void setArmed(bool armed)
     {
         is_armed_ = armed;
@@ -1052,6 +1126,8 @@ private: //methods
                 rotor_controls_[7] = HilControlsMessage.aux4;
 
                 normalizeRotorControls();
+                last_controls_time_usec_ = HilControlsMessage.time_usec;
+                hil_controls_changed_.notify_all();
             }
         }
         else if (msg.msgid == HilActuatorControlsMessage.msgid) {
@@ -1065,17 +1141,26 @@ private: //methods
                 rotor_controls_[i] = HilActuatorControlsMessage.controls[i];
             }
             normalizeRotorControls();
+            last_controls_time_usec_ = HilActuatorControlsMessage.time_usec;
+            hil_controls_changed_.notify_all();
         }
         //else ignore message
     }
 
+    //encoded into the batch update() sends at the end of the step
+    void queueHILMessage(const mavlinkcom::MavLinkMessageBase& msg)
+    {
+        hil_messages_.emplace_back();
+        msg.encode(hil_messages_.back());
+    }
+
     void sendHILSensor(const Vector3r& acceleration, const Vector3r& gyro, const Vector3r& mag, float abs_pressure, float pressure_alt)
     {
         if (!is_simulation_mode_)
             throw std::logic_error("Attempt to send simulated sensor messages while not in simulation mode");
 
         mavlinkcom::MavLinkHilSensor hil_sensor;
-        hil_sensor.time_usec = static_cast<uint64_t>(Utils::getTimeSinceEpochNanos() / 1000.0);
+        hil_sensor.time_usec = hil_time_usec_;
 
         hil_sensor.xacc = acceleration.x();
         hil_sensor.yacc = acceleration.y();
@@ -1093,9 +1178,7 @@ private: //methods
         //TODO: enable temperature? diff_pressure
         hil_sensor.fields_updated = was_reset_ ? (1 << 31) : 0;
 
-        if (hil_node_ != nullptr) {
-            hil_node_->sendMessage(hil_sensor);
-        }
+        queueHILMessage(hil_sensor);
 
         std::lock_guard<std::mutex> guard(last_message_mutex_);
         last_sensor_message_ = hil_sensor;
@@ -1117,9 +1200,7 @@ private: //methods
         distance_sensor.orientation = static_cast<uint8_t>(orientation);
         //TODO: use covariance parameter?
 
-        if (hil_node_ != nullptr) {
-            hil_node_->sendMessage(distance_sensor);
-        }
+        queueHILMessage(distance_sensor);
 
         std::lock_guard<std::mutex> guard(last_message_mutex_);
         last_distance_message_ = distance_sensor;
@@ -1132,7 +1213,7 @@ private: //methods
             throw std::logic_error("Attempt to send simulated GPS messages while not in simulation mode");
 
         mavlinkcom::MavLinkHilGps hil_gps;
-        hil_gps.time_usec = static_cast<uint64_t>(Utils::getTimeSinceEpochNanos() / 1000.0);
+        hil_gps.time_usec = hil_time_usec_;
         hil_gps.lat = static_cast<int32_t>(geo_point.latitude * 1E7);
         hil_gps.lon = static_cast<int32_t>(geo_point.longitude* 1E7);
         hil_gps.alt = static_cast<int32_t>(geo_point.altitude * 1000);
@@ -1146,9 +1227,7 @@ private: //methods
         hil_gps.cog = static_cast<uint16_t>(cog * 100);
         hil_gps.satellites_visible = static_cast<uint8_t>(satellites_visible);
 
-        if (hil_node_ != nullptr) {
-            hil_node_->sendMessage(hil_gps);
-        }
+        queueHILMessage(hil_gps);
 
         if (hil_gps.lat < 0.1f && hil_gps.lat > -0.1f) {
             //Utils::DebugBreak();
@@ -1159,6 +1238,33 @@ private: //methods
         last_gps_message_ = hil_gps;
     }
 
+    //PX4 in lock-step answers each HIL_SENSOR with HIL_ACTUATOR_CONTROLS stamped with the same time_usec, so
+    //block until that answer is in and the physics step that follows uses controls computed from this
+    //sensor data.  Nothing to wait for until the firmware has sent its first controls.
+    void waitForControls(uint64_t time_usec)
+    {
+        std::unique_lock<std::mutex> lock(hil_controls_mutex_);
+        if (last_controls_time_usec_ == 0)
+            return;
+
+        ++lock_step_stats_.steps;
+        if (last_controls_time_usec_ < time_usec) {
+            auto start = std::chrono::steady_clock::now();
+            bool answered = hil_controls_changed_.wait_for(lock, std::chrono::milliseconds(connection_info_.lock_step_timeout_ms),
+                [&] { return last_controls_time_usec_ >= time_usec; });
+            uint64_t waited = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - start).count());
+            lock_step_stats_.wait_usec += waited;
+            lock_step_stats_.max_wait_usec = std::max(lock_step_stats_.max_wait_usec, waited);
+            if (!answered)
+                ++lock_step_stats_.stalls;
+        }
+        if (last_controls_time_usec_ < time_usec) {
+            ++lock_step_stats_.lagged_steps;
+            lock_step_stats_.max_lag_usec = std::max(lock_step_stats_.max_lag_usec, time_usec - last_controls_time_usec_);
+        }
+    }
+
     void resetState()
     {
         //reset state
@@ -1175,6 +1281,12 @@ private: //methods
         Utils::setValue(rotor_controls_, 0.0f);
         was_reset_ = false;
         mocap_pose_ = Pose::nanPose();
+        hil_time_usec_ = 0;
+        {
+            std::lock_guard<std::mutex> guard(hil_controls_mutex_);
+            last_controls_time_usec_ = 0;
+            lock_step_stats_ = LockStepStats();
+        }
     }
 
 
@@ -1204,6 +1316,8 @@ private: //variables
     size_t status_messages_MaxSize = 5000;
 
     std::shared_ptr<mavlinkcom::MavLinkNode> hil_node_;
+    //sensor messages of the current update(), only touched by the thread calling it
+    std::vector<mavlinkcom::MavLinkMessage> hil_messages_;
     std::shared_ptr<mavlinkcom::MavLinkConnection> connection_;
     std::shared_ptr<mavlinkcom::MavLinkVideoServer> video_server_;
     std::shared_ptr<MultirotorApiBase> mav_vehicle_control_;
@@ -1230,6 +1344,11 @@ private: //variables
     bool actuators_message_supported_;
     uint64_t last_gps_time_;
     bool was_reset_;
+    uint64_t hil_time_usec_ = 0; //time_usec of the sensor messages sent by this update
+    //lock-step state, guarded by hil_controls_mutex_
+    std::condition_variable hil_controls_changed_;
+    uint64_t last_controls_time_usec_ = 0;
+    LockStepStats lock_step_stats_;
     bool is_ready_;
     std::string is_ready_message_;
     Pose mocap_pose_;
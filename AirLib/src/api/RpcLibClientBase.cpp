@@ -14,6 +14,9 @@
 #include <functional>
 #include <vector>
 #include <thread>
+#include <mutex>
+#include <unordered_map>
+#include <fstream>
 STRICT_MODE_OFF
 
 #ifndef RPCLIB_MSGPACK
@@ -28,6 +31,7 @@ STRICT_MODE_OFF
 #undef FLOAT
 #undef check
 #include "rpc/client.h"
+#include "rpc/server.h"
 //TODO: HACK: UE4 defines macro with stupid names like "check" that conflicts with msgpack library
 #ifndef check
 #define check(expr) (static_cast<void>((expr)))
@@ -45,6 +49,8 @@ __pragma(warning( disable : 4239))
 
 namespace msr { namespace airlib {
 
+typedef std::function<void(const RPCLIB_MSGPACK::object&)> TopicHandler;
+
 struct RpcLibClientBase::impl {
     impl(const string&  ip_address, uint16_t port, float timeout_sec)
         : client(ip_address, port)
@@ -53,11 +59,159 @@ struct RpcLibClientBase::impl {
         client.set_timeout(static_cast<int64_t>(timeout_sec * 1.0E3));
     }
 
+    static constexpr uint16_t kTopicCallbackPortStart = 41551;
+    static constexpr uint16_t kTopicCallbackPortCount = 64;
+
+    ~impl()
+    {
+        //stop callback server before handlers it dispatches to go away
+        if (topic_server)
+            topic_server->stop();
+    }
+
+    //registers handler before asking server to start the stream so no samples are missed
+    template<typename... TArgs>
+    int subscribe(const std::string& method, const TopicHandler& handler, const TopicOptions& options, const TArgs&... args)
+    {
+        int client_topic_id;
+        uint16_t callback_port;
+        std::string callback_host;
+        {
+            std::lock_guard<std::mutex> locker(topic_mutex);
+            callback_port = startTopicServer();
+            callback_host = topic_callback_host;
+            client_topic_id = ++last_client_topic_id;
+            topic_handlers[client_topic_id] = handler;
+        }
+
+        try {
+            int server_topic_id = client.call(method, args..., msr::airlib_rpclib::RpcLibAdapatorsBase::TopicOptions(options),
+                callback_host, callback_port, client_topic_id).template as<int>();
+
+            std::lock_guard<std::mutex> locker(topic_mutex);
+            server_topic_ids[client_topic_id] = server_topic_id;
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> locker(topic_mutex);
+            topic_handlers.erase(client_topic_id);
+            throw;
+        }
+
+        return client_topic_id;
+    }
+
+    bool unsubscribe(int client_topic_id)
+    {
+        int server_topic_id;
+        {
+            std::lock_guard<std::mutex> locker(topic_mutex);
+            topic_handlers.erase(client_topic_id);
+            auto it = server_topic_ids.find(client_topic_id);
+            if (it == server_topic_ids.end())
+                return false;
+            server_topic_id = it->second;
+            server_topic_ids.erase(it);
+        }
+
+        return client.call("unsubscribeTopic", server_topic_id).as<bool>();
+    }
+
+    void openImageRing()
+    {
+        const auto& info = client.call("simGetSharedImageRingInfo").as<msr::airlib_rpclib::RpcLibAdapatorsBase::SharedImageRingInfo>();
+        if (info.name == "")
+            throw std::runtime_error("Simulator does not support shared memory image transport");
+        if (!image_ring.open(info.name))
+            throw std::runtime_error("Cannot open shared memory " + info.name + ", client must run on same machine as simulator");
+    }
+
+    //subscribe reads these under topic_mutex too, port only matters until callback server is started
+    void setTopicCallbackEndpoint(const std::string& host, uint16_t port)
+    {
+        std::lock_guard<std::mutex> locker(topic_mutex);
+        topic_callback_host = host;
+        topic_callback_port = port;
+    }
+
     rpc::client client;
+    SharedImageRing image_ring;
+
+private:
+    //must be called with topic_mutex held
+    uint16_t startTopicServer()
+    {
+        if (topic_server)
+            return topic_callback_port;
+
+        const uint16_t first_port = topic_callback_port != 0 ? topic_callback_port : kTopicCallbackPortStart;
+        const uint16_t port_count = topic_callback_port != 0 ? 1 : kTopicCallbackPortCount;
+        for (uint16_t port = first_port; port < first_port + port_count && !topic_server; ++port) {
+            try {
+                topic_server.reset(new rpc::server(port));
+                topic_callback_port = port;
+            }
+            catch (const std::exception&) {
+                //port in use, try next one
+            }
+        }
+        if (!topic_server)
+            throw std::runtime_error(Utils::stringf("Cannot start topic callback server on ports %u to %u",
+                first_port, first_port + port_count - 1));
+
+        topic_server->bind("onTopicSamples", [this](int client_topic_id, const RPCLIB_MSGPACK::object& batch) -> void {
+            TopicHandler handler;
+            {
+                std::lock_guard<std::mutex> locker(topic_mutex);
+                auto it = topic_handlers.find(client_topic_id);
+                if (it == topic_handlers.end())
+                    return;
+                handler = it->second;
+            }
+
+            //exceptions from user callback should not end the stream
+            try {
+                handler(batch);
+            }
+            catch (const std::exception& ex) {
+                Utils::log(Utils::stringf("Topic callback for subscription %d failed: %s", client_topic_id, ex.what()), Utils::kLogLevelWarn);
+            }
+        });
+        //single thread so callbacks of all subscriptions are serialized
+        topic_server->async_run(1);
+
+        return topic_callback_port;
+    }
+
+private:
+    std::mutex topic_mutex;
+    std::string topic_callback_host;
+    uint16_t topic_callback_port = 0;
+    int last_client_topic_id = 0;
+    std::unordered_map<int, TopicHandler> topic_handlers;
+    std::unordered_map<int, int> server_topic_ids;
+    std::unique_ptr<rpc::server> topic_server;
 };
 
 typedef msr::airlib_rpclib::RpcLibAdapatorsBase RpcLibAdapatorsBase;
 
+//decodes batch of adaptor samples and hands converted samples to user callback
+template<typename TAdaptor, typename T>
+static TopicHandler makeTopicHandler(const TopicCallback<T>& callback, 
+    const std::function<T(const TAdaptor&)>& convert)
+{
+    return [callback, convert](const RPCLIB_MSGPACK::object& batch) {
+        const auto& samples_adaptor = batch.as<std::vector<RpcLibAdapatorsBase::TopicSample<TAdaptor>>>();
+
+        std::vector<TopicSample<T>> samples(samples_adaptor.size());
+        for (size_t i = 0; i < samples_adaptor.size(); ++i) {
+            samples[i].time_stamp = samples_adaptor[i].time_stamp;
+            samples[i].data = convert(samples_adaptor[i].data);
+        }
+
+        callback(samples);
+    };
+}
+
 RpcLibClientBase::RpcLibClientBase(const string&  ip_address, uint16_t port, float timeout_sec)
 {
     pimpl_.reset(new impl(ip_address, port, timeout_sec));
@@ -184,6 +338,17 @@ Pose RpcLibClientBase::simGetVehiclePose(const std::string& vehicle_name) const
 {
     return pimpl_->client.call("simGetVehiclePose", vehicle_name).as<RpcLibAdapatorsBase::Pose>().to();
 }
+vector<Pose> RpcLibClientBase::simGetVehiclePoseBatch(const vector<std::string>& vehicle_names) const
+{
+    vector<Pose> poses;
+    //rpclib can't return empty vectors: https://github.com/rpclib/rpclib/issues/152
+    if (vehicle_names.size() == 0)
+        return poses;
+
+    const auto& poses_adaptor = pimpl_->client.call("simGetVehiclePoseBatch", vehicle_names).as<vector<RpcLibAdapatorsBase::Pose>>();
+    RpcLibAdapatorsBase::to(poses_adaptor, poses);
+    return poses;
+}
 void RpcLibClientBase::simSetVehiclePose(const Pose& pose, bool ignore_collision, const std::string& vehicle_name)
 {
     pimpl_->client.call("simSetVehiclePose", RpcLibAdapatorsBase::Pose(pose), ignore_collision, vehicle_name);
@@ -197,6 +362,31 @@ vector<ImageCaptureBase::ImageResponse> RpcLibClientBase::simGetImages(vector<Im
 
     return RpcLibAdapatorsBase::ImageResponse::to(response_adaptor);
 }
+vector<SharedImageResponse> RpcLibClientBase::simGetImagesShared(vector<ImageCaptureBase::ImageRequest> request, const std::string& vehicle_name)
+{
+    if (!pimpl_->image_ring.isOpen())
+        pimpl_->openImageRing();
+
+    const auto& response_adaptor = pimpl_->client.call("simGetImagesShared", 
+        RpcLibAdapatorsBase::ImageRequest::from(request), vehicle_name)
+        .as<vector<RpcLibAdapatorsBase::SharedImageResponse>>();
+
+    //simulator restarted and created new ring, our mapping still points at old one
+    if (response_adaptor.size() > 0 && response_adaptor[0].instance_id != pimpl_->image_ring.getInstanceId()) {
+        pimpl_->openImageRing();
+        if (response_adaptor[0].instance_id != pimpl_->image_ring.getInstanceId())
+            throw std::runtime_error("Shared memory " + pimpl_->image_ring.getName() + " was replaced while images were being read");
+    }
+
+    vector<SharedImageResponse> response;
+    for (const auto& item : response_adaptor)
+        response.push_back(item.to(pimpl_->image_ring));
+    return response;
+}
+bool RpcLibClientBase::isSharedImageCurrent(const SharedImageResponse& response) const
+{
+    return pimpl_->image_ring.isCurrent(response.descriptor);
+}
 vector<uint8_t> RpcLibClientBase::simGetImage(const std::string& camera_name, ImageCaptureBase::ImageType type, const std::string& vehicle_name)
 {
     vector<uint8_t> result = pimpl_->client.call("simGetImage", camera_name, type, vehicle_name).as<vector<uint8_t>>();
@@ -227,6 +417,43 @@ void RpcLibClientBase::simContinueForTime(double seconds)
     pimpl_->client.call("simContinueForTime", seconds);
 }
 
+void RpcLibClientBase::simStep(unsigned int steps)
+{
+    //server limits steps per call so it doesn't hold an RPC thread for too long
+    const unsigned int max_steps = WorldSimApiBase::kMaxStepsPerCall;
+    while (steps > 0) {
+        const unsigned int call_steps = std::min(steps, max_steps);
+        pimpl_->client.call("simStep", call_steps);
+        steps -= call_steps;
+    }
+}
+
+std::vector<TickProfiler::PhaseStats> RpcLibClientBase::simGetTickProfile() const
+{
+    const auto& stats_adaptor = pimpl_->client.call("simGetTickProfile").
+        as<std::vector<RpcLibAdapatorsBase::TickPhaseStats>>();
+
+    std::vector<TickProfiler::PhaseStats> stats;
+    RpcLibAdapatorsBase::to(stats_adaptor, stats);
+    return stats;
+}
+void RpcLibClientBase::simResetTickProfile()
+{
+    pimpl_->client.call("simResetTickProfile");
+}
+std::string RpcLibClientBase::simGetTickTrace() const
+{
+    return pimpl_->client.call("simGetTickTrace").as<std::string>();
+}
+bool RpcLibClientBase::simDumpTickTrace(const std::string& file_path) const
+{
+    std::ofstream file(file_path);
+    if (!file.is_open())
+        return false;
+    file << simGetTickTrace();
+    return file.good();
+}
+
 void RpcLibClientBase::simEnableWeather(bool enable)
 {
     pimpl_->client.call("simEnableWeather", enable);
@@ -265,6 +492,17 @@ msr::airlib::Kinematics::State RpcLibClientBase::simGetGroundTruthKinematics(con
 {
     return pimpl_->client.call("simGetGroundTruthKinematics", vehicle_name).as<RpcLibAdapatorsBase::KinematicsState>().to();
 }
+vector<msr::airlib::Kinematics::State> RpcLibClientBase::simGetGroundTruthKinematicsBatch(const vector<std::string>& vehicle_names) const
+{
+    vector<msr::airlib::Kinematics::State> states;
+    if (vehicle_names.size() == 0)
+        return states;
+
+    const auto& states_adaptor = pimpl_->client.call("simGetGroundTruthKinematicsBatch", vehicle_names)
+        .as<vector<RpcLibAdapatorsBase::KinematicsState>>();
+    RpcLibAdapatorsBase::to(states_adaptor, states);
+    return states;
+}
 msr::airlib::Environment::State RpcLibClientBase::simGetGroundTruthEnvironment(const std::string& vehicle_name) const
 {
     return pimpl_->client.call("simGetGroundTruthEnvironment", vehicle_name).as<RpcLibAdapatorsBase::EnvironmentState>().to();;
@@ -388,6 +626,42 @@ std::unordered_map<std::string, msr::airlib::Pose> RpcLibClientBase::simGetBoneP
     return r;
 }
 
+int RpcLibClientBase::subscribeKinematics(const TopicCallback<Kinematics::State>& callback, const TopicOptions& options)
+{
+    return pimpl_->subscribe("subscribeTopic", makeTopicHandler<RpcLibAdapatorsBase::KinematicsState, Kinematics::State>(callback,
+        [](const RpcLibAdapatorsBase::KinematicsState& d) { return d.to(); }), options, std::string("kinematics"));
+}
+int RpcLibClientBase::subscribeImu(const TopicCallback<ImuBase::Output>& callback, const TopicOptions& options)
+{
+    return pimpl_->subscribe("subscribeTopic", makeTopicHandler<RpcLibAdapatorsBase::ImuData, ImuBase::Output>(callback,
+        [](const RpcLibAdapatorsBase::ImuData& d) { return d.to(); }), options, std::string("imu"));
+}
+int RpcLibClientBase::subscribeGps(const TopicCallback<GpsBase::Output>& callback, const TopicOptions& options)
+{
+    return pimpl_->subscribe("subscribeTopic", makeTopicHandler<RpcLibAdapatorsBase::GpsData, GpsBase::Output>(callback,
+        [](const RpcLibAdapatorsBase::GpsData& d) { return d.to(); }), options, std::string("gps"));
+}
+int RpcLibClientBase::subscribeLidar(const TopicCallback<LidarData>& callback, const TopicOptions& options)
+{
+    return pimpl_->subscribe("subscribeTopic", makeTopicHandler<RpcLibAdapatorsBase::LidarData, LidarData>(callback,
+        [](const RpcLibAdapatorsBase::LidarData& d) { return d.to(); }), options, std::string("lidar"));
+}
+int RpcLibClientBase::subscribeImages(const vector<ImageCaptureBase::ImageRequest>& request,
+    const TopicCallback<vector<ImageCaptureBase::ImageResponse>>& callback, const TopicOptions& options)
+{
+    typedef vector<RpcLibAdapatorsBase::ImageResponse> ResponseAdaptor;
+    return pimpl_->subscribe("subscribeImages", makeTopicHandler<ResponseAdaptor, vector<ImageCaptureBase::ImageResponse>>(callback,
+        [](const ResponseAdaptor& d) { return RpcLibAdapatorsBase::ImageResponse::to(d); }), options,
+        RpcLibAdapatorsBase::ImageRequest::from(request));
+}
+bool RpcLibClientBase::unsubscribe(int subscription_id)
+{
+    return pimpl_->unsubscribe(subscription_id);
+}
+void RpcLibClientBase::setTopicCallbackEndpoint(const std::string& host, uint16_t port)
+{
+    pimpl_->setTopicCallbackEndpoint(host, port);
+}
 
 }} //namespace
 
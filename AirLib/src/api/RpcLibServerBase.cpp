@@ -11,6 +11,14 @@
 
 
 #include "common/Common.hpp"
+#include "common/Settings.hpp"
+#include "common/SharedImageRing.hpp"
+#include "common/ClockFactory.hpp"
+#include "common/common_utils/BoundedQueue.hpp"
+#include <thread>
+#include <atomic>
+#include <map>
+#include <condition_variable>
 STRICT_MODE_OFF
 
 #ifndef RPCLIB_MSGPACK
@@ -23,6 +31,7 @@ STRICT_MODE_OFF
 #undef FLOAT
 #undef check
 #include "rpc/server.h"
+#include "rpc/client.h"
 //TODO: HACK: UE4 defines macro with stupid names like "check" that conflicts with msgpack library
 #ifndef check
 #define check(expr) (static_cast<void>((expr)))
@@ -36,22 +45,346 @@ STRICT_MODE_ON
 
 namespace msr { namespace airlib {
 
+typedef msr::airlib_rpclib::RpcLibAdapatorsBase RpcLibAdapatorsBase;
+
+/*
+Server side of one topic subscription. Sampler thread calls sampler at requested rate and
+pushes timestamped samples in to bounded queue, sender thread drains queue in batches and
+calls "onTopicSamples" on client's callback server over its own connection so slow
+subscribers never hold up API server threads. When client is slower than sampling rate,
+queue applies overflow policy: DropOldest keeps latest samples, Block slows down sampler.
+Stream stops itself if client can't be reached and then calls on_stopped so the owner can
+join its threads.
+*/
+class TopicStreamBase {
+public:
+    virtual ~TopicStreamBase() = default;
+    virtual void stop() = 0;
+    virtual bool isRunning() const = 0;
+    //host:port of the subscriber's callback server, identifies the client for subscription limits
+    virtual const std::string& getCallbackEndpoint() const = 0;
+};
+
+template<typename TData>
+class TopicStream : public TopicStreamBase {
+public:
+    typedef RpcLibAdapatorsBase::TopicSample<TData> Sample;
+    static constexpr int64_t kSendTimeoutMillis = 5000;
+
+    TopicStream(const std::function<TData()>& sampler, const TopicOptions& options,
+        const std::string& callback_host, uint16_t callback_port, int client_topic_id,
+        const std::function<void()>& on_stopped)
+        : sampler_(sampler), options_(options), queue_(options.queue_size, options.overflow_policy),
+        client_(callback_host, callback_port), client_topic_id_(client_topic_id),
+        callback_endpoint_(callback_host + ":" + std::to_string(callback_port)), on_stopped_(on_stopped)
+    {
+        if (options_.rate_hz <= 0)
+            options_.rate_hz = 1;
+        if (options_.max_batch == 0)
+            options_.max_batch = 1;
+
+        client_.set_timeout(kSendTimeoutMillis);
+
+        is_running_ = true;
+        sampler_thread_ = std::thread(&TopicStream::samplerLoop, this);
+        sender_thread_ = std::thread(&TopicStream::senderLoop, this);
+    }
+
+    virtual ~TopicStream() override
+    {
+        stop();
+        if (sampler_thread_.joinable())
+            sampler_thread_.join();
+        if (sender_thread_.joinable())
+            sender_thread_.join();
+    }
+
+    virtual void stop() override
+    {
+        is_running_ = false;
+        queue_.close();
+    }
+
+    virtual bool isRunning() const override
+    {
+        return is_running_;
+    }
+
+    virtual const std::string& getCallbackEndpoint() const override
+    {
+        return callback_endpoint_;
+    }
+
+private:
+    //called from our own threads, so they can't be joined here
+    void stopSelf()
+    {
+        if (is_running_.exchange(false)) {
+            queue_.close();
+            if (on_stopped_)
+                on_stopped_();
+        }
+    }
+
+    void samplerLoop()
+    {
+        const auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(1.0 / options_.rate_hz));
+        auto next_sample = std::chrono::steady_clock::now();
+
+        while (is_running_) {
+            try {
+                TData data = sampler_();
+                if (!queue_.push(Sample(ClockFactory::get()->nowNanos(), data)))
+                    break;
+            }
+            catch (const std::exception& ex) {
+                Utils::log(Utils::stringf("Topic stream %d stopped: %s", client_topic_id_, ex.what()), Utils::kLogLevelWarn);
+                stopSelf();
+                break;
+            }
+
+            //absolute schedule so time taken by sampler doesn't lower the rate,
+            //if we fell behind (for example because of Block policy) we don't try to catch up
+            next_sample += period;
+            auto now = std::chrono::steady_clock::now();
+            if (next_sample < now)
+                next_sample = now;
+            else
+                std::this_thread::sleep_until(next_sample);
+        }
+    }
+
+    void senderLoop()
+    {
+        std::vector<Sample> batch;
+        batch.reserve(options_.max_batch);
+        while (queue_.popBatch(batch, options_.max_batch)) {
+            try {
+                client_.call("onTopicSamples", client_topic_id_, batch);
+            }
+            catch (const std::exception& ex) {
+                Utils::log(Utils::stringf("Topic stream %d lost its subscriber: %s", client_topic_id_, ex.what()), Utils::kLogLevelWarn);
+                stopSelf();
+                break;
+            }
+        }
+    }
+
+private:
+    std::function<TData()> sampler_;
+    TopicOptions options_;
+    common_utils::BoundedQueue<Sample> queue_;
+    rpc::client client_;
+    int client_topic_id_;
+    std::string callback_endpoint_;
+    std::function<void()> on_stopped_;
+    std::atomic<bool> is_running_;
+    std::thread sampler_thread_;
+    std::thread sender_thread_;
+};
+
 struct RpcLibServerBase::impl {
     impl(string server_address, uint16_t port)
-        : server(server_address, port)
+        : server(server_address, port), port_(port)
     {}
 
     impl(uint16_t port)
-        : server(port)
+        : server(port), port_(port)
     {}
 
     ~impl() {
+        //streams are joined first so none of them can signal the reaper after it is gone
+        stopTopicStreams();
+
+        {
+            std::lock_guard<std::mutex> locker(topic_mutex_);
+            reaper_stop_ = true;
+        }
+        topic_stopped_.notify_one();
+        if (reaper_thread_.joinable())
+            reaper_thread_.join();
+    }
+
+    //ring is created on first use so servers which never get shared image requests don't reserve memory
+    SharedImageRing* getImageRing()
+    {
+        std::lock_guard<std::mutex> locker(image_ring_mutex_);
+
+        if (!image_ring_.isOpen() && !image_ring_failed_) {
+            uint32_t slot_count = SharedImageRing::kDefaultSlotCount;
+            uint64_t slot_size = SharedImageRing::kDefaultSlotSize;
+            Settings ring_settings;
+            if (Settings::singleton().getChild("ImageSharedMemory", ring_settings)) {
+                slot_count = static_cast<uint32_t>(ring_settings.getInt("SlotCount", static_cast<int>(slot_count)));
+                slot_size = static_cast<uint64_t>(ring_settings.getInt("SlotSizeMB", static_cast<int>(slot_size >> 20))) << 20;
+            }
+
+            image_ring_failed_ = !image_ring_.create("/airsim_images_" + std::to_string(port_), slot_count, slot_size);
+        }
+
+        return image_ring_.isOpen() ? &image_ring_ : nullptr;
+    }
+
+    /*
+    rpclib doesn't tell handlers the address of the caller, so the server would connect to whatever
+    host a client names. Only loopback is allowed unless the host is listed in the comma separated
+    TopicCallbackHosts setting, otherwise any client could make the simulator open connections
+    to other machines.
+    */
+    static bool isAllowedCallbackHost(const std::string& host)
+    {
+        if (host == "localhost" || host == "::1" || Utils::startsWith(host, "127."))
+            return true;
+
+        const std::string allowed = Settings::singleton().getString("TopicCallbackHosts", "");
+        for (const auto& item : Utils::split(allowed, ", ", 2)) {
+            if (item == host)
+                return true;
+        }
+        return false;
+    }
+
+    /*
+    rpclib doesn't tell us who is calling so each client is told apart by the callback endpoint it
+    gives, subscriptions over TopicMaxSubscriptionsPerClient for one endpoint or over
+    TopicMaxSubscriptions in total are rejected.
+    */
+    static void checkTopicLimits(const std::map<int, std::unique_ptr<TopicStreamBase>>& streams, const std::string& endpoint)
+    {
+        const int max_total = Settings::singleton().getInt("TopicMaxSubscriptions", kDefaultMaxTopicStreams);
+        const int max_per_client = Settings::singleton().getInt("TopicMaxSubscriptionsPerClient", kDefaultMaxTopicStreamsPerClient);
+
+        if (static_cast<int>(streams.size()) >= max_total)
+            throw std::runtime_error(Utils::stringf("Topic subscription rejected, server already has %d subscriptions", max_total));
+
+        int client_count = 0;
+        for (const auto& stream : streams) {
+            if (stream.second->getCallbackEndpoint() == endpoint)
+                ++client_count;
+        }
+        if (client_count >= max_per_client)
+            throw std::runtime_error(Utils::stringf("Topic subscription rejected, client %s already has %d subscriptions",
+                endpoint.c_str(), max_per_client));
+    }
+
+    //sampler is called once here so bad vehicle or sensor name is reported to subscriber right away
+    template<typename TData>
+    int addTopicStream(const std::function<TData()>& sampler, const RpcLibAdapatorsBase::TopicOptions& options,
+        const std::string& callback_host, uint16_t callback_port, int client_topic_id)
+    {
+        const std::string host = callback_host == "" ? "127.0.0.1" : callback_host;
+        if (!isAllowedCallbackHost(host))
+            throw std::invalid_argument("Topic callback host '" + host + "' is not loopback or listed in TopicCallbackHosts setting");
+
+        const std::string endpoint = host + ":" + std::to_string(callback_port);
+        {
+            //stopped streams are joined by reaper so they don't count against limits for long
+            std::lock_guard<std::mutex> locker(topic_mutex_);
+            checkTopicLimits(topic_streams_, endpoint);
+        }
+
+        sampler();
+
+        //declared before lock so rejected stream is joined after lock is released
+        std::unique_ptr<TopicStreamBase> stream(new TopicStream<TData>(sampler, options.to(),
+            host, callback_port, client_topic_id, [this]() { onTopicStreamStopped(); }));
+
+        std::lock_guard<std::mutex> locker(topic_mutex_);
+        //checked again as other subscriptions may have been added while stream was starting
+        checkTopicLimits(topic_streams_, endpoint);
+        if (!reaper_thread_.joinable())
+            reaper_thread_ = std::thread(&impl::reapTopicStreams, this);
+        const int topic_id = ++last_topic_id_;
+        topic_streams_[topic_id] = std::move(stream);
+        return topic_id;
+    }
+
+    bool removeTopicStream(int topic_id)
+    {
+        std::unique_ptr<TopicStreamBase> stream;
+        {
+            std::lock_guard<std::mutex> locker(topic_mutex_);
+            auto it = topic_streams_.find(topic_id);
+            if (it == topic_streams_.end())
+                return false;
+            stream = std::move(it->second);
+            topic_streams_.erase(it);
+        }
+        //joins stream threads outside of lock
+        return stream != nullptr;
+    }
+
+    void stopTopicStreams()
+    {
+        std::map<int, std::unique_ptr<TopicStreamBase>> streams;
+        {
+            std::lock_guard<std::mutex> locker(topic_mutex_);
+            streams.swap(topic_streams_);
+        }
+        for (auto& stream : streams)
+            stream.second->stop();
     }
 
     rpc::server server;
-};
 
-typedef msr::airlib_rpclib::RpcLibAdapatorsBase RpcLibAdapatorsBase;
+private:
+    static constexpr int kDefaultMaxTopicStreams = 64;
+    static constexpr int kDefaultMaxTopicStreamsPerClient = 16;
+
+    //called by stream threads, a stream can't join its own threads so reaper does it
+    void onTopicStreamStopped()
+    {
+        {
+            std::lock_guard<std::mutex> locker(topic_mutex_);
+            has_stopped_streams_ = true;
+        }
+        topic_stopped_.notify_one();
+    }
+
+    void reapTopicStreams()
+    {
+        std::unique_lock<std::mutex> locker(topic_mutex_);
+        while (!reaper_stop_) {
+            topic_stopped_.wait(locker, [this]() { return reaper_stop_ || has_stopped_streams_; });
+            has_stopped_streams_ = false;
+
+            std::vector<std::unique_ptr<TopicStreamBase>> stopped;
+            takeStoppedTopicStreams(stopped);
+            //joins stream threads outside of lock
+            locker.unlock();
+            stopped.clear();
+            locker.lock();
+        }
+    }
+
+    //caller must hold topic_mutex_ and destroy stopped streams after releasing it
+    void takeStoppedTopicStreams(std::vector<std::unique_ptr<TopicStreamBase>>& stopped)
+    {
+        for (auto it = topic_streams_.begin(); it != topic_streams_.end();) {
+            if (!it->second->isRunning()) {
+                stopped.push_back(std::move(it->second));
+                it = topic_streams_.erase(it);
+            }
+            else
+                ++it;
+        }
+    }
+
+private:
+    uint16_t port_;
+    SharedImageRing image_ring_;
+    bool image_ring_failed_ = false;
+    std::mutex image_ring_mutex_;
+
+    std::map<int, std::unique_ptr<TopicStreamBase>> topic_streams_;
+    int last_topic_id_ = 0;
+    std::mutex topic_mutex_;
+    std::condition_variable topic_stopped_;
+    bool has_stopped_streams_ = false;
+    bool reaper_stop_ = false;
+    std::thread reaper_thread_;
+};
 
 RpcLibServerBase::RpcLibServerBase(ApiProvider* api_provider, const std::string& server_address, uint16_t port)
     : api_provider_(api_provider)
@@ -77,6 +410,22 @@ RpcLibServerBase::RpcLibServerBase(ApiProvider* api_provider, const std::string&
     pimpl_->server.bind("simContinueForTime", [&](double seconds) -> void { 
         getWorldSimApi()->continueForTime(seconds); 
     });
+    pimpl_->server.bind("simStep", [&](unsigned int steps) -> void { 
+        if (steps > WorldSimApiBase::kMaxStepsPerCall)
+            throw std::invalid_argument(Utils::stringf("simStep accepts at most %u steps per call, %u were requested",
+                WorldSimApiBase::kMaxStepsPerCall, steps));
+        getWorldSimApi()->step(steps); 
+    });
+    pimpl_->server.bind("simGetTickProfile", []() -> std::vector<RpcLibAdapatorsBase::TickPhaseStats> {
+        return RpcLibAdapatorsBase::TickPhaseStats::from(TickProfiler::singleton().getPhaseStats());
+    });
+    pimpl_->server.bind("simResetTickProfile", []() -> void {
+        TickProfiler::singleton().clear();
+    });
+    //the client saves the trace, RPC callers don't get to write files on the simulator machine
+    pimpl_->server.bind("simGetTickTrace", []() -> std::string {
+        return TickProfiler::singleton().getChromeTrace();
+    });
 
     pimpl_->server.bind("simSetTimeOfDay", [&](bool is_enabled, const string& start_datetime, bool is_start_datetime_dst, 
         float celestial_clock_speed, float update_interval_secs, bool move_sun) -> void {
@@ -106,6 +455,41 @@ RpcLibServerBase::RpcLibServerBase(ApiProvider* api_provider, const std::string&
             const auto& response = getVehicleSimApi(vehicle_name)->getImages(RpcLibAdapatorsBase::ImageRequest::to(request_adapter));
             return RpcLibAdapatorsBase::ImageResponse::from(response);
     });
+    pimpl_->server.bind("simGetSharedImageRingInfo", [&]() -> RpcLibAdapatorsBase::SharedImageRingInfo {
+        RpcLibAdapatorsBase::SharedImageRingInfo info;
+        const SharedImageRing* ring = pimpl_->getImageRing();
+        if (ring) {
+            info.name = ring->getName();
+            info.slot_count = ring->getSlotCount();
+            info.slot_size = ring->getSlotSize();
+            info.instance_id = ring->getInstanceId();
+        }
+        return info;
+    });
+    pimpl_->server.bind("simGetImagesShared", [&](const std::vector<RpcLibAdapatorsBase::ImageRequest>& request_adapter, const std::string& vehicle_name) -> 
+        vector<RpcLibAdapatorsBase::SharedImageResponse> {
+            const auto& response = getVehicleSimApi(vehicle_name)->getImages(RpcLibAdapatorsBase::ImageRequest::to(request_adapter));
+
+            SharedImageRing* ring = pimpl_->getImageRing();
+            if (!ring)
+                throw ApiNotSupported("Shared memory image transport is not available on this server");
+
+            vector<RpcLibAdapatorsBase::SharedImageResponse> response_adapter;
+            for (const auto& item : response) {
+                const void* data = item.pixels_as_float ? static_cast<const void*>(item.image_data_float.data()) 
+                    : static_cast<const void*>(item.image_data_uint8.data());
+                uint64_t size = item.pixels_as_float ? item.image_data_float.size() * sizeof(float) : item.image_data_uint8.size();
+
+                SharedImageRing::Descriptor descriptor;
+                if (!ring->write(data, size, descriptor))
+                    throw std::runtime_error(Utils::stringf("Image of %llu bytes does not fit in shared memory slot of %llu bytes",
+                        static_cast<unsigned long long>(size), static_cast<unsigned long long>(ring->getSlotSize())));
+
+                response_adapter.push_back(RpcLibAdapatorsBase::SharedImageResponse(item, descriptor));
+            }
+
+            return response_adapter;
+    });
     pimpl_->server.bind("simGetImage", [&](const std::string& camera_name, ImageCaptureBase::ImageType type, const std::string& vehicle_name) -> vector<uint8_t> {
         auto result = getVehicleSimApi(vehicle_name)->getImage(camera_name, type);
         if (result.size() == 0) {
@@ -152,7 +536,48 @@ RpcLibServerBase::RpcLibServerBase(ApiProvider* api_provider, const std::string&
 
     pimpl_->server.bind("getLidarData", [&](const std::string& lidar_name, const std::string& vehicle_name) -> RpcLibAdapatorsBase::LidarData {
         const auto& lidar_data = getVehicleApi(vehicle_name)->getLidarData(lidar_name);
-        return RpcLibAdapatorsBase::LidarData(lidar_data);
+        return RpcLibAdapatorsBase::LidarData(*lidar_data);
+    });
+
+    pimpl_->server.bind("subscribeTopic", [&](const std::string& topic, const RpcLibAdapatorsBase::TopicOptions& options,
+        const std::string& callback_host, uint16_t callback_port, int client_topic_id) -> int {
+        const std::string vehicle_name = options.vehicle_name;
+        const std::string sensor_name = options.sensor_name;
+
+        if (topic == "kinematics") {
+            return pimpl_->addTopicStream<RpcLibAdapatorsBase::KinematicsState>([this, vehicle_name]() {
+                return RpcLibAdapatorsBase::KinematicsState(*getVehicleSimApi(vehicle_name)->getGroundTruthKinematics());
+            }, options, callback_host, callback_port, client_topic_id);
+        }
+        else if (topic == "imu") {
+            return pimpl_->addTopicStream<RpcLibAdapatorsBase::ImuData>([this, vehicle_name, sensor_name]() {
+                return RpcLibAdapatorsBase::ImuData(getVehicleApi(vehicle_name)->getImuData(sensor_name));
+            }, options, callback_host, callback_port, client_topic_id);
+        }
+        else if (topic == "gps") {
+            return pimpl_->addTopicStream<RpcLibAdapatorsBase::GpsData>([this, vehicle_name, sensor_name]() {
+                return RpcLibAdapatorsBase::GpsData(getVehicleApi(vehicle_name)->getGpsData(sensor_name));
+            }, options, callback_host, callback_port, client_topic_id);
+        }
+        else if (topic == "lidar") {
+            return pimpl_->addTopicStream<RpcLibAdapatorsBase::LidarData>([this, vehicle_name, sensor_name]() {
+                return RpcLibAdapatorsBase::LidarData(*getVehicleApi(vehicle_name)->getLidarData(sensor_name));
+            }, options, callback_host, callback_port, client_topic_id);
+        }
+        else
+            throw ApiNotSupported("Topic '" + topic + "' is not supported");
+    });
+    pimpl_->server.bind("subscribeImages", [&](const std::vector<RpcLibAdapatorsBase::ImageRequest>& request_adapter, 
+        const RpcLibAdapatorsBase::TopicOptions& options, const std::string& callback_host, uint16_t callback_port, int client_topic_id) -> int {
+        const std::vector<ImageCaptureBase::ImageRequest> request = RpcLibAdapatorsBase::ImageRequest::to(request_adapter);
+        const std::string vehicle_name = options.vehicle_name;
+
+        return pimpl_->addTopicStream<std::vector<RpcLibAdapatorsBase::ImageResponse>>([this, request, vehicle_name]() {
+            return RpcLibAdapatorsBase::ImageResponse::from(getVehicleSimApi(vehicle_name)->getImages(request));
+        }, options, callback_host, callback_port, client_topic_id);
+    });
+    pimpl_->server.bind("unsubscribeTopic", [&](int topic_id) -> bool {
+        return pimpl_->removeTopicStream(topic_id);
     });
 
     pimpl_->server.bind("simGetCameraInfo", [&](const std::string& camera_name, const std::string& vehicle_name) -> RpcLibAdapatorsBase::CameraInfo {
@@ -183,6 +608,21 @@ RpcLibServerBase::RpcLibServerBase(ApiProvider* api_provider, const std::string&
         return RpcLibAdapatorsBase::KinematicsState(result);
     });
 
+    pimpl_->server.bind("simGetGroundTruthKinematicsBatch", [&](const std::vector<std::string>& vehicle_names) -> 
+        std::vector<RpcLibAdapatorsBase::KinematicsState> {
+        std::vector<RpcLibAdapatorsBase::KinematicsState> result;
+        for (const auto* api : getVehicleSimApis(vehicle_names))
+            result.push_back(RpcLibAdapatorsBase::KinematicsState(*api->getGroundTruthKinematics()));
+        return result;
+    });
+    pimpl_->server.bind("simGetVehiclePoseBatch", [&](const std::vector<std::string>& vehicle_names) -> 
+        std::vector<RpcLibAdapatorsBase::Pose> {
+        std::vector<RpcLibAdapatorsBase::Pose> result;
+        for (const auto* api : getVehicleSimApis(vehicle_names))
+            result.push_back(RpcLibAdapatorsBase::Pose(api->getPose()));
+        return result;
+    });
+
     pimpl_->server.bind("simGetGroundTruthEnvironment", [&](const std::string& vehicle_name) -> RpcLibAdapatorsBase::EnvironmentState {
         const Environment::State& result = (*getVehicleSimApi(vehicle_name)->getGroundTruthEnvironment()).getState();
         return RpcLibAdapatorsBase::EnvironmentState(result);
@@ -275,6 +715,7 @@ void RpcLibServerBase::start(bool block, std::size_t thread_count)
 
 void RpcLibServerBase::stop()
 {
+    pimpl_->stopTopicStreams();
     pimpl_->server.stop();
 }
 
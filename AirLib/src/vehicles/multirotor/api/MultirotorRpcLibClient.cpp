@@ -168,6 +168,44 @@ MultirotorState MultirotorRpcLibClient::getMultirotorState(const std::string& ve
     return static_cast<rpc::client*>(getClient())->call("getMultirotorState", vehicle_name).
         as<MultirotorRpcLibAdapators::MultirotorState>().to();
 }
+vector<MultirotorState> MultirotorRpcLibClient::getMultirotorStateBatch(const vector<std::string>& vehicle_names)
+{
+    vector<MultirotorState> states;
+    //rpclib can't return empty vectors: https://github.com/rpclib/rpclib/issues/152
+    if (vehicle_names.size() == 0)
+        return states;
+
+    const auto& states_adaptor = static_cast<rpc::client*>(getClient())->call("getMultirotorStateBatch", vehicle_names).
+        as<vector<MultirotorRpcLibAdapators::MultirotorState>>();
+    MultirotorRpcLibAdapators::to(states_adaptor, states);
+    return states;
+}
+
+MultirotorRpcLibClient* MultirotorRpcLibClient::moveByVelocityBatchAsync(const vector<VelocityCommand>& commands, float duration,
+    DrivetrainType drivetrain, const vector<std::string>& vehicle_names)
+{
+    vector<MultirotorRpcLibAdapators::VelocityCommand> commands_adaptor;
+    MultirotorRpcLibAdapators::from(commands, commands_adaptor);
+    pimpl_->last_future = static_cast<rpc::client*>(getClient())->async_call("moveByVelocityBatch", commands_adaptor, duration,
+        drivetrain, vehicle_names);
+    return this;
+}
+MultirotorRpcLibClient* MultirotorRpcLibClient::moveByAngleZBatchAsync(const vector<AngleZCommand>& commands, float duration,
+    const vector<std::string>& vehicle_names)
+{
+    vector<MultirotorRpcLibAdapators::AngleZCommand> commands_adaptor;
+    MultirotorRpcLibAdapators::from(commands, commands_adaptor);
+    pimpl_->last_future = static_cast<rpc::client*>(getClient())->async_call("moveByAngleZBatch", commands_adaptor, duration, vehicle_names);
+    return this;
+}
+MultirotorRpcLibClient* MultirotorRpcLibClient::moveByAngleThrottleBatchAsync(const vector<AngleThrottleCommand>& commands, float duration,
+    const vector<std::string>& vehicle_names)
+{
+    vector<MultirotorRpcLibAdapators::AngleThrottleCommand> commands_adaptor;
+    MultirotorRpcLibAdapators::from(commands, commands_adaptor);
+    pimpl_->last_future = static_cast<rpc::client*>(getClient())->async_call("moveByAngleThrottleBatch", commands_adaptor, duration, vehicle_names);
+    return this;
+}
 
 void MultirotorRpcLibClient::moveByRC(const RCData& rc_data, const std::string& vehicle_name)
 {
@@ -11,6 +11,11 @@
 
 
 #include "common/Common.hpp"
+#include "common/Settings.hpp"
+#include "common/common_utils/ctpl_stl.h"
+#include <future>
+#include <thread>
+#include <unordered_map>
 STRICT_MODE_OFF
 
 #ifndef RPCLIB_MSGPACK
@@ -38,9 +43,90 @@ namespace msr { namespace airlib {
 
 typedef msr::airlib_rpclib::MultirotorRpcLibAdapators MultirotorRpcLibAdapators;
 
+struct MultirotorRpcLibServer::impl {
+    /*
+    Move commands block for their duration so commands of a batch call run in parallel on
+    a thread pool, one thread per command so every vehicle starts moving at once. Each vehicle
+    runs one command at a time, a new one cancels the last, so the pool never needs more threads
+    than there are vehicles and is bounded by ApiBatchThreads or the vehicle count, whichever is
+    larger. Commands of an older batch that haven't started yet when a newer batch for the same
+    vehicle arrives are skipped so they can't override the newer command.
+    */
+    impl(int thread_count, const ApiProvider* api_provider)
+        : api_provider_(api_provider)
+    {
+        min_threads_ = thread_count > 0 ? static_cast<size_t>(thread_count) : 
+            std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        pool_.resize(static_cast<int>(min_threads_));
+    }
+
+    bool runBatch(const std::vector<MultirotorApiBase*>& apis, const std::function<bool(MultirotorApiBase*, size_t)>& command)
+    {
+        std::vector<std::future<bool>> results;
+        results.reserve(apis.size());
+        {
+            std::lock_guard<std::mutex> locker(pool_mutex_);
+            size_t needed = std::max(min_threads_, std::min(apis.size(), api_provider_->getVehicleCount()));
+            if (needed > static_cast<size_t>(pool_.size()))
+                pool_.resize(static_cast<int>(needed));
+
+            for (size_t i = 0; i < apis.size(); ++i) {
+                uint64_t generation = ++generations_[apis[i]];
+                //cancel task still running from previous batch so its pool thread frees up right away
+                apis[i]->cancelLastTask();
+                results.push_back(pool_.push([this, &apis, &command, i, generation](int) {
+                    return isLatest(apis[i], generation) && command(apis[i], i);
+                }));
+            }
+        }
+
+        bool result = true;
+        std::string error;
+        for (auto& item : results) {
+            try {
+                result = item.get() && result;
+            }
+            catch (const std::exception& ex) {
+                if (error == "")
+                    error = ex.what();
+                result = false;
+            }
+        }
+
+        if (error != "")
+            throw std::runtime_error(error);
+        return result;
+    }
+
+    template<typename TCommand>
+    static void checkBatchSize(const std::vector<TCommand>& commands, const std::vector<std::string>& vehicle_names)
+    {
+        if (commands.size() != vehicle_names.size())
+            throw std::invalid_argument(Utils::stringf("Batch has %u commands for %u vehicles",
+                static_cast<unsigned int>(commands.size()), static_cast<unsigned int>(vehicle_names.size())));
+    }
+
+private:
+    bool isLatest(MultirotorApiBase* api, uint64_t generation)
+    {
+        std::lock_guard<std::mutex> locker(pool_mutex_);
+        return generations_[api] == generation;
+    }
+
+private:
+    const ApiProvider* api_provider_;
+    size_t min_threads_;
+    ctpl::thread_pool pool_;
+    //number of commands issued to each vehicle, a queued command runs only if it is still the latest
+    std::unordered_map<MultirotorApiBase*, uint64_t> generations_;
+    std::mutex pool_mutex_;
+};
+
 MultirotorRpcLibServer::MultirotorRpcLibServer(ApiProvider* api_provider, string server_address, uint16_t port)
         : RpcLibServerBase(api_provider, server_address, port)
 {
+    pimpl_.reset(new impl(Settings::singleton().getInt("ApiBatchThreads", 0), api_provider));
+
     (static_cast<rpc::server*>(getServer()))->
         bind("takeoff", [&](float timeout_sec, const std::string& vehicle_name) -> bool { 
         return getVehicleApi(vehicle_name)->takeoff(timeout_sec); 
@@ -125,11 +211,50 @@ MultirotorRpcLibServer::MultirotorRpcLibServer(ApiProvider* api_provider, string
         bind("getMultirotorState", [&](const std::string& vehicle_name) -> MultirotorRpcLibAdapators::MultirotorState {
         return MultirotorRpcLibAdapators::MultirotorState(getVehicleApi(vehicle_name)->getMultirotorState()); 
     });
+
+    //batch versions take one command per vehicle and make single round trip for whole swarm
+    (static_cast<rpc::server*>(getServer()))->
+        bind("moveByVelocityBatch", [&](const std::vector<MultirotorRpcLibAdapators::VelocityCommand>& commands, float duration, 
+            DrivetrainType drivetrain, const std::vector<std::string>& vehicle_names) -> bool {
+        impl::checkBatchSize(commands, vehicle_names);
+        return pimpl_->runBatch(getMultirotorApis(vehicle_names), [&](MultirotorApiBase* api, size_t i) {
+            const auto& command = commands[i];
+            return api->moveByVelocity(command.vx, command.vy, command.vz, duration, drivetrain, command.yaw_mode.to());
+        });
+    });
+    (static_cast<rpc::server*>(getServer()))->
+        bind("moveByAngleZBatch", [&](const std::vector<MultirotorRpcLibAdapators::AngleZCommand>& commands, float duration, 
+            const std::vector<std::string>& vehicle_names) -> bool {
+        impl::checkBatchSize(commands, vehicle_names);
+        return pimpl_->runBatch(getMultirotorApis(vehicle_names), [&](MultirotorApiBase* api, size_t i) {
+            const auto& command = commands[i];
+            return api->moveByAngleZ(command.pitch, command.roll, command.z, command.yaw, duration);
+        });
+    });
+    (static_cast<rpc::server*>(getServer()))->
+        bind("moveByAngleThrottleBatch", [&](const std::vector<MultirotorRpcLibAdapators::AngleThrottleCommand>& commands, float duration, 
+            const std::vector<std::string>& vehicle_names) -> bool {
+        impl::checkBatchSize(commands, vehicle_names);
+        return pimpl_->runBatch(getMultirotorApis(vehicle_names), [&](MultirotorApiBase* api, size_t i) {
+            const auto& command = commands[i];
+            return api->moveByAngleThrottle(command.pitch, command.roll, command.throttle, command.yaw_rate, duration);
+        });
+    });
+    (static_cast<rpc::server*>(getServer()))->
+        bind("getMultirotorStateBatch", [&](const std::vector<std::string>& vehicle_names) -> 
+            std::vector<MultirotorRpcLibAdapators::MultirotorState> {
+        std::vector<MultirotorRpcLibAdapators::MultirotorState> result;
+        for (auto* api : getMultirotorApis(vehicle_names))
+            result.push_back(MultirotorRpcLibAdapators::MultirotorState(api->getMultirotorState()));
+        return result;
+    });
 }
 
 //required for pimpl
 MultirotorRpcLibServer::~MultirotorRpcLibServer()
 {
+    //no more calls may reach batch thread pool once it is gone
+    stop();
 }
 
 
@@ -0,0 +1,61 @@
+#ifndef msr_AirLibBenchmarks_BatchPhysicsEngineBenchmark_hpp
+#define msr_AirLibBenchmarks_BatchPhysicsEngineBenchmark_hpp
+
+#include "BenchmarkBase.hpp"
+#include "BoxBody.hpp"
+#include "physics/PhysicsWorld.hpp"
+#include "physics/FastPhysicsEngine.hpp"
+#include "physics/BatchPhysicsEngine.hpp"
+#include "common/SteppableClock.hpp"
+
+namespace msr { namespace airlib {
+
+//Body updates/sec of FastPhysicsEngine vs BatchPhysicsEngine for bodies
+//without firmware so only physics engine cost is measured
+class BatchPhysicsEngineBenchmark : public BenchmarkBase {
+public:
+    virtual void run() override
+    {
+        std::cout << "BatchPhysicsEngineBenchmark: BoxBody" << std::endl;
+
+        for (uint body_count : { 1u, 8u, 32u, 128u, 1024u }) {
+            double fast = runWorld(body_count, std::unique_ptr<PhysicsEngineBase>(new FastPhysicsEngine()));
+            double batch = runWorld(body_count, std::unique_ptr<PhysicsEngineBase>(new BatchPhysicsEngine()));
+
+            report(Utils::stringf("%u bodies, FastPhysicsEngine", body_count), fast, "body updates/s");
+            report(Utils::stringf("%u bodies, BatchPhysicsEngine", body_count), batch, "body updates/s");
+        }
+    }
+
+private:
+    double runWorld(uint body_count, std::unique_ptr<PhysicsEngineBase> physics_engine)
+    {
+        auto clock = std::make_shared<SteppableClock>(step_size_, 1000000000LL);
+        ClockFactory::get(clock);
+
+        std::vector<std::unique_ptr<BoxBody>> boxes;
+        std::vector<UpdatableObject*> bodies;
+        for (uint i = 0; i < body_count; ++i) {
+            boxes.emplace_back(new BoxBody(Vector3r(i * 2.0f, 0, -10.0f)));
+            bodies.push_back(boxes.back().get());
+        }
+        //world resets bodies which in turn resets their kinematics
+        PhysicsWorld physics_world(std::move(physics_engine), bodies,
+            static_cast<uint64_t>(step_size_ * 1E9), false, false);
+
+        const uint ticks = std::max(200000u / body_count, 100u);
+        common_utils::Timer timer;
+        timer.start();
+        physics_world.step(ticks);
+        double elapsed = timer.seconds();
+
+        return ticks * body_count / elapsed;
+    }
+
+private:
+    const float step_size_ = 3E-3f;
+};
+
+
+}}
+#endif
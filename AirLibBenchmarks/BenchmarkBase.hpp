@@ -0,0 +1,32 @@
+#ifndef msr_AirLibBenchmarks_BenchmarkBase_hpp
+#define msr_AirLibBenchmarks_BenchmarkBase_hpp
+
+#include <string>
+#include <iostream>
+#include <exception>
+#include "common/common_utils/Utils.hpp"
+#include "common/common_utils/Timer.hpp"
+
+namespace msr { namespace airlib {
+
+class BenchmarkBase {
+public:
+    virtual void run() = 0;
+    virtual ~BenchmarkBase() = default;
+
+protected:
+    void report(const std::string& name, double value, const std::string& unit)
+    {
+        std::cout << common_utils::Utils::stringf("    %-48s %14.2f %s", name.c_str(), value, unit.c_str()) << std::endl;
+    }
+
+    void benchAssert(bool condition, const std::string& message)
+    {
+        if (!condition)
+            throw std::runtime_error(message.c_str());
+    }
+};
+
+
+}}
+#endif
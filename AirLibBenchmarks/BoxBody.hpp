@@ -0,0 +1,87 @@
+#ifndef msr_AirLibBenchmarks_BoxBody_hpp
+#define msr_AirLibBenchmarks_BoxBody_hpp
+
+#include "physics/PhysicsBody.hpp"
+
+namespace msr { namespace airlib {
+
+//Physics body without any firmware or sensors so benchmarks measure only physics
+//engine cost. Box with four thrust vertices and six drag faces like a quadrotor.
+class BoxBody : public PhysicsBody {
+private:
+    class ThrustVertex : public PhysicsBodyVertex {
+    public:
+        ThrustVertex(const Vector3r& position, real_T thrust)
+            : PhysicsBodyVertex(position, Vector3r(0, 0, -1)), thrust_(thrust)
+        {
+        }
+    protected:
+        virtual void setWrench(Wrench& wrench) override
+        {
+            wrench.force = getNormal() * thrust_;
+        }
+    private:
+        real_T thrust_;
+    };
+
+public:
+    BoxBody(const Vector3r& position, real_T thrust_ratio = 1.01f)
+        : kinematics_(initialState(position)),
+        environment_(Environment::State(position, GeoPoint(47.641468, -122.140165, 122)))
+    {
+        const real_T mass = 1.0f;
+        const real_T arm = 0.2f;
+        Matrix3x3r inertia = Matrix3x3r::Zero();
+        inertia(0, 0) = inertia(1, 1) = 0.0075f; inertia(2, 2) = 0.013f;
+
+        //slightly uneven thrust so body accelerates and rotates
+        const real_T thrust = mass * EarthUtils::Gravity / 4;
+        thrust_vertices_.emplace_back(Vector3r(arm, arm, 0), thrust * thrust_ratio);
+        thrust_vertices_.emplace_back(Vector3r(-arm, -arm, 0), thrust * thrust_ratio);
+        thrust_vertices_.emplace_back(Vector3r(arm, -arm, 0), thrust);
+        thrust_vertices_.emplace_back(Vector3r(-arm, arm, 0), thrust);
+
+        const real_T drag = 0.1f;
+        drag_vertices_.emplace_back(Vector3r(0, 0, -0.05f), Vector3r(0, 0, -1), drag);
+        drag_vertices_.emplace_back(Vector3r(0, 0, 0.05f), Vector3r(0, 0, 1), drag);
+        drag_vertices_.emplace_back(Vector3r(0, -0.1f, 0), Vector3r(0, -1, 0), drag);
+        drag_vertices_.emplace_back(Vector3r(0, 0.1f, 0), Vector3r(0, 1, 0), drag);
+        drag_vertices_.emplace_back(Vector3r(-0.1f, 0, 0), Vector3r(-1, 0, 0), drag);
+        drag_vertices_.emplace_back(Vector3r(0.1f, 0, 0), Vector3r(1, 0, 0), drag);
+
+        PhysicsBody::initialize(mass, inertia, &kinematics_, &environment_);
+    }
+
+    virtual void reset() override
+    {
+        kinematics_.reset();
+        PhysicsBody::reset();
+    }
+
+    virtual real_T getRestitution() const override { return 0.5f; }
+    virtual real_T getFriction() const override { return 0.7f; }
+    virtual uint wrenchVertexCount() const override { return static_cast<uint>(thrust_vertices_.size()); }
+    virtual PhysicsBodyVertex& getWrenchVertex(uint index) override { return thrust_vertices_.at(index); }
+    virtual const PhysicsBodyVertex& getWrenchVertex(uint index) const override { return thrust_vertices_.at(index); }
+    virtual uint dragVertexCount() const override { return static_cast<uint>(drag_vertices_.size()); }
+    virtual PhysicsBodyVertex& getDragVertex(uint index) override { return drag_vertices_.at(index); }
+    virtual const PhysicsBodyVertex& getDragVertex(uint index) const override { return drag_vertices_.at(index); }
+
+private:
+    static Kinematics::State initialState(const Vector3r& position)
+    {
+        Kinematics::State state = Kinematics::State::zero();
+        state.pose.position = position;
+        return state;
+    }
+
+private:
+    Kinematics kinematics_;
+    Environment environment_;
+    vector<ThrustVertex> thrust_vertices_;
+    vector<PhysicsBodyVertex> drag_vertices_;
+};
+
+
+}}
+#endif
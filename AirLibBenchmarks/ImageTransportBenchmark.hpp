@@ -0,0 +1,93 @@
+#ifndef msr_AirLibBenchmarks_ImageTransportBenchmark_hpp
+#define msr_AirLibBenchmarks_ImageTransportBenchmark_hpp
+
+#include "BenchmarkBase.hpp"
+#include "SyntheticVehicleSimApi.hpp"
+#include "api/ApiProvider.hpp"
+#include "api/RpcLibServerBase.hpp"
+#include "api/RpcLibClientBase.hpp"
+#include <ctime>
+
+namespace msr { namespace airlib {
+
+//Compares simGetImages against simGetImagesShared over localhost RPC with 4 uncompressed
+//1080p cameras served by SyntheticImageCapture. CPU time includes both server and client
+//because both run in this process.
+class ImageTransportBenchmark : public BenchmarkBase {
+public:
+    virtual void run() override
+    {
+        std::cout << "ImageTransportBenchmark: 4 cameras, " << width_ << "x" << height_ << std::endl;
+
+        SyntheticVehicleSimApi vehicle_sim_api(width_, height_);
+        ApiProvider api_provider(nullptr);
+        api_provider.insert_or_assign("", nullptr, &vehicle_sim_api);
+
+        RpcLibServerBase server(&api_provider, "127.0.0.1", port_);
+        server.start(false, 4);
+
+        RpcLibClientBase client("127.0.0.1", port_);
+        client.confirmConnection();
+
+        runPath(client, false, false, 50);
+        runPath(client, true, false, 50);
+        runPath(client, false, true, 50);
+        runPath(client, true, true, 50);
+
+        server.stop();
+    }
+
+private:
+    void runPath(RpcLibClientBase& client, bool shared, bool pixels_as_float, unsigned int calls)
+    {
+        std::vector<ImageCaptureBase::ImageRequest> requests;
+        for (int camera = 0; camera < 4; ++camera)
+            requests.push_back(ImageCaptureBase::ImageRequest(std::to_string(camera),
+                pixels_as_float ? ImageCaptureBase::ImageType::DepthPlanner : ImageCaptureBase::ImageType::Scene,
+                pixels_as_float, false));
+
+        const size_t frame_bytes = static_cast<size_t>(width_) * height_ * (pixels_as_float ? sizeof(float) : 3);
+        uint64_t checksum = 0;
+
+        common_utils::Timer timer;
+        timer.start();
+        std::clock_t cpu_start = std::clock();
+        for (unsigned int call = 0; call < calls; ++call) {
+            if (shared) {
+                const auto& responses = client.simGetImagesShared(requests);
+                for (const auto& response : responses) {
+                    benchAssert(response.data != nullptr && response.descriptor.size == frame_bytes, "bad shared image");
+                    checksum += response.data[frame_bytes / 2];
+                    benchAssert(client.isSharedImageCurrent(response), "shared image was overwritten");
+                }
+            }
+            else {
+                const auto& responses = client.simGetImages(requests);
+                for (const auto& response : responses) {
+                    const uint8_t* data = pixels_as_float ? reinterpret_cast<const uint8_t*>(response.image_data_float.data())
+                        : response.image_data_uint8.data();
+                    benchAssert((pixels_as_float ? response.image_data_float.size() * sizeof(float) : response.image_data_uint8.size())
+                        == frame_bytes, "bad image");
+                    checksum += data[frame_bytes / 2];
+                }
+            }
+        }
+        double cpu_seconds = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+        double elapsed = timer.seconds();
+        unused(checksum);
+
+        const unsigned int frames = calls * static_cast<unsigned int>(requests.size());
+        std::string name = std::string(shared ? "simGetImagesShared" : "simGetImages") + (pixels_as_float ? " float" : " uint8");
+        report(name, frames / elapsed, "frames/s");
+        report(name + " CPU", cpu_seconds * 1E3 / frames, "ms/frame");
+    }
+
+private:
+    const int width_ = 1920;
+    const int height_ = 1080;
+    const uint16_t port_ = 41460;
+};
+
+
+}}
+#endif
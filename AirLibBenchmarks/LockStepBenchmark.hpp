@@ -0,0 +1,164 @@
+#ifndef msr_AirLibBenchmarks_LockStepBenchmark_hpp
+#define msr_AirLibBenchmarks_LockStepBenchmark_hpp
+
+#include "BenchmarkBase.hpp"
+#include "vehicles/multirotor/firmwares/mavlink/MavLinkMultirotorApi.hpp"
+#include "sensors/imu/ImuSimple.hpp"
+#include "sensors/magnetometer/MagnetometerSimple.hpp"
+#include "sensors/barometer/BarometerSimple.hpp"
+#include "sensors/gps/GpsSimple.hpp"
+#include "common/SteppableClock.hpp"
+#include <random>
+#include <thread>
+
+namespace msr { namespace airlib {
+
+//Stand-in for PX4 SITL in lock-step: answers every HIL_SENSOR with HIL_ACTUATOR_CONTROLS stamped with the
+//same time_usec after spending a random 50 to 450us computing them. The controls encode the sensor time so
+//the benchmark can tell which sensor update the controls it is using came from.
+class EchoAutopilot {
+public:
+    EchoAutopilot(int port)
+    {
+        connection_ = mavlinkcom::MavLinkConnection::connectLocalUdp("autopilot", "127.0.0.1", port);
+        connection_->subscribe([this](std::shared_ptr<mavlinkcom::MavLinkConnection> connection, const mavlinkcom::MavLinkMessage& msg) {
+            if (msg.msgid != mavlinkcom::MavLinkHilSensor::kMessageId)
+                return;
+            mavlinkcom::MavLinkHilSensor sensor;
+            sensor.decode(msg);
+
+            auto done = std::chrono::steady_clock::now() + std::chrono::microseconds(compute_usec_(random_));
+            while (std::chrono::steady_clock::now() < done) {
+            }
+
+            mavlinkcom::MavLinkHilActuatorControls controls;
+            controls.time_usec = sensor.time_usec;
+            for (int i = 0; i < 16; ++i)
+                controls.controls[i] = 0;
+            controls.controls[0] = encode(sensor.time_usec);
+            controls.controls[1] = encode(sensor.time_usec / 97);
+            controls.mode = 0;
+            controls.flags = 0;
+            connection->sendMessage(controls);
+        });
+    }
+
+    ~EchoAutopilot()
+    {
+        connection_->close();
+    }
+
+    //PX4 multirotor controls are 0..1 and MavLinkMultirotorApi maps them to 0.2..1
+    static float encode(uint64_t value)
+    {
+        return (value % 97) / 100.0f;
+    }
+    static bool matches(uint64_t value, real_T actuation)
+    {
+        int decoded = static_cast<int>(std::round((actuation - 0.2f) / 0.8f * 100));
+        return decoded == static_cast<int>(value % 97);
+    }
+
+private:
+    std::shared_ptr<mavlinkcom::MavLinkConnection> connection_;
+    std::mt19937 random_{ 42 };
+    std::uniform_int_distribution<int> compute_usec_{ 50, 450 };
+};
+
+//Runs MavLinkMultirotorApi against EchoAutopilot over loopback UDP: free running at real time, free
+//running as fast as possible and in lock-step as fast as possible. Reports how many physics steps went
+//on with controls that were not computed from that step's sensor data.
+class LockStepBenchmark : public BenchmarkBase {
+public:
+    virtual void run() override
+    {
+        std::cout << "LockStepBenchmark: " << steps_ << " steps of " << step_size_ * 1E3 << "ms" << std::endl;
+
+        sensors_.insert(&imu_, SensorBase::SensorType::Imu);
+        sensors_.insert(&magnetometer_, SensorBase::SensorType::Magnetometer);
+        sensors_.insert(&barometer_, SensorBase::SensorType::Barometer);
+        sensors_.insert(&gps_, SensorBase::SensorType::Gps);
+
+        runMode("free-run real time", false, true, port_);
+        runMode("free-run unpaced", false, false, port_ + 1);
+        runMode("lock-step", true, false, port_ + 2);
+    }
+
+private:
+    void runMode(const std::string& name, bool lock_step, bool paced, int port)
+    {
+        auto clock = std::make_shared<SteppableClock>(step_size_);
+        ClockFactory::get(clock);
+
+        EchoAutopilot autopilot(port);
+
+        AirSimSettings::MavLinkConnectionInfo connection_info;
+        connection_info.use_serial = false;
+        connection_info.ip_address = "127.0.0.1";
+        connection_info.ip_port = port;
+        connection_info.sitl_ip_address = "";
+        connection_info.logviewer_ip_address = "";
+        connection_info.qgc_ip_address = "";
+        connection_info.lock_step = lock_step;
+
+        MavLinkMultirotorApi api;
+        api.initialize(connection_info, &sensors_, true);
+        std::string message;
+        benchAssert(api.isReady(message), message);
+        api.reset();
+
+        //until the autopilot has answered once there is nothing to be in step with
+        for (int i = 0; i < 20; ++i) {
+            clock->step();
+            api.update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+
+        unsigned int out_of_step = 0;
+        common_utils::Timer timer;
+        timer.start();
+        for (unsigned int step = 0; step < steps_; ++step) {
+            clock->step();
+            api.update();
+
+            //what the physics step would use
+            uint64_t time_usec = api.getLastSensorMessage().time_usec;
+            if (!EchoAutopilot::matches(time_usec, api.getActuation(0)) || !EchoAutopilot::matches(time_usec / 97, api.getActuation(1)))
+                ++out_of_step;
+
+            if (paced) {
+                double next = (step + 1) * step_size_;
+                double now = timer.seconds();
+                if (next > now)
+                    std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int64_t>((next - now) * 1E6)));
+            }
+        }
+        double seconds = timer.seconds();
+        auto stats = api.getLockStepStats();
+
+        report(name + " steps/s", steps_ / seconds, "");
+        report(name + " sim speed", steps_ * step_size_ / seconds, "x real time");
+        report(name + " steps out of step", 100.0 * out_of_step / steps_, "%");
+        if (lock_step) {
+            benchAssert(out_of_step == stats.lagged_steps, "lock-step counters disagree with the autopilot");
+            report(name + " stalls", static_cast<double>(stats.stalls), "");
+            report(name + " mean wait", stats.steps > 0 ? static_cast<double>(stats.wait_usec) / stats.steps : 0, "us");
+            report(name + " max wait", static_cast<double>(stats.max_wait_usec), "us");
+        }
+    }
+
+private:
+    const unsigned int steps_ = 1000;
+    const float step_size_ = 3E-3f;
+    const int port_ = 14597;
+
+    SensorCollection sensors_;
+    ImuSimple imu_;
+    MagnetometerSimple magnetometer_;
+    BarometerSimple barometer_;
+    GpsSimple gps_;
+};
+
+
+}}
+#endif
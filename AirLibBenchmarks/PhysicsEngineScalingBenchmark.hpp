@@ -0,0 +1,75 @@
+#ifndef msr_AirLibBenchmarks_PhysicsEngineScalingBenchmark_hpp
+#define msr_AirLibBenchmarks_PhysicsEngineScalingBenchmark_hpp
+
+#include "BenchmarkBase.hpp"
+#include "SimpleFlightVehicle.hpp"
+#include "physics/PhysicsWorld.hpp"
+#include "physics/FastPhysicsEngine.hpp"
+#include "common/SteppableClock.hpp"
+
+namespace msr { namespace airlib {
+
+//Reports ticks/sec of FastPhysicsEngine for different number of MultiRotor
+//bodies and thread counts and verifies parallel results match serial ones
+class PhysicsEngineScalingBenchmark : public BenchmarkBase {
+public:
+    virtual void run() override
+    {
+        std::cout << "PhysicsEngineScalingBenchmark: MultiRotor + SimpleFlight, "
+            << std::thread::hardware_concurrency() << " hardware threads" << std::endl;
+
+        for (uint body_count : { 1u, 8u, 32u, 128u }) {
+            std::vector<Vector3r> serial_positions;
+            for (uint thread_count : { 1u, 2u, 4u, 8u, 16u }) {
+                std::vector<Vector3r> positions;
+                double ticks_per_sec = runWorld(body_count, thread_count, positions);
+
+                report(Utils::stringf("%u bodies, %u threads", body_count, thread_count), ticks_per_sec, "ticks/s");
+
+                if (thread_count == 1)
+                    serial_positions = positions;
+                else
+                    benchAssert(positions == serial_positions, "parallel update produced different result than serial");
+            }
+        }
+    }
+
+private:
+    double runWorld(uint body_count, uint thread_count, std::vector<Vector3r>& positions)
+    {
+        //fixed start time so every run sees bit-identical time deltas
+        auto clock = std::make_shared<SteppableClock>(step_size_, 1000000000LL);
+        ClockFactory::get(clock);
+
+        std::vector<std::unique_ptr<SimpleFlightVehicle>> vehicles;
+        std::vector<UpdatableObject*> bodies;
+        for (uint i = 0; i < body_count; ++i) {
+            //start them in the air so there is something to integrate
+            vehicles.emplace_back(new SimpleFlightVehicle(Vector3r(i * 2.0f, 0, -10.0f - i)));
+            bodies.push_back(vehicles.back()->getVehicle());
+        }
+
+        PhysicsWorld physics_world(std::unique_ptr<PhysicsEngineBase>(new FastPhysicsEngine(true, thread_count)), bodies,
+            static_cast<uint64_t>(step_size_ * 1E9), false, false);
+
+        //keep total work roughly constant across body counts
+        const uint ticks = std::max(20000u / body_count, 100u);
+        common_utils::Timer timer;
+        timer.start();
+        physics_world.step(ticks);
+        double elapsed = timer.seconds();
+
+        positions.clear();
+        for (const auto& vehicle : vehicles)
+            positions.push_back(vehicle->getVehicle()->getKinematics().pose.position);
+
+        return ticks / elapsed;
+    }
+
+private:
+    const float step_size_ = 3E-3f;
+};
+
+
+}}
+#endif
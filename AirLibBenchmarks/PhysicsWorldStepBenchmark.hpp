@@ -0,0 +1,77 @@
+#ifndef msr_AirLibBenchmarks_PhysicsWorldStepBenchmark_hpp
+#define msr_AirLibBenchmarks_PhysicsWorldStepBenchmark_hpp
+
+#include "BenchmarkBase.hpp"
+#include "SimpleFlightVehicle.hpp"
+#include "physics/PhysicsWorld.hpp"
+#include "physics/FastPhysicsEngine.hpp"
+#include "common/SteppableClock.hpp"
+
+namespace msr { namespace airlib {
+
+//Compares steps/sec of the world driven by ScheduledExecutor at fixed period
+//against back-to-back stepping via PhysicsWorld::step
+class PhysicsWorldStepBenchmark : public BenchmarkBase {
+public:
+    virtual void run() override
+    {
+        std::cout << "PhysicsWorldStepBenchmark: MultiRotor + SimpleFlight, dt = "
+            << step_size_ * 1E3 << "ms" << std::endl;
+
+        runExecutor(2.0f);
+        runBatch(20000);
+    }
+
+private:
+    void runExecutor(float run_seconds)
+    {
+        auto clock = std::make_shared<SteppableClock>(step_size_);
+        ClockFactory::get(clock);
+
+        SimpleFlightVehicle vehicle;
+        std::vector<UpdatableObject*> vehicles = { vehicle.getVehicle() };
+        PhysicsWorld physics_world(std::unique_ptr<PhysicsEngineBase>(new FastPhysicsEngine()), vehicles,
+            static_cast<uint64_t>(step_size_ * 1E9));
+
+        uint64_t start_steps = clock->getStepCount();
+        common_utils::Timer timer;
+        timer.start();
+        std::this_thread::sleep_for(std::chrono::duration<double>(run_seconds));
+        uint64_t steps = clock->getStepCount() - start_steps;
+        double elapsed = timer.seconds();
+        physics_world.stopAsyncUpdator();
+
+        report("ScheduledExecutor", steps / elapsed, "steps/s");
+    }
+
+    void runBatch(unsigned int steps)
+    {
+        auto clock = std::make_shared<SteppableClock>(step_size_);
+        ClockFactory::get(clock);
+
+        SimpleFlightVehicle vehicle;
+        std::vector<UpdatableObject*> vehicles = { vehicle.getVehicle() };
+        PhysicsWorld physics_world(std::unique_ptr<PhysicsEngineBase>(new FastPhysicsEngine()), vehicles,
+            static_cast<uint64_t>(step_size_ * 1E9), false, false);
+
+        TTimePoint sim_start = clock->nowNanos();
+        common_utils::Timer timer;
+        timer.start();
+        physics_world.step(steps);
+        double elapsed = timer.seconds();
+
+        //each step must advance sim time by exactly one dt
+        TTimeDelta sim_elapsed = clock->elapsedSince(sim_start);
+        benchAssert(std::abs(sim_elapsed - steps * step_size_) < step_size_, "sim time did not advance by steps * dt");
+
+        report("PhysicsWorld::step", steps / elapsed, "steps/s");
+        report("PhysicsWorld::step real-time factor", sim_elapsed / elapsed, "x");
+    }
+
+private:
+    const float step_size_ = 3E-3f;
+};
+
+
+}}
+#endif
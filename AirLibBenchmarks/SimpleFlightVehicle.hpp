@@ -0,0 +1,57 @@
+#ifndef msr_AirLibBenchmarks_SimpleFlightVehicle_hpp
+#define msr_AirLibBenchmarks_SimpleFlightVehicle_hpp
+
+#include "vehicles/multirotor/MultiRotorParamsFactory.hpp"
+#include "vehicles/multirotor/MultiRotor.hpp"
+#include "common/AirSimSettings.hpp"
+
+namespace msr { namespace airlib {
+
+//MultiRotor with SimpleFlight firmware and everything it needs to live on
+//its own, so benchmarks can create as many as they want
+class SimpleFlightVehicle {
+public:
+    SimpleFlightVehicle(const Vector3r& position = Vector3r::Zero())
+    {
+        params_ = MultiRotorParamsFactory::createConfig(
+            AirSimSettings::singleton().getVehicleSetting("SimpleFlight"),
+            std::make_shared<SensorFactory>());
+        api_ = params_->createMultirotorApi();
+
+        Kinematics::State initial_kinematic_state = Kinematics::State::zero();
+        initial_kinematic_state.pose = Pose(position, Quaternionr::Identity());
+        kinematics_.reset(new Kinematics(initial_kinematic_state));
+
+        Environment::State initial_environment;
+        initial_environment.position = position;
+        initial_environment.geo_point = GeoPoint();
+        environment_.reset(new Environment(initial_environment));
+
+        vehicle_.reset(new MultiRotor(params_.get(), api_.get(), kinematics_.get(), environment_.get()));
+        api_->setSimulatedGroundTruth(&kinematics_->getState(), environment_.get());
+
+        //kinematics and api are not members of world so nobody else would reset them
+        kinematics_->reset();
+        api_->reset();
+    }
+
+    MultiRotor* getVehicle()
+    {
+        return vehicle_.get();
+    }
+    MultirotorApiBase* getApi()
+    {
+        return api_.get();
+    }
+
+private:
+    std::unique_ptr<MultiRotorParams> params_;
+    std::unique_ptr<MultirotorApiBase> api_;
+    std::unique_ptr<Kinematics> kinematics_;
+    std::unique_ptr<Environment> environment_;
+    std::unique_ptr<MultiRotor> vehicle_;
+};
+
+
+}}
+#endif
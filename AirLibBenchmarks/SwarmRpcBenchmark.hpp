@@ -0,0 +1,83 @@
+#ifndef msr_AirLibBenchmarks_SwarmRpcBenchmark_hpp
+#define msr_AirLibBenchmarks_SwarmRpcBenchmark_hpp
+
+#include "BenchmarkBase.hpp"
+#include "SyntheticMultirotorApi.hpp"
+#include "api/ApiProvider.hpp"
+#include "vehicles/multirotor/api/MultirotorRpcLibServer.hpp"
+#include "vehicles/multirotor/api/MultirotorRpcLibClient.hpp"
+
+namespace msr { namespace airlib {
+
+//Cost of one control tick for a swarm over localhost RPC: fetch state of every vehicle and send
+//each a velocity command, once with per-vehicle calls and once with batch calls. Commands have
+//zero duration so only RPC and dispatch overhead is measured, not the flight controller.
+class SwarmRpcBenchmark : public BenchmarkBase {
+public:
+    virtual void run() override
+    {
+        std::cout << "SwarmRpcBenchmark: per-vehicle vs batch calls, " << ticks_ << " ticks" << std::endl;
+
+        for (unsigned int vehicle_count : { 1, 8, 32, 64 })
+            runSwarm(vehicle_count);
+    }
+
+private:
+    void runSwarm(unsigned int vehicle_count)
+    {
+        std::vector<std::unique_ptr<SyntheticMultirotorApi>> vehicle_apis;
+        std::vector<std::string> vehicle_names;
+        ApiProvider api_provider(nullptr);
+        for (unsigned int i = 0; i < vehicle_count; ++i) {
+            vehicle_apis.emplace_back(new SyntheticMultirotorApi());
+            vehicle_names.push_back("Drone" + std::to_string(i));
+            api_provider.insert_or_assign(vehicle_names.back(), vehicle_apis.back().get(), nullptr);
+        }
+
+        MultirotorRpcLibServer server(&api_provider, "127.0.0.1", port_);
+        server.start(false, 4);
+
+        MultirotorRpcLibClient client("127.0.0.1", port_);
+        client.confirmConnection();
+
+        std::vector<VelocityCommand> commands(vehicle_count, VelocityCommand(1, 0, 0));
+
+        //per-vehicle: 2 round trips per vehicle per tick
+        common_utils::Timer timer;
+        timer.start();
+        for (unsigned int tick = 0; tick < ticks_; ++tick) {
+            for (const auto& vehicle_name : vehicle_names)
+                client.getMultirotorState(vehicle_name);
+            for (const auto& vehicle_name : vehicle_names)
+                client.moveByVelocityAsync(1, 0, 0, 0, DrivetrainType::MaxDegreeOfFreedom, YawMode(), vehicle_name)->waitOnLastTask();
+        }
+        double per_vehicle_seconds = timer.seconds();
+
+        //batch: 2 round trips per tick
+        timer.start();
+        for (unsigned int tick = 0; tick < ticks_; ++tick) {
+            const auto& states = client.getMultirotorStateBatch(vehicle_names);
+            benchAssert(states.size() == vehicle_count, "wrong number of states");
+            bool result = false;
+            client.moveByVelocityBatchAsync(commands, 0, DrivetrainType::MaxDegreeOfFreedom, vehicle_names)->waitOnLastTask(&result);
+            benchAssert(result, "batch command failed");
+        }
+        double batch_seconds = timer.seconds();
+
+        server.stop();
+
+        const std::string prefix = std::to_string(vehicle_count) + " vehicles ";
+        report(prefix + "per-vehicle tick", per_vehicle_seconds * 1E3 / ticks_, "ms");
+        report(prefix + "batch tick", batch_seconds * 1E3 / ticks_, "ms");
+        report(prefix + "per-vehicle throughput", vehicle_count * ticks_ / per_vehicle_seconds, "vehicle updates/s");
+        report(prefix + "batch throughput", vehicle_count * ticks_ / batch_seconds, "vehicle updates/s");
+    }
+
+private:
+    const unsigned int ticks_ = 200;
+    const uint16_t port_ = 41461;
+};
+
+
+}}
+#endif
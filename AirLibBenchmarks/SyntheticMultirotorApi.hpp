@@ -0,0 +1,103 @@
+#ifndef msr_AirLibBenchmarks_SyntheticMultirotorApi_hpp
+#define msr_AirLibBenchmarks_SyntheticMultirotorApi_hpp
+
+#include "vehicles/multirotor/api/MultirotorApiBase.hpp"
+#include <atomic>
+
+namespace msr { namespace airlib {
+
+//Multirotor API without vehicle behind it, commands are only counted so RPC overhead can be measured
+class SyntheticMultirotorApi : public MultirotorApiBase {
+public:
+    uint64_t getCommandCount() const
+    {
+        return command_count_;
+    }
+
+    virtual void enableApiControl(bool is_enabled) override
+    {
+        api_control_enabled_ = is_enabled;
+    }
+    virtual bool isApiControlEnabled() const override
+    {
+        return api_control_enabled_;
+    }
+    virtual bool armDisarm(bool arm) override
+    {
+        unused(arm);
+        return true;
+    }
+    virtual GeoPoint getHomeGeoPoint() const override
+    {
+        return GeoPoint();
+    }
+    virtual RCData getRCData() const override
+    {
+        return RCData();
+    }
+
+protected:
+    virtual void commandRollPitchZ(float pitch, float roll, float z, float yaw) override
+    {
+        unused(pitch); unused(roll); unused(z); unused(yaw);
+        ++command_count_;
+    }
+    virtual void commandRollPitchThrottle(float pitch, float roll, float throttle, float yaw_rate) override
+    {
+        unused(pitch); unused(roll); unused(throttle); unused(yaw_rate);
+        ++command_count_;
+    }
+    virtual void commandVelocity(float vx, float vy, float vz, const YawMode& yaw_mode) override
+    {
+        unused(vx); unused(vy); unused(vz); unused(yaw_mode);
+        ++command_count_;
+    }
+    virtual void commandVelocityZ(float vx, float vy, float z, const YawMode& yaw_mode) override
+    {
+        unused(vx); unused(vy); unused(z); unused(yaw_mode);
+        ++command_count_;
+    }
+    virtual void commandPosition(float x, float y, float z, const YawMode& yaw_mode) override
+    {
+        unused(x); unused(y); unused(z); unused(yaw_mode);
+        ++command_count_;
+    }
+
+    virtual Kinematics::State getKinematicsEstimated() const override
+    {
+        return Kinematics::State::zero();
+    }
+    virtual LandedState getLandedState() const override
+    {
+        return LandedState::Flying;
+    }
+    virtual GeoPoint getGpsLocation() const override
+    {
+        return GeoPoint();
+    }
+    virtual const MultirotorApiParams& getMultirotorApiParams() const override
+    {
+        return params_;
+    }
+
+    virtual float getCommandPeriod() const override
+    {
+        return 1.0f / 50;
+    }
+    virtual float getTakeoffZ() const override
+    {
+        return -2.0f;
+    }
+    virtual float getDistanceAccuracy() const override
+    {
+        return 0.5f;
+    }
+
+private:
+    MultirotorApiParams params_;
+    bool api_control_enabled_ = true;
+    std::atomic<uint64_t> command_count_ { 0 };
+};
+
+}}
+#endif
@@ -0,0 +1,136 @@
+#ifndef msr_AirLibBenchmarks_SyntheticVehicleSimApi_hpp
+#define msr_AirLibBenchmarks_SyntheticVehicleSimApi_hpp
+
+#include "api/VehicleSimApiBase.hpp"
+#include "common/ImageCaptureBase.hpp"
+
+namespace msr { namespace airlib {
+
+//Returns same pre-generated frame for every camera so image APIs can be measured without renderer
+class SyntheticImageCapture : public ImageCaptureBase {
+public:
+    SyntheticImageCapture(int width, int height)
+        : width_(width), height_(height)
+    {
+        frame_uint8_.resize(static_cast<size_t>(width) * height * 3);
+        for (size_t i = 0; i < frame_uint8_.size(); ++i)
+            frame_uint8_[i] = static_cast<uint8_t>(i * 7);
+        frame_float_.resize(static_cast<size_t>(width) * height);
+        for (size_t i = 0; i < frame_float_.size(); ++i)
+            frame_float_[i] = static_cast<float>(i % 1000) / 10.0f;
+    }
+
+    virtual void getImages(const std::vector<ImageRequest>& requests, std::vector<ImageResponse>& responses) const override
+    {
+        for (const auto& request : requests) {
+            ImageResponse response;
+            response.camera_name = request.camera_name;
+            response.image_type = request.image_type;
+            response.pixels_as_float = request.pixels_as_float;
+            response.compress = false;
+            response.width = width_;
+            response.height = height_;
+            response.time_stamp = ++frame_count_;
+            if (request.pixels_as_float)
+                response.image_data_float = frame_float_;
+            else
+                response.image_data_uint8 = frame_uint8_;
+            responses.push_back(std::move(response));
+        }
+    }
+
+private:
+    int width_, height_;
+    std::vector<uint8_t> frame_uint8_;
+    std::vector<float> frame_float_;
+    mutable TTimePoint frame_count_ = 0;
+};
+
+//vehicle sim API that only serves images from SyntheticImageCapture
+class SyntheticVehicleSimApi : public VehicleSimApiBase {
+public:
+    SyntheticVehicleSimApi(int width, int height)
+        : image_capture_(width, height)
+    {}
+
+    virtual const ImageCaptureBase* getImageCapture() const override
+    {
+        return &image_capture_;
+    }
+    virtual void initialize() override
+    {}
+
+    virtual std::vector<ImageCaptureBase::ImageResponse> getImages(const std::vector<ImageCaptureBase::ImageRequest>& request) const override
+    {
+        std::vector<ImageCaptureBase::ImageResponse> responses;
+        image_capture_.getImages(request, responses);
+        return responses;
+    }
+    virtual std::vector<uint8_t> getImage(const std::string& camera_name, ImageCaptureBase::ImageType image_type) const override
+    {
+        std::vector<ImageCaptureBase::ImageResponse> responses;
+        image_capture_.getImages({ ImageCaptureBase::ImageRequest(camera_name, image_type) }, responses);
+        return responses.at(0).image_data_uint8;
+    }
+
+    virtual Pose getPose() const override
+    {
+        return Pose();
+    }
+    virtual void setPose(const Pose& pose, bool ignore_collision) override
+    {
+        unused(pose);
+        unused(ignore_collision);
+    }
+    virtual const Kinematics::State* getGroundTruthKinematics() const override
+    {
+        return &kinematics_;
+    }
+    virtual const msr::airlib::Environment* getGroundTruthEnvironment() const override
+    {
+        return nullptr;
+    }
+
+    virtual CameraInfo getCameraInfo(const std::string& camera_name) const override
+    {
+        unused(camera_name);
+        return CameraInfo();
+    }
+    virtual void setCameraOrientation(const std::string& camera_name, const Quaternionr& orientation) override
+    {
+        unused(camera_name);
+        unused(orientation);
+    }
+
+    virtual CollisionInfo getCollisionInfo() const override
+    {
+        return CollisionInfo();
+    }
+    virtual int getRemoteControlID() const override
+    {
+        return -1;
+    }
+    virtual RCData getRCData() const override
+    {
+        return RCData();
+    }
+    virtual std::string getVehicleName() const override
+    {
+        return "";
+    }
+    virtual std::string getRecordFileLine(bool is_header_line) const override
+    {
+        unused(is_header_line);
+        return "";
+    }
+    virtual void toggleTrace() override
+    {}
+
+private:
+    SyntheticImageCapture image_capture_;
+    Kinematics::State kinematics_ = Kinematics::State::zero();
+};
+
+
+}}
+#endif
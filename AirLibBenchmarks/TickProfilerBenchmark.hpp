@@ -0,0 +1,76 @@
+#ifndef msr_AirLibBenchmarks_TickProfilerBenchmark_hpp
+#define msr_AirLibBenchmarks_TickProfilerBenchmark_hpp
+
+#include "BenchmarkBase.hpp"
+#include "SimpleFlightVehicle.hpp"
+#include "physics/PhysicsWorld.hpp"
+#include "physics/FastPhysicsEngine.hpp"
+#include "common/SteppableClock.hpp"
+#include "common/TickProfiler.hpp"
+
+namespace msr { namespace airlib {
+
+//Measures cost of a profiled scope and reports phase breakdown of stepping a
+//SimpleFlight multirotor, also writes Chrome trace of last steps
+class TickProfilerBenchmark : public BenchmarkBase {
+public:
+    virtual void run() override
+    {
+        std::cout << "TickProfilerBenchmark" << std::endl;
+
+        runScopeOverhead(1000000);
+        runPhaseBreakdown(5000);
+    }
+
+private:
+    void runScopeOverhead(unsigned int scopes)
+    {
+        TickProfiler::PhaseId phase = TickProfiler::singleton().registerPhase("TickProfilerBenchmark/empty");
+        common_utils::Timer timer;
+        timer.start();
+        for (unsigned int i = 0; i < scopes; ++i) {
+            TickProfiler::Scope scope(phase);
+        }
+        double elapsed = timer.seconds();
+
+        report("scope overhead", elapsed * 1E9 / scopes, "ns");
+    }
+
+    void runPhaseBreakdown(unsigned int steps)
+    {
+        auto clock = std::make_shared<SteppableClock>(step_size_);
+        ClockFactory::get(clock);
+
+        SimpleFlightVehicle vehicle;
+        std::vector<UpdatableObject*> vehicles = { vehicle.getVehicle() };
+        PhysicsWorld physics_world(std::unique_ptr<PhysicsEngineBase>(new FastPhysicsEngine()), vehicles,
+            static_cast<uint64_t>(step_size_ * 1E9), false, false);
+
+        TickProfiler::singleton().clear();
+        physics_world.step(steps);
+
+        bool world_seen = false;
+        for (const auto& stats : TickProfiler::singleton().getPhaseStats()) {
+            if (stats.name == "World/update") {
+                world_seen = true;
+                benchAssert(stats.count > 0 && stats.count <= steps, "unexpected World/update count");
+            }
+            if (stats.name.find("TickProfilerBenchmark") == 0)
+                continue;
+            report(stats.name + " p50", stats.p50 * 1E3, "us");
+            report(stats.name + " p99", stats.p99 * 1E3, "us");
+        }
+        benchAssert(world_seen, "World/update phase was not recorded");
+
+        const std::string trace_path = "airlib_tick_trace.json";
+        benchAssert(TickProfiler::singleton().writeChromeTrace(trace_path), "could not write trace");
+        std::cout << "    trace: " << trace_path << std::endl;
+    }
+
+private:
+    const float step_size_ = 3E-3f;
+};
+
+
+}}
+#endif
@@ -0,0 +1,67 @@
+#ifndef msr_AirLibBenchmarks_TickSchedulerBenchmark_hpp
+#define msr_AirLibBenchmarks_TickSchedulerBenchmark_hpp
+
+#include "BenchmarkBase.hpp"
+#include "common/common_utils/ScheduledExecutor.hpp"
+
+namespace msr { namespace airlib {
+
+//Runs ScheduledExecutor with empty callback at physics loop period for different
+//spin windows and reports tick jitter, overruns and share of time spent spinning
+class TickSchedulerBenchmark : public BenchmarkBase {
+public:
+    virtual void run() override
+    {
+        std::cout << "TickSchedulerBenchmark: period = " << period_nanos_ / 1E6 << "ms" << std::endl;
+
+        runSpinWindow(0, 1.0f);
+        runSpinWindow(common_utils::ScheduledExecutor::kDefaultSpinWindowNanos, 1.0f);
+        runSpinWindow(period_nanos_, 1.0f);
+    }
+
+private:
+    void runSpinWindow(uint64_t spin_window_nanos, float run_seconds)
+    {
+        typedef common_utils::ScheduledExecutor ScheduledExecutor;
+
+        ScheduledExecutor executor([](uint64_t) { return true; }, period_nanos_, spin_window_nanos);
+        common_utils::Timer timer;
+        timer.start();
+        executor.start();
+        std::this_thread::sleep_for(std::chrono::duration<double>(run_seconds));
+        executor.stop();
+        double elapsed = timer.seconds();
+
+        const ScheduledExecutor::TickStats stats = executor.getStats();
+        benchAssert(stats.ticks > 0, "executor did not tick");
+
+        //smallest bucket bound under which 99% of ticks fall
+        uint64_t total = 0, p99_bound = 0;
+        for (unsigned int i = 0; i < ScheduledExecutor::kJitterBuckets; ++i)
+            total += stats.jitter_histogram[i];
+        uint64_t cumulative = 0;
+        for (unsigned int i = 0; i < ScheduledExecutor::kJitterBuckets; ++i) {
+            cumulative += stats.jitter_histogram[i];
+            if (cumulative * 100 >= total * 99) {
+                p99_bound = i < ScheduledExecutor::kJitterBuckets - 1 ? ScheduledExecutor::jitterBucketBound(i)
+                    : stats.max_jitter_nanos;
+                break;
+            }
+        }
+
+        std::string prefix = common_utils::Utils::stringf("spin window %6.0fus", executor.getSpinWindowNanos() / 1E3);
+        //first period is only used to prime the schedule and doesn't tick
+        report(prefix + " ticks lost to drift", elapsed * 1E9 / period_nanos_ - 1 - stats.ticks, "ticks");
+        report(prefix + " p99 jitter below", p99_bound / 1E3, "us");
+        report(prefix + " max jitter", stats.max_jitter_nanos / 1E3, "us");
+        report(prefix + " overruns", static_cast<double>(stats.overruns), "ticks");
+        report(prefix + " spinning", 100.0 * stats.spin_nanos / (elapsed * 1E9), "% of core");
+    }
+
+private:
+    const uint64_t period_nanos_ = 3000000LL;
+};
+
+
+}}
+#endif
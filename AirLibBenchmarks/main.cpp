@@ -0,0 +1,29 @@
+#include "PhysicsWorldStepBenchmark.hpp"
+#include "PhysicsEngineScalingBenchmark.hpp"
+#include "BatchPhysicsEngineBenchmark.hpp"
+#include "TickSchedulerBenchmark.hpp"
+#include "TickProfilerBenchmark.hpp"
+#include "ImageTransportBenchmark.hpp"
+#include "SwarmRpcBenchmark.hpp"
+#include "LockStepBenchmark.hpp"
+
+int main()
+{
+    using namespace msr::airlib;
+
+    std::unique_ptr<BenchmarkBase> benchmarks[] = {
+        std::unique_ptr<BenchmarkBase>(new PhysicsWorldStepBenchmark()),
+        std::unique_ptr<BenchmarkBase>(new PhysicsEngineScalingBenchmark()),
+        std::unique_ptr<BenchmarkBase>(new BatchPhysicsEngineBenchmark()),
+        std::unique_ptr<BenchmarkBase>(new TickSchedulerBenchmark()),
+        std::unique_ptr<BenchmarkBase>(new TickProfilerBenchmark()),
+        std::unique_ptr<BenchmarkBase>(new ImageTransportBenchmark()),
+        std::unique_ptr<BenchmarkBase>(new SwarmRpcBenchmark()),
+        std::unique_ptr<BenchmarkBase>(new LockStepBenchmark())
+    };
+
+    for (auto& benchmark : benchmarks)
+        benchmark->run();
+
+    return 0;
+}
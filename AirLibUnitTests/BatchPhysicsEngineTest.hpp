@@ -0,0 +1,149 @@
+#ifndef msr_AirLibUnitTests_BatchPhysicsEngineTest_hpp
+#define msr_AirLibUnitTests_BatchPhysicsEngineTest_hpp
+
+#include "TestBase.hpp"
+#include "physics/FastPhysicsEngine.hpp"
+#include "physics/BatchPhysicsEngine.hpp"
+#include "common/SteppableClock.hpp"
+
+namespace msr { namespace airlib {
+
+//Runs identical bodies through FastPhysicsEngine and BatchPhysicsEngine side by side
+//and checks that resulting kinematics agree
+class BatchPhysicsEngineTest : public TestBase {
+private:
+    class ForceVertex : public PhysicsBodyVertex {
+    public:
+        ForceVertex(const Vector3r& position, const Vector3r& normal, const Vector3r& force)
+            : PhysicsBodyVertex(position, normal), force_(force)
+        {
+        }
+    protected:
+        virtual void setWrench(Wrench& wrench) override
+        {
+            wrench.force = force_;
+        }
+    private:
+        Vector3r force_;
+    };
+
+    //box with off-center thrust so it accelerates, spins and generates drag
+    class TestBody : public PhysicsBody {
+    public:
+        TestBody(uint index)
+            : kinematics_(initialState(index)), 
+            environment_(Environment::State(Vector3r::Zero(), GeoPoint(47.641468, -122.140165, 122)))
+        {
+            const real_T mass = 1.0f + 0.1f * index;
+            Matrix3x3r inertia = Matrix3x3r::Zero();
+            inertia(0, 0) = 0.01f; inertia(1, 1) = 0.02f; inertia(2, 2) = 0.03f;
+            inertia(0, 1) = inertia(1, 0) = 0.001f;
+
+            wrench_vertices_.emplace_back(Vector3r(0.1f, 0, 0), Vector3r(0, 0, -1), Vector3r(0, 0, -5.0f * mass));
+            wrench_vertices_.emplace_back(Vector3r(-0.1f, 0, 0), Vector3r(0, 0, -1), 
+                Vector3r(0.01f * index, 0, -5.0f * mass * (1 + 0.002f * index)));
+            drag_vertices_.emplace_back(Vector3r(0, 0, -0.04f), Vector3r(0, 0, -1), 0.1f);
+            drag_vertices_.emplace_back(Vector3r(0, 0, 0.04f), Vector3r(0, 0, 1), 0.1f);
+            drag_vertices_.emplace_back(Vector3r(0.2f, 0, 0), Vector3r(1, 0, 0), 0.05f);
+            drag_vertices_.emplace_back(Vector3r(-0.2f, 0, 0), Vector3r(-1, 0, 0), 0.05f);
+
+            PhysicsBody::initialize(mass, inertia, &kinematics_, &environment_);
+        }
+
+        virtual void reset() override
+        {
+            kinematics_.reset();
+            PhysicsBody::reset();
+        }
+
+        virtual real_T getRestitution() const override { return 0.5f; }
+        virtual real_T getFriction() const override { return 0.7f; }
+        virtual uint wrenchVertexCount() const override { return static_cast<uint>(wrench_vertices_.size()); }
+        virtual PhysicsBodyVertex& getWrenchVertex(uint index) override { return wrench_vertices_.at(index); }
+        virtual const PhysicsBodyVertex& getWrenchVertex(uint index) const override { return wrench_vertices_.at(index); }
+        virtual uint dragVertexCount() const override { return static_cast<uint>(drag_vertices_.size()); }
+        virtual PhysicsBodyVertex& getDragVertex(uint index) override { return drag_vertices_.at(index); }
+        virtual const PhysicsBodyVertex& getDragVertex(uint index) const override { return drag_vertices_.at(index); }
+
+    private:
+        static Kinematics::State initialState(uint index)
+        {
+            Kinematics::State state = Kinematics::State::zero();
+            state.pose.position = Vector3r(index * 1.0f, 0, -10.0f);
+            state.twist.angular = Vector3r(0.1f * index, 0, 0);
+            return state;
+        }
+
+    private:
+        Kinematics kinematics_;
+        Environment environment_;
+        vector<ForceVertex> wrench_vertices_;
+        vector<PhysicsBodyVertex> drag_vertices_;
+    };
+
+public:
+    virtual void run() override
+    {
+        auto clock = std::make_shared<SteppableClock>(3E-3f, 1000000000LL);
+        ClockFactory::get(clock);
+
+        const uint body_count = 16;
+        vector<std::unique_ptr<TestBody>> fast_bodies, batch_bodies;
+        FastPhysicsEngine fast_engine;
+        BatchPhysicsEngine batch_engine;
+        for (uint i = 0; i < body_count; ++i) {
+            fast_bodies.emplace_back(new TestBody(i));
+            batch_bodies.emplace_back(new TestBody(i));
+            fast_bodies.back()->reset();
+            batch_bodies.back()->reset();
+            fast_engine.insert(fast_bodies.back().get());
+            batch_engine.insert(batch_bodies.back().get());
+        }
+        fast_engine.reset();
+        batch_engine.reset();
+
+        for (uint tick = 0; tick < 2000; ++tick) {
+            clock->step();
+
+            //hit the ground once half way through to exercise collision response
+            if (tick == 1000) {
+                for (uint i = 0; i < body_count; i += 2) {
+                    const Vector3r position = fast_bodies[i]->getKinematics().pose.position;
+                    CollisionInfo collision_info(true, Vector3r(0, 0, -1), position, position, 0, 
+                        clock->nowNanos(), "ground", 0);
+                    fast_bodies[i]->setCollisionInfo(collision_info);
+                    batch_bodies[i]->setCollisionInfo(collision_info);
+                }
+            }
+
+            for (uint i = 0; i < body_count; ++i) {
+                fast_bodies[i]->update();
+                batch_bodies[i]->update();
+            }
+            fast_engine.update();
+            batch_engine.update();
+        }
+
+        for (uint i = 0; i < body_count; ++i) {
+            const Kinematics::State& expected = fast_bodies[i]->getKinematics();
+            const Kinematics::State& actual = batch_bodies[i]->getKinematics();
+            const std::string body = " for body " + std::to_string(i);
+
+            testAssert(isClose(expected.pose.position, actual.pose.position), "position differs" + body);
+            testAssert(expected.pose.orientation.angularDistance(actual.pose.orientation) < 1E-3f, "orientation differs" + body);
+            testAssert(isClose(expected.twist.linear, actual.twist.linear), "linear velocity differs" + body);
+            testAssert(isClose(expected.twist.angular, actual.twist.angular), "angular velocity differs" + body);
+            testAssert(fast_bodies[i]->isGrounded() == batch_bodies[i]->isGrounded(), "grounded state differs" + body);
+        }
+    }
+
+private:
+    static bool isClose(const Vector3r& expected, const Vector3r& actual)
+    {
+        return (expected - actual).norm() <= 1E-3f * std::max(1.0f, expected.norm());
+    }
+};
+
+
+}}
+#endif
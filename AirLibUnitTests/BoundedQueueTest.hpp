@@ -0,0 +1,79 @@
+#ifndef msr_AirLibUnitTests_BoundedQueueTest_hpp
+#define msr_AirLibUnitTests_BoundedQueueTest_hpp
+
+#include "TestBase.hpp"
+#include "common/common_utils/BoundedQueue.hpp"
+#include "api/TopicSubscription.hpp"
+#include <thread>
+
+namespace msr { namespace airlib {
+
+class BoundedQueueTest : public TestBase {
+public:
+    virtual void run() override
+    {
+        using common_utils::BoundedQueue;
+        using common_utils::QueueOverflowPolicy;
+
+        //drop oldest keeps latest items
+        BoundedQueue<int> dropping(4, QueueOverflowPolicy::DropOldest);
+        for (int i = 0; i < 10; ++i)
+            testAssert(dropping.push(i), "push failed");
+        testAssert(dropping.size() == 4, "wrong size");
+        testAssert(dropping.getDroppedCount() == 6, "wrong dropped count");
+
+        std::vector<int> batch;
+        testAssert(dropping.popBatch(batch, 3), "popBatch failed");
+        testAssert(batch.size() == 3 && batch[0] == 6 && batch[2] == 8, "wrong batch");
+        testAssert(dropping.popBatch(batch, 3), "popBatch failed");
+        testAssert(batch.size() == 1 && batch[0] == 9, "wrong batch");
+
+        int item;
+        testAssert(!dropping.tryPop(item), "tryPop on empty queue");
+        testAssert(!dropping.pop(item, std::chrono::milliseconds(1)), "pop with timeout on empty queue");
+
+        //block makes producer wait for consumer, nothing is lost
+        BoundedQueue<int> blocking(2, QueueOverflowPolicy::Block);
+        std::thread producer([&blocking]() {
+            for (int i = 0; i < 1000; ++i)
+                blocking.push(i);
+            blocking.close();
+        });
+        int expected = 0;
+        while (blocking.pop(item)) {
+            testAssert(item == expected, "item out of order");
+            testAssert(blocking.size() <= 2, "capacity exceeded");
+            ++expected;
+        }
+        producer.join();
+        testAssert(expected == 1000, "items lost");
+        testAssert(blocking.getDroppedCount() == 0, "blocking queue dropped items");
+        testAssert(!blocking.push(0), "push after close");
+
+        //close wakes up blocked consumer
+        BoundedQueue<int> closing(1);
+        std::thread consumer([&closing, this]() {
+            std::vector<int> items;
+            testAssert(!closing.popBatch(items, 10), "popBatch on closed queue");
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        closing.close();
+        consumer.join();
+
+        //local topic queue fed by subscription callback
+        TopicQueue<int> topic_queue(8);
+        auto callback = topic_queue.callback();
+        std::vector<TopicSample<int>> samples(3);
+        for (int i = 0; i < 3; ++i) {
+            samples[i].time_stamp = 100 + i;
+            samples[i].data = i;
+        }
+        callback(samples);
+        TopicSample<int> sample;
+        testAssert(topic_queue.size() == 3, "wrong topic queue size");
+        testAssert(topic_queue.pop(sample, 0.1f) && sample.time_stamp == 100 && sample.data == 0, "wrong topic sample");
+    }
+};
+
+}}
+#endif
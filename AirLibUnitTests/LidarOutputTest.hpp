@@ -0,0 +1,58 @@
+#ifndef msr_AirLibUnitTests_LidarOutputTest_hpp
+#define msr_AirLibUnitTests_LidarOutputTest_hpp
+
+#include "TestBase.hpp"
+#include "sensors/lidar/LidarBase.hpp"
+
+namespace msr { namespace airlib {
+
+class LidarOutputTest : public TestBase {
+public:
+    virtual void run() override
+    {
+        TestLidar lidar;
+
+        lidar.produce(100);
+        std::shared_ptr<const LidarData> first = lidar.getOutput();
+        testAssert(first->point_cloud.size() == 300 && first->ring.size() == 100, "wrong first scan");
+
+        //reader holding on to scan must not see it change
+        lidar.produce(200);
+        testAssert(first->point_cloud.size() == 300 && first->time_stamp == 100, "published scan was modified");
+        testAssert(lidar.getOutput()->point_cloud.size() == 600, "wrong second scan");
+
+        //once nobody holds it, buffer is reused instead of reallocated
+        const LidarData* first_buffer = first.get();
+        first.reset();
+        lidar.produce(50);
+        std::shared_ptr<const LidarData> third = lidar.getOutput();
+        testAssert(third.get() == first_buffer, "back buffer was not reused");
+        testAssert(third->point_cloud.size() == 150 && third->ring.size() == 50, "stale data in reused buffer");
+        testAssert(third->time_stamp == 50, "getOutput doesn't return latest scan");
+    }
+
+private:
+    class TestLidar : public LidarBase {
+    public:
+        void produce(unsigned int points)
+        {
+            LidarData& output = beginOutput();
+            output.point_cloud.clear();
+            output.ring.clear();
+            for (unsigned int i = 0; i < points; ++i) {
+                output.point_cloud.push_back(static_cast<real_T>(i));
+                output.point_cloud.push_back(0);
+                output.point_cloud.push_back(0);
+                output.ring.push_back(static_cast<uint16_t>(i % 16));
+            }
+            output.time_stamp = points;
+            publishOutput();
+        }
+
+        virtual void update() override
+        {}
+    };
+};
+
+}}
+#endif
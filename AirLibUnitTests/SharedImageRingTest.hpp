@@ -0,0 +1,72 @@
+#ifndef msr_AirLibUnitTests_SharedImageRingTest_hpp
+#define msr_AirLibUnitTests_SharedImageRingTest_hpp
+
+#include "TestBase.hpp"
+#include "common/SharedImageRing.hpp"
+
+namespace msr { namespace airlib {
+
+class SharedImageRingTest : public TestBase {
+public:
+    virtual void run() override
+    {
+        SharedImageRing writer;
+        if (!writer.create("/airlib_shared_image_ring_test", 4, 1 << 20)) {
+            //not supported on this platform
+            return;
+        }
+
+        SharedImageRing reader;
+        testAssert(reader.open("/airlib_shared_image_ring_test"), "cannot open ring");
+        testAssert(reader.getSlotCount() == 4, "wrong slot count");
+
+        std::vector<SharedImageRing::Descriptor> descriptors(6);
+        std::vector<uint8_t> payload(1000);
+        for (size_t i = 0; i < descriptors.size(); ++i) {
+            std::fill(payload.begin(), payload.end(), static_cast<uint8_t>(i));
+            testAssert(writer.write(payload.data(), payload.size(), descriptors[i]), "write failed");
+        }
+        std::vector<uint8_t> oversized(static_cast<size_t>(writer.getSlotSize()) + 1);
+        testAssert(!writer.write(oversized.data(), oversized.size(), descriptors[0]), "oversized payload was accepted");
+        testAssert(!reader.write(payload.data(), payload.size(), descriptors[0]), "reader could write");
+
+        //first two images were overwritten by last two
+        testAssert(!reader.isCurrent(descriptors[0]) && !reader.isCurrent(descriptors[1]), "overwritten slot is current");
+        for (size_t i = 2; i < descriptors.size(); ++i) {
+            const uint8_t* data = reader.getData(descriptors[i]);
+            testAssert(reader.isCurrent(descriptors[i]), "slot is not current");
+            testAssert(data != nullptr && data[0] == i && data[999] == i, "wrong payload");
+        }
+
+        //server that takes over ring without removing it first starts sequences again at 1
+        const uint64_t first_instance = reader.getInstanceId();
+        SharedImageRing restarted;
+        testAssert(restarted.create("/airlib_shared_image_ring_test", 4, 1 << 20), "cannot take over ring");
+        testAssert(reader.getInstanceId() != first_instance, "instance id did not change");
+        for (size_t i = 0; i < descriptors.size(); ++i)
+            testAssert(!reader.isCurrent(descriptors[i]) && reader.getData(descriptors[i]) == nullptr, "slot of old instance is current");
+        SharedImageRing::Descriptor after_restart;
+        testAssert(restarted.write(payload.data(), payload.size(), after_restart), "write after restart failed");
+        testAssert(reader.isCurrent(after_restart), "slot of new instance is not current");
+        restarted.close();
+        writer.close();
+
+        //server that removed ring and created new one, reader still maps old one until it reopens
+        SharedImageRing recreated;
+        testAssert(recreated.create("/airlib_shared_image_ring_test", 4, 1 << 20), "cannot recreate ring");
+        SharedImageRing::Descriptor recreated_descriptor;
+        testAssert(recreated.write(payload.data(), payload.size(), recreated_descriptor), "write to recreated ring failed");
+        testAssert(recreated_descriptor.instance_id != reader.getInstanceId(), "old mapping has new instance id");
+        testAssert(!reader.isCurrent(recreated_descriptor) && reader.getData(recreated_descriptor) == nullptr,
+            "old mapping accepted slot of new ring");
+        testAssert(reader.open("/airlib_shared_image_ring_test") && reader.isCurrent(recreated_descriptor),
+            "reopened mapping does not accept slot of new ring");
+        recreated.close();
+
+        SharedImageRing stale_reader;
+        testAssert(!stale_reader.open("/airlib_shared_image_ring_test"), "ring was not removed");
+    }
+};
+
+}}
+#endif
@@ -0,0 +1,88 @@
+#ifndef msr_AirLibUnitTests_TickProfilerTest_hpp
+#define msr_AirLibUnitTests_TickProfilerTest_hpp
+
+#include "TestBase.hpp"
+#include "common/TickProfiler.hpp"
+#include <thread>
+#include <atomic>
+
+namespace msr { namespace airlib {
+
+class TickProfilerTest : public TestBase {
+public:
+    virtual void run() override
+    {
+        TickProfiler& profiler = TickProfiler::singleton();
+        TickProfiler::PhaseId phase = profiler.registerPhase("TickProfilerTest/phase");
+        testAssert(profiler.registerPhase("TickProfilerTest/phase") == phase, "phase registered twice");
+
+        //durations 1..100us recorded from two threads
+        profiler.clear();
+        uint64_t start = TickProfiler::nanos();
+        auto record = [&](uint64_t first, uint64_t last) {
+            for (uint64_t us = first; us <= last; ++us)
+                profiler.record(phase, start, start + us * 1000);
+        };
+        std::thread other(record, 51, 100);
+        record(1, 50);
+        other.join();
+
+        TickProfiler::PhaseStats stats;
+        testAssert(findPhase(profiler.getPhaseStats(), "TickProfilerTest/phase", stats), "phase not found");
+        testAssert(stats.count == 100, "wrong count");
+        testAssert(std::abs(stats.p50 - 0.050) < 1E-9, "wrong p50");
+        testAssert(std::abs(stats.p99 - 0.099) < 1E-9, "wrong p99");
+        testAssert(std::abs(stats.max - 0.100) < 1E-9, "wrong max");
+
+        //ring keeps only most recent events
+        profiler.clear();
+        start = TickProfiler::nanos();
+        record(1, 20000);
+        testAssert(findPhase(profiler.getPhaseStats(), "TickProfilerTest/phase", stats), "phase not found");
+        testAssert(stats.count < 20000, "ring did not overwrite old events");
+        testAssert(stats.count == 8192, "completed events in ring were not all reported");
+        testAssert(std::abs(stats.max - 20.0) < 1E-9, "most recent event lost");
+
+        //reading while another thread overwrites the ring never yields torn events
+        profiler.clear();
+        start = TickProfiler::nanos();
+        std::atomic<bool> writing(true);
+        std::thread writer([&]() {
+            while (writing)
+                profiler.record(phase, start, start + 5000);
+        });
+        for (int i = 0; i < 20; ++i) {
+            if (findPhase(profiler.getPhaseStats(), "TickProfilerTest/phase", stats))
+                testAssert(std::abs(stats.p50 - 0.005) < 1E-9 && std::abs(stats.max - 0.005) < 1E-9, "torn event was reported");
+        }
+        writing = false;
+        writer.join();
+
+        //buffers of exited threads are dropped beyond kMaxRetiredBuffers
+        TickProfiler::PhaseId exited_phase = profiler.registerPhase("TickProfilerTest/exited");
+        for (size_t i = 0; i < TickProfiler::kMaxRetiredBuffers + 4; ++i) {
+            std::thread([&]() { profiler.record(exited_phase, start, start + 1000); }).join();
+        }
+        testAssert(findPhase(profiler.getPhaseStats(), "TickProfilerTest/exited", stats), "exited phase not found");
+        testAssert(stats.count == TickProfiler::kMaxRetiredBuffers, "buffers of exited threads were not capped");
+
+        profiler.clear();
+        testAssert(!findPhase(profiler.getPhaseStats(), "TickProfilerTest/phase", stats), "clear did not drop events");
+    }
+
+private:
+    static bool findPhase(const std::vector<TickProfiler::PhaseStats>& all_stats, const std::string& name,
+        TickProfiler::PhaseStats& found)
+    {
+        for (const auto& stats : all_stats) {
+            if (stats.name == name) {
+                found = stats;
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+}}
+#endif
@@ -5,6 +5,11 @@
 #include "WorkerThreadTest.hpp"
 #include "QuaternionTest.hpp"
 #include "CelestialTests.hpp"
+#include "BatchPhysicsEngineTest.hpp"
+#include "TickProfilerTest.hpp"
+#include "SharedImageRingTest.hpp"
+#include "BoundedQueueTest.hpp"
+#include "LidarOutputTest.hpp"
 
 int main()
 {
@@ -14,6 +19,11 @@ int main()
         std::unique_ptr<TestBase>(new QuaternionTest()),
         std::unique_ptr<TestBase>(new CelestialTest()),
         std::unique_ptr<TestBase>(new SettingsTest()),
+        std::unique_ptr<TestBase>(new BatchPhysicsEngineTest()),
+        std::unique_ptr<TestBase>(new TickProfilerTest()),
+        std::unique_ptr<TestBase>(new SharedImageRingTest()),
+        std::unique_ptr<TestBase>(new BoundedQueueTest()),
+        std::unique_ptr<TestBase>(new LidarOutputTest()),
         std::unique_ptr<TestBase>(new SimpleFlightTest())
         //,
         //std::unique_ptr<TestBase>(new PixhawkTest()),
@@ -208,19 +208,23 @@ private:
                 right_img[idx-counter] = result->response.at(1).image_data_uint8 [idx];
             }
 
-            //Get SGM disparity and confidence
-            p_state->ProcessFrameAirSim(result->sample,dtime,left_img, right_img);
+            //Get SGM disparity and confidence, straight from the RGBA images
+            p_state->ProcessFrameAirSim(result->sample, dtime,
+                ImageView(result->response.at(0).image_data_uint8.data(), w, h, w * 4, 4),
+                ImageView(result->response.at(1).image_data_uint8.data(), w, h, w * 4, 4));
+            MapView<float> sgm_disparity = p_state->GetDisparity();
+            MapView<unsigned char> sgm_confidence = p_state->GetConfidence();
 
             //Get adjust SGM disparity and compute depth
 	        for (int idx = 0; idx < (h*w); idx++)
 	        {
-		        float d = p_state->dispMap[idx];
+		        float d = sgm_disparity(idx % w, idx / w);
 		        if (d < FLT_MAX)
 		        {
                     sgm_depth_data[idx] = -(B*f/d);
                     sgm_disparity_data[idx] = -d;
 		        }
-                sgm_confidence_data[idx] = p_state->confMap[idx];
+                sgm_confidence_data[idx] = sgm_confidence(idx % w, idx / w);
                 
 	        }
 
@@ -0,0 +1,96 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+//Reads back the PNG files svpng() in writePNG.h writes: 8 bit gray, RGB or RGBA, stored (uncompressed)
+//deflate blocks and no filtering, which is what DataCollectorSGM records. This is not a general PNG
+//reader, anything else is rejected. Returns false if the file can't be read.
+inline bool readUncompressedPNG(const std::string& path, unsigned int& w, unsigned int& h, int& channels, std::vector<uint8_t>& img)
+{
+    FILE* fp = fopen(path.c_str(), "rb");
+    if (fp == nullptr)
+        return false;
+    std::vector<uint8_t> file;
+    uint8_t buffer[4096];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+        file.insert(file.end(), buffer, buffer + read);
+    fclose(fp);
+
+    auto u32 = [&file](size_t pos) {
+        return (static_cast<unsigned int>(file[pos]) << 24) | (static_cast<unsigned int>(file[pos + 1]) << 16) |
+            (static_cast<unsigned int>(file[pos + 2]) << 8) | file[pos + 3];
+    };
+
+    static const uint8_t magic[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    if (file.size() < 8 || !std::equal(magic, magic + 8, file.begin()))
+        return false;
+
+    //chunks: length, type, data, crc
+    std::vector<uint8_t> idat;
+    w = h = 0;
+    channels = 0;
+    for (size_t pos = 8; pos + 12 <= file.size();) {
+        unsigned int length = u32(pos);
+        if (pos + 12 + length > file.size())
+            return false;
+        std::string type(file.begin() + pos + 4, file.begin() + pos + 8);
+        size_t data = pos + 8;
+        if (type == "IHDR") {
+            if (length < 13)
+                return false;
+            w = u32(data);
+            h = u32(data + 4);
+            uint8_t depth = file[data + 8], color = file[data + 9];
+            if (depth != 8 || file[data + 10] != 0 || file[data + 11] != 0 || file[data + 12] != 0)
+                return false;
+            channels = color == 0 ? 1 : (color == 2 ? 3 : (color == 6 ? 4 : 0));
+            if (channels == 0)
+                return false;
+        }
+        else if (type == "IDAT")
+            idat.insert(idat.end(), file.begin() + data, file.begin() + data + length);
+        else if (type == "IEND")
+            break;
+        pos = data + length + 4;
+    }
+    if (channels == 0 || idat.size() < 2)
+        return false;
+
+    //zlib header, then stored blocks: final flag and type in a byte of their own, then the length and its
+    //one's complement, little endian
+    std::vector<uint8_t> raw;
+    size_t pos = 2;
+    bool final_block = false;
+    while (!final_block) {
+        if (pos + 5 > idat.size() || (idat[pos] & 6) != 0)
+            return false;
+        final_block = (idat[pos] & 1) != 0;
+        size_t length = idat[pos + 1] | (idat[pos + 2] << 8);
+        pos += 5;
+        if (pos + length > idat.size())
+            return false;
+        raw.insert(raw.end(), idat.begin() + pos, idat.begin() + pos + length);
+        pos += length;
+    }
+
+    //each row starts with its filter type, which has to be none
+    size_t row_size = static_cast<size_t>(w) * channels;
+    if (raw.size() < h * (row_size + 1))
+        return false;
+    img.resize(h * row_size);
+    for (size_t y = 0; y < h; ++y) {
+        const uint8_t* row = raw.data() + y * (row_size + 1);
+        if (row[0] != 0)
+            return false;
+        std::copy(row + 1, row + 1 + row_size, img.begin() + y * row_size);
+    }
+    return true;
+}
@@ -18,8 +18,50 @@ STRICT_MODE_ON
 
 #include "../../SGM/src/sgmstereo/sgmstereo.h"
 #include "../../SGM/src/stereoPipeline/StateStereo.h"                                                                                        
+#include "StereoDepthPipeline.hpp"
+#include <mutex>
+
 namespace msr { namespace airlib {
 
+//StereoFrameSource for the simulator. The fetch stage and the planner use the client from different
+//threads, so its calls are made one at a time.
+class SimStereoFrameSource : public StereoFrameSource {
+public:
+    SimStereoFrameSource(RpcLibClientBase& client, const std::vector<ImageCaptureBase::ImageRequest>& request)
+        : client_(client), request_(request)
+    {}
+
+    virtual bool fetch(StereoFrame& frame) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        frame.pose = client_.simGetVehiclePose();
+        std::vector<ImageCaptureBase::ImageResponse> response = client_.simGetImages(request_);
+        if (response.size() < 2)
+            throw std::length_error("No images received!");
+        //the frame gets the response buffers, PrepareFrame reads them in place
+        frame.left.swap(response.at(0).image_data_uint8);
+        frame.right.swap(response.at(1).image_data_uint8);
+        return true;
+    }
+
+    virtual Pose getPose() override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return client_.simGetVehiclePose();
+    }
+
+    virtual void setPose(const Pose& pose) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        client_.simSetVehiclePose(pose, true);
+    }
+
+private:
+    RpcLibClientBase& client_;
+    std::vector<ImageCaptureBase::ImageRequest> request_;
+    std::mutex mutex_;
+};
+
 class DepthNav {
 public: //types
 	struct Params {
@@ -51,6 +93,9 @@ public: //types
         real_T control_loop_period = 0.25f*max_allowed_obs_dist; //30.0f / 1000; //sec
         real_T max_linear_speed = 10; // m/s
         real_T max_angular_speed = 6; // rad/s
+
+        //run gotoGoalSGM's stages on their own threads, or one after another
+        bool pipelined_sgm = false;
 	};
 
     class DepthNavException : public std::runtime_error {
@@ -69,8 +114,12 @@ public:
 
     void initialize(RpcLibClientBase& client, const std::vector<ImageCaptureBase::ImageRequest>& request){
         const std::vector<ImageCaptureBase::ImageResponse>& response_init = client.simGetImages(request);
-        params_.depth_width = response_init.at(0).width;
-        params_.depth_height = response_init.at(0).height;
+        initialize(response_init.at(0).width, response_init.at(0).height);
+    }
+
+    void initialize(unsigned int depth_width, unsigned int depth_height){
+        params_.depth_width = depth_width;
+        params_.depth_height = depth_height;
 		params_.vehicle_height_px = int(ceil(params_.depth_height * params_.vehicle_height / (tan(params_.fov / 2) * params_.max_allowed_obs_dist * 2))); //height
 		params_.vehicle_width_px = int(ceil(params_.depth_width * params_.vehicle_width / (tan(hfov2vfov(params_.fov, params_.depth_height, params_.depth_width) / 2) * params_.max_allowed_obs_dist * 2))); //width    
     }
@@ -134,58 +183,30 @@ public:
 
     virtual void gotoGoalSGM(const Pose& goal_pose, RpcLibClientBase& client, const std::vector<ImageCaptureBase::ImageRequest>& request, CStateStereo * p_state)
     {
+        SimStereoFrameSource source(client, request);
+        StereoDepthPipeline::Params pipeline_params;
+        pipeline_params.fov = params_.fov;
+        StereoDepthPipeline pipeline(source, *p_state, pipeline_params);
+        gotoGoalSGM(goal_pose, pipeline);
+    }
 
-        typedef ImageCaptureBase::ImageResponse ImageResponse;
-        typedef common_utils::FileSystem FileSystem;
-
-        float dtime = 0;
-        int counter = 0;
-
-        std::vector<float> sgm_depth_image(params_.depth_height*params_.depth_width);
-
-        do {
-            const Pose current_pose = client.simGetVehiclePose();
+    //Plans with the newest depth out of pipeline. Depth is only valid relative to the pose the images
+    //were taken from, which in pipelined mode can be older than the last pose we set, so we plan from
+    //frame.pose and not from where the vehicle is by now
+    virtual void gotoGoalSGM(const Pose& goal_pose, StereoDepthPipeline& pipeline)
+    {
+        StereoFrameSource& source = pipeline.getSource();
 
-            const std::vector<ImageResponse>& response = client.simGetImages(request);
+        auto plan = [&](const StereoFrame& frame) {
+            const Pose& current_pose = frame.pose;
 
-            if (response.size() == 0)
-                throw std::length_error("No images received!");
-            /*
-            if (response.at(0).height != params_.depth_height || response.at(0).width != params_.depth_height)
-                throw DepthNavException("Image Dimension mismatch. Please check left camera in the AirSim config file.");
-
-            if (response.at(1).height != params_.depth_height || response.at(1).width != params_.depth_height)
-                throw DepthNavException("Image Dimension mismatch. Please check right camera in the AirSim config file.");
-            */
-            const std::vector<uint8_t>& left_image = response.at(0).image_data_uint8;
-            const std::vector<uint8_t>& right_image = response.at(1).image_data_uint8;
-
-            //baseline * focal_length = depth * disparity
-            float f = params_.depth_width / (2 * tan(params_.fov/2));
-            float B = 0.25; 
-   
-            p_state->ProcessFrameAirSim(counter, dtime, left_image, right_image);
-                                                                     
-	        for (unsigned int idx = 0; idx < (params_.depth_height*params_.depth_width); idx++)
-	        {
-		        float d = p_state->dispMap[idx];
-		        if (d < FLT_MAX)
-		        {
-                    //float dn = (d - dmin)/drange;
-                    sgm_depth_image[idx] = -(B*f/d);
-
-		        }
-	        }
-
-            counter++;
-
-            const Pose next_pose = getNextPose(sgm_depth_image, goal_pose.position, 
+            const Pose next_pose = getNextPose(frame.depth, goal_pose.position, 
                 current_pose, params_.control_loop_period);
 
             if (VectorMath::hasNan(next_pose))
                 throw DepthNavException("No further path can be found.");
             else { 
-                client.simSetVehiclePose(next_pose, true);
+                source.setPose(next_pose);
             /*
                 //convert pose to velocity commands
                 //obey max linear speed constraint
@@ -209,16 +230,21 @@ public:
                 //For ComputerVision mode, we will just create new pose
                 Pose contrained_next_pose(current_pose.position + linear_vel * params_.control_loop_period,
                     to_orientation);
-                client.simSetVehiclePose(contrained_next_pose, true);
+                source.setPose(contrained_next_pose);
             */  
             }
 
             real_T dist2goal = getDistanceToGoal(next_pose.position, goal_pose.position);
             if (dist2goal <= params_.min_exit_dist_from_goal)
-                return;
+                return false;
             Utils::log(Utils::stringf("Distance to target: %f", dist2goal));
+            return true;
+        };
 
-        } while (true);
+        if (params_.pipelined_sgm)
+            pipeline.run(plan);
+        else
+            pipeline.runSerial(plan);
     }
 
 protected:    
@@ -0,0 +1,171 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "DepthNavCost.hpp"
+#include "StereoDepthPipeline.hpp"
+#include "../DataCollection/readPNG.h"
+#include "common/common_utils/FileSystem.hpp"
+#include <iostream>
+#include <iomanip>
+#include <thread>
+
+namespace msr { namespace airlib {
+
+//StereoFrameSource that plays back the left/right pairs DataCollectorSGM recorded, over and over, in place
+//of the simulator. Each fetch waits fetch_delay_ms first for the time simGetImages takes to render and
+//send the images, and the pose is whatever the planner last set.
+class RecordedStereoFrameSource : public StereoFrameSource {
+public:
+    RecordedStereoFrameSource(const std::string& data_dir, unsigned int frame_count, unsigned int fetch_delay_ms)
+        : frame_count_(frame_count), fetch_delay_ms_(fetch_delay_ms)
+    {
+        //DataCollectorSGM numbers samples from 1
+        for (int sample = 0; ; ++sample) {
+            std::string left_file = FileSystem::combine(data_dir, Utils::stringf("left/%06d.png", sample));
+            std::string right_file = FileSystem::combine(data_dir, Utils::stringf("right/%06d.png", sample));
+            Pair pair;
+            unsigned int right_width, right_height;
+            int channels, right_channels;
+            if (!readUncompressedPNG(left_file, width_, height_, channels, pair.left) ||
+                !readUncompressedPNG(right_file, right_width, right_height, right_channels, pair.right)) {
+                if (sample == 0)
+                    continue;
+                break;
+            }
+            if (channels < 3 || right_channels != channels || right_width != width_ || right_height != height_)
+                throw std::runtime_error("Stereo pair " + left_file + " is not a pair of RGB images of the same size");
+            if (pairs_.size() > 0 && pair.left.size() != pairs_[0].left.size())
+                throw std::runtime_error("Recorded stereo pairs differ in size at " + left_file);
+            pairs_.push_back(std::move(pair));
+        }
+        if (pairs_.size() == 0)
+            throw std::runtime_error("No recorded stereo pairs in " + data_dir + ", record some with DataCollectorSGM");
+    }
+
+    virtual bool fetch(StereoFrame& frame) override
+    {
+        if (fetched_ >= frame_count_)
+            return false;
+        std::this_thread::sleep_for(std::chrono::milliseconds(fetch_delay_ms_));
+        const Pair& pair = pairs_[fetched_++ % pairs_.size()];
+        frame.left = pair.left;
+        frame.right = pair.right;
+        frame.pose = getPose();
+        return true;
+    }
+
+    virtual Pose getPose() override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pose_;
+    }
+
+    virtual void setPose(const Pose& pose) override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pose_ = pose;
+    }
+
+    unsigned int getWidth() const
+    {
+        return width_;
+    }
+
+    unsigned int getHeight() const
+    {
+        return height_;
+    }
+
+    size_t getPairCount() const
+    {
+        return pairs_.size();
+    }
+
+private:
+    typedef common_utils::FileSystem FileSystem;
+
+    struct Pair {
+        std::vector<uint8_t> left, right;
+    };
+
+    std::vector<Pair> pairs_;
+    unsigned int width_ = 0, height_ = 0;
+    unsigned int frame_count_;
+    unsigned int fetched_ = 0;
+    unsigned int fetch_delay_ms_;
+
+    std::mutex mutex_;
+    Pose pose_ = Pose(Vector3r(0, 0, -1), Quaternionr(1, 0, 0, 0));
+};
+
+//Headless DepthNavCost::gotoGoalSGM on recorded stereo pairs, with the stages one after another and
+//pipelined with and without latest_frame_wins. Reports frames/s and the time each stage takes, and how
+//old the depth is by the time the planner has used it.
+class DepthNavBenchmark {
+public:
+    DepthNavBenchmark(const std::string& data_dir, unsigned int frame_count = 100, unsigned int fetch_delay_ms = 20)
+        : data_dir_(data_dir), frame_count_(frame_count), fetch_delay_ms_(fetch_delay_ms)
+    {}
+
+    void run()
+    {
+        runMode("serial", false, false);
+        runMode("pipelined, every frame", true, false);
+        runMode("pipelined, latest frame wins", true, true);
+    }
+
+private:
+    void runMode(const std::string& name, bool pipelined, bool latest_frame_wins)
+    {
+        RecordedStereoFrameSource source(data_dir_, frame_count_, fetch_delay_ms_);
+
+        DepthNavCost depth_nav;
+        depth_nav.params_.pipelined_sgm = pipelined;
+        depth_nav.initialize(source.getWidth(), source.getHeight());
+
+        SGMOptions options;
+        options.maxImageDimensionWidth = source.getWidth();
+        CStateStereo stereo;
+        stereo.Initialize(options, source.getHeight(), source.getWidth());
+
+        StereoDepthPipeline::Params pipeline_params;
+        pipeline_params.fov = depth_nav.params_.fov;
+        pipeline_params.latest_frame_wins = latest_frame_wins;
+        StereoDepthPipeline pipeline(source, stereo, pipeline_params);
+
+        std::cout << "DepthNavBenchmark " << name << ": " << frame_count_ << " frames of "
+            << source.getPairCount() << " recorded " << source.getWidth() << "x" << source.getHeight() << " pairs, "
+            << fetch_delay_ms_ << "ms fetch delay" << std::endl;
+
+        //far enough away that it is never reached
+        Pose goal_pose(Vector3r(1000, 0, -1), Quaternionr(1, 0, 0, 0));
+        try {
+            depth_nav.gotoGoalSGM(goal_pose, pipeline);
+        }
+        catch (const DepthNav::DepthNavException& e) {
+            std::cout << "    stopped early: " << e.what() << std::endl;
+        }
+        stereo.CleanUp();
+
+        std::cout << std::fixed << std::setprecision(2);
+        std::cout << "    " << std::setw(8) << "stage" << std::setw(10) << "frames" << std::setw(10) << "dropped"
+            << std::setw(12) << "mean ms" << std::setw(12) << "max ms" << std::setw(12) << "frames/s" << std::endl;
+        for (int stage = 0; stage < StereoDepthPipeline::StageCount; ++stage) {
+            auto stats = pipeline.getStats(static_cast<StereoDepthPipeline::Stage>(stage));
+            std::cout << "    " << std::setw(8) << StereoDepthPipeline::getStageName(static_cast<StereoDepthPipeline::Stage>(stage))
+                << std::setw(10) << stats.frames << std::setw(10) << stats.dropped << std::setw(12) << stats.mean_ms
+                << std::setw(12) << stats.max_ms << std::setw(12) << stats.frames_per_sec << std::endl;
+        }
+        std::cout << "    fetch to plan latency mean " << pipeline.getMeanLatencyMs() << "ms, max "
+            << pipeline.getMaxLatencyMs() << "ms" << std::endl;
+    }
+
+private:
+    std::string data_dir_;
+    unsigned int frame_count_;
+    unsigned int fetch_delay_ms_;
+};
+
+}}
@@ -0,0 +1,386 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "common/Common.hpp"
+#include "common/common_utils/BoundedQueue.hpp"
+#include "../../SGM/src/stereoPipeline/StateStereo.h"
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <functional>
+#include <exception>
+#include <chrono>
+#include <memory>
+#include <cfloat>
+
+namespace msr { namespace airlib {
+
+//One stereo pair on its way through StereoDepthPipeline. Frames are recycled, so their buffers are only
+//allocated for the first few frames.
+struct StereoFrame {
+    uint64_t id = 0;
+    //vehicle pose when the images were taken
+    Pose pose;
+    //RGB or RGBA images at input resolution as the source fetched them
+    std::vector<uint8_t> left, right;
+    //gray scale images at SGM resolution
+    std::vector<uint8_t> left_gray, right_gray;
+    //depth at SGM resolution, pixels without a disparity keep the last depth they had
+    std::vector<float> depth;
+    //when fetching the frame started, for the latency up to planning
+    std::chrono::steady_clock::time_point fetch_start;
+};
+
+//Where StereoDepthPipeline gets its stereo pairs and the vehicle the planner steers: the simulator, or
+//recorded pairs for benchmarks. fetch() is only called by the fetch stage, getPose() and setPose() only by
+//the planner, which runs on another thread.
+class StereoFrameSource {
+public:
+    virtual ~StereoFrameSource() = default;
+
+    //fills in frame.left, frame.right and frame.pose, returns false when there are no more frames
+    virtual bool fetch(StereoFrame& frame) = 0;
+    virtual Pose getPose() = 0;
+    virtual void setPose(const Pose& pose) = 0;
+};
+
+/*
+    Stereo depth for a planner in four stages on their own threads: fetch the pair from the source, gray
+    scale at SGM resolution (the simulator's cameras are already rectified, so downsampling is all that is
+    left to do), SGM and depth from disparity, and planning, which runs on the thread that calls run(). The
+    stages are joined by bounded queues. With latest_frame_wins a stage that finds the queue in front of
+    the next one full replaces the oldest frame in it, so every stage, and the planner in particular, works
+    on the newest frame there is and frames do not get old waiting behind a slow stage. The replaced frames
+    are counted as dropped by the stage they did not get to. Otherwise a full queue blocks the stage feeding
+    it, and every frame gets planned with.
+*/
+class StereoDepthPipeline {
+public:
+    enum Stage {
+        StageFetch = 0, StagePrepare, StageStereo, StagePlan, StageCount
+    };
+
+    struct Params {
+        //capacity of the queues between the stages
+        size_t queue_capacity = 1;
+        bool latest_frame_wins = true;
+        //baseline * focal_length = depth * disparity
+        float baseline = 0.25f;
+        real_T fov = Utils::degreesToRadians(90.0f);
+    };
+
+    struct StageStats {
+        uint64_t frames = 0;        //frames the stage finished
+        uint64_t dropped = 0;       //frames replaced by newer ones before the stage got to them
+        double mean_ms = 0;         //time the stage spent on a frame
+        double max_ms = 0;
+        double frames_per_sec = 0;  //over the whole run
+    };
+
+    //plans with the depth of frame, returns false to stop
+    typedef std::function<bool(const StereoFrame& frame)> PlanFunc;
+
+    StereoDepthPipeline(StereoFrameSource& source, CStateStereo& stereo, const Params& params)
+        : source_(source), stereo_(stereo), params_(params)
+    {
+        //a frame in each stage and in each queue, and one the fetch stage can be filling while the
+        //others are busy
+        size_t frame_count = 3 * params_.queue_capacity + 5;
+        for (size_t i = 0; i < frame_count; ++i)
+            frames_.push_back(std::unique_ptr<StereoFrame>(new StereoFrame()));
+    }
+
+    StereoFrameSource& getSource()
+    {
+        return source_;
+    }
+
+    //runs until the source runs out of frames or plan returns false. An exception in any stage stops the
+    //others and is rethrown here.
+    void run(const PlanFunc& plan)
+    {
+        begin();
+
+        //frames are replaced by pushFrame rather than by the queues, so they go back to free_
+        free_.reset(new FrameQueue(frames_.size(), common_utils::QueueOverflowPolicy::Block));
+        to_prepare_.reset(new FrameQueue(params_.queue_capacity, common_utils::QueueOverflowPolicy::Block));
+        to_stereo_.reset(new FrameQueue(params_.queue_capacity, common_utils::QueueOverflowPolicy::Block));
+        to_plan_.reset(new FrameQueue(params_.queue_capacity, common_utils::QueueOverflowPolicy::Block));
+        for (auto& frame : frames_)
+            free_->push(frame.get());
+
+        std::thread fetch_thread(&StereoDepthPipeline::runStage, this, &StereoDepthPipeline::fetchLoop);
+        std::thread prepare_thread(&StereoDepthPipeline::runStage, this, &StereoDepthPipeline::prepareLoop);
+        std::thread stereo_thread(&StereoDepthPipeline::runStage, this, &StereoDepthPipeline::stereoLoop);
+
+        try {
+            StereoFrame* frame;
+            while (to_plan_->pop(frame)) {
+                bool go_on = planFrame(*frame, plan);
+                free_->push(frame);
+                if (!go_on)
+                    break;
+            }
+        }
+        catch (...) {
+            setError(std::current_exception());
+        }
+
+        closeQueues();
+        fetch_thread.join();
+        prepare_thread.join();
+        stereo_thread.join();
+        end();
+
+        if (error_)
+            std::rethrow_exception(error_);
+    }
+
+    //the same stages one after another on the calling thread, for comparison with run()
+    void runSerial(const PlanFunc& plan)
+    {
+        begin();
+        StereoFrame& frame = *frames_[0];
+        try {
+            while (fetchFrame(frame)) {
+                prepareFrame(frame);
+                stereoFrame(frame);
+                if (!planFrame(frame, plan))
+                    break;
+            }
+        }
+        catch (...) {
+            end();
+            throw;
+        }
+        end();
+    }
+
+    StageStats getStats(Stage stage) const
+    {
+        const Counter& counter = counters_[stage];
+        StageStats stats;
+        stats.frames = counter.frames;
+        stats.dropped = counter.dropped;
+        stats.mean_ms = stats.frames > 0 ? counter.total_usec / 1E3 / stats.frames : 0;
+        stats.max_ms = counter.max_usec / 1E3;
+        double seconds = getRunSeconds();
+        stats.frames_per_sec = seconds > 0 ? stats.frames / seconds : 0;
+        return stats;
+    }
+
+    //from the start of fetching a frame to the end of planning with it
+    double getMeanLatencyMs() const
+    {
+        uint64_t frames = latency_.frames;
+        return frames > 0 ? latency_.total_usec / 1E3 / frames : 0;
+    }
+
+    double getMaxLatencyMs() const
+    {
+        return latency_.max_usec / 1E3;
+    }
+
+    double getRunSeconds() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto end = running_ ? std::chrono::steady_clock::now() : end_;
+        return std::chrono::duration<double>(end - start_).count();
+    }
+
+    static const char* getStageName(Stage stage)
+    {
+        static const char* names[] = { "fetch", "prepare", "sgm", "plan" };
+        return stage < StageCount ? names[stage] : "";
+    }
+
+private:
+    typedef common_utils::BoundedQueue<StereoFrame*> FrameQueue;
+    typedef std::chrono::steady_clock clock;
+
+    struct Counter {
+        std::atomic<uint64_t> frames{ 0 };
+        std::atomic<uint64_t> dropped{ 0 };
+        std::atomic<uint64_t> total_usec{ 0 };
+        std::atomic<uint64_t> max_usec{ 0 };
+
+        void add(clock::time_point start)
+        {
+            uint64_t usec = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start).count());
+            total_usec += usec;
+            uint64_t max = max_usec;
+            while (usec > max && !max_usec.compare_exchange_weak(max, usec)) {
+            }
+            ++frames;
+        }
+
+        void clear()
+        {
+            frames = dropped = total_usec = max_usec = 0;
+        }
+    };
+
+    void begin()
+    {
+        for (auto& counter : counters_)
+            counter.clear();
+        latency_.clear();
+        error_ = nullptr;
+        next_id_ = 0;
+        std::lock_guard<std::mutex> lock(mutex_);
+        start_ = clock::now();
+        running_ = true;
+    }
+
+    void end()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        end_ = clock::now();
+        running_ = false;
+    }
+
+    bool fetchFrame(StereoFrame& frame)
+    {
+        auto start = clock::now();
+        frame.fetch_start = start;
+        frame.id = next_id_++;
+        if (!source_.fetch(frame))
+            return false;
+        counters_[StageFetch].add(start);
+        return true;
+    }
+
+    void prepareFrame(StereoFrame& frame)
+    {
+        auto start = clock::now();
+        size_t pixels = static_cast<size_t>(stereo_.processingFrameWidth) * stereo_.processingFrameHeight;
+        frame.left_gray.resize(pixels);
+        frame.right_gray.resize(pixels);
+        if (!stereo_.PrepareFrame(frame.left, frame.right, frame.left_gray.data(), frame.right_gray.data()))
+            throw std::runtime_error("Stereo images are not at the resolution CStateStereo was initialized with");
+        counters_[StagePrepare].add(start);
+    }
+
+    void stereoFrame(StereoFrame& frame)
+    {
+        auto start = clock::now();
+        stereo_.ProcessFrameGray(frame.left_gray.data(), frame.right_gray.data());
+
+        //depth only changes where there is a disparity, like the loop this pipeline replaced
+        MapView<float> disparity = stereo_.GetDisparity();
+        depth_.resize(static_cast<size_t>(disparity.width) * disparity.height, 0);
+        float f = disparity.width / (2 * std::tan(params_.fov / 2));
+        for (int y = 0; y < disparity.height; ++y) {
+            const float* row = disparity.row(y);
+            float* depth_row = depth_.data() + static_cast<size_t>(y) * disparity.width;
+            for (int x = 0; x < disparity.width; ++x) {
+                if (row[x] < FLT_MAX)
+                    depth_row[x] = -(params_.baseline * f / row[x]);
+            }
+        }
+        frame.depth = depth_;
+        counters_[StageStereo].add(start);
+    }
+
+    bool planFrame(const StereoFrame& frame, const PlanFunc& plan)
+    {
+        auto start = clock::now();
+        bool go_on = plan(frame);
+        counters_[StagePlan].add(start);
+        latency_.add(frame.fetch_start);
+        return go_on;
+    }
+
+    void fetchLoop()
+    {
+        StereoFrame* frame;
+        while (free_->pop(frame)) {
+            if (!fetchFrame(*frame) || !pushFrame(*to_prepare_, frame, StagePrepare))
+                break;
+        }
+        to_prepare_->close();
+    }
+
+    void prepareLoop()
+    {
+        StereoFrame* frame;
+        while (to_prepare_->pop(frame)) {
+            prepareFrame(*frame);
+            if (!pushFrame(*to_stereo_, frame, StageStereo))
+                break;
+        }
+        to_stereo_->close();
+    }
+
+    void stereoLoop()
+    {
+        StereoFrame* frame;
+        while (to_stereo_->pop(frame)) {
+            stereoFrame(*frame);
+            if (!pushFrame(*to_plan_, frame, StagePlan))
+                break;
+        }
+        to_plan_->close();
+    }
+
+    //each queue has one stage feeding it, so once the oldest frame is out there is room
+    bool pushFrame(FrameQueue& queue, StereoFrame* frame, Stage next_stage)
+    {
+        StereoFrame* oldest;
+        if (params_.latest_frame_wins && queue.size() >= queue.capacity() && queue.tryPop(oldest)) {
+            free_->push(oldest);
+            ++counters_[next_stage].dropped;
+        }
+        return queue.push(frame);
+    }
+
+    void runStage(void (StereoDepthPipeline::*loop)())
+    {
+        try {
+            (this->*loop)();
+        }
+        catch (...) {
+            setError(std::current_exception());
+            closeQueues();
+        }
+    }
+
+    void setError(std::exception_ptr error)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!error_)
+            error_ = error;
+    }
+
+    void closeQueues()
+    {
+        free_->close();
+        to_prepare_->close();
+        to_stereo_->close();
+        to_plan_->close();
+    }
+
+private:
+    StereoFrameSource& source_;
+    CStateStereo& stereo_;
+    Params params_;
+
+    std::vector<std::unique_ptr<StereoFrame>> frames_;
+    std::unique_ptr<FrameQueue> free_, to_prepare_, to_stereo_, to_plan_;
+    //only used by the SGM stage
+    std::vector<float> depth_;
+    uint64_t next_id_ = 0;
+
+    Counter counters_[StageCount];
+    Counter latency_;
+
+    mutable std::mutex mutex_;
+    std::exception_ptr error_;
+    bool running_ = false;
+    clock::time_point start_, end_;
+};
+
+}}
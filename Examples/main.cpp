@@ -6,6 +6,7 @@
 #include "DepthNav/DepthNavCost.hpp"
 #include "DepthNav/DepthNavThreshold.hpp"
 #include "DepthNav/DepthNavOptAStar.hpp"
+#include "DepthNav/DepthNavBenchmark.hpp"
 #include <iostream>
 #include <string>
 #include <sys/stat.h>
@@ -171,10 +172,23 @@ void runDepthNavSGM()
     delete p_state;
 }
 
+void runDepthNavBenchmark(int argc, const char *argv[])
+{
+    using namespace msr::airlib;
+
+    //recorded with runDataCollectorSGM
+    DepthNavBenchmark benchmark(argc < 2 ? 
+        common_utils::FileSystem::combine(
+            common_utils::FileSystem::getAppDataFolder(), "data_sgm")
+        : std::string(argv[1]), argc < 3 ? 100 : std::stoi(argv[2]));
+    benchmark.run();
+}
+
 int main(int argc, const char *argv[])
 {
     //runDepthNavGT();
     //runDepthNavSGM();
+    //runDepthNavBenchmark(argc, argv);
     runDataCollectorSGM(argc, argv);
 
     return 0;
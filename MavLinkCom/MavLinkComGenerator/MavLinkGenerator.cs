@@ -40,6 +40,7 @@ namespace MavLinkComGenerator
                     impl.WriteLine("// Copyright (c) Microsoft Corporation. All rights reserved.");
                     impl.WriteLine("// Licensed under the MIT License.");
                     impl.WriteLine("#include \"MavLinkMessages.hpp\""); ;
+                    impl.WriteLine("#include \"MavLinkCodec.hpp\"");
                     impl.WriteLine("#include <sstream>");
                     impl.WriteLine("using namespace mavlinkcom;");
                     impl.WriteLine("");
@@ -252,12 +253,9 @@ namespace MavLinkComGenerator
                     }
                 }
 
-                header.WriteLine("    virtual std::string toJSon();");
-                header.WriteLine("protected:");
-
-                header.WriteLine("    virtual int pack(char* buffer) const;");
-                impl.WriteLine("int MavLink{0}::pack(char* buffer) const {{", name);
-
+                // wire layout for MavLinkCodec, the fields are declared in the same order so they can be
+                // copied as one block.
+                header.WriteLine("    static constexpr MavLinkField kFields[] = {");
                 int offset = 0;
                 for (int i = 0; i < length; i++)
                 {
@@ -267,49 +265,28 @@ namespace MavLinkComGenerator
                     {
                         type = "uint8_t";
                     }
-                    int size = typeSize[type];
-                    if (field.isArray)
-                    {
-                        // it is an array.
-                        impl.WriteLine("    pack_{0}_array({1}, buffer, reinterpret_cast<const {0}*>(&this->{2}[0]), {3});", type, field.array_length, field.name, offset);
-                        size *= field.array_length;
-                    }
-                    else
-                    {
-                        impl.WriteLine("    pack_{0}(buffer, reinterpret_cast<const {0}*>(&this->{1}), {2});", type, field.name, offset);
-                    }
-                    offset += size;
+                    int count = field.isArray ? field.array_length : 1;
+                    header.WriteLine("        {{ {0}, MavLinkFieldType::{1}, {2} }},", offset, fieldTypes[type], count);
+                    offset += typeSize[type] * count;
                 }
-                impl.WriteLine("    return {0};", offset);
+                header.WriteLine("    };");
+                header.WriteLine("    char* fieldData() {{ return reinterpret_cast<char*>(&{0}); }}", m.fields[0].name);
+                header.WriteLine("    const char* fieldData() const {{ return reinterpret_cast<const char*>(&{0}); }}", m.fields[0].name);
+                impl.WriteLine("constexpr MavLinkField MavLink{0}::kFields[];", name);
+                impl.WriteLine("");
+
+                header.WriteLine("    virtual std::string toJSon();");
+                header.WriteLine("protected:");
+
+                header.WriteLine("    virtual int pack(char* buffer) const;");
+                impl.WriteLine("int MavLink{0}::pack(char* buffer) const {{", name);
+                impl.WriteLine("    return MavLinkCodec<MavLink{0}>::pack(*this, buffer);", name);
                 impl.WriteLine("}");
                 impl.WriteLine("");
 
                 header.WriteLine("    virtual int unpack(const char* buffer);");
                 impl.WriteLine("int MavLink{0}::unpack(const char* buffer) {{", name);
-
-                offset = 0;
-                for (int i = 0; i < length; i++)
-                {
-                    var field = m.fields[i];
-                    var type = field.type;
-                    if (type == "uint8_t_mavlink_version")
-                    {
-                        type = "uint8_t";
-                    }
-                    int size = typeSize[type];
-                    if (field.isArray)
-                    {
-                        // it is an array.
-                        impl.WriteLine("    unpack_{0}_array({1}, buffer, reinterpret_cast<{0}*>(&this->{2}[0]), {3});", type, field.array_length, field.name, offset);
-                        size *= field.array_length;
-                    }
-                    else
-                    {
-                        impl.WriteLine("    unpack_{0}(buffer, reinterpret_cast<{0}*>(&this->{1}), {2});", type, field.name, offset);
-                    }
-                    offset += size;
-                }
-                impl.WriteLine(" return {0};", offset);
+                impl.WriteLine("    return MavLinkCodec<MavLink{0}>::unpack(buffer, *this);", name);
                 impl.WriteLine("}");
                 impl.WriteLine("");
 
@@ -444,6 +421,21 @@ namespace MavLinkComGenerator
             {"uint64_t" , 8 }
         };
 
+        public static Dictionary<string, string> fieldTypes = new Dictionary<string, string>()
+        {
+            {"float"    , "Float"},
+            {"double"   , "Double"},
+            {"char"     , "Char"},
+            {"int8_t"   , "Int8"},
+            {"uint8_t"  , "UInt8"},
+            {"int16_t"  , "Int16"},
+            {"uint16_t" , "UInt16"},
+            {"int32_t"  , "Int32"},
+            {"uint32_t" , "UInt32"},
+            {"int64_t"  , "Int64"},
+            {"uint64_t" , "UInt64"}
+        };
+
         private void GenerateEnums()
         {
 
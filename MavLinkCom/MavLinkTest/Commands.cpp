@@ -504,6 +504,8 @@ bool PlayLogCommand::Parse(const std::vector<std::string>& args)
 
     this->_syncParams = false;
     this->_fileName = "";
+    this->_fromSeconds = 0;
+    this->_toSeconds = 0;
 
     std::string cmd = args[0];
     if (cmd == "playlog") {
@@ -513,17 +515,23 @@ bool PlayLogCommand::Parse(const std::vector<std::string>& args)
             if (arg == "-sync") {
                 this->_syncParams = true;
             }
+            else if (arg.substr(0, 6) == "-from:") {
+                this->_fromSeconds = std::stod(arg.substr(6));
+            }
+            else if (arg.substr(0, 4) == "-to:") {
+                this->_toSeconds = std::stod(arg.substr(4));
+            }
             else if (_fileName == "") {
-                _fileName = args.at(1);
-                log_.openForReading(_fileName);
+                _fileName = arg;
+                log_.open(_fileName);
             }
             else {
-                printf("Usage: playlog <mavlink_logfile>\n");
+                printf("Usage: playlog <mavlink_logfile> [-sync] [-from:seconds] [-to:seconds]\n");
                 return false;
             }
         }
         if (_fileName == "") {
-            printf("Usage: playlog <mavlink_logfile>\n");
+            printf("Usage: playlog <mavlink_logfile> [-sync] [-from:seconds] [-to:seconds]\n");
             return false;
         }
     }
@@ -584,7 +592,13 @@ void PlayLogCommand::Execute(std::shared_ptr<MavLinkVehicle> com)
     }
     printf("loading log...\n");
 
-    while (log_.read(msg, log_timestamp)) {
+    // the index lets us jump straight to the requested part of the log.
+    uint64_t start = log_.getStartTime() + static_cast<uint64_t>(_fromSeconds * 1E6);
+    uint64_t end = _toSeconds > 0 ? log_.getStartTime() + static_cast<uint64_t>(_toSeconds * 1E6) : log_.getEndTime() + 1;
+    log_.forEach(start, end, [&](const MavLinkLogRecord& record) {
+        record.toMessage(msg);
+        log_timestamp = record.timestamp;
+
         if (log_start_timestamp == 0)
             log_start_timestamp = log_timestamp;
 
@@ -691,7 +705,8 @@ void PlayLogCommand::Execute(std::shared_ptr<MavLinkVehicle> com)
         default:
             break;
         }
-    }
+        return true;
+    });
 
     printf("### Log playback is complete.\n");
 }
@@ -8,6 +8,7 @@
 #include "MavLinkMessages.hpp"
 #include "MavLinkVideoStream.hpp"
 #include "MavLinkFtpClient.hpp"
+#include "MavLinkLogReader.hpp"
 #include "Utils.hpp"
 #include <string>
 #include <vector>
@@ -435,17 +436,19 @@ public:
     virtual bool Parse(const std::vector<std::string>& args);
 
     virtual void PrintHelp() {
-        printf("playlog filename - play commands in specified .mavlink file.\n");
+        printf("playlog filename [-sync] [-from:seconds] [-to:seconds] - play commands in specified .mavlink file, optionally only the part between the given number of seconds from the start of the log.\n");
     }
 
     virtual void Execute(std::shared_ptr<MavLinkVehicle> com);
 
 private:
-    MavLinkFileLog log_;
+    MavLinkLogReader log_;
     float quaternion_[4];
     float x, y, z;
     std::string _fileName;
     bool _syncParams;
+    double _fromSeconds;
+    double _toSeconds;
 };
 
 
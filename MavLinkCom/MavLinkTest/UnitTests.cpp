@@ -12,7 +12,24 @@
 #include "MavLinkVideoStream.hpp"
 #include "MavLinkTcpServer.hpp"
 #include "MavLinkFtpClient.hpp"
+#include "MavLinkNode.hpp"
+#include "MavLinkLogReader.hpp"
+#include "MavLinkCodec.hpp"
+#include "MavLinkParser.hpp"
 #include "Semaphore.hpp"
+#include <atomic>
+#include <algorithm>
+#include <vector>
+#include <fstream>
+#include <iterator>
+#include <cstdlib>
+#include <ctime>
+#include <random>
+#include <map>
+#include <condition_variable>
+#ifdef __linux__
+#include <sys/resource.h>
+#endif
 
 STRICT_MODE_OFF
 #include "json.hpp"
@@ -39,6 +56,9 @@ void UnitTests::RunAll(std::string comPort, int boardRate)
 	RunTest("SerialPx4Test", [=] { SerialPx4Test(); });
 	RunTest("FtpTest", [=] { FtpTest(); });
     RunTest("JSonLogTest", [=] { JSonLogTest(); });
+    RunTest("ParserFuzzTest", [=] { ParserFuzzTest(); });
+    RunTest("ParamFetchTest", [=] { ParamFetchTest(); });
+    RunTest("FtpWindowTest", [=] { FtpWindowTest(); });
 }
 
 void UnitTests::RunTest(const std::string& name, TestHandler handler)
@@ -458,4 +478,1444 @@ void UnitTests::JSonLogTest()
         printf("found %d valid rows in the json file, and %d HIGHRES_IMU records\n", found, imu);
     }
 
-}
\ No newline at end of file
+}
+
+void UnitTests::LoopbackBenchmark(const std::string& logFile, int seconds)
+{
+    // the stream to pump, either a recorded log or a synthetic mix resembling PX4 HIL traffic:
+    // HIL_SENSOR and HIL_ACTUATOR_CONTROLS at full rate, HIL_GPS every 20th and a heartbeat every 1000th.
+    std::vector<MavLinkMessage> stream;
+    if (logFile.size() > 0) {
+        MavLinkFileLog log;
+        log.openForReading(logFile);
+        MavLinkMessage msg;
+        uint64_t timestamp;
+        while (log.read(msg, timestamp)) {
+            stream.push_back(msg);
+        }
+        log.close();
+        if (stream.size() == 0) {
+            throw std::runtime_error(Utils::stringf("No messages found in log file '%s'", logFile.c_str()));
+        }
+    }
+    else {
+        MavLinkHilSensor sensor;
+        MavLinkHilActuatorControls actuators;
+        MavLinkHilGps gps;
+        MavLinkHeartbeat hb;
+        hb.autopilot = 0;
+        hb.base_mode = 0;
+        hb.custom_mode = 0;
+        hb.mavlink_version = 3;
+        hb.system_status = 1;
+        hb.type = 1;
+        for (int i = 0; i < 1000; i++) {
+            MavLinkMessage msg;
+            sensor.time_usec = i * 1000;
+            sensor.encode(msg);
+            stream.push_back(msg);
+            actuators.time_usec = i * 1000;
+            actuators.encode(msg);
+            stream.push_back(msg);
+            if (i % 20 == 0) {
+                gps.time_usec = i * 1000;
+                gps.encode(msg);
+                stream.push_back(msg);
+            }
+            if (i == 0) {
+                hb.encode(msg);
+                stream.push_back(msg);
+            }
+        }
+    }
+    for (auto& msg : stream) {
+        msg.sysid = 1;
+        msg.compid = 1;
+    }
+
+    // every message we send gets next sequence number from the sending connection, so the
+    // handler can find the send time by seq as long as fewer than 256 messages are in flight.
+    const int window = 128;
+    std::atomic<uint64_t> sendTimes[256];
+    for (auto& t : sendTimes) {
+        t = 0;
+    }
+    std::atomic<uint64_t> received(0);
+    std::vector<uint64_t> latencies;
+    latencies.reserve(1000000);
+    auto nanos = [] {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    };
+
+    printf("    stream: %d messages from %s\n", static_cast<int>(stream.size()), logFile.size() > 0 ? logFile.c_str() : "synthetic HIL mix");
+
+    // first one message per write, then the same stream packed into batches that go out with one write each.
+    for (int sendBatch : { 1, 8 }) {
+        std::fill(std::begin(sendTimes), std::end(sendTimes), 0);
+        received = 0;
+        latencies.clear();
+
+        auto localConnection = MavLinkConnection::connectLocalUdp("benchmark", "127.0.0.1", 14589);
+        auto id = localConnection->subscribe([&](std::shared_ptr<MavLinkConnection> connection, const MavLinkMessage& msg) {
+            uint64_t sent = sendTimes[msg.seq].load(std::memory_order_acquire);
+            if (sent != 0 && latencies.size() < latencies.capacity()) {
+                latencies.push_back(nanos() - sent);
+            }
+            received.fetch_add(1, std::memory_order_release);
+        });
+        auto remoteConnection = MavLinkConnection::connectRemoteUdp("benchmark", "127.0.0.1", "127.0.0.1", 14589);
+
+        std::vector<MavLinkMessage> batch;
+        batch.reserve(sendBatch);
+        uint64_t sent = 0;
+        uint64_t lost = 0;
+        uint64_t start = nanos();
+        uint64_t end = start + static_cast<uint64_t>(seconds) * 1000000000ULL;
+        size_t next = 0;
+        while (nanos() < end) {
+            // keep window full; udp may drop under load so give up on messages that don't show up
+            uint64_t waitStart = nanos();
+            while (sent - received.load(std::memory_order_acquire) - lost + sendBatch > window) {
+                if (nanos() - waitStart > 100000000ULL) {
+                    lost = sent - received.load(std::memory_order_acquire);
+                    break;
+                }
+                std::this_thread::yield();
+            }
+            batch.clear();
+            for (int i = 0; i < sendBatch; i++) {
+                sendTimes[sent & 0xFF].store(nanos(), std::memory_order_release);
+                if (sendBatch > 1) {
+                    batch.push_back(stream[next]);
+                }
+                else {
+                    remoteConnection->sendMessage(stream[next]);
+                }
+                sent++;
+                next = (next + 1) % stream.size();
+            }
+            if (sendBatch > 1) {
+                remoteConnection->sendMessages(batch);
+            }
+        }
+        uint64_t drainStart = nanos();
+        while (received.load() + lost < sent && nanos() - drainStart < 1000000000ULL) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        double elapsed = static_cast<double>(nanos() - start) / 1E9;
+
+        localConnection->unsubscribe(id);
+        remoteConnection->close();
+        localConnection->close();
+
+        MavLinkTelemetry telemetry;
+        localConnection->getTelemetry(telemetry);
+        MavLinkTelemetry sendTelemetry;
+        remoteConnection->getTelemetry(sendTelemetry);
+
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&](double p) {
+            if (latencies.size() == 0) {
+                return 0.0;
+            }
+            size_t index = std::min(latencies.size() - 1, static_cast<size_t>(p * latencies.size()));
+            return static_cast<double>(latencies[index]) / 1000.0;
+        };
+        auto perPacket = [](uint32_t calls, uint64_t packets) {
+            return packets > 0 ? static_cast<double>(calls) / packets : 0.0;
+        };
+
+        printf("    %d message(s) per send batch:\n", sendBatch);
+        printf("    sent %llu, received %llu in %.2f seconds\n", static_cast<unsigned long long>(sent),
+            static_cast<unsigned long long>(received.load()), elapsed);
+        printf("    throughput: %.0f packets/s\n", received.load() / elapsed);
+        printf("    syscalls per packet: %.3f write, %.3f read\n", perPacket(sendTelemetry.portWrites, sent),
+            perPacket(telemetry.portReads, received.load()));
+        printf("    send to handler latency: p50 %.1f us, p99 %.1f us, max %.1f us\n", percentile(0.5), percentile(0.99), percentile(1.0));
+        printf("    handler time: %u us for %u messages\n", telemetry.handlerMicroseconds, telemetry.messagesHandled);
+    }
+}
+
+namespace {
+    // process cpu time in seconds, user plus system, across all threads.
+    double processCpuSeconds()
+    {
+#ifdef __linux__
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1E6;
+#else
+        return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+    }
+
+    int processThreadCount()
+    {
+#ifdef __linux__
+        std::ifstream status("/proc/self/status");
+        std::string line;
+        while (std::getline(status, line)) {
+            if (line.compare(0, 8, "Threads:") == 0) {
+                return std::atoi(line.c_str() + 8);
+            }
+        }
+#endif
+        return -1;
+    }
+}
+
+void UnitTests::EventLoopBenchmark(int seconds)
+{
+    // each simulated vehicle is a pair of udp connections on the loopback interface with a node sending
+    // heartbeats on one end, like a PX4 SITL instance talking to AirSim.  One thread sends HIL_SENSOR at
+    // 250 Hz to every vehicle with the send time in time_usec so the handler can measure latency.
+    struct Vehicle {
+        std::shared_ptr<MavLinkConnection> local;
+        std::shared_ptr<MavLinkConnection> remote;
+        std::shared_ptr<MavLinkNode> node;
+        int subscription = 0;
+        std::atomic<uint64_t> received{ 0 };
+        std::atomic<uint64_t> heartbeats{ 0 };
+        std::vector<uint64_t> latencies;
+    };
+    auto micros = [] {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    };
+    const int rateHz = 250;
+    const int basePort = 14600;
+
+    printf("    %8s %12s %8s %8s %10s %10s %10s\n", "vehicles", "mode", "threads", "cpu %", "msgs/s", "p50 us", "p99 us");
+    for (int vehicleCount : { 1, 10, 50 }) {
+        for (int loopThreads : { 0, 2 }) {
+            int baseThreads = processThreadCount();
+            if (!MavLinkConnection::setEventLoopThreads(loopThreads)) {
+                printf("    %8d %12s   not supported on this platform\n", vehicleCount, "event loop");
+                continue;
+            }
+
+            std::vector<std::unique_ptr<Vehicle>> vehicles;
+            for (int i = 0; i < vehicleCount; i++) {
+                std::unique_ptr<Vehicle> v(new Vehicle());
+                Vehicle* vehicle = v.get();
+                vehicle->latencies.reserve(static_cast<size_t>(rateHz * seconds * 2));
+                int port = basePort + i;
+                vehicle->local = MavLinkConnection::connectLocalUdp("vehicle" + std::to_string(i), "127.0.0.1", port);
+                // each connection calls its handler from one thread at a time so vehicle needs no lock.
+                vehicle->subscription = vehicle->local->subscribe([vehicle, micros](std::shared_ptr<MavLinkConnection> connection, const MavLinkMessage& msg) {
+                    unused(connection);
+                    if (msg.msgid == static_cast<int>(MavLinkMessageIds::MAVLINK_MSG_ID_HIL_SENSOR)) {
+                        MavLinkHilSensor sensor;
+                        sensor.decode(msg);
+                        if (vehicle->latencies.size() < vehicle->latencies.capacity()) {
+                            vehicle->latencies.push_back(micros() - sensor.time_usec);
+                        }
+                        vehicle->received++;
+                    }
+                    else if (msg.msgid == static_cast<int>(MavLinkMessageIds::MAVLINK_MSG_ID_HEARTBEAT)) {
+                        vehicle->heartbeats++;
+                    }
+                });
+                vehicle->remote = MavLinkConnection::connectRemoteUdp("vehicle" + std::to_string(i), "127.0.0.1", "127.0.0.1", port);
+                vehicle->node = std::make_shared<MavLinkNode>(1, 1);
+                vehicle->node->connect(vehicle->remote);
+                vehicle->node->startHeartbeat();
+                vehicles.push_back(std::move(v));
+            }
+            int threads = processThreadCount() - baseThreads;
+
+            uint64_t sent = 0;
+            double cpuStart = processCpuSeconds();
+            auto start = std::chrono::steady_clock::now();
+            auto end = start + std::chrono::seconds(seconds);
+            auto next = start;
+            MavLinkHilSensor sensor;
+            MavLinkMessage msg;
+            while (next < end) {
+                for (auto& vehicle : vehicles) {
+                    sensor.time_usec = micros();
+                    sensor.encode(msg);
+                    vehicle->remote->sendMessage(msg);
+                    sent++;
+                }
+                next += std::chrono::microseconds(1000000 / rateHz);
+                std::this_thread::sleep_until(next);
+            }
+            // give stragglers a moment to arrive before we stop counting.
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            double cpu = processCpuSeconds() - cpuStart;
+            double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            uint64_t received = 0;
+            std::vector<uint64_t> latencies;
+            for (size_t i = 0; i < vehicles.size(); i++) {
+                auto& vehicle = vehicles[i];
+                vehicle->local->unsubscribe(vehicle->subscription);
+                vehicle->node->close();
+                vehicle->remote->close();
+                vehicle->local->close();
+                received += vehicle->received;
+                if (vehicle->heartbeats == 0) {
+                    printf("    warning: no heartbeats received from vehicle on port %d\n", basePort + static_cast<int>(i));
+                }
+                latencies.insert(latencies.end(), vehicle->latencies.begin(), vehicle->latencies.end());
+            }
+            vehicles.clear();
+
+            std::sort(latencies.begin(), latencies.end());
+            auto percentile = [&](double p) {
+                if (latencies.size() == 0) {
+                    return 0.0;
+                }
+                size_t index = std::min(latencies.size() - 1, static_cast<size_t>(p * latencies.size()));
+                return static_cast<double>(latencies[index]);
+            };
+            printf("    %8d %12s %8d %8.1f %10.0f %10.0f %10.0f\n", vehicleCount, loopThreads > 0 ? "event loop" : "threads",
+                threads, 100.0 * cpu / elapsed, received / elapsed, percentile(0.5), percentile(0.99));
+            if (received < sent) {
+                printf("    warning: %llu of %llu messages were lost\n", static_cast<unsigned long long>(sent - received),
+                    static_cast<unsigned long long>(sent));
+            }
+        }
+    }
+    MavLinkConnection::setEventLoopThreads(0);
+}
+
+void UnitTests::LogReaderBenchmark(int messageCount)
+{
+    // write a synthetic HIL log at 4 kHz, HIL_SENSOR and HIL_ACTUATOR_CONTROLS alternating with a HIL_GPS every 20th.
+    auto logPath = FileSystem::combine(FileSystem::getTempFolder(), "logreaderbenchmark.mavlink");
+    const uint64_t startTime = 1500000000000000ULL;
+    const uint64_t period = 250;
+    {
+        MavLinkMessage sensorMsg, actuatorMsg, gpsMsg;
+        MavLinkHilSensor sensor;
+        sensor.encode(sensorMsg);
+        MavLinkHilActuatorControls actuators;
+        actuators.encode(actuatorMsg);
+        MavLinkHilGps gps;
+        gps.encode(gpsMsg);
+
+        MavLinkFileLog log;
+        log.openForWriting(logPath);
+        for (int i = 0; i < messageCount; i++) {
+            const MavLinkMessage& msg = (i % 20 == 0) ? gpsMsg : ((i % 2 == 0) ? sensorMsg : actuatorMsg);
+            log.write(msg, startTime + i * period);
+        }
+        log.close();
+    }
+    FileSystem::remove(MavLinkLogReader::getIndexFileName(logPath));
+
+    // pull 10 seconds out of the middle of the log.
+    uint64_t rangeStart = startTime + (messageCount / 2) * period;
+    uint64_t rangeEnd = rangeStart + 10000000;
+    const int gpsId = static_cast<int>(MavLinkMessageIds::MAVLINK_MSG_ID_HIL_GPS);
+    auto seconds = [](std::chrono::steady_clock::time_point since) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - since).count();
+    };
+
+    // what we had to do before: read every message and keep the ones we want.
+    auto start = std::chrono::steady_clock::now();
+    size_t scanCount = 0, scanGps = 0;
+    double latitude = 0;
+    {
+        MavLinkFileLog log;
+        log.openForReading(logPath);
+        MavLinkMessage msg;
+        uint64_t timestamp;
+        while (log.read(msg, timestamp)) {
+            if (timestamp >= rangeStart && timestamp < rangeEnd) {
+                scanCount++;
+                if (msg.msgid == gpsId) {
+                    MavLinkHilGps gps;
+                    gps.decode(msg);
+                    latitude += gps.lat;
+                    scanGps++;
+                }
+            }
+        }
+        log.close();
+    }
+    double scanTime = seconds(start);
+
+    MavLinkLogReader reader;
+    start = std::chrono::steady_clock::now();
+    reader.open(logPath);
+    double buildTime = seconds(start);
+    reader.close();
+
+    start = std::chrono::steady_clock::now();
+    reader.open(logPath);
+    double loadTime = seconds(start);
+
+    start = std::chrono::steady_clock::now();
+    size_t rangeCount = 0;
+    reader.forEach(rangeStart, rangeEnd, [&](const MavLinkLogRecord& record) {
+        unused(record);
+        rangeCount++;
+        return true;
+    });
+    double rangeTime = seconds(start);
+
+    start = std::chrono::steady_clock::now();
+    size_t rangeGps = 0;
+    reader.forEach(rangeStart, rangeEnd, [&](const MavLinkLogRecord& record) {
+        MavLinkMessage msg;
+        record.toMessage(msg);
+        MavLinkHilGps gps;
+        gps.decode(msg);
+        latitude -= gps.lat;
+        rangeGps++;
+        return true;
+    }, gpsId);
+    double gpsTime = seconds(start);
+    size_t total = reader.size();
+    reader.close();
+
+    FileSystem::remove(MavLinkLogReader::getIndexFileName(logPath));
+    FileSystem::remove(logPath);
+
+    if (total != static_cast<size_t>(messageCount) || rangeCount != scanCount || rangeGps != scanGps || latitude != 0) {
+        throw std::runtime_error(Utils::stringf("MavLinkLogReader found %d messages and %d HIL_GPS in range, full scan found %d and %d",
+            static_cast<int>(rangeCount), static_cast<int>(rangeGps), static_cast<int>(scanCount), static_cast<int>(scanGps)));
+    }
+
+    printf("    log: %d messages, extracting 10 seconds (%d messages, %d HIL_GPS)\n", messageCount,
+        static_cast<int>(scanCount), static_cast<int>(scanGps));
+    printf("    full scan with MavLinkFileLog::read: %.3f s\n", scanTime);
+    printf("    MavLinkLogReader first open, building and saving index: %.3f s\n", buildTime);
+    printf("    MavLinkLogReader open with saved index: %.3f s\n", loadTime);
+    printf("    indexed time range: %.6f s, time range of HIL_GPS only: %.6f s\n", rangeTime, gpsTime);
+}
+
+void UnitTests::LogWriterBenchmark(int messageCount)
+{
+    // measures how long sendMessage takes with no send log, with MavLinkFileLog writing on the calling
+    // thread and with its background writer.  A local connection soaks up the messages.
+    auto logPath = FileSystem::combine(FileSystem::getTempFolder(), "logwriterbenchmark.mavlink");
+    auto nanos = [] {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    };
+    const char* modes[] = { "no log", "log", "async log" };
+
+    printf("    %10s %10s %10s %10s %12s %10s %10s\n", "mode", "p50 ns", "p99 ns", "max ns", "MB/s", "blocked", "dropped");
+    for (int mode = 0; mode < 3; mode++) {
+        auto localConnection = MavLinkConnection::connectLocalUdp("logwriter", "127.0.0.1", 14591);
+        auto remoteConnection = MavLinkConnection::connectRemoteUdp("logwriter", "127.0.0.1", "127.0.0.1", 14591);
+
+        std::shared_ptr<MavLinkFileLog> log;
+        if (mode > 0) {
+            log = std::make_shared<MavLinkFileLog>();
+            log->setAsync(mode == 2);
+            log->openForWriting(logPath);
+            remoteConnection->startLoggingSendMessage(log);
+        }
+
+        std::vector<uint64_t> latencies;
+        latencies.reserve(messageCount);
+        MavLinkHilSensor sensor;
+        sensor.sysid = 1;
+        sensor.compid = 1;
+        MavLinkMessage msg;
+        uint64_t start = nanos();
+        for (int i = 0; i < messageCount; i++) {
+            sensor.time_usec = i;
+            sensor.encode(msg);
+            uint64_t before = nanos();
+            remoteConnection->sendMessage(msg);
+            latencies.push_back(nanos() - before);
+        }
+        double elapsed = static_cast<double>(nanos() - start) / 1E9;
+
+        MavLinkLogWriterStats stats;
+        size_t logged = 0;
+        if (log != nullptr) {
+            remoteConnection->stopLoggingSendMessage();
+            log->close();
+            log->getWriterStats(stats);
+            MavLinkLogReader reader;
+            reader.open(logPath, false);
+            logged = reader.size();
+            reader.close();
+            FileSystem::remove(logPath);
+        }
+        remoteConnection->close();
+        localConnection->close();
+
+        if (log != nullptr && logged + stats.droppedAppends != static_cast<size_t>(messageCount)) {
+            throw std::runtime_error(Utils::stringf("%s wrote %d of %d messages", modes[mode], static_cast<int>(logged), messageCount));
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+        printf("    %10s %10llu %10llu %10llu %12.1f %10llu %10llu\n", modes[mode],
+            static_cast<unsigned long long>(latencies[latencies.size() / 2]),
+            static_cast<unsigned long long>(latencies[latencies.size() * 99 / 100]),
+            static_cast<unsigned long long>(latencies.back()),
+            static_cast<double>(stats.bytesWritten) / elapsed / 1E6,
+            static_cast<unsigned long long>(stats.blockedAppends),
+            static_cast<unsigned long long>(stats.droppedAppends));
+    }
+}
+
+namespace {
+    // the field by field pack and unpack that MavLinkMessages.cpp used before MavLinkCodec, kept here so
+    // CodecBenchmark can compare against it.
+    class LegacyHilSensor : public MavLinkHilSensor {
+    protected:
+        virtual int pack(char* buffer) const override {
+            pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->xacc), 8);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->yacc), 12);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->zacc), 16);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->xgyro), 20);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->ygyro), 24);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->zgyro), 28);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->xmag), 32);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->ymag), 36);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->zmag), 40);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->abs_pressure), 44);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->diff_pressure), 48);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->pressure_alt), 52);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->temperature), 56);
+            pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->fields_updated), 60);
+            return 64;
+        }
+        virtual int unpack(const char* buffer) override {
+            unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->xacc), 8);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->yacc), 12);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->zacc), 16);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->xgyro), 20);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->ygyro), 24);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->zgyro), 28);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->xmag), 32);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->ymag), 36);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->zmag), 40);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->abs_pressure), 44);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->diff_pressure), 48);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->pressure_alt), 52);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->temperature), 56);
+            unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->fields_updated), 60);
+            return 64;
+        }
+    };
+
+    class LegacyHilGps : public MavLinkHilGps {
+    protected:
+        virtual int pack(char* buffer) const override {
+            pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
+            pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 8);
+            pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 12);
+            pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->alt), 16);
+            pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->eph), 20);
+            pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->epv), 22);
+            pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->vel), 24);
+            pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->vn), 26);
+            pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->ve), 28);
+            pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->vd), 30);
+            pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->cog), 32);
+            pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->fix_type), 34);
+            pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->satellites_visible), 35);
+            return 36;
+        }
+        virtual int unpack(const char* buffer) override {
+            unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
+            unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 8);
+            unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 12);
+            unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->alt), 16);
+            unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->eph), 20);
+            unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->epv), 22);
+            unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->vel), 24);
+            unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->vn), 26);
+            unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->ve), 28);
+            unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->vd), 30);
+            unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->cog), 32);
+            unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->fix_type), 34);
+            unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->satellites_visible), 35);
+            return 36;
+        }
+    };
+
+    class LegacyAttitude : public MavLinkAttitude {
+    protected:
+        virtual int pack(char* buffer) const override {
+            pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->roll), 4);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->pitch), 8);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->yaw), 12);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->rollspeed), 16);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->pitchspeed), 20);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->yawspeed), 24);
+            return 28;
+        }
+        virtual int unpack(const char* buffer) override {
+            unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->roll), 4);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->pitch), 8);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->yaw), 12);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->rollspeed), 16);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->pitchspeed), 20);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->yawspeed), 24);
+            return 28;
+        }
+    };
+
+    class LegacyLocalPositionNed : public MavLinkLocalPositionNed {
+    protected:
+        virtual int pack(char* buffer) const override {
+            pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->x), 4);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->y), 8);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->z), 12);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->vx), 16);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->vy), 20);
+            pack_float(buffer, reinterpret_cast<const float*>(&this->vz), 24);
+            return 28;
+        }
+        virtual int unpack(const char* buffer) override {
+            unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->x), 4);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->y), 8);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->z), 12);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->vx), 16);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->vy), 20);
+            unpack_float(buffer, reinterpret_cast<float*>(&this->vz), 24);
+            return 28;
+        }
+    };
+
+    template <typename TMessage, typename TLegacy>
+    void runCodecBenchmark(const char* name, int iterations)
+    {
+        const int length = MavLinkCodec<TMessage>::kLength;
+        auto nanosPerMessage = [iterations](std::chrono::steady_clock::time_point since) {
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - since).count() / iterations;
+        };
+
+        // random payload, both codecs have to give back exactly the same bytes.
+        MavLinkMessage source = {};
+        source.msgid = TMessage::kMessageId;
+        source.protocol_version = 1;
+        char* sourcePayload = reinterpret_cast<char*>(source.payload64);
+        for (int i = 0; i < length; i++) {
+            sourcePayload[i] = static_cast<char>(rand());
+        }
+        TLegacy legacy;
+        TMessage message;
+        legacy.decode(source);
+        MavLinkCodec<TMessage>::decode(source, message);
+        MavLinkMessage legacyMsg = {}, codecMsg = {};
+        legacy.encode(legacyMsg);
+        MavLinkCodec<TMessage>::encode(message, codecMsg);
+        if (legacyMsg.len != length || codecMsg.len != length ||
+            memcmp(legacyMsg.payload64, sourcePayload, length) != 0 || memcmp(codecMsg.payload64, sourcePayload, length) != 0) {
+            throw std::runtime_error(Utils::stringf("%s: MavLinkCodec does not match field by field pack/unpack", name));
+        }
+
+        // vary one byte per iteration and sum another so the compiler can't drop or hoist the work.
+        unsigned sum = 0;
+        MavLinkMessage msg;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            legacy.fieldData()[0] = static_cast<char>(i);
+            legacy.encode(msg);
+            sum += reinterpret_cast<const uint8_t*>(msg.payload64)[length - 1];
+        }
+        double oldEncode = nanosPerMessage(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            message.fieldData()[0] = static_cast<char>(i);
+            MavLinkCodec<TMessage>::encode(message, msg);
+            sum += reinterpret_cast<const uint8_t*>(msg.payload64)[length - 1];
+        }
+        double newEncode = nanosPerMessage(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            sourcePayload[0] = static_cast<char>(i);
+            legacy.decode(source);
+            sum += static_cast<uint8_t>(legacy.fieldData()[length - 1]);
+        }
+        double oldDecode = nanosPerMessage(start);
+
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < iterations; i++) {
+            sourcePayload[0] = static_cast<char>(i);
+            MavLinkCodec<TMessage>::decode(source, message);
+            sum += static_cast<uint8_t>(message.fieldData()[length - 1]);
+        }
+        double newDecode = nanosPerMessage(start);
+
+        // frame a batch of these messages back to back and decode them all, this includes checking the crc.
+        const int batchSize = 1000;
+        std::vector<uint8_t> batch(batchSize * 280);
+        size_t batchLength = 0;
+        for (int i = 0; i < batchSize; i++) {
+            source.seq = static_cast<uint8_t>(i);
+            source.len = static_cast<uint8_t>(length);
+            batchLength += MavLinkBatchDecoder::writeFrame(source, batch.data() + batchLength);
+        }
+        std::vector<TMessage> decoded;
+        decoded.reserve(batchSize);
+        int rounds = std::max(1, iterations / batchSize);
+        start = std::chrono::steady_clock::now();
+        for (int i = 0; i < rounds; i++) {
+            decoded.clear();
+            MavLinkBatchDecoder decoder(batch.data(), batchLength);
+            if (decoder.decodeAll(decoded) != batchSize) {
+                throw std::runtime_error(Utils::stringf("%s: batch decoder lost messages", name));
+            }
+            sum += decoded.back().fieldData()[0];
+        }
+        double batchDecode = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (static_cast<double>(rounds) * batchSize);
+
+        static volatile unsigned sink;
+        sink = sum;
+        printf("    %22s %12.1f %12.1f %12.1f %12.1f %12.1f\n", name, oldEncode, newEncode, oldDecode, newDecode, batchDecode);
+    }
+}
+
+void UnitTests::CodecBenchmark(int iterations)
+{
+    printf("    %22s %12s %12s %12s %12s %12s\n", "ns per message", "old encode", "new encode", "old decode", "new decode", "batch decode");
+    runCodecBenchmark<MavLinkHilSensor, LegacyHilSensor>("HIL_SENSOR", iterations);
+    runCodecBenchmark<MavLinkHilGps, LegacyHilGps>("HIL_GPS", iterations);
+    runCodecBenchmark<MavLinkAttitude, LegacyAttitude>("ATTITUDE", iterations);
+    runCodecBenchmark<MavLinkLocalPositionNed, LegacyLocalPositionNed>("LOCAL_POSITION_NED", iterations);
+}
+
+namespace {
+    // what a parser reported, in order, so two parsers can be compared.
+    struct ParsedFrame
+    {
+        MavLinkMessage msg;
+        uint32_t crcErrors;
+    };
+
+    std::vector<ParsedFrame> parseInChunks(MavLinkParser& parser, const std::vector<uint8_t>& stream, std::mt19937& random)
+    {
+        std::vector<ParsedFrame> frames;
+        size_t pos = 0;
+        while (pos < stream.size()) {
+            size_t chunk = std::min(stream.size() - pos, static_cast<size_t>(1 + random() % 600));
+            parser.parse(stream.data() + pos, static_cast<int>(chunk), [&](const MavLinkMessage& msg) {
+                frames.push_back(ParsedFrame{ msg, parser.getCrcErrors() });
+            });
+            pos += chunk;
+        }
+        return frames;
+    }
+
+    bool sameFrame(const ParsedFrame& a, const ParsedFrame& b)
+    {
+        return a.crcErrors == b.crcErrors && a.msg.msgid == b.msg.msgid && a.msg.len == b.msg.len &&
+            a.msg.seq == b.msg.seq && a.msg.sysid == b.msg.sysid && a.msg.compid == b.msg.compid &&
+            a.msg.magic == b.msg.magic && a.msg.incompat_flags == b.msg.incompat_flags &&
+            a.msg.compat_flags == b.msg.compat_flags && a.msg.checksum == b.msg.checksum &&
+            a.msg.protocol_version == b.msg.protocol_version &&
+            memcmp(a.msg.payload64, b.msg.payload64, sizeof(a.msg.payload64)) == 0;
+    }
+}
+
+void UnitTests::ParserFuzzTest()
+{
+    // random mix of good mavlink 1 and 2 frames, damaged frames and garbage, fed to the fast parser and
+    // to the plain byte parser in different sized pieces.  Both have to report exactly the same thing.
+    const uint32_t knownIds[] = { 0, 30, 32, 74, 105, 107, 113, 93, 0x3001 /* unknown to mavlink */ };
+    for (uint32_t seed = 1; seed <= 20; seed++) {
+        std::mt19937 random(seed);
+        std::vector<uint8_t> stream;
+        uint8_t frame[300];
+        for (int i = 0; i < 5000; i++) {
+            MavLinkMessage msg = {};
+            msg.protocol_version = (random() % 2) ? 2 : 1;
+            msg.msgid = knownIds[random() % (sizeof(knownIds) / sizeof(knownIds[0]))];
+            if (msg.msgid > 255) {
+                msg.protocol_version = 2;
+            }
+            msg.len = static_cast<uint8_t>(random() % 256);
+            msg.seq = static_cast<uint8_t>(i);
+            msg.sysid = static_cast<uint8_t>(random());
+            msg.compid = static_cast<uint8_t>(random());
+            uint8_t* payload = reinterpret_cast<uint8_t*>(msg.payload64);
+            for (int j = 0; j < msg.len; j++) {
+                payload[j] = static_cast<uint8_t>(random());
+            }
+            int length = MavLinkBatchDecoder::writeFrame(msg, frame);
+
+            switch (random() % 10) {
+            case 0:
+                // flip a bit anywhere in the frame.
+                frame[random() % length] ^= static_cast<uint8_t>(1 << (random() % 8));
+                break;
+            case 1:
+                // lose the end of the frame.
+                length = static_cast<int>(random() % length);
+                break;
+            case 2:
+                // garbage that may contain start markers.
+                for (int j = static_cast<int>(random() % 40); j > 0; j--) {
+                    uint32_t r = random() % 8;
+                    stream.push_back(r == 0 ? 0xFD : (r == 1 ? 0xFE : static_cast<uint8_t>(random())));
+                }
+                break;
+            default:
+                break;
+            }
+            stream.insert(stream.end(), frame, frame + length);
+        }
+
+        MavLinkParser fast, slow;
+        slow.setFastPath(false);
+        std::vector<ParsedFrame> fastFrames = parseInChunks(fast, stream, random);
+        std::vector<ParsedFrame> slowFrames = parseInChunks(slow, stream, random);
+        if (fastFrames.size() != slowFrames.size() || fast.getCrcErrors() != slow.getCrcErrors()) {
+            throw std::runtime_error(Utils::stringf("seed %d: fast parser found %d messages and %d errors, byte parser %d and %d",
+                static_cast<int>(seed), static_cast<int>(fastFrames.size()), static_cast<int>(fast.getCrcErrors()),
+                static_cast<int>(slowFrames.size()), static_cast<int>(slow.getCrcErrors())));
+        }
+        for (size_t i = 0; i < fastFrames.size(); i++) {
+            if (!sameFrame(fastFrames[i], slowFrames[i])) {
+                throw std::runtime_error(Utils::stringf("seed %d: message %d differs between fast parser and byte parser",
+                    static_cast<int>(seed), static_cast<int>(i)));
+            }
+        }
+        if (seed == 1) {
+            printf("    %d bytes, %d messages, %d crc errors, same from both parsers\n", static_cast<int>(stream.size()),
+                static_cast<int>(fastFrames.size()), static_cast<int>(fast.getCrcErrors()));
+        }
+    }
+}
+
+void UnitTests::ParserBenchmark(const std::string& logFile)
+{
+    // the stream is either the messages from the given log or a synthetic HIL session: HIL_SENSOR and
+    // HIL_ACTUATOR_CONTROLS at 1 kHz with ATTITUDE, LOCAL_POSITION_NED and HIL_GPS mixed in.
+    std::vector<uint8_t> stream;
+    uint8_t frame[300];
+    MavLinkMessage msg;
+    if (!logFile.empty()) {
+        MavLinkLogReader reader;
+        reader.open(logFile);
+        for (size_t i = 0; i < reader.size(); i++) {
+            MavLinkLogRecord record;
+            reader.getRecord(i, record);
+            record.toMessage(msg);
+            msg.protocol_version = record.magic == 0xFE ? 1 : 2;
+            stream.insert(stream.end(), frame, frame + MavLinkBatchDecoder::writeFrame(msg, frame));
+        }
+        reader.close();
+    }
+    else {
+        MavLinkHilSensor sensor;
+        MavLinkHilActuatorControls actuators;
+        MavLinkAttitude attitude;
+        MavLinkLocalPositionNed position;
+        MavLinkHilGps gps;
+        for (int i = 0; stream.size() < 32 * 1024 * 1024; i++) {
+            MavLinkMessageBase* messages[] = { &sensor, &actuators, &attitude, &position, &gps };
+            int count = (i % 4 == 0) ? ((i % 200 == 0) ? 5 : 4) : 2;
+            sensor.time_usec = actuators.time_usec = gps.time_usec = static_cast<uint64_t>(i) * 1000;
+            sensor.xacc = static_cast<float>(i % 100) / 10.0f;
+            attitude.time_boot_ms = position.time_boot_ms = static_cast<uint32_t>(i);
+            attitude.roll = static_cast<float>(i % 360);
+            position.x = static_cast<float>(i) / 100.0f;
+            for (int j = 0; j < count; j++) {
+                messages[j]->protocol_version = 2;
+                messages[j]->encode(msg);
+                msg.seq = static_cast<uint8_t>(i);
+                msg.sysid = 1;
+                msg.compid = 1;
+                stream.insert(stream.end(), frame, frame + MavLinkBatchDecoder::writeFrame(msg, frame));
+            }
+        }
+    }
+
+    // hand the stream over in 512 byte reads like MavLinkConnection does.
+    const int readSize = 512;
+    const int passes = logFile.empty() ? 3 : 10;
+    printf("    %14s %12s %14s %12s\n", "parser", "MB/s", "messages/s", "crc errors");
+    for (int fastPath = 0; fastPath < 2; fastPath++) {
+        MavLinkParser parser;
+        parser.setFastPath(fastPath == 1);
+        size_t messages = 0;
+        uint32_t checksum = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int pass = 0; pass < passes; pass++) {
+            for (size_t pos = 0; pos < stream.size(); pos += readSize) {
+                int count = static_cast<int>(std::min(stream.size() - pos, static_cast<size_t>(readSize)));
+                messages += parser.parse(stream.data() + pos, count, [&](const MavLinkMessage& m) {
+                    checksum += m.checksum;
+                });
+            }
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        static volatile uint32_t sink;
+        sink = checksum;
+        printf("    %14s %12.1f %14.0f %12u\n", fastPath ? "fast path" : "byte at a time",
+            static_cast<double>(stream.size()) * passes / seconds / 1E6, static_cast<double>(messages) / seconds, parser.getCrcErrors());
+    }
+}
+
+namespace {
+    // stands in for a vehicle serving parameters over udp, dropping the given fraction of its replies.
+    class ParamServer
+    {
+    public:
+        ParamServer(int port, int count, double loss)
+            : loss_(loss), random_(static_cast<uint32_t>(port))
+        {
+            for (int i = 0; i < count; i++) {
+                MavLinkParamValue p;
+                std::memset(p.param_id, 0, sizeof(p.param_id));
+                std::snprintf(p.param_id, sizeof(p.param_id), "TEST_PARAM_%04d", i % 10000);
+                p.param_index = static_cast<uint16_t>(i);
+                p.param_count = static_cast<uint16_t>(count);
+                if (i % 2 == 0) {
+                    p.param_type = static_cast<uint8_t>(MAV_PARAM_TYPE::MAV_PARAM_TYPE_REAL32);
+                    p.param_value = static_cast<float>(i) * 0.25f;
+                }
+                else {
+                    // integers are sent as the raw bits in the float, like PX4 does.
+                    p.param_type = static_cast<uint8_t>(MAV_PARAM_TYPE::MAV_PARAM_TYPE_INT32);
+                    int32_t value = i * 1000;
+                    std::memcpy(&p.param_value, &value, sizeof(value));
+                }
+                params_.push_back(p);
+            }
+            connection_ = MavLinkConnection::connectLocalUdp("paramserver", "127.0.0.1", port);
+            connection_->subscribe([this](std::shared_ptr<MavLinkConnection> con, const MavLinkMessage& msg) {
+                unused(con);
+                handleMessage(msg);
+            });
+        }
+
+        ~ParamServer()
+        {
+            connection_->close();
+        }
+
+        void setValue(int index, float value)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            params_[index].param_value = value;
+        }
+
+        const MavLinkParamValue& getParam(int index) { return params_[index]; }
+        size_t getValuesSent() { return sent_.load(); }
+
+    private:
+        uint32_t getHash()
+        {
+            // any hash of the names and values will do, PX4 uses crc32.
+            uint32_t hash = 2166136261u;
+            for (auto& p : params_) {
+                const uint8_t* bytes = reinterpret_cast<const uint8_t*>(p.param_id);
+                for (size_t i = 0; i < sizeof(p.param_id); i++) {
+                    hash = (hash ^ bytes[i]) * 16777619u;
+                }
+                bytes = reinterpret_cast<const uint8_t*>(&p.param_value);
+                for (size_t i = 0; i < sizeof(p.param_value); i++) {
+                    hash = (hash ^ bytes[i]) * 16777619u;
+                }
+            }
+            return hash;
+        }
+
+        void send(MavLinkParamValue& p)
+        {
+            sent_++;
+            if (std::uniform_real_distribution<double>(0, 1)(random_) < loss_) {
+                return;
+            }
+            p.sysid = 1;
+            p.compid = 1;
+            connection_->sendMessage(p);
+        }
+
+        void handleMessage(const MavLinkMessage& msg)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            if (msg.msgid == MavLinkParamRequestList::kMessageId) {
+                // PX4 paces the list too, a burst this size would overflow the receive buffer.
+                for (auto& p : params_) {
+                    send(p);
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+                }
+            }
+            else if (msg.msgid == MavLinkParamRequestRead::kMessageId) {
+                MavLinkParamRequestRead read;
+                read.decode(msg);
+                if (std::strncmp(read.param_id, "_HASH_CHECK", sizeof(read.param_id)) == 0) {
+                    MavLinkParamValue hash;
+                    std::memset(hash.param_id, 0, sizeof(hash.param_id));
+                    std::strcpy(hash.param_id, "_HASH_CHECK");
+                    uint32_t value = getHash();
+                    std::memcpy(&hash.param_value, &value, sizeof(value));
+                    hash.param_type = static_cast<uint8_t>(MAV_PARAM_TYPE::MAV_PARAM_TYPE_UINT32);
+                    hash.param_count = static_cast<uint16_t>(params_.size());
+                    hash.param_index = static_cast<uint16_t>(-1);
+                    send(hash);
+                    return;
+                }
+                for (auto& p : params_) {
+                    if (read.param_index >= 0 ? p.param_index == read.param_index : std::strncmp(read.param_id, p.param_id, sizeof(p.param_id)) == 0) {
+                        send(p);
+                        break;
+                    }
+                }
+            }
+            else if (msg.msgid == MavLinkCommandLong::kMessageId) {
+                MavLinkAutopilotVersion version;
+                version.uid = 0x1234;
+                version.flight_sw_version = 0x01080000;
+                version.sysid = 1;
+                version.compid = 1;
+                connection_->sendMessage(version);
+            }
+        }
+
+        std::shared_ptr<MavLinkConnection> connection_;
+        std::vector<MavLinkParamValue> params_;
+        std::mutex mutex_;
+        double loss_;
+        std::mt19937 random_;
+        std::atomic<size_t> sent_{ 0 };
+    };
+
+    void checkParamList(ParamServer& server, const std::vector<MavLinkParameter>& list, int count)
+    {
+        if (static_cast<int>(list.size()) != count) {
+            throw std::runtime_error(Utils::stringf("getParamList returned %d of %d parameters", static_cast<int>(list.size()), count));
+        }
+        for (auto& p : list) {
+            const MavLinkParamValue& expected = server.getParam(p.index);
+            if (std::strncmp(p.name.c_str(), expected.param_id, sizeof(expected.param_id)) != 0 ||
+                std::memcmp(&p.value, &expected.param_value, sizeof(p.value)) != 0 || p.type != expected.param_type) {
+                throw std::runtime_error(Utils::stringf("parameter %s has the wrong value", p.name.c_str()));
+            }
+        }
+    }
+}
+
+void UnitTests::ParamFetchTest()
+{
+    const int count = 900;
+    const int port = 14592;
+    auto elapsed = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    printf("    %10s %10s %14s\n", "loss", "seconds", "values sent");
+    for (double loss : { 0.0, 0.05, 0.2 }) {
+        ParamServer server(port, count, loss);
+        MavLinkNode node(166, 1);
+        node.connect(MavLinkConnection::connectRemoteUdp("paramclient", "127.0.0.1", "127.0.0.1", port));
+        auto start = std::chrono::steady_clock::now();
+        auto list = node.getParamList();
+        double seconds = elapsed(start);
+        node.close();
+        checkParamList(server, list, count);
+        printf("    %10.2f %10.3f %14d\n", loss, seconds, static_cast<int>(server.getValuesSent()));
+    }
+
+    // the second connect should load the list from the cache, and changing a parameter should make the third
+    // download it again.  The server only talks to the first client it hears from, so each connect gets a new
+    // one serving the same parameters.
+    std::string cacheFolder = FileSystem::ensureFolder(FileSystem::combine(FileSystem::getTempFolder(), "paramcache"));
+    std::string cacheFile = FileSystem::combine(cacheFolder, "params_1_1234_1080000.txt");
+    FileSystem::remove(cacheFile);
+    const char* runs[] = { "first connect", "cached", "changed" };
+    for (int run = 0; run < 3; run++) {
+        ParamServer server(port, count, 0.05);
+        if (run == 2) {
+            server.setValue(10, 123.5f);
+        }
+        MavLinkNode node(166, 1);
+        node.setParamCacheFolder(cacheFolder);
+        node.connect(MavLinkConnection::connectRemoteUdp("paramclient", "127.0.0.1", "127.0.0.1", port));
+        auto start = std::chrono::steady_clock::now();
+        auto list = node.getParamList();
+        double seconds = elapsed(start);
+        node.close();
+        checkParamList(server, list, count);
+        size_t sent = server.getValuesSent();
+        printf("    %14s %10.3f s %8d values sent\n", runs[run], seconds, static_cast<int>(sent));
+        if (!FileSystem::exists(cacheFile)) {
+            throw std::runtime_error("parameter cache was not written");
+        }
+        if ((run == 1) != (sent < 10)) {
+            throw std::runtime_error(Utils::stringf("%s sent %d parameter values", runs[run], static_cast<int>(sent)));
+        }
+    }
+    FileSystem::remove(cacheFile);
+
+    // refresh a handful of parameters by name at once, including one that doesn't exist.
+    {
+        ParamServer lossy(port, count, 0.2);
+        MavLinkNode node(166, 1);
+        node.connect(MavLinkConnection::connectRemoteUdp("paramclient", "127.0.0.1", "127.0.0.1", port));
+        std::vector<std::string> names;
+        for (int i = 0; i < 20; i++) {
+            names.push_back(Utils::stringf("TEST_PARAM_%04d", i * 7));
+        }
+        names.push_back("NOT_A_PARAM");
+        auto start = std::chrono::steady_clock::now();
+        auto params = node.getParameters(names);
+        double seconds = elapsed(start);
+        node.close();
+        for (int i = 0; i < 20; i++) {
+            float expected = (i * 7) % 2 == 0 ? static_cast<float>(i * 7) * 0.25f : static_cast<float>(i * 7 * 1000);
+            if (params[i].name != names[i] || params[i].index != i * 7 || params[i].value != expected) {
+                throw std::runtime_error(Utils::stringf("getParameters returned the wrong value for %s", names[i].c_str()));
+            }
+        }
+        if (params[20].index != -1) {
+            throw std::runtime_error("getParameters found a parameter that does not exist");
+        }
+        printf("    20 parameters by name with 20%% loss in %.3f s\n", seconds);
+    }
+}
+
+namespace {
+    // same layout as FtpPayload in MavLinkFtpClientImpl.cpp (and PX4's PayloadHeader).
+    struct StandInFtpPayload {
+        uint16_t seq_number;
+        uint8_t session;
+        uint8_t opcode;
+        uint8_t size;
+        uint8_t req_opcode;
+        uint8_t burst_complete;
+        uint8_t padding;
+        uint32_t offset;
+        uint8_t data[239];
+    };
+
+    // stands in for the ftp server on a vehicle, keeping files in memory.  Replies are delayed by the given
+    // latency and the given fraction of them is dropped.
+    class FtpServer
+    {
+    public:
+        enum : uint8_t {
+            kCmdTerminateSession = 1, kCmdResetSessions = 2, kCmdOpenFileRO = 4, kCmdReadFile = 5, kCmdCreateFile = 6,
+            kCmdWriteFile = 7, kCmdOpenFileWO = 11, kCmdBurstreadFile = 15, kRspAck = 128, kRspNak = 129
+        };
+        enum : uint8_t { kErrFailErrno = 2, kErrEOF = 6, kErrUnknownCommand = 8 };
+
+        FtpServer(int port, int latencyMilliseconds, double loss, bool burst)
+            : latency_(latencyMilliseconds), loss_(loss), burst_(burst), random_(static_cast<uint32_t>(port + latencyMilliseconds))
+        {
+            running_ = true;
+            sender_ = std::thread(&FtpServer::sendReplies, this);
+            connection_ = MavLinkConnection::connectLocalUdp("ftpserver", "127.0.0.1", port);
+            connection_->subscribe([this](std::shared_ptr<MavLinkConnection> con, const MavLinkMessage& msg) {
+                unused(con);
+                if (msg.msgid == MavLinkFileTransferProtocol::kMessageId) {
+                    MavLinkFileTransferProtocol request;
+                    request.decode(msg);
+                    handleRequest(request);
+                }
+            });
+        }
+
+        ~FtpServer()
+        {
+            {
+                std::lock_guard<std::mutex> guard(mutex_);
+                running_ = false;
+            }
+            queued_.notify_all();
+            sender_.join();
+            connection_->close();
+        }
+
+        std::vector<uint8_t>& getFile(const std::string& name) { return files_[name]; }
+
+    private:
+        void handleRequest(MavLinkFileTransferProtocol& request)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            StandInFtpPayload* in = reinterpret_cast<StandInFtpPayload*>(request.payload);
+            std::string name(reinterpret_cast<char*>(in->data), in->size);
+            auto now = std::chrono::steady_clock::now() + std::chrono::milliseconds(latency_);
+            switch (in->opcode) {
+            case kCmdTerminateSession:
+            case kCmdResetSessions:
+                reply(request, kRspAck, 0, nullptr, now);
+                break;
+            case kCmdOpenFileRO:
+                if (files_.find(name) == files_.end()) {
+                    uint8_t error[2] = { kErrFailErrno, 2 };
+                    reply(request, kRspNak, 2, error, now);
+                }
+                else {
+                    open_ = name;
+                    uint32_t size = static_cast<uint32_t>(files_[name].size());
+                    reply(request, kRspAck, sizeof(size), reinterpret_cast<uint8_t*>(&size), now);
+                }
+                break;
+            case kCmdCreateFile:
+            case kCmdOpenFileWO:
+                open_ = name;
+                files_[name].clear();
+                reply(request, kRspAck, 0, nullptr, now);
+                break;
+            case kCmdReadFile:
+            case kCmdBurstreadFile: {
+                if (in->opcode == kCmdBurstreadFile && !burst_) {
+                    uint8_t error = kErrUnknownCommand;
+                    reply(request, kRspNak, 1, &error, now);
+                    break;
+                }
+                std::vector<uint8_t>& file = files_[open_];
+                uint32_t offset = in->offset;
+                if (offset >= file.size()) {
+                    uint8_t error = kErrEOF;
+                    reply(request, kRspNak, 1, &error, now);
+                    break;
+                }
+                // a read answers one block, a burst streams the rest of the file paced like PX4 does.
+                do {
+                    StandInFtpPayload* out = reinterpret_cast<StandInFtpPayload*>(request.payload);
+                    uint32_t size = std::min(static_cast<uint32_t>(sizeof(out->data)), static_cast<uint32_t>(file.size()) - offset);
+                    out->offset = offset;
+                    out->burst_complete = offset + size >= file.size() ? 1 : 0;
+                    reply(request, kRspAck, static_cast<uint8_t>(size), file.data() + offset, now);
+                    offset += size;
+                    now += std::chrono::microseconds(100);
+                } while (in->opcode == kCmdBurstreadFile && offset < file.size());
+                break;
+            }
+            case kCmdWriteFile: {
+                std::vector<uint8_t>& file = files_[open_];
+                if (file.size() < in->offset + in->size) {
+                    file.resize(in->offset + in->size);
+                }
+                std::memcpy(file.data() + in->offset, in->data, in->size);
+                uint32_t written = in->size;
+                reply(request, kRspAck, sizeof(written), reinterpret_cast<uint8_t*>(&written), now);
+                break;
+            }
+            default: {
+                uint8_t error = kErrUnknownCommand;
+                reply(request, kRspNak, 1, &error, now);
+                break;
+            }
+            }
+        }
+
+        void reply(const MavLinkFileTransferProtocol& request, uint8_t opcode, uint8_t size, const uint8_t* data, std::chrono::steady_clock::time_point when)
+        {
+            if (std::uniform_real_distribution<double>(0, 1)(random_) < loss_) {
+                return;
+            }
+            MavLinkFileTransferProtocol response = request;
+            StandInFtpPayload* in = reinterpret_cast<StandInFtpPayload*>(const_cast<uint8_t*>(request.payload));
+            StandInFtpPayload* out = reinterpret_cast<StandInFtpPayload*>(response.payload);
+            out->seq_number = static_cast<uint16_t>(in->seq_number + 1);
+            out->session = 1;
+            out->req_opcode = in->opcode;
+            out->opcode = opcode;
+            out->size = size;
+            if (size > 0) {
+                std::memcpy(out->data, data, size);
+            }
+            response.sysid = 1;
+            response.compid = 1;
+            replies_.insert(std::make_pair(when, response));
+            queued_.notify_all();
+        }
+
+        void sendReplies()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (running_) {
+                if (replies_.size() == 0) {
+                    queued_.wait(lock);
+                    continue;
+                }
+                auto first = replies_.begin();
+                if (first->first > std::chrono::steady_clock::now()) {
+                    queued_.wait_until(lock, first->first);
+                    continue;
+                }
+                MavLinkFileTransferProtocol response = first->second;
+                replies_.erase(first);
+                lock.unlock();
+                connection_->sendMessage(response);
+                lock.lock();
+            }
+        }
+
+        std::shared_ptr<MavLinkConnection> connection_;
+        std::map<std::string, std::vector<uint8_t>> files_;
+        std::string open_;
+        std::multimap<std::chrono::steady_clock::time_point, MavLinkFileTransferProtocol> replies_;
+        std::mutex mutex_;
+        std::condition_variable queued_;
+        std::thread sender_;
+        bool running_ = false;
+        int latency_;
+        double loss_;
+        bool burst_;
+        std::mt19937 random_;
+    };
+}
+
+void UnitTests::FtpWindowTest()
+{
+    const int port = 14593;
+    const size_t fileSize = 64 * 1024;
+    std::vector<uint8_t> contents(fileSize);
+    std::mt19937 random(7);
+    for (auto& b : contents) {
+        b = static_cast<uint8_t>(random());
+    }
+    std::string localPath = FileSystem::combine(FileSystem::getTempFolder(), "ftpwindowtest.bin");
+    {
+        std::ofstream stream(localPath, std::ios::binary);
+        stream.write(reinterpret_cast<const char*>(contents.data()), contents.size());
+    }
+
+    struct Mode {
+        const char* name;
+        int window;
+        bool burst;
+    };
+    const Mode modes[] = { { "stop and wait", 1, false }, { "window 8", 8, false }, { "burst", 8, true } };
+    const int latencies[] = { 10, 10 };
+    const double losses[] = { 0, 0.05 };
+
+    printf("    %8s %6s %14s %10s %10s %8s\n", "latency", "loss", "mode", "put KB/s", "get KB/s", "resends");
+    for (int condition = 0; condition < 2; condition++) {
+        for (const Mode& mode : modes) {
+            FtpServer server(port, latencies[condition], losses[condition], mode.burst);
+            MavLinkFtpClient ftp{ 166, 1 };
+            ftp.connect(MavLinkConnection::connectRemoteUdp("ftpclient", "127.0.0.1", "127.0.0.1", port));
+            ftp.setWindowSize(mode.window);
+            ftp.setBurstRead(mode.burst);
+
+            MavLinkFtpProgress progress;
+            auto start = std::chrono::steady_clock::now();
+            ftp.put(progress, "/fs/microsd/test.bin", localPath);
+            double putSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (progress.error != 0) {
+                throw std::runtime_error(Utils::stringf("%s put failed: %s", mode.name, progress.message.c_str()));
+            }
+            if (server.getFile("/fs/microsd/test.bin") != contents) {
+                throw std::runtime_error(Utils::stringf("%s put wrote the wrong contents", mode.name));
+            }
+            int resends = progress.resend_count;
+
+            std::string getPath = localPath + ".get";
+            start = std::chrono::steady_clock::now();
+            ftp.get(progress, "/fs/microsd/test.bin", getPath);
+            double getSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            ftp.close();
+            if (progress.error != 0) {
+                throw std::runtime_error(Utils::stringf("%s get failed: %s", mode.name, progress.message.c_str()));
+            }
+            std::ifstream stream(getPath, std::ios::binary);
+            std::vector<uint8_t> received((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+            stream.close();
+            FileSystem::remove(getPath);
+            if (received != contents) {
+                throw std::runtime_error(Utils::stringf("%s get read the wrong contents", mode.name));
+            }
+            resends += progress.resend_count;
+
+            printf("    %6d ms %5.0f%% %14s %10.1f %10.1f %8d\n", latencies[condition], losses[condition] * 100, mode.name,
+                fileSize / putSeconds / 1024, fileSize / getSeconds / 1024, resends);
+        }
+    }
+    FileSystem::remove(localPath);
+}
+
+void UnitTests::HilTransportBenchmark(int iterations)
+{
+    const int port = 14594;
+    const char* segmentName = "mavlinktest_hil";
+    auto nanos = [] {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    };
+
+    printf("    %14s %10s %10s %10s %12s\n", "transport", "p50 us", "p99 us", "max us", "cpu us/trip");
+    for (int transport = 0; transport < 2; transport++) {
+        bool shared = transport == 1;
+        std::shared_ptr<MavLinkConnection> echo;
+        std::shared_ptr<MavLinkConnection> client;
+        if (shared) {
+            try {
+                // the simulator creates the segment and SITL opens it.
+                client = MavLinkConnection::connectSharedMemory("hil", segmentName, true);
+                echo = MavLinkConnection::connectSharedMemory("echo", segmentName, false);
+            }
+            catch (const std::exception& e) {
+                printf("    %14s %s\n", "shared memory", e.what());
+                continue;
+            }
+        }
+        else {
+            echo = MavLinkConnection::connectLocalUdp("echo", "127.0.0.1", port);
+            client = MavLinkConnection::connectRemoteUdp("hil", "127.0.0.1", "127.0.0.1", port);
+        }
+
+        // the stand-in SITL sends every message straight back.
+        echo->subscribe([](std::shared_ptr<MavLinkConnection> con, const MavLinkMessage& msg) {
+            con->sendMessage(msg);
+        });
+
+        std::mutex mutex;
+        std::condition_variable answered;
+        uint64_t echoed = 0;
+        client->subscribe([&](std::shared_ptr<MavLinkConnection> con, const MavLinkMessage& msg) {
+            unused(con);
+            if (msg.msgid != MavLinkHilSensor::kMessageId) {
+                return;
+            }
+            MavLinkHilSensor sensor;
+            sensor.decode(msg);
+            std::lock_guard<std::mutex> lock(mutex);
+            echoed = sensor.time_usec;
+            answered.notify_one();
+        });
+
+        // the udp echo only learns where to answer from the first packet, so prime it.
+        MavLinkHilSensor sensor;
+        sensor.time_usec = 0;
+        sensor.fields_updated = 0x1FFF;
+        client->sendMessage(sensor);
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        std::vector<uint64_t> latencies;
+        latencies.reserve(iterations);
+        double cpuStart = processCpuSeconds();
+        for (int i = 1; i <= iterations; i++) {
+            sensor.time_usec = i;
+            sensor.xacc = static_cast<float>(i);
+            uint64_t start = nanos();
+            client->sendMessage(sensor);
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!answered.wait_for(lock, std::chrono::seconds(1), [&] { return echoed == static_cast<uint64_t>(i); })) {
+                throw std::runtime_error(Utils::stringf("%s echo did not answer message %d", shared ? "shared memory" : "udp", i));
+            }
+            latencies.push_back(nanos() - start);
+        }
+        double cpu = processCpuSeconds() - cpuStart;
+
+        client->close();
+        echo->close();
+
+        std::sort(latencies.begin(), latencies.end());
+        auto percentile = [&](double p) {
+            size_t index = std::min(latencies.size() - 1, static_cast<size_t>(p * latencies.size()));
+            return static_cast<double>(latencies[index]) / 1000.0;
+        };
+        printf("    %14s %10.1f %10.1f %10.1f %12.1f\n", shared ? "shared memory" : "udp", percentile(0.5), percentile(0.99),
+            percentile(1.0), cpu * 1E6 / iterations);
+    }
+}
@@ -19,6 +19,37 @@ public:
 	void SendImageTest();
 	void FtpTest();
     void JSonLogTest();
+    // feeds random good, damaged and garbage frames to MavLinkParser with and without its fast path and checks
+    // they report the same messages and errors.
+    void ParserFuzzTest();
+    // fetches parameters from a stand-in vehicle over loopback udp that drops some of its replies, checks
+    // every parameter arrives and that the parameter cache is used until the vehicle's parameters change.
+    void ParamFetchTest();
+    // puts and gets a file with a stand-in ftp server over loopback udp that delays and drops replies, and
+    // reports throughput for stop and wait, windowed and burst transfers.
+    void FtpWindowTest();
+    // measures HIL_SENSOR round trips to a local echo stand-in over loopback udp and over a shared memory
+    // connection, and reports latency percentiles and cpu per round trip.
+    void HilTransportBenchmark(int iterations = 20000);
+    // pumps messages through a pair of connections on the loopback interface and reports
+    // throughput, syscalls per packet and latency from send to handler, once sending messages one at a
+    // time and once in send batches.  Replays given .mavlink log if logFile is not empty.
+    void LoopbackBenchmark(const std::string& logFile, int seconds = 5);
+    // simulates 1, 10 and 50 vehicles over loopback udp with dedicated threads per connection and then
+    // with the shared event loop, and reports threads, cpu use and latency for each.
+    void EventLoopBenchmark(int seconds = 5);
+    // writes a large synthetic log and compares pulling a time range out of it by reading every message with
+    // MavLinkFileLog against the indexed MavLinkLogReader.
+    void LogReaderBenchmark(int messageCount = 5000000);
+    // reports sendMessage latency with no send log, a MavLinkFileLog writing on the sending thread and one
+    // using its background writer.
+    void LogWriterBenchmark(int messageCount = 200000);
+    // checks MavLinkCodec gives the same bytes as the old field by field pack/unpack and reports encode,
+    // decode and batch decode time for a few of the high rate messages.
+    void CodecBenchmark(int iterations = 2000000);
+    // runs ParserFuzzTest and then reports MavLinkParser throughput byte at a time and with the fast path, on
+    // the messages from the given .mavlink log or a generated HIL stream if logFile is empty.
+    void ParserBenchmark(const std::string& logFile);
 private:
 	void RunTest(const std::string& name, TestHandler handler);
     void VerifyFile(mavlinkcom::MavLinkFtpClient& ftp, const std::string& dir, const std::string& name, bool exists, bool isdir);
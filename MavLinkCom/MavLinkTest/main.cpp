@@ -132,6 +132,16 @@ std::vector<PortAddress> proxyEndPoints;
 // from kicking in when you try and fly.
 bool noRadio = false;
 bool unitTest = false;
+bool benchmark = false;
+bool eventLoopBenchmark = false;
+bool logReaderBenchmark = false;
+bool logWriterBenchmark = false;
+bool codecBenchmark = false;
+bool parserBenchmark = false;
+bool paramTest = false;
+bool ftpTest = false;
+bool hilTransportBenchmark = false;
+std::string benchmarkLogFile;
 bool verbose = false;
 bool nsh = false;
 bool noparams = false;
@@ -415,12 +425,15 @@ void OpenLogFiles() {
         const char* ext = jsonLogFormat ? "json" : "mavlink";
         std::string input = Utils::stringf("%02d-%02d-%02d-input.%s", local->tm_hour, local->tm_min, local->tm_sec, ext);
         auto infile = FileSystem::combine(path, input);
+        // these are written from the message handlers, keep the disk I/O off those threads.
         inLogFile = std::make_shared<MavLinkFileLog>();
+        inLogFile->setAsync(true);
         inLogFile->openForWriting(infile, jsonLogFormat);
 
         std::string output = Utils::stringf("%02d-%02d-%02d-output.%s", local->tm_hour, local->tm_min, local->tm_sec, ext);
         auto outfile = FileSystem::combine(path, output);
         outLogFile = std::make_shared<MavLinkFileLog>();
+        outLogFile->setAsync(true);
         outLogFile->openForWriting(outfile, jsonLogFormat);
 
     }
@@ -765,6 +778,15 @@ void PrintUsage() {
     printf("    -nsh                                   - enter NuttX shell immediately on connecting with PX4\n");
     printf("    -telemetry                             - generate telemetry mavlink messages for logviewer\n");
     printf("    -wifi:iface                            - add wifi rssi to the telemetry using given wifi interface name (e.g. wplsp0)\n");
+    printf("    -benchmark[:filename]                  - measure message throughput and latency over loopback udp, replaying given .mavlink log if any\n");
+    printf("    -eventloopbenchmark                    - compare threads, cpu use and latency for 1, 10 and 50 vehicles with and without the event loop\n");
+    printf("    -logreaderbenchmark                    - compare extracting a time range from a large generated log by full scan and with the indexed log reader\n");
+    printf("    -logwriterbenchmark                    - compare sendMessage latency with no log, a log written on the sending thread and an async log\n");
+    printf("    -codecbenchmark                        - compare the table driven message codec with field by field pack/unpack\n");
+    printf("    -parserbenchmark[:logfile]             - check the fast parser against the byte parser and compare parse throughput\n");
+    printf("    -paramtest                             - fetch parameters from a lossy stand-in vehicle with and without the parameter cache\n");
+    printf("    -ftptest                               - compare stop and wait, windowed and burst ftp transfers with a stand-in server\n");
+    printf("    -hiltransportbenchmark                 - compare HIL round trip latency to a local echo over udp and shared memory\n");
     printf("If no arguments it will find a COM port matching the name 'PX4'\n");
     printf("You can specify -proxy multiple times with different port numbers to proxy drone messages out to multiple listeners\n");
 }
@@ -947,6 +969,41 @@ bool ParseCommandLine(int argc, const char* argv[])
             else if (lower == "test") {
                 unitTest = true;
             }
+            else if (lower == "eventloopbenchmark") {
+                eventLoopBenchmark = true;
+            }
+            else if (lower == "logreaderbenchmark") {
+                logReaderBenchmark = true;
+            }
+            else if (lower == "logwriterbenchmark") {
+                logWriterBenchmark = true;
+            }
+            else if (lower == "codecbenchmark") {
+                codecBenchmark = true;
+            }
+            else if (lower == "parserbenchmark") {
+                parserBenchmark = true;
+                if (parts.size() > 1)
+                {
+                    benchmarkLogFile = std::string(arg + 1 + strlen("parserbenchmark") + 1);
+                }
+            }
+            else if (lower == "paramtest") {
+                paramTest = true;
+            }
+            else if (lower == "ftptest") {
+                ftpTest = true;
+            }
+            else if (lower == "hiltransportbenchmark") {
+                hilTransportBenchmark = true;
+            }
+            else if (lower == "benchmark") {
+                benchmark = true;
+                if (parts.size() > 1)
+                {
+                    benchmarkLogFile = std::string(arg + 1 + strlen("benchmark") + 1);
+                }
+            }
             else if (lower == "verbose") {
                 verbose = true;
             }
@@ -1510,6 +1567,61 @@ int main(int argc, const char* argv[])
         return 0;
     }
 
+    if (benchmark) {
+        UnitTests test;
+        test.LoopbackBenchmark(benchmarkLogFile);
+        return 0;
+    }
+
+    if (eventLoopBenchmark) {
+        UnitTests test;
+        test.EventLoopBenchmark();
+        return 0;
+    }
+
+    if (logReaderBenchmark) {
+        UnitTests test;
+        test.LogReaderBenchmark();
+        return 0;
+    }
+
+    if (logWriterBenchmark) {
+        UnitTests test;
+        test.LogWriterBenchmark();
+        return 0;
+    }
+
+    if (codecBenchmark) {
+        UnitTests test;
+        test.CodecBenchmark();
+        return 0;
+    }
+
+    if (parserBenchmark) {
+        UnitTests test;
+        test.ParserFuzzTest();
+        test.ParserBenchmark(benchmarkLogFile);
+        return 0;
+    }
+
+    if (paramTest) {
+        UnitTests test;
+        test.ParamFetchTest();
+        return 0;
+    }
+
+    if (ftpTest) {
+        UnitTests test;
+        test.FtpWindowTest();
+        return 0;
+    }
+
+    if (hilTransportBenchmark) {
+        UnitTests test;
+        test.HilTransportBenchmark();
+        return 0;
+    }
+
     try {
         return console(initScript);
     }
@@ -0,0 +1,193 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef MavLinkCom_MavLinkCodec_hpp
+#define MavLinkCom_MavLinkCodec_hpp
+
+#include <cstring>
+#include <cstddef>
+#include <vector>
+#include "MavLinkMessageBase.hpp"
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define MAVLINKCOM_BIG_ENDIAN 1
+#else
+#define MAVLINKCOM_BIG_ENDIAN 0
+#endif
+
+namespace mavlinkcom
+{
+    // Packs and unpacks the payload of a message from MavLinkMessages.hpp using its kFields table instead of
+    // one call per field.  The generator declares the fields in wire order and mavlink sorts them by
+    // descending element size, so there is no padding between them and they sit in memory exactly as
+    // they do in the payload (checked at compile time below).  On little endian machines the whole
+    // payload is one memcpy, big endian machines swap each element.
+    template <typename TMessage>
+    class MavLinkCodec
+    {
+    public:
+        static constexpr int kFieldCount = static_cast<int>(sizeof(TMessage::kFields) / sizeof(MavLinkField));
+        static constexpr int kLength = TMessage::kFields[kFieldCount - 1].offset + TMessage::kFields[kFieldCount - 1].size();
+
+        // pack the fields in to buffer, returns the payload length.
+        static int pack(const TMessage& msg, char* buffer)
+        {
+            static_assert(isPacked(), "kFields must be in wire order with no gaps for MavLinkCodec to copy the payload");
+#if MAVLINKCOM_BIG_ENDIAN
+            copySwapped(msg.fieldData(), buffer);
+#else
+            std::memcpy(buffer, msg.fieldData(), kLength);
+#endif
+            return kLength;
+        }
+
+        // unpack a payload of the given length, fields past the end are zeroed the same as the trailing
+        // zeros mavlink2 trims from the payload.  Returns the full payload length.
+        static int unpack(const char* buffer, int length, TMessage& msg)
+        {
+            static_assert(isPacked(), "kFields must be in wire order with no gaps for MavLinkCodec to copy the payload");
+            if (length > kLength) {
+                length = kLength;
+            }
+            else if (length < 0) {
+                length = 0;
+            }
+#if MAVLINKCOM_BIG_ENDIAN
+            char padded[kLength] = { 0 };
+            std::memcpy(padded, buffer, length);
+            copySwapped(padded, msg.fieldData());
+#else
+            char* data = msg.fieldData();
+            std::memcpy(data, buffer, length);
+            std::memset(data + length, 0, kLength - length);
+#endif
+            return kLength;
+        }
+
+        static int unpack(const char* buffer, TMessage& msg)
+        {
+            return unpack(buffer, kLength, msg);
+        }
+
+        // same as MavLinkMessageBase::encode and decode without the virtual call.
+        static void encode(const TMessage& msg, MavLinkMessage& result)
+        {
+            result.msgid = msg.msgid;
+            result.sysid = msg.sysid;
+            result.compid = msg.compid;
+            result.protocol_version = msg.protocol_version;
+            result.len = static_cast<uint8_t>(pack(msg, reinterpret_cast<char*>(result.payload64)));
+        }
+
+        static void decode(const MavLinkMessage& msg, TMessage& result)
+        {
+            result.msgid = msg.msgid;
+            result.protocol_version = msg.protocol_version;
+            unpack(reinterpret_cast<const char*>(msg.payload64), result);
+        }
+
+    private:
+        static constexpr bool isPacked()
+        {
+            int offset = 0;
+            int lastSize = 8;
+            for (int i = 0; i < kFieldCount; i++) {
+                const MavLinkField& field = TMessage::kFields[i];
+                if (field.offset != offset || field.elementSize() > lastSize) {
+                    return false;
+                }
+                lastSize = field.elementSize();
+                offset += field.size();
+            }
+            return true;
+        }
+
+#if MAVLINKCOM_BIG_ENDIAN
+        // copy kLength bytes reversing the bytes of each element, the swap is the same in both directions.
+        static void copySwapped(const char* from, char* to)
+        {
+            for (int i = 0; i < kFieldCount; i++) {
+                const MavLinkField& field = TMessage::kFields[i];
+                int size = field.elementSize();
+                const char* src = from + field.offset;
+                char* dst = to + field.offset;
+                if (size == 1) {
+                    std::memcpy(dst, src, field.count);
+                    continue;
+                }
+                for (int j = 0; j < field.count; j++, src += size, dst += size) {
+                    for (int k = 0; k < size; k++) {
+                        dst[k] = src[size - 1 - k];
+                    }
+                }
+            }
+        }
+#endif
+    };
+
+    template <typename TMessage> constexpr int MavLinkCodec<TMessage>::kFieldCount;
+    template <typename TMessage> constexpr int MavLinkCodec<TMessage>::kLength;
+
+    // One frame found by MavLinkBatchDecoder, payload points in to the buffer being decoded.
+    struct MavLinkFrame
+    {
+        uint32_t msgid;
+        uint8_t len;
+        uint8_t seq;
+        uint8_t sysid;
+        uint8_t compid;
+        uint8_t protocol_version;
+        const uint8_t* payload;
+    };
+
+    // Decodes a buffer holding many back to back mavlink 1 or 2 frames, for example a batch of udp
+    // packets or a block read from a log, straight in to typed messages without going through the
+    // byte at a time parser in MavLinkConnection.  Frames with a bad checksum, bytes between frames and
+    // a partial frame at the end of the buffer are skipped.
+    class MavLinkBatchDecoder
+    {
+    public:
+        MavLinkBatchDecoder(const uint8_t* buffer, size_t length);
+
+        // find the next frame with a good checksum, returns false when the end of the buffer is reached.
+        bool next(MavLinkFrame& frame);
+
+        // decode every remaining frame with TMessage's id and append them to messages, frames with other
+        // ids are skipped.  Returns the number of messages added.
+        template <typename TMessage>
+        size_t decodeAll(std::vector<TMessage>& messages)
+        {
+            size_t count = 0;
+            MavLinkFrame frame;
+            while (next(frame)) {
+                if (frame.msgid != TMessage::kMessageId) {
+                    continue;
+                }
+                messages.emplace_back();
+                TMessage& msg = messages.back();
+                msg.sysid = frame.sysid;
+                msg.compid = frame.compid;
+                msg.protocol_version = frame.protocol_version;
+                MavLinkCodec<TMessage>::unpack(reinterpret_cast<const char*>(frame.payload), frame.len, msg);
+                count++;
+            }
+            return count;
+        }
+
+        // number of bytes that were not part of a good frame so far.
+        size_t getSkippedBytes() { return skipped_; }
+
+        // write msg as an unsigned frame (mavlink2 if msg.protocol_version is 2, otherwise mavlink1) using
+        // msg.seq, sysid, compid and len as they are.  buffer needs room for 280 bytes (MAVLINK_MAX_PACKET_LEN).
+        // Returns the frame length.
+        static int writeFrame(const MavLinkMessage& msg, uint8_t* buffer);
+
+    private:
+        const uint8_t* buffer_;
+        size_t length_;
+        size_t pos_ = 0;
+        size_t skipped_ = 0;
+    };
+}
+
+#endif
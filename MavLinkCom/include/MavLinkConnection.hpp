@@ -85,6 +85,20 @@ namespace mavlinkcom {
         // NIC to use, for example, wifi versus hard wired ethernet adapter.  For localhost pass 127.0.0.1.
         static std::shared_ptr<MavLinkConnection>  connectTcp(const std::string& nodeName, const std::string& localAddr, const std::string& remoteIpAddr, int remotePort);
 
+        // Connect to another process on the same machine through a pair of rings in shared memory instead of
+        // the network, for example a PX4 SITL build running next to the simulator.  One side passes create=true
+        // and owns the named segment, the other side passes false to open it once it exists.  Bytes written
+        // before the other side opens the segment are dropped, the same as an unconnected udp port.
+        // Currently only available on Linux.
+        static std::shared_ptr<MavLinkConnection>  connectSharedMemory(const std::string& nodeName, const std::string& segmentName, bool create);
+
+        // By default every connection reads its port and publishes messages on two threads of its own and every
+        // node sending heartbeats has another one.  With many vehicles that adds up to a lot of threads, so this
+        // lets connections and nodes created after this call share threadCount event loop threads instead.
+        // Message handlers then run on the event loop thread and should return quickly.  Pass 0 to go back to
+        // dedicated threads.  Currently only available on Linux, returns false if not supported.
+        static bool setEventLoopThreads(int threadCount);
+
         // instance methods
         std::string getName();
         int getTargetComponentId();
@@ -113,6 +127,12 @@ namespace mavlinkcom {
         // Send the given already encoded message, assuming the compid and sysid have been set by the caller.
         void sendMessage(const MavLinkMessage& msg);
 
+        // Send the given already encoded messages, assuming the compid and sysid have been set by the caller, with
+        // as few system calls as the port allows (one sendmmsg per 32 messages for udp on Linux).  Use this when
+        // sending a burst of messages together, like the HIL sensor messages of one simulation step.  Messages
+        // other threads send in the meantime go out on their own.
+        void sendMessages(const std::vector<MavLinkMessage>& messages);
+
         // get the next telemetry snapshot, then clear the internal counters and start over.  This way each snapshot
         // gives you a picture of what happened in whatever timeslice you decide to call this method.  This is packaged
         // in a mavlink message so you can easily send it to the LogViewer.
@@ -33,6 +33,7 @@ namespace mavlinkcom {
 		double average_rate = 0;
 		double longest_delay = 0;
 		int message_count;
+		int resend_count = 0; // read or write requests sent again because no answer came back in time.
 	};
 
 	class MavLinkFtpClient : public MavLinkNode
@@ -51,6 +52,14 @@ namespace mavlinkcom {
         void rmdir(MavLinkFtpProgress& progress, const std::string& remotePath);
 
 		void cancel(); // cancel any pending operation.
+
+		// get and put keep up to this many read or write requests outstanding instead of waiting for each
+		// answer before sending the next request, default is 8.  A window of 1 is the old stop and wait.
+		void setWindowSize(int window);
+
+		// get asks the vehicle to stream the whole file with BurstReadFile and only requests the pieces
+		// that got lost, on by default.  Vehicles that don't support it fall back to windowed reads.
+		void setBurstRead(bool enabled);
 	};
 }
 
@@ -7,6 +7,8 @@
 #include <string>
 #include <stdio.h>
 #include <cstdint>
+#include <memory>
+#include <atomic>
 #include "MavLinkMessageBase.hpp"
 
 namespace mavlinkcom
@@ -19,14 +21,34 @@ namespace mavlinkcom
         virtual ~MavLinkLog() = default;
     };
 
+    // Counters for a MavLinkFileLog opened for writing, covering the time since the previous getWriterStats call.
+    struct MavLinkLogWriterStats
+    {
+        uint64_t messages = 0;          // messages passed to write()
+        uint64_t bytesWritten = 0;      // bytes that reached the file
+        double bytesPerSecond = 0;      // bytesWritten divided by the time since the previous call
+        uint64_t blockedAppends = 0;    // writes that had to wait for the background writer to free a buffer
+        uint64_t droppedAppends = 0;    // writes that were thrown away because the buffers were full, see setAsync
+    };
+
     // This implementation of MavLinkLog reads/writes MavLinkMessages to a local file.
     class MavLinkFileLog : public MavLinkLog
     {
+        class AsyncWriter;
         std::string file_name_;
         FILE* ptr_;
         bool reading_;
         bool writing_;
         bool json_;
+        bool async_;
+        bool drop_when_full_;
+        std::unique_ptr<AsyncWriter> writer_;
+        std::atomic<uint64_t> messages_;
+        std::atomic<uint64_t> bytes_written_;
+        std::atomic<uint64_t> blocked_appends_;
+        std::atomic<uint64_t> dropped_appends_;
+        uint64_t stats_time_;
+        void append(const void* data, size_t size);
     public:
         MavLinkFileLog();
         virtual ~MavLinkFileLog();
@@ -37,6 +59,16 @@ namespace mavlinkcom
         virtual void write(const mavlinkcom::MavLinkMessage& msg, uint64_t timestamp = 0) override;
         bool read(mavlinkcom::MavLinkMessage& msg, uint64_t& timestamp);
         static uint64_t getTimeStamp();
+
+        // When async is true, the next openForWriting starts a background thread that owns the file and write()
+        // only copies the message in to a memory buffer, so logging doesn't slow down whoever is sending
+        // or receiving messages.  close() waits until everything is written.  If the disk can't keep up
+        // and all buffers are full, write() waits for the writer thread, or drops the message if
+        // dropWhenFull is true.
+        void setAsync(bool async, bool dropWhenFull = false);
+
+        // get counters for the file being written and reset them.
+        void getWriterStats(MavLinkLogWriterStats& result);
     };
 
 
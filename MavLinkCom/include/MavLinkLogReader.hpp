@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef MavLinkCom_MavLinkLogReader_hpp
+#define MavLinkCom_MavLinkLogReader_hpp
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <cstdint>
+#include "MavLinkMessageBase.hpp"
+
+namespace mavlinkcom
+{
+    // One message in a log opened by MavLinkLogReader.  The payload points straight into the mapped file, so
+    // it is only valid until the reader is closed, and it is not aligned so use toMessage() or memcpy
+    // before reading multi byte fields.
+    struct MavLinkLogRecord
+    {
+        uint64_t timestamp;     // microseconds, as written by MavLinkFileLog::write
+        uint8_t magic;
+        uint8_t len;
+        uint8_t seq;
+        uint8_t sysid;
+        uint8_t compid;
+        uint8_t msgid;          // the log only stores the mavlink1 (low byte) msgid
+        uint16_t checksum;
+        const uint8_t* payload; // len bytes
+
+        // copy this record in to a MavLinkMessage so it can be decoded with MavLinkMessageBase::decode.
+        void toMessage(MavLinkMessage& msg) const;
+    };
+
+    // Reads .mavlink logs written by MavLinkFileLog by mapping the file in to memory instead of reading it
+    // message by message.  On open it finds where every message starts along with its timestamp and msgid,
+    // so you can jump straight to a time range or visit only the messages with a given id without
+    // decoding the rest of the log.  Building that index means one pass over the file, so it is saved next
+    // to the log (filename + ".idx") and reused the next time the same log is opened.
+    class MavLinkLogReader
+    {
+    public:
+        // return false from the callback to stop iterating.
+        typedef std::function<bool(const MavLinkLogRecord& record)> RecordCallback;
+
+        MavLinkLogReader();
+        ~MavLinkLogReader();
+
+        // map the log and load or build its index.  If useIndexFile is true an existing index file that
+        // matches the log is loaded and a newly built index is saved, failing to save it is not an error.
+        void open(const std::string& filename, bool useIndexFile = true);
+        void close();
+        bool isOpen();
+
+        // number of complete messages in the log, a partly written message at the end is ignored.
+        size_t size();
+
+        // timestamps of the earliest and latest message in the log, 0 if the log is empty.
+        uint64_t getStartTime();
+        uint64_t getEndTime();
+
+        // get message number i in file order, returns false if i is out of range.
+        bool getRecord(size_t i, MavLinkLogRecord& record);
+
+        // visit messages with startTime <= timestamp < endTime in timestamp order (file order for equal
+        // timestamps).  Pass msgid >= 0 to visit only messages with that id.
+        void forEach(uint64_t startTime, uint64_t endTime, const RecordCallback& callback, int msgid = -1);
+
+        // visit every message with the given id in file order.
+        void forEachMessage(int msgid, const RecordCallback& callback);
+
+        // write the index to the given file, open() does this for you unless useIndexFile is false.
+        void saveIndex(const std::string& indexFile);
+
+        static std::string getIndexFileName(const std::string& logFile);
+
+    private:
+        class MappedFile;
+        bool loadIndex(const std::string& indexFile);
+        void buildIndex();
+        void buildLookups();
+        void readRecord(uint32_t index, MavLinkLogRecord& record);
+        // true if visiting should continue.
+        bool visit(uint32_t index, const RecordCallback& callback);
+
+        std::unique_ptr<MappedFile> file_;
+        std::string file_name_;
+        // per message, in file order.
+        std::vector<uint64_t> offsets_;
+        std::vector<uint64_t> times_;
+        std::vector<uint8_t> msgids_;
+        // message numbers sorted by timestamp, left empty when the log is already in timestamp order
+        // which is the usual case.
+        std::vector<uint32_t> time_order_;
+        // message numbers in file order for each msgid.
+        std::vector<std::vector<uint32_t>> by_msgid_;
+    };
+}
+
+#endif
@@ -43,6 +43,27 @@ namespace mavlinkcom
         uint8_t protocol_version;
     };
 
+    enum class MavLinkFieldType : uint8_t {
+        Char, Int8, UInt8, Int16, UInt16, Int32, UInt32, Int64, UInt64, Float, Double
+    };
+
+    // Where one field of a strongly typed message lives in the payload: byte offset, element type and
+    // number of elements (1 unless it is an array).  Every message in MavLinkMessages.hpp has a constexpr
+    // kFields table of these in wire order which MavLinkCodec uses to pack and unpack the payload.
+    struct MavLinkField
+    {
+        uint16_t offset;
+        MavLinkFieldType type;
+        uint16_t count;
+
+        constexpr int elementSize() const {
+            return (type == MavLinkFieldType::Int64 || type == MavLinkFieldType::UInt64 || type == MavLinkFieldType::Double) ? 8 :
+                (type == MavLinkFieldType::Int32 || type == MavLinkFieldType::UInt32 || type == MavLinkFieldType::Float) ? 4 :
+                (type == MavLinkFieldType::Int16 || type == MavLinkFieldType::UInt16) ? 2 : 1;
+        }
+        constexpr int size() const { return elementSize() * count; }
+    };
+
     // This is the base class for all the strongly typed messages define in MavLinkMessages.hpp
     class MavLinkMessageBase
     {
@@ -141,6 +162,9 @@ namespace mavlinkcom
         uint32_t renderTime;         // total time spent rendering frames since the last telemetry message
         const char* wifiInterfaceName; // the name of the wifi interface we are measuring RSSI on.
         int32_t wifiRssi;            // if this device is communicating over wifi this is the signal strength.
+        // the following are not sent in the message, they show how well reads and writes are being batched.
+        uint32_t portReads = 0;      // number of read calls on the port since the last telemetry message
+        uint32_t portWrites = 0;     // number of write calls on the port since the last telemetry message
         virtual std::string toJSon() {
 
             std::ostringstream result;
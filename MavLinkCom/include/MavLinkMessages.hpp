@@ -1436,6 +1436,16 @@ public:
     // MAVLink version, not writable by user, gets added by protocol because of magic
     // data type: uint8_t_mavlink_version
     uint8_t mavlink_version = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt8, 1 },
+        { 5, MavLinkFieldType::UInt8, 1 },
+        { 6, MavLinkFieldType::UInt8, 1 },
+        { 7, MavLinkFieldType::UInt8, 1 },
+        { 8, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&custom_mode); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&custom_mode); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1494,6 +1504,23 @@ public:
     // Remaining battery energy: (0%: 0, 100%: 100), -1: autopilot estimate the remaining
     // battery
     int8_t battery_remaining = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt32, 1 },
+        { 8, MavLinkFieldType::UInt32, 1 },
+        { 12, MavLinkFieldType::UInt16, 1 },
+        { 14, MavLinkFieldType::UInt16, 1 },
+        { 16, MavLinkFieldType::Int16, 1 },
+        { 18, MavLinkFieldType::UInt16, 1 },
+        { 20, MavLinkFieldType::UInt16, 1 },
+        { 22, MavLinkFieldType::UInt16, 1 },
+        { 24, MavLinkFieldType::UInt16, 1 },
+        { 26, MavLinkFieldType::UInt16, 1 },
+        { 28, MavLinkFieldType::UInt16, 1 },
+        { 30, MavLinkFieldType::Int8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&onboard_control_sensors_present); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&onboard_control_sensors_present); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1510,6 +1537,12 @@ public:
     uint64_t time_unix_usec = 0;
     // Timestamp of the component clock since boot time in milliseconds.
     uint32_t time_boot_ms = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::UInt32, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_unix_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_unix_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1533,6 +1566,14 @@ public:
     // 0: request ping from all receiving components, if greater than 0: message is
     // a ping response and number is the system id of the requesting system
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::UInt32, 1 },
+        { 12, MavLinkFieldType::UInt8, 1 },
+        { 13, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1556,6 +1597,14 @@ public:
     // Password / Key, depending on version plaintext or encrypted. 25 or less characters,
     // NULL terminated. The characters may involve A-Z, a-z, 0-9, and "!?,.-"
     char passkey[25] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+        { 3, MavLinkFieldType::Char, 25 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&target_system); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&target_system); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1574,6 +1623,13 @@ public:
     // 0: ACK, 1: NACK: Wrong passkey, 2: NACK: Unsupported passkey encryption method,
     // 3: NACK: Already under control
     uint8_t ack = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&gcs_system_id); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&gcs_system_id); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1589,6 +1645,11 @@ public:
     MavLinkAuthKey() { msgid = kMessageId; }
     // key
     char key[32] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Char, 32 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&key); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&key); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1608,6 +1669,13 @@ public:
     uint8_t target_system = 0;
     // The new base mode
     uint8_t base_mode = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt8, 1 },
+        { 5, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&custom_mode); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&custom_mode); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1636,6 +1704,14 @@ public:
     // chars - applications have to provide 16+1 bytes storage if the ID is stored
     // as string
     char param_id[16] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int16, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+        { 3, MavLinkFieldType::UInt8, 1 },
+        { 4, MavLinkFieldType::Char, 16 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&param_index); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&param_index); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1652,6 +1728,12 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&target_system); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&target_system); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1678,6 +1760,15 @@ public:
     char param_id[16] = { 0 };
     // Onboard parameter type: see the MAV_PARAM_TYPE enum for supported data types.
     uint8_t param_type = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Float, 1 },
+        { 4, MavLinkFieldType::UInt16, 1 },
+        { 6, MavLinkFieldType::UInt16, 1 },
+        { 8, MavLinkFieldType::Char, 16 },
+        { 24, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&param_value); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&param_value); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1708,6 +1799,15 @@ public:
     char param_id[16] = { 0 };
     // Onboard parameter type: see the MAV_PARAM_TYPE enum for supported data types.
     uint8_t param_type = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Float, 1 },
+        { 4, MavLinkFieldType::UInt8, 1 },
+        { 5, MavLinkFieldType::UInt8, 1 },
+        { 6, MavLinkFieldType::Char, 16 },
+        { 22, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&param_value); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&param_value); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1744,6 +1844,20 @@ public:
     uint8_t fix_type = 0;
     // Number of satellites visible. If unknown, set to 255
     uint8_t satellites_visible = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::Int32, 1 },
+        { 16, MavLinkFieldType::Int32, 1 },
+        { 20, MavLinkFieldType::UInt16, 1 },
+        { 22, MavLinkFieldType::UInt16, 1 },
+        { 24, MavLinkFieldType::UInt16, 1 },
+        { 26, MavLinkFieldType::UInt16, 1 },
+        { 28, MavLinkFieldType::UInt8, 1 },
+        { 29, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1770,6 +1884,16 @@ public:
     uint8_t satellite_azimuth[20] = { 0 };
     // Signal to noise ratio of satellite
     uint8_t satellite_snr[20] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 20 },
+        { 21, MavLinkFieldType::UInt8, 20 },
+        { 41, MavLinkFieldType::UInt8, 20 },
+        { 61, MavLinkFieldType::UInt8, 20 },
+        { 81, MavLinkFieldType::UInt8, 20 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&satellites_visible); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&satellites_visible); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1802,6 +1926,20 @@ public:
     int16_t ymag = 0;
     // Z Magnetic field (milli tesla)
     int16_t zmag = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Int16, 1 },
+        { 6, MavLinkFieldType::Int16, 1 },
+        { 8, MavLinkFieldType::Int16, 1 },
+        { 10, MavLinkFieldType::Int16, 1 },
+        { 12, MavLinkFieldType::Int16, 1 },
+        { 14, MavLinkFieldType::Int16, 1 },
+        { 16, MavLinkFieldType::Int16, 1 },
+        { 18, MavLinkFieldType::Int16, 1 },
+        { 20, MavLinkFieldType::Int16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1835,6 +1973,20 @@ public:
     int16_t ymag = 0;
     // Z Magnetic field (raw)
     int16_t zmag = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Int16, 1 },
+        { 10, MavLinkFieldType::Int16, 1 },
+        { 12, MavLinkFieldType::Int16, 1 },
+        { 14, MavLinkFieldType::Int16, 1 },
+        { 16, MavLinkFieldType::Int16, 1 },
+        { 18, MavLinkFieldType::Int16, 1 },
+        { 20, MavLinkFieldType::Int16, 1 },
+        { 22, MavLinkFieldType::Int16, 1 },
+        { 24, MavLinkFieldType::Int16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1858,6 +2010,15 @@ public:
     int16_t press_diff2 = 0;
     // Raw Temperature measurement (raw)
     int16_t temperature = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Int16, 1 },
+        { 10, MavLinkFieldType::Int16, 1 },
+        { 12, MavLinkFieldType::Int16, 1 },
+        { 14, MavLinkFieldType::Int16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1878,6 +2039,14 @@ public:
     float press_diff = 0;
     // Temperature measurement (0.01 degrees celsius)
     int16_t temperature = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Int16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1903,6 +2072,17 @@ public:
     float pitchspeed = 0;
     // Yaw angular speed (rad/s)
     float yawspeed = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1932,6 +2112,18 @@ public:
     float pitchspeed = 0;
     // Yaw angular speed (rad/s)
     float yawspeed = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1958,6 +2150,17 @@ public:
     float vy = 0;
     // Z Speed
     float vz = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -1991,6 +2194,19 @@ public:
     // Vehicle heading (yaw angle) in degrees * 100, 0.0..359.99 degrees. If unknown,
     // set to: UINT16_MAX
     uint16_t hdg = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Int32, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::Int32, 1 },
+        { 16, MavLinkFieldType::Int32, 1 },
+        { 20, MavLinkFieldType::Int16, 1 },
+        { 22, MavLinkFieldType::Int16, 1 },
+        { 24, MavLinkFieldType::Int16, 1 },
+        { 26, MavLinkFieldType::UInt16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2034,6 +2250,21 @@ public:
     uint8_t port = 0;
     // Receive signal strength indicator, 0: 0%, 100: 100%, 255: invalid/unknown.
     uint8_t rssi = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Int16, 1 },
+        { 6, MavLinkFieldType::Int16, 1 },
+        { 8, MavLinkFieldType::Int16, 1 },
+        { 10, MavLinkFieldType::Int16, 1 },
+        { 12, MavLinkFieldType::Int16, 1 },
+        { 14, MavLinkFieldType::Int16, 1 },
+        { 16, MavLinkFieldType::Int16, 1 },
+        { 18, MavLinkFieldType::Int16, 1 },
+        { 20, MavLinkFieldType::UInt8, 1 },
+        { 21, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2078,6 +2309,21 @@ public:
     uint8_t port = 0;
     // Receive signal strength indicator, 0: 0%, 100: 100%, 255: invalid/unknown.
     uint8_t rssi = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt16, 1 },
+        { 6, MavLinkFieldType::UInt16, 1 },
+        { 8, MavLinkFieldType::UInt16, 1 },
+        { 10, MavLinkFieldType::UInt16, 1 },
+        { 12, MavLinkFieldType::UInt16, 1 },
+        { 14, MavLinkFieldType::UInt16, 1 },
+        { 16, MavLinkFieldType::UInt16, 1 },
+        { 18, MavLinkFieldType::UInt16, 1 },
+        { 20, MavLinkFieldType::UInt8, 1 },
+        { 21, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2128,6 +2374,28 @@ public:
     // Servo output port (set of 8 outputs = 1 port). Most MAVs will just use one,
     // but this allows to encode more than 8 servos.
     uint8_t port = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt16, 1 },
+        { 6, MavLinkFieldType::UInt16, 1 },
+        { 8, MavLinkFieldType::UInt16, 1 },
+        { 10, MavLinkFieldType::UInt16, 1 },
+        { 12, MavLinkFieldType::UInt16, 1 },
+        { 14, MavLinkFieldType::UInt16, 1 },
+        { 16, MavLinkFieldType::UInt16, 1 },
+        { 18, MavLinkFieldType::UInt16, 1 },
+        { 20, MavLinkFieldType::UInt16, 1 },
+        { 22, MavLinkFieldType::UInt16, 1 },
+        { 24, MavLinkFieldType::UInt16, 1 },
+        { 26, MavLinkFieldType::UInt16, 1 },
+        { 28, MavLinkFieldType::UInt16, 1 },
+        { 30, MavLinkFieldType::UInt16, 1 },
+        { 32, MavLinkFieldType::UInt16, 1 },
+        { 34, MavLinkFieldType::UInt16, 1 },
+        { 36, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2149,6 +2417,14 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int16, 1 },
+        { 2, MavLinkFieldType::Int16, 1 },
+        { 4, MavLinkFieldType::UInt8, 1 },
+        { 5, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&start_index); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&start_index); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2171,6 +2447,14 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int16, 1 },
+        { 2, MavLinkFieldType::Int16, 1 },
+        { 4, MavLinkFieldType::UInt8, 1 },
+        { 5, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&start_index); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&start_index); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2214,6 +2498,24 @@ public:
     uint8_t current = 0;
     // autocontinue to next wp
     uint8_t autocontinue = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Float, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::UInt16, 1 },
+        { 30, MavLinkFieldType::UInt16, 1 },
+        { 32, MavLinkFieldType::UInt8, 1 },
+        { 33, MavLinkFieldType::UInt8, 1 },
+        { 34, MavLinkFieldType::UInt8, 1 },
+        { 35, MavLinkFieldType::UInt8, 1 },
+        { 36, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&param1); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&param1); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2232,6 +2534,13 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+        { 3, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&seq); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&seq); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2251,6 +2560,13 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+        { 3, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&seq); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&seq); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2265,6 +2581,11 @@ public:
     MavLinkMissionCurrent() { msgid = kMessageId; }
     // Sequence
     uint16_t seq = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&seq); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&seq); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2280,6 +2601,12 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&target_system); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&target_system); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2299,6 +2626,13 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+        { 3, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&count); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&count); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2314,6 +2648,12 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&target_system); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&target_system); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2329,6 +2669,11 @@ public:
     MavLinkMissionItemReached() { msgid = kMessageId; }
     // Sequence
     uint16_t seq = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&seq); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&seq); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2347,6 +2692,13 @@ public:
     uint8_t target_component = 0;
     // See MAV_MISSION_RESULT enum
     uint8_t type = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&target_system); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&target_system); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2369,6 +2721,14 @@ public:
     int32_t altitude = 0;
     // System ID
     uint8_t target_system = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int32, 1 },
+        { 4, MavLinkFieldType::Int32, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&latitude); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&latitude); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2387,6 +2747,13 @@ public:
     int32_t longitude = 0;
     // Altitude (AMSL), in meters * 1000 (positive for up)
     int32_t altitude = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int32, 1 },
+        { 4, MavLinkFieldType::Int32, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&latitude); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&latitude); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2424,6 +2791,19 @@ public:
     // Index of parameter RC channel. Not equal to the RC channel id. Typically correpsonds
     // to a potentiometer-knob on the RC.
     uint8_t parameter_rc_channel_index = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Float, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Int16, 1 },
+        { 18, MavLinkFieldType::UInt8, 1 },
+        { 19, MavLinkFieldType::UInt8, 1 },
+        { 20, MavLinkFieldType::Char, 16 },
+        { 36, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&param_value0); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&param_value0); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2442,6 +2822,13 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+        { 3, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&seq); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&seq); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2474,6 +2861,19 @@ public:
     // Coordinate frame, as defined by MAV_FRAME enum in mavlink_types.h. Can be either
     // global, GPS, right-handed with Z axis up or local, right handed, Z axis down.
     uint8_t frame = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Float, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::UInt8, 1 },
+        { 25, MavLinkFieldType::UInt8, 1 },
+        { 26, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&p1x); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&p1x); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2500,6 +2900,17 @@ public:
     // Coordinate frame, as defined by MAV_FRAME enum in mavlink_types.h. Can be either
     // global, GPS, right-handed with Z axis up or local, right handed, Z axis down.
     uint8_t frame = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Float, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&p1x); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&p1x); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2525,6 +2936,16 @@ public:
     float yawspeed = 0;
     // Attitude covariance
     float covariance[9] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 4 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 9 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2552,6 +2973,18 @@ public:
     int16_t target_bearing = 0;
     // Distance to active MISSION in meters
     uint16_t wp_dist = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Float, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Int16, 1 },
+        { 22, MavLinkFieldType::Int16, 1 },
+        { 24, MavLinkFieldType::UInt16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&nav_roll); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&nav_roll); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2589,6 +3022,20 @@ public:
     float covariance[36] = { 0 };
     // Class id of the estimator this estimate originated from.
     uint8_t estimator_type = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::Int32, 1 },
+        { 16, MavLinkFieldType::Int32, 1 },
+        { 20, MavLinkFieldType::Int32, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 36 },
+        { 180, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2626,6 +3073,22 @@ public:
     float covariance[45] = { 0 };
     // Class id of the estimator this estimate originated from.
     uint8_t estimator_type = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::Float, 1 },
+        { 44, MavLinkFieldType::Float, 45 },
+        { 224, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2701,6 +3164,31 @@ public:
     uint8_t chancount = 0;
     // Receive signal strength indicator, 0: 0%, 100: 100%, 255: invalid/unknown.
     uint8_t rssi = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt16, 1 },
+        { 6, MavLinkFieldType::UInt16, 1 },
+        { 8, MavLinkFieldType::UInt16, 1 },
+        { 10, MavLinkFieldType::UInt16, 1 },
+        { 12, MavLinkFieldType::UInt16, 1 },
+        { 14, MavLinkFieldType::UInt16, 1 },
+        { 16, MavLinkFieldType::UInt16, 1 },
+        { 18, MavLinkFieldType::UInt16, 1 },
+        { 20, MavLinkFieldType::UInt16, 1 },
+        { 22, MavLinkFieldType::UInt16, 1 },
+        { 24, MavLinkFieldType::UInt16, 1 },
+        { 26, MavLinkFieldType::UInt16, 1 },
+        { 28, MavLinkFieldType::UInt16, 1 },
+        { 30, MavLinkFieldType::UInt16, 1 },
+        { 32, MavLinkFieldType::UInt16, 1 },
+        { 34, MavLinkFieldType::UInt16, 1 },
+        { 36, MavLinkFieldType::UInt16, 1 },
+        { 38, MavLinkFieldType::UInt16, 1 },
+        { 40, MavLinkFieldType::UInt8, 1 },
+        { 41, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2722,6 +3210,15 @@ public:
     uint8_t req_stream_id = 0;
     // 1 to start sending, 0 to stop sending.
     uint8_t start_stop = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+        { 3, MavLinkFieldType::UInt8, 1 },
+        { 4, MavLinkFieldType::UInt8, 1 },
+        { 5, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&req_message_rate); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&req_message_rate); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2739,6 +3236,13 @@ public:
     uint8_t stream_id = 0;
     // 1 stream is enabled, 0 stream is stopped.
     uint8_t on_off = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+        { 3, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&message_rate); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&message_rate); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2776,6 +3280,16 @@ public:
     uint16_t buttons = 0;
     // The system to be controlled.
     uint8_t target = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int16, 1 },
+        { 2, MavLinkFieldType::Int16, 1 },
+        { 4, MavLinkFieldType::Int16, 1 },
+        { 6, MavLinkFieldType::Int16, 1 },
+        { 8, MavLinkFieldType::UInt16, 1 },
+        { 10, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&x); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&x); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2819,6 +3333,20 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt16, 1 },
+        { 4, MavLinkFieldType::UInt16, 1 },
+        { 6, MavLinkFieldType::UInt16, 1 },
+        { 8, MavLinkFieldType::UInt16, 1 },
+        { 10, MavLinkFieldType::UInt16, 1 },
+        { 12, MavLinkFieldType::UInt16, 1 },
+        { 14, MavLinkFieldType::UInt16, 1 },
+        { 16, MavLinkFieldType::UInt8, 1 },
+        { 17, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&chan1_raw); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&chan1_raw); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2864,6 +3392,24 @@ public:
     uint8_t current = 0;
     // autocontinue to next wp
     uint8_t autocontinue = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Float, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Int32, 1 },
+        { 20, MavLinkFieldType::Int32, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::UInt16, 1 },
+        { 30, MavLinkFieldType::UInt16, 1 },
+        { 32, MavLinkFieldType::UInt8, 1 },
+        { 33, MavLinkFieldType::UInt8, 1 },
+        { 34, MavLinkFieldType::UInt8, 1 },
+        { 35, MavLinkFieldType::UInt8, 1 },
+        { 36, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&param1); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&param1); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2887,6 +3433,16 @@ public:
     int16_t heading = 0;
     // Current throttle setting in integer percent, 0 to 100
     uint16_t throttle = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Float, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Int16, 1 },
+        { 18, MavLinkFieldType::UInt16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&airspeed); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&airspeed); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2928,6 +3484,23 @@ public:
     uint8_t current = 0;
     // autocontinue to next wp
     uint8_t autocontinue = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Float, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Int32, 1 },
+        { 20, MavLinkFieldType::Int32, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::UInt16, 1 },
+        { 30, MavLinkFieldType::UInt8, 1 },
+        { 31, MavLinkFieldType::UInt8, 1 },
+        { 32, MavLinkFieldType::UInt8, 1 },
+        { 33, MavLinkFieldType::UInt8, 1 },
+        { 34, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&param1); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&param1); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2962,6 +3535,21 @@ public:
     // 0: First transmission of this command. 1-255: Confirmation transmissions (e.g.
     // for kill command)
     uint8_t confirmation = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Float, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::UInt16, 1 },
+        { 30, MavLinkFieldType::UInt8, 1 },
+        { 31, MavLinkFieldType::UInt8, 1 },
+        { 32, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&param1); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&param1); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -2977,6 +3565,12 @@ public:
     uint16_t command = 0;
     // See MAV_RESULT enum
     uint8_t result = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&command); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&command); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3002,6 +3596,17 @@ public:
     uint8_t mode_switch = 0;
     // Override mode switch position, 0.. 255
     uint8_t manual_override_switch = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::UInt8, 1 },
+        { 21, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3035,6 +3640,19 @@ public:
     // bit 1: body roll rate, bit 2: body pitch rate, bit 3: body yaw rate. bit 4-bit
     // 6: reserved, bit 7: throttle, bit 8: attitude
     uint8_t type_mask = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 4 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::UInt8, 1 },
+        { 37, MavLinkFieldType::UInt8, 1 },
+        { 38, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3065,6 +3683,17 @@ public:
     // bit 1: body roll rate, bit 2: body pitch rate, bit 3: body yaw rate. bit 4-bit
     // 7: reserved, bit 8: attitude
     uint8_t type_mask = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 4 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3118,6 +3747,26 @@ public:
     // Valid options are: MAV_FRAME_LOCAL_NED = 1, MAV_FRAME_LOCAL_OFFSET_NED = 7,
     // MAV_FRAME_BODY_NED = 8, MAV_FRAME_BODY_OFFSET_NED = 9
     uint8_t coordinate_frame = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::Float, 1 },
+        { 44, MavLinkFieldType::Float, 1 },
+        { 48, MavLinkFieldType::UInt16, 1 },
+        { 50, MavLinkFieldType::UInt8, 1 },
+        { 51, MavLinkFieldType::UInt8, 1 },
+        { 52, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3168,6 +3817,24 @@ public:
     // Valid options are: MAV_FRAME_LOCAL_NED = 1, MAV_FRAME_LOCAL_OFFSET_NED = 7,
     // MAV_FRAME_BODY_NED = 8, MAV_FRAME_BODY_OFFSET_NED = 9
     uint8_t coordinate_frame = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::Float, 1 },
+        { 44, MavLinkFieldType::Float, 1 },
+        { 48, MavLinkFieldType::UInt16, 1 },
+        { 50, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3225,6 +3892,26 @@ public:
     // Valid options are: MAV_FRAME_GLOBAL_INT = 5, MAV_FRAME_GLOBAL_RELATIVE_ALT_INT
     // = 6, MAV_FRAME_GLOBAL_TERRAIN_ALT_INT = 11
     uint8_t coordinate_frame = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Int32, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::Float, 1 },
+        { 44, MavLinkFieldType::Float, 1 },
+        { 48, MavLinkFieldType::UInt16, 1 },
+        { 50, MavLinkFieldType::UInt8, 1 },
+        { 51, MavLinkFieldType::UInt8, 1 },
+        { 52, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3278,6 +3965,24 @@ public:
     // Valid options are: MAV_FRAME_GLOBAL_INT = 5, MAV_FRAME_GLOBAL_RELATIVE_ALT_INT
     // = 6, MAV_FRAME_GLOBAL_TERRAIN_ALT_INT = 11
     uint8_t coordinate_frame = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Int32, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::Float, 1 },
+        { 44, MavLinkFieldType::Float, 1 },
+        { 48, MavLinkFieldType::UInt16, 1 },
+        { 50, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3305,6 +4010,17 @@ public:
     float pitch = 0;
     // Yaw
     float yaw = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3351,6 +4067,26 @@ public:
     int16_t yacc = 0;
     // Z acceleration (mg)
     int16_t zacc = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Int32, 1 },
+        { 36, MavLinkFieldType::Int32, 1 },
+        { 40, MavLinkFieldType::Int32, 1 },
+        { 44, MavLinkFieldType::Int16, 1 },
+        { 46, MavLinkFieldType::Int16, 1 },
+        { 48, MavLinkFieldType::Int16, 1 },
+        { 50, MavLinkFieldType::Int16, 1 },
+        { 52, MavLinkFieldType::Int16, 1 },
+        { 54, MavLinkFieldType::Int16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3384,6 +4120,21 @@ public:
     uint8_t mode = 0;
     // Navigation mode (MAV_NAV_MODE)
     uint8_t nav_mode = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::UInt8, 1 },
+        { 41, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3425,6 +4176,24 @@ public:
     uint16_t chan12_raw = 0;
     // Receive signal strength indicator, 0: 0%, 255: 100%
     uint8_t rssi = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::UInt16, 1 },
+        { 10, MavLinkFieldType::UInt16, 1 },
+        { 12, MavLinkFieldType::UInt16, 1 },
+        { 14, MavLinkFieldType::UInt16, 1 },
+        { 16, MavLinkFieldType::UInt16, 1 },
+        { 18, MavLinkFieldType::UInt16, 1 },
+        { 20, MavLinkFieldType::UInt16, 1 },
+        { 22, MavLinkFieldType::UInt16, 1 },
+        { 24, MavLinkFieldType::UInt16, 1 },
+        { 26, MavLinkFieldType::UInt16, 1 },
+        { 28, MavLinkFieldType::UInt16, 1 },
+        { 30, MavLinkFieldType::UInt16, 1 },
+        { 32, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3445,6 +4214,14 @@ public:
     float controls[16] = { 0 };
     // System mode (MAV_MODE), includes arming state.
     uint8_t mode = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::UInt64, 1 },
+        { 16, MavLinkFieldType::Float, 16 },
+        { 80, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3473,6 +4250,18 @@ public:
     uint8_t sensor_id = 0;
     // Optical flow quality / confidence. 0: bad, 255: maximum quality
     uint8_t quality = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Int16, 1 },
+        { 22, MavLinkFieldType::Int16, 1 },
+        { 24, MavLinkFieldType::UInt8, 1 },
+        { 25, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3497,6 +4286,17 @@ public:
     float pitch = 0;
     // Yaw angle in rad
     float yaw = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3521,6 +4321,17 @@ public:
     float pitch = 0;
     // Yaw angle in rad
     float yaw = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3539,6 +4350,14 @@ public:
     float y = 0;
     // Global Z speed
     float z = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3563,6 +4382,17 @@ public:
     float pitch = 0;
     // Yaw angle in rad
     float yaw = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3605,6 +4435,25 @@ public:
     // Bitmask for fields that have updated since last message, bit 0 = xacc, bit
     // 12: temperature
     uint16_t fields_updated = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::Float, 1 },
+        { 44, MavLinkFieldType::Float, 1 },
+        { 48, MavLinkFieldType::Float, 1 },
+        { 52, MavLinkFieldType::Float, 1 },
+        { 56, MavLinkFieldType::Float, 1 },
+        { 60, MavLinkFieldType::UInt16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3647,6 +4496,22 @@ public:
     uint8_t sensor_id = 0;
     // Optical flow quality / confidence. 0: no valid flow, 255: maximum quality
     uint8_t quality = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::UInt32, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::UInt32, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::Int16, 1 },
+        { 42, MavLinkFieldType::UInt8, 1 },
+        { 43, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3690,6 +4555,25 @@ public:
     // 12: temperature, bit 31: full reset of attitude/position/velocities/etc was
     // performed in sim.
     uint32_t fields_updated = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::Float, 1 },
+        { 44, MavLinkFieldType::Float, 1 },
+        { 48, MavLinkFieldType::Float, 1 },
+        { 52, MavLinkFieldType::Float, 1 },
+        { 56, MavLinkFieldType::Float, 1 },
+        { 60, MavLinkFieldType::UInt32, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3746,6 +4630,31 @@ public:
     float ve = 0;
     // True velocity in m/s in DOWN direction in earth-fixed NED frame
     float vd = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Float, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::Float, 1 },
+        { 44, MavLinkFieldType::Float, 1 },
+        { 48, MavLinkFieldType::Float, 1 },
+        { 52, MavLinkFieldType::Float, 1 },
+        { 56, MavLinkFieldType::Float, 1 },
+        { 60, MavLinkFieldType::Float, 1 },
+        { 64, MavLinkFieldType::Float, 1 },
+        { 68, MavLinkFieldType::Float, 1 },
+        { 72, MavLinkFieldType::Float, 1 },
+        { 76, MavLinkFieldType::Float, 1 },
+        { 80, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&q1); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&q1); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3771,6 +4680,17 @@ public:
     uint8_t noise = 0;
     // Remote background noise level
     uint8_t remnoise = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt16, 1 },
+        { 4, MavLinkFieldType::UInt8, 1 },
+        { 5, MavLinkFieldType::UInt8, 1 },
+        { 6, MavLinkFieldType::UInt8, 1 },
+        { 7, MavLinkFieldType::UInt8, 1 },
+        { 8, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&rxerrors); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&rxerrors); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3794,6 +4714,14 @@ public:
     // encoding used can be extension specific and might not always be documented
     // as part of the mavlink specification.
     uint8_t payload[251] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+        { 3, MavLinkFieldType::UInt8, 251 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&target_network); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&target_network); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3809,6 +4737,12 @@ public:
     int64_t tc1 = 0;
     // Time sync timestamp 2
     int64_t ts1 = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int64, 1 },
+        { 8, MavLinkFieldType::Int64, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&tc1); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&tc1); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3824,6 +4758,12 @@ public:
     uint64_t time_usec = 0;
     // Image frame sequence
     uint32_t seq = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::UInt32, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3867,6 +4807,23 @@ public:
     uint8_t fix_type = 0;
     // Number of satellites visible. If unknown, set to 255
     uint8_t satellites_visible = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::Int32, 1 },
+        { 16, MavLinkFieldType::Int32, 1 },
+        { 20, MavLinkFieldType::UInt16, 1 },
+        { 22, MavLinkFieldType::UInt16, 1 },
+        { 24, MavLinkFieldType::UInt16, 1 },
+        { 26, MavLinkFieldType::Int16, 1 },
+        { 28, MavLinkFieldType::Int16, 1 },
+        { 30, MavLinkFieldType::Int16, 1 },
+        { 32, MavLinkFieldType::UInt16, 1 },
+        { 34, MavLinkFieldType::UInt8, 1 },
+        { 35, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3909,6 +4866,22 @@ public:
     uint8_t sensor_id = 0;
     // Optical flow quality / confidence. 0: no valid flow, 255: maximum quality
     uint8_t quality = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::UInt32, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::UInt32, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::Int16, 1 },
+        { 42, MavLinkFieldType::UInt8, 1 },
+        { 43, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3955,6 +4928,26 @@ public:
     int16_t yacc = 0;
     // Z acceleration (mg)
     int16_t zacc = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 4 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Int32, 1 },
+        { 40, MavLinkFieldType::Int32, 1 },
+        { 44, MavLinkFieldType::Int32, 1 },
+        { 48, MavLinkFieldType::Int16, 1 },
+        { 50, MavLinkFieldType::Int16, 1 },
+        { 52, MavLinkFieldType::Int16, 1 },
+        { 54, MavLinkFieldType::UInt16, 1 },
+        { 56, MavLinkFieldType::UInt16, 1 },
+        { 58, MavLinkFieldType::Int16, 1 },
+        { 60, MavLinkFieldType::Int16, 1 },
+        { 62, MavLinkFieldType::Int16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -3987,6 +4980,20 @@ public:
     int16_t ymag = 0;
     // Z Magnetic field (milli tesla)
     int16_t zmag = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Int16, 1 },
+        { 6, MavLinkFieldType::Int16, 1 },
+        { 8, MavLinkFieldType::Int16, 1 },
+        { 10, MavLinkFieldType::Int16, 1 },
+        { 12, MavLinkFieldType::Int16, 1 },
+        { 14, MavLinkFieldType::Int16, 1 },
+        { 16, MavLinkFieldType::Int16, 1 },
+        { 18, MavLinkFieldType::Int16, 1 },
+        { 20, MavLinkFieldType::Int16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4007,6 +5014,14 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt16, 1 },
+        { 4, MavLinkFieldType::UInt8, 1 },
+        { 5, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&start); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&start); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4028,6 +5043,15 @@ public:
     uint16_t num_logs = 0;
     // High log number
     uint16_t last_log_num = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt32, 1 },
+        { 8, MavLinkFieldType::UInt16, 1 },
+        { 10, MavLinkFieldType::UInt16, 1 },
+        { 12, MavLinkFieldType::UInt16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_utc); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_utc); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4049,6 +5073,15 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt32, 1 },
+        { 8, MavLinkFieldType::UInt16, 1 },
+        { 10, MavLinkFieldType::UInt8, 1 },
+        { 11, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&ofs); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&ofs); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4068,6 +5101,14 @@ public:
     uint8_t count = 0;
     // log data
     uint8_t data[90] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt16, 1 },
+        { 6, MavLinkFieldType::UInt8, 1 },
+        { 7, MavLinkFieldType::UInt8, 90 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&ofs); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&ofs); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4083,6 +5124,12 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&target_system); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&target_system); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4098,6 +5145,12 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&target_system); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&target_system); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4117,6 +5170,14 @@ public:
     uint8_t len = 0;
     // raw data (110 is enough for 12 satellites of RTCMv2)
     uint8_t data[110] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+        { 3, MavLinkFieldType::UInt8, 110 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&target_system); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&target_system); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4154,6 +5215,22 @@ public:
     uint8_t satellites_visible = 0;
     // Number of DGPS satellites
     uint8_t dgps_numch = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::Int32, 1 },
+        { 16, MavLinkFieldType::Int32, 1 },
+        { 20, MavLinkFieldType::UInt32, 1 },
+        { 24, MavLinkFieldType::UInt16, 1 },
+        { 26, MavLinkFieldType::UInt16, 1 },
+        { 28, MavLinkFieldType::UInt16, 1 },
+        { 30, MavLinkFieldType::UInt16, 1 },
+        { 32, MavLinkFieldType::UInt8, 1 },
+        { 33, MavLinkFieldType::UInt8, 1 },
+        { 34, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4171,6 +5248,13 @@ public:
     uint16_t Vservo = 0;
     // power supply status flags (see MAV_POWER_STATUS enum)
     uint16_t flags = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt16, 1 },
+        { 4, MavLinkFieldType::UInt16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&Vcc); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&Vcc); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4197,6 +5281,16 @@ public:
     uint8_t count = 0;
     // serial data
     uint8_t data[70] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt16, 1 },
+        { 6, MavLinkFieldType::UInt8, 1 },
+        { 7, MavLinkFieldType::UInt8, 1 },
+        { 8, MavLinkFieldType::UInt8, 1 },
+        { 9, MavLinkFieldType::UInt8, 70 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&baudrate); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&baudrate); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4235,6 +5329,23 @@ public:
     uint8_t nsats = 0;
     // Coordinate system of baseline. 0 == ECEF, 1 == NED
     uint8_t baseline_coords_type = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt32, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::Int32, 1 },
+        { 16, MavLinkFieldType::Int32, 1 },
+        { 20, MavLinkFieldType::UInt32, 1 },
+        { 24, MavLinkFieldType::Int32, 1 },
+        { 28, MavLinkFieldType::UInt16, 1 },
+        { 30, MavLinkFieldType::UInt8, 1 },
+        { 31, MavLinkFieldType::UInt8, 1 },
+        { 32, MavLinkFieldType::UInt8, 1 },
+        { 33, MavLinkFieldType::UInt8, 1 },
+        { 34, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_last_baseline_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_last_baseline_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4273,6 +5384,23 @@ public:
     uint8_t nsats = 0;
     // Coordinate system of baseline. 0 == ECEF, 1 == NED
     uint8_t baseline_coords_type = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt32, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::Int32, 1 },
+        { 16, MavLinkFieldType::Int32, 1 },
+        { 20, MavLinkFieldType::UInt32, 1 },
+        { 24, MavLinkFieldType::Int32, 1 },
+        { 28, MavLinkFieldType::UInt16, 1 },
+        { 30, MavLinkFieldType::UInt8, 1 },
+        { 31, MavLinkFieldType::UInt8, 1 },
+        { 32, MavLinkFieldType::UInt8, 1 },
+        { 33, MavLinkFieldType::UInt8, 1 },
+        { 34, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_last_baseline_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_last_baseline_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4305,6 +5433,20 @@ public:
     int16_t ymag = 0;
     // Z Magnetic field (milli tesla)
     int16_t zmag = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Int16, 1 },
+        { 6, MavLinkFieldType::Int16, 1 },
+        { 8, MavLinkFieldType::Int16, 1 },
+        { 10, MavLinkFieldType::Int16, 1 },
+        { 12, MavLinkFieldType::Int16, 1 },
+        { 14, MavLinkFieldType::Int16, 1 },
+        { 16, MavLinkFieldType::Int16, 1 },
+        { 18, MavLinkFieldType::Int16, 1 },
+        { 20, MavLinkFieldType::Int16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4330,6 +5472,17 @@ public:
     uint8_t payload = 0;
     // JPEG quality out of [1,100]
     uint8_t jpg_quality = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt16, 1 },
+        { 6, MavLinkFieldType::UInt16, 1 },
+        { 8, MavLinkFieldType::UInt16, 1 },
+        { 10, MavLinkFieldType::UInt8, 1 },
+        { 11, MavLinkFieldType::UInt8, 1 },
+        { 12, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&size); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&size); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4344,6 +5497,12 @@ public:
     uint16_t seqnr = 0;
     // image data bytes
     uint8_t data[253] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt8, 253 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&seqnr); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&seqnr); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4370,6 +5529,18 @@ public:
     uint8_t orientation = 0;
     // Measurement covariance in centimeters, 0 for unknown / invalid readings
     uint8_t covariance = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::UInt16, 1 },
+        { 6, MavLinkFieldType::UInt16, 1 },
+        { 8, MavLinkFieldType::UInt16, 1 },
+        { 10, MavLinkFieldType::UInt8, 1 },
+        { 11, MavLinkFieldType::UInt8, 1 },
+        { 12, MavLinkFieldType::UInt8, 1 },
+        { 13, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4389,6 +5560,14 @@ public:
     int32_t lon = 0;
     // Grid spacing in meters
     uint16_t grid_spacing = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::Int32, 1 },
+        { 16, MavLinkFieldType::UInt16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&mask); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&mask); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4411,6 +5590,15 @@ public:
     int16_t data[16] = { 0 };
     // bit within the terrain request mask
     uint8_t gridbit = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int32, 1 },
+        { 4, MavLinkFieldType::Int32, 1 },
+        { 8, MavLinkFieldType::UInt16, 1 },
+        { 10, MavLinkFieldType::Int16, 16 },
+        { 42, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&lat); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&lat); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4427,6 +5615,12 @@ public:
     int32_t lat = 0;
     // Longitude (degrees *10^7)
     int32_t lon = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int32, 1 },
+        { 4, MavLinkFieldType::Int32, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&lat); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&lat); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4452,6 +5646,17 @@ public:
     uint16_t pending = 0;
     // Number of 4x4 terrain blocks in memory
     uint16_t loaded = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int32, 1 },
+        { 4, MavLinkFieldType::Int32, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::UInt16, 1 },
+        { 18, MavLinkFieldType::UInt16, 1 },
+        { 20, MavLinkFieldType::UInt16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&lat); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&lat); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4471,6 +5676,14 @@ public:
     float press_diff = 0;
     // Temperature measurement (0.01 degrees celsius)
     int16_t temperature = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Int16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4492,6 +5705,15 @@ public:
     float y = 0;
     // Z position in meters (NED)
     float z = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 4 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4518,6 +5740,15 @@ public:
     uint8_t target_system = 0;
     // Component ID
     uint8_t target_component = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 8 },
+        { 40, MavLinkFieldType::UInt8, 1 },
+        { 41, MavLinkFieldType::UInt8, 1 },
+        { 42, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4540,6 +5771,13 @@ public:
     // Actuator group. The "_mlx" indicates this is a multi-instance message and a
     // MAVLink parser should use this field to difference between instances.
     uint8_t group_mlx = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 8 },
+        { 40, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4579,6 +5817,17 @@ public:
     // of e.g. the laser altimeter. It is generally a moving target. A negative value
     // indicates no measurement available.
     float bottom_clearance = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4603,6 +5852,15 @@ public:
     // The storage path the autopilot wants the URI to be stored in. Will only be
     // valid if the transfer_type has a storage associated (e.g. MAVLink FTP).
     uint8_t storage[120] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 1 },
+        { 2, MavLinkFieldType::UInt8, 120 },
+        { 122, MavLinkFieldType::UInt8, 1 },
+        { 123, MavLinkFieldType::UInt8, 120 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&request_id); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&request_id); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4622,6 +5880,14 @@ public:
     float press_diff = 0;
     // Temperature measurement (0.01 degrees celsius)
     int16_t temperature = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Int16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4656,6 +5922,21 @@ public:
     // bit positions for tracker reporting capabilities (POS = 0, VEL = 1, ACCEL =
     // 2, ATT + RATES = 3)
     uint8_t est_capabilities = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::UInt64, 1 },
+        { 16, MavLinkFieldType::Int32, 1 },
+        { 20, MavLinkFieldType::Int32, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 3 },
+        { 40, MavLinkFieldType::Float, 3 },
+        { 52, MavLinkFieldType::Float, 4 },
+        { 68, MavLinkFieldType::Float, 3 },
+        { 80, MavLinkFieldType::Float, 3 },
+        { 92, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&timestamp); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&timestamp); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4701,6 +5982,27 @@ public:
     float pitch_rate = 0;
     // Angular rate in yaw axis
     float yaw_rate = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::Float, 1 },
+        { 44, MavLinkFieldType::Float, 1 },
+        { 48, MavLinkFieldType::Float, 3 },
+        { 60, MavLinkFieldType::Float, 3 },
+        { 72, MavLinkFieldType::Float, 4 },
+        { 88, MavLinkFieldType::Float, 1 },
+        { 92, MavLinkFieldType::Float, 1 },
+        { 96, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4736,6 +6038,19 @@ public:
     // Remaining battery energy: (0%: 0, 100%: 100), -1: autopilot does not estimate
     // the remaining battery
     int8_t battery_remaining = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int32, 1 },
+        { 4, MavLinkFieldType::Int32, 1 },
+        { 8, MavLinkFieldType::Int16, 1 },
+        { 10, MavLinkFieldType::UInt16, 10 },
+        { 30, MavLinkFieldType::Int16, 1 },
+        { 32, MavLinkFieldType::UInt8, 1 },
+        { 33, MavLinkFieldType::UInt8, 1 },
+        { 34, MavLinkFieldType::UInt8, 1 },
+        { 35, MavLinkFieldType::Int8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&current_consumed); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&current_consumed); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4775,6 +6090,21 @@ public:
     // an unique identifier, but should allow to identify the commit using the main
     // version number even for very large code bases.
     uint8_t os_custom_version[8] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::UInt64, 1 },
+        { 16, MavLinkFieldType::UInt32, 1 },
+        { 20, MavLinkFieldType::UInt32, 1 },
+        { 24, MavLinkFieldType::UInt32, 1 },
+        { 28, MavLinkFieldType::UInt32, 1 },
+        { 32, MavLinkFieldType::UInt16, 1 },
+        { 34, MavLinkFieldType::UInt16, 1 },
+        { 36, MavLinkFieldType::UInt8, 8 },
+        { 44, MavLinkFieldType::UInt8, 8 },
+        { 52, MavLinkFieldType::UInt8, 8 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&capabilities); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&capabilities); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4803,6 +6133,18 @@ public:
     // MAV_FRAME enum specifying the whether the following feilds are earth-frame,
     // body-frame, etc.
     uint8_t frame = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::UInt8, 1 },
+        { 29, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4844,6 +6186,20 @@ public:
     // Integer bitmask indicating which EKF outputs are valid. See definition for
     // ESTIMATOR_STATUS_FLAGS.
     uint16_t flags = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::UInt16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4872,6 +6228,19 @@ public:
     float horiz_accuracy = 0;
     // Vertical speed 1-STD accuracy
     float vert_accuracy = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4921,6 +6290,28 @@ public:
     uint8_t fix_type = 0;
     // Number of satellites visible.
     uint8_t satellites_visible = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::UInt32, 1 },
+        { 12, MavLinkFieldType::Int32, 1 },
+        { 16, MavLinkFieldType::Int32, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 1 },
+        { 28, MavLinkFieldType::Float, 1 },
+        { 32, MavLinkFieldType::Float, 1 },
+        { 36, MavLinkFieldType::Float, 1 },
+        { 40, MavLinkFieldType::Float, 1 },
+        { 44, MavLinkFieldType::Float, 1 },
+        { 48, MavLinkFieldType::Float, 1 },
+        { 52, MavLinkFieldType::Float, 1 },
+        { 56, MavLinkFieldType::UInt16, 1 },
+        { 58, MavLinkFieldType::UInt16, 1 },
+        { 60, MavLinkFieldType::UInt8, 1 },
+        { 61, MavLinkFieldType::UInt8, 1 },
+        { 62, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -4938,6 +6329,13 @@ public:
     uint8_t len = 0;
     // RTCM message (may be fragmented)
     uint8_t data[180] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 1 },
+        { 2, MavLinkFieldType::UInt8, 180 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&flags); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&flags); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5006,6 +6404,38 @@ public:
     uint8_t failsafe = 0;
     // current waypoint number
     uint8_t wp_num = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::UInt32, 1 },
+        { 12, MavLinkFieldType::Int32, 1 },
+        { 16, MavLinkFieldType::Int32, 1 },
+        { 20, MavLinkFieldType::Int16, 1 },
+        { 22, MavLinkFieldType::Int16, 1 },
+        { 24, MavLinkFieldType::UInt16, 1 },
+        { 26, MavLinkFieldType::Int16, 1 },
+        { 28, MavLinkFieldType::Int16, 1 },
+        { 30, MavLinkFieldType::Int16, 1 },
+        { 32, MavLinkFieldType::Int16, 1 },
+        { 34, MavLinkFieldType::Int16, 1 },
+        { 36, MavLinkFieldType::Int16, 1 },
+        { 38, MavLinkFieldType::UInt16, 1 },
+        { 40, MavLinkFieldType::UInt8, 1 },
+        { 41, MavLinkFieldType::UInt8, 1 },
+        { 42, MavLinkFieldType::Int8, 1 },
+        { 43, MavLinkFieldType::UInt8, 1 },
+        { 44, MavLinkFieldType::UInt8, 1 },
+        { 45, MavLinkFieldType::UInt8, 1 },
+        { 46, MavLinkFieldType::Int8, 1 },
+        { 47, MavLinkFieldType::UInt8, 1 },
+        { 48, MavLinkFieldType::UInt8, 1 },
+        { 49, MavLinkFieldType::UInt8, 1 },
+        { 50, MavLinkFieldType::Int8, 1 },
+        { 51, MavLinkFieldType::Int8, 1 },
+        { 52, MavLinkFieldType::UInt8, 1 },
+        { 53, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5031,6 +6461,17 @@ public:
     uint32_t clipping_1 = 0;
     // third accelerometer clipping count
     uint32_t clipping_2 = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::UInt32, 1 },
+        { 24, MavLinkFieldType::UInt32, 1 },
+        { 28, MavLinkFieldType::UInt32, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5084,6 +6525,20 @@ public:
     // should set it to the opposite direction of the takeoff, assuming the takeoff
     // happened from the threshold / touchdown zone.
     float approach_z = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int32, 1 },
+        { 4, MavLinkFieldType::Int32, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 4 },
+        { 40, MavLinkFieldType::Float, 1 },
+        { 44, MavLinkFieldType::Float, 1 },
+        { 48, MavLinkFieldType::Float, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&latitude); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&latitude); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5137,6 +6592,21 @@ public:
     float approach_z = 0;
     // System ID.
     uint8_t target_system = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int32, 1 },
+        { 4, MavLinkFieldType::Int32, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Float, 1 },
+        { 24, MavLinkFieldType::Float, 4 },
+        { 40, MavLinkFieldType::Float, 1 },
+        { 44, MavLinkFieldType::Float, 1 },
+        { 48, MavLinkFieldType::Float, 1 },
+        { 52, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&latitude); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&latitude); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5154,6 +6624,12 @@ public:
     int32_t interval_us = 0;
     // The ID of the requested MAVLink message. v1.0 is limited to 254 messages.
     uint16_t message_id = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::Int32, 1 },
+        { 4, MavLinkFieldType::UInt16, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&interval_us); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&interval_us); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5170,6 +6646,12 @@ public:
     uint8_t vtol_state = 0;
     // The landed state. Is set to MAV_LANDED_STATE_UNDEFINED if landed state is unknown.
     uint8_t landed_state = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&vtol_state); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&vtol_state); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5207,6 +6689,23 @@ public:
     uint8_t emitter_type = 0;
     // Time since last communication in seconds
     uint8_t tslc = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Int32, 1 },
+        { 8, MavLinkFieldType::Int32, 1 },
+        { 12, MavLinkFieldType::Int32, 1 },
+        { 16, MavLinkFieldType::UInt16, 1 },
+        { 18, MavLinkFieldType::UInt16, 1 },
+        { 20, MavLinkFieldType::Int16, 1 },
+        { 22, MavLinkFieldType::UInt16, 1 },
+        { 24, MavLinkFieldType::UInt16, 1 },
+        { 26, MavLinkFieldType::UInt8, 1 },
+        { 27, MavLinkFieldType::Char, 9 },
+        { 36, MavLinkFieldType::UInt8, 1 },
+        { 37, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&ICAO_address); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&ICAO_address); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5232,6 +6731,17 @@ public:
     uint8_t action = 0;
     // How concerned the aircraft is about this collision
     uint8_t threat_level = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::UInt8, 1 },
+        { 17, MavLinkFieldType::UInt8, 1 },
+        { 18, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&id); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&id); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5264,6 +6774,15 @@ public:
     // encoding used can be extension specific and might not always be documented
     // as part of the mavlink specification.
     uint8_t payload[249] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+        { 3, MavLinkFieldType::UInt8, 1 },
+        { 4, MavLinkFieldType::UInt8, 1 },
+        { 5, MavLinkFieldType::UInt8, 249 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&message_type); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&message_type); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5287,6 +6806,14 @@ public:
     uint8_t type = 0;
     // Memory contents at specified address
     int8_t value[32] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt8, 1 },
+        { 3, MavLinkFieldType::UInt8, 1 },
+        { 4, MavLinkFieldType::Int8, 32 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&address); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&address); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5307,6 +6834,15 @@ public:
     float z = 0;
     // Name
     char name[10] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt64, 1 },
+        { 8, MavLinkFieldType::Float, 1 },
+        { 12, MavLinkFieldType::Float, 1 },
+        { 16, MavLinkFieldType::Float, 1 },
+        { 20, MavLinkFieldType::Char, 10 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_usec); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_usec); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5326,6 +6862,13 @@ public:
     float value = 0;
     // Name of the debug variable
     char name[10] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::Char, 10 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5345,6 +6888,13 @@ public:
     int32_t value = 0;
     // Name of the debug variable
     char name[10] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Int32, 1 },
+        { 8, MavLinkFieldType::Char, 10 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5363,6 +6913,12 @@ public:
     uint8_t severity = 0;
     // Status text message, without null termination character
     char text[50] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt8, 1 },
+        { 1, MavLinkFieldType::Char, 50 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&severity); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&severity); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5381,6 +6937,13 @@ public:
     float value = 0;
     // index of debug variable
     uint8_t ind = 0;
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt32, 1 },
+        { 4, MavLinkFieldType::Float, 1 },
+        { 8, MavLinkFieldType::UInt8, 1 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&time_boot_ms); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&time_boot_ms); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
@@ -5401,6 +6964,15 @@ public:
     uint16_t max_version = 0;
     uint8_t spec_version_hash[8] = { 0 };
     uint8_t library_version_hash[8] = { 0 };
+    static constexpr MavLinkField kFields[] = {
+        { 0, MavLinkFieldType::UInt16, 1 },
+        { 2, MavLinkFieldType::UInt16, 1 },
+        { 4, MavLinkFieldType::UInt16, 1 },
+        { 6, MavLinkFieldType::UInt8, 8 },
+        { 14, MavLinkFieldType::UInt8, 8 },
+    };
+    char* fieldData() { return reinterpret_cast<char*>(&version); }
+    const char* fieldData() const { return reinterpret_cast<const char*>(&version); }
     virtual std::string toJSon();
 protected:
     virtual int pack(char* buffer) const;
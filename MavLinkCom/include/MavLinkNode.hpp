@@ -47,8 +47,13 @@ namespace mavlinkcom {
         // already doing it.
         void startHeartbeat();
 
-        // get the list of configurable parameters supported by this node.
+        // get the list of configurable parameters supported by this node.  Missing parameters are
+        // requested a window at a time, and if setParamCacheFolder was called the list is loaded from the
+        // cache instead when the vehicle reports the same parameter hash as last time.
         std::vector<MavLinkParameter> getParamList();
+
+        // folder where getParamList keeps one parameter file per vehicle, empty (the default) turns this off.
+        void setParamCacheFolder(const std::string& folder);
         
         // get the parameter from last getParamList download.
         MavLinkParameter getCachedParameter(const std::string& name);
@@ -56,6 +61,11 @@ namespace mavlinkcom {
         // get a single parameter by name.
         AsyncResult<MavLinkParameter> getParameter(const std::string& name);
 
+        // get up to date values of several parameters at once, the requests are pipelined instead of waiting
+        // for each answer in turn.  The result is in the same order as names, with index -1 for parameters
+        // the vehicle did not answer.
+        std::vector<MavLinkParameter> getParameters(const std::vector<std::string>& names);
+
         // set a new value on a given parameter.  
         // it is best if you use getParameter to get the current value, see if it
         // needs changing, change the value, then call setParameter with the same parameter object.
@@ -89,6 +99,9 @@ namespace mavlinkcom {
         // passing a message along).
         void sendMessage(MavLinkMessage& msg);
 
+        // Send already encoded messages to the remote node together, see MavLinkConnection::sendMessages.
+        void sendMessages(std::vector<MavLinkMessage>& messages);
+
         // send a command to the remote node
         void sendCommand(MavLinkCommand& cmd);
 
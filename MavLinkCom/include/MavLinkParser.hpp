@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef MavLinkCom_MavLinkParser_hpp
+#define MavLinkCom_MavLinkParser_hpp
+
+#include <functional>
+#include <memory>
+#include <stdint.h>
+#include "MavLinkMessageBase.hpp"
+
+namespace mavlinkcom_impl {
+    class MavLinkParserImpl;
+}
+
+namespace mavlinkcom
+{
+    // The parser MavLinkConnection uses for incoming bytes, for when you have a raw mavlink stream from
+    // somewhere else, like a capture file.  Data can be handed over in pieces of any size, a frame split
+    // across two calls is picked up where it left off.
+    class MavLinkParser
+    {
+    public:
+        // called for every message with a good crc, msg is only valid during the call.
+        typedef std::function<void(const MavLinkMessage& msg)> MessageHandler;
+
+        MavLinkParser();
+        ~MavLinkParser();
+
+        // returns the number of good messages found.
+        int parse(const uint8_t* buffer, int count, const MessageHandler& handler);
+
+        // number of frames dropped because of a bad crc or signature so far.
+        uint32_t getCrcErrors() { return crc_errors_; }
+
+        // by default whole frames are checked in one go and only partial or broken frames go through the
+        // mavlink byte at a time parser, turning this off uses the byte parser for everything.
+        void setFastPath(bool enabled);
+
+    private:
+        std::unique_ptr<mavlinkcom_impl::MavLinkParserImpl> pImpl;
+        MavLinkMessage message_;
+        uint32_t crc_errors_ = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "StrictMode.hpp"
+
+STRICT_MODE_OFF
+#define MAVLINK_PACKED
+#include "../mavlink/common/mavlink.h"
+#include "../mavlink/mavlink_types.h"
+#include "../mavlink/mavlink_helpers.h"
+STRICT_MODE_ON
+
+#include "MavLinkCodec.hpp"
+#include "impl/MavLinkCrc.hpp"
+
+using namespace mavlinkcom;
+using namespace mavlinkcom_impl;
+
+namespace {
+    uint8_t getCrcExtra(uint32_t msgid)
+    {
+        // same as MavLinkConnectionImpl, messages mavlink doesn't know about (like MavLinkTelemetry) use 0.
+        const mavlink_msg_entry_t* entry = mavlink_get_msg_entry(msgid);
+        return entry != nullptr ? entry->crc_extra : 0;
+    }
+}
+
+MavLinkBatchDecoder::MavLinkBatchDecoder(const uint8_t* buffer, size_t length)
+    : buffer_(buffer), length_(length)
+{
+}
+
+bool MavLinkBatchDecoder::next(MavLinkFrame& frame)
+{
+    while (pos_ < length_) {
+        const uint8_t* start = buffer_ + pos_;
+        size_t remaining = length_ - pos_;
+        bool mavlink1 = start[0] == MAVLINK_STX_MAVLINK1;
+        if (!mavlink1 && start[0] != MAVLINK_STX) {
+            pos_++;
+            skipped_++;
+            continue;
+        }
+
+        size_t header_len = mavlink1 ? MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1 : MAVLINK_CORE_HEADER_LEN + 1;
+        if (remaining < header_len) {
+            break;
+        }
+        uint8_t len = start[1];
+        bool signed_frame = !mavlink1 && (start[2] & MAVLINK_IFLAG_SIGNED) != 0;
+        size_t frame_len = header_len + len + 2 + (signed_frame ? MAVLINK_SIGNATURE_BLOCK_LEN : 0);
+        if (remaining < frame_len) {
+            break;
+        }
+
+        uint32_t msgid;
+        if (mavlink1) {
+            frame.seq = start[2];
+            frame.sysid = start[3];
+            frame.compid = start[4];
+            msgid = start[5];
+        }
+        else {
+            frame.seq = start[4];
+            frame.sysid = start[5];
+            frame.compid = start[6];
+            msgid = start[7] | (start[8] << 8) | (start[9] << 16);
+        }
+
+        const uint8_t* payload = start + header_len;
+        uint16_t checksum = MavLinkCrc::accumulate(MavLinkCrc::kInitial, &start[1], header_len - 1 + len);
+        checksum = MavLinkCrc::accumulate(checksum, getCrcExtra(msgid));
+        if (payload[len] != (checksum & 0xFF) || payload[len + 1] != (checksum >> 8)) {
+            // could be a stray magic byte in the middle of garbage, resync one byte later.
+            pos_++;
+            skipped_++;
+            continue;
+        }
+
+        frame.msgid = msgid;
+        frame.len = len;
+        frame.protocol_version = mavlink1 ? 1 : 2;
+        frame.payload = payload;
+        pos_ += frame_len;
+        return true;
+    }
+
+    // partial frame at the end.
+    skipped_ += length_ - pos_;
+    pos_ = length_;
+    return false;
+}
+
+int MavLinkBatchDecoder::writeFrame(const MavLinkMessage& msg, uint8_t* buffer)
+{
+    bool mavlink1 = msg.protocol_version != 2;
+    int header_len;
+    if (mavlink1) {
+        header_len = MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1;
+        buffer[0] = MAVLINK_STX_MAVLINK1;
+        buffer[1] = msg.len;
+        buffer[2] = msg.seq;
+        buffer[3] = msg.sysid;
+        buffer[4] = msg.compid;
+        buffer[5] = msg.msgid & 0xFF;
+    }
+    else {
+        header_len = MAVLINK_CORE_HEADER_LEN + 1;
+        buffer[0] = MAVLINK_STX;
+        buffer[1] = msg.len;
+        buffer[2] = 0;
+        buffer[3] = 0;
+        buffer[4] = msg.seq;
+        buffer[5] = msg.sysid;
+        buffer[6] = msg.compid;
+        buffer[7] = msg.msgid & 0xFF;
+        buffer[8] = (msg.msgid >> 8) & 0xFF;
+        buffer[9] = (msg.msgid >> 16) & 0xFF;
+    }
+    uint8_t* payload = buffer + header_len;
+    std::memcpy(payload, msg.payload64, msg.len);
+
+    uint16_t checksum = MavLinkCrc::accumulate(MavLinkCrc::kInitial, &buffer[1], header_len - 1 + msg.len);
+    checksum = MavLinkCrc::accumulate(checksum, getCrcExtra(msg.msgid));
+    payload[msg.len] = checksum & 0xFF;
+    payload[msg.len + 1] = checksum >> 8;
+    return header_len + msg.len + 2;
+}
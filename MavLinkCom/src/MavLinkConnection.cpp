@@ -32,6 +32,16 @@ std::shared_ptr<MavLinkConnection>  MavLinkConnection::connectTcp(const std::str
     return MavLinkConnectionImpl::connectTcp(nodeName, localAddr, remoteIpAddr, remotePort);
 }
 
+std::shared_ptr<MavLinkConnection>  MavLinkConnection::connectSharedMemory(const std::string& nodeName, const std::string& segmentName, bool create)
+{
+    return MavLinkConnectionImpl::connectSharedMemory(nodeName, segmentName, create);
+}
+
+bool MavLinkConnection::setEventLoopThreads(int threadCount)
+{
+    return EventLoop::configure(threadCount);
+}
+
 void MavLinkConnection::startListening(const std::string& nodeName, std::shared_ptr<Port> connectedPort)
 {
     pImpl->startListening(shared_from_this(), nodeName, connectedPort);
@@ -94,6 +104,11 @@ void MavLinkConnection::sendMessage(const MavLinkMessage& msg)
     pImpl->sendMessage(msg);
 }
 
+void MavLinkConnection::sendMessages(const std::vector<MavLinkMessage>& messages)
+{
+    pImpl->sendMessages(messages);
+}
+
 int MavLinkConnection::subscribe(MessageHandler handler)
 {
     return pImpl->subscribe(handler);
@@ -28,6 +28,18 @@ void MavLinkFtpClient::cancel()
 	ptr->cancel();
 }
 
+void MavLinkFtpClient::setWindowSize(int window)
+{
+	auto ptr = dynamic_cast<MavLinkFtpClientImpl*>(pImpl.get());
+	ptr->setWindowSize(window);
+}
+
+void MavLinkFtpClient::setBurstRead(bool enabled)
+{
+	auto ptr = dynamic_cast<MavLinkFtpClientImpl*>(pImpl.get());
+	ptr->setBurstRead(enabled);
+}
+
 void MavLinkFtpClient::list(MavLinkFtpProgress& progress, const std::string& remotePath, std::vector<MavLinkFileInfo>& files)
 {
 	auto ptr = dynamic_cast<MavLinkFtpClientImpl*>(pImpl.get());
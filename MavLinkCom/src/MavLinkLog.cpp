@@ -4,10 +4,205 @@
 #include "MavLinkLog.hpp"
 #include "Utils.hpp"
 #include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#ifndef _WIN32
+#include <sys/uio.h>
+#include <limits.h>
+#include <unistd.h>
+#endif
 
 using namespace mavlinkcom;
 using namespace mavlink_utils;
 
+namespace {
+	// each message in a binary log is the timestamp, 6 header bytes, the payload and the checksum.
+	const size_t kMaxRecordSize = sizeof(uint64_t) + 6 + 255 + sizeof(uint16_t);
+
+	// async writer buffers, a block is written as soon as it is full or when it is older than kFlushMilliseconds.
+	const size_t kBlockSize = 256 * 1024;
+	const int kBlockCount = 8;
+	const int kFlushMilliseconds = 100;
+}
+
+// Collects appended bytes in large blocks and writes full blocks to the file on its own thread.  Callers
+// only hold the lock long enough to copy their bytes, file I/O never happens while holding it.
+class MavLinkFileLog::AsyncWriter
+{
+public:
+	AsyncWriter(MavLinkFileLog* owner)
+		: owner_(owner), file_(owner->ptr_), drop_when_full_(owner->drop_when_full_)
+	{
+		for (int i = 0; i < kBlockCount; i++) {
+			blocks_.push_back(std::unique_ptr<Block>(new Block()));
+			blocks_.back()->data.resize(kBlockSize);
+			free_.push_back(blocks_.back().get());
+		}
+		current_ = free_.back();
+		free_.pop_back();
+		// anything the FILE has buffered must go out before we start writing blocks.
+		fflush(file_);
+		thread_ = std::thread(&AsyncWriter::run, this);
+	}
+
+	~AsyncWriter()
+	{
+		stop();
+	}
+
+	void append(const void* data, size_t size)
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		if (stopping_ || size > kBlockSize) {
+			owner_->dropped_appends_++;
+			return;
+		}
+		if (current_ != nullptr && current_->used + size > kBlockSize) {
+			full_.push_back(current_);
+			current_ = nullptr;
+			has_data_.notify_one();
+		}
+		if (current_ == nullptr) {
+			if (free_.empty()) {
+				if (drop_when_full_) {
+					owner_->dropped_appends_++;
+					return;
+				}
+				owner_->blocked_appends_++;
+				has_space_.wait(lock, [this] { return !free_.empty() || stopping_; });
+				if (free_.empty()) {
+					owner_->dropped_appends_++;
+					return;
+				}
+			}
+			current_ = free_.back();
+			free_.pop_back();
+		}
+		::memcpy(current_->data.data() + current_->used, data, size);
+		current_->used += size;
+	}
+
+	// write everything appended so far and stop the thread.
+	void stop()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if (stopping_) {
+				return;
+			}
+			stopping_ = true;
+		}
+		has_data_.notify_one();
+		has_space_.notify_all();
+		if (thread_.joinable()) {
+			thread_.join();
+		}
+	}
+
+private:
+	struct Block {
+		std::vector<uint8_t> data;
+		size_t used = 0;
+	};
+
+	void run()
+	{
+		std::vector<Block*> batch;
+		while (true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				// partly filled block is written after a short while too, so the file never lags far behind.
+				has_data_.wait_for(lock, std::chrono::milliseconds(kFlushMilliseconds), [this] { return !full_.empty() || stopping_; });
+				batch.assign(full_.begin(), full_.end());
+				full_.clear();
+				if (current_ != nullptr && current_->used > 0 && (batch.empty() || stopping_)) {
+					batch.push_back(current_);
+					current_ = nullptr;
+				}
+				if (batch.empty() && stopping_) {
+					break;
+				}
+			}
+
+			writeBlocks(batch);
+
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				for (Block* block : batch) {
+					block->used = 0;
+					free_.push_back(block);
+				}
+			}
+			has_space_.notify_all();
+		}
+	}
+
+	void writeBlocks(const std::vector<Block*>& batch)
+	{
+		if (batch.empty()) {
+			return;
+		}
+		size_t total = 0;
+#ifdef _WIN32
+		for (Block* block : batch) {
+			total += fwrite(block->data.data(), 1, block->used, file_);
+		}
+#else
+		// one writev for all the blocks, looping in case the kernel takes less than all of it.
+		int fd = fileno(file_);
+		std::vector<iovec> iov;
+		for (Block* block : batch) {
+			iovec v;
+			v.iov_base = block->data.data();
+			v.iov_len = block->used;
+			iov.push_back(v);
+		}
+		size_t next = 0;
+		while (next < iov.size())
+		{
+			ssize_t rc = ::writev(fd, &iov[next], static_cast<int>(std::min<size_t>(iov.size() - next, IOV_MAX)));
+			if (rc < 0) {
+				if (errno == EINTR) {
+					continue;
+				}
+				Utils::log(Utils::stringf("MavLinkFileLog: write failed, error=%d", errno), Utils::kLogLevelError);
+				break;
+			}
+			total += static_cast<size_t>(rc);
+			size_t written = static_cast<size_t>(rc);
+			while (next < iov.size() && written >= iov[next].iov_len) {
+				written -= iov[next].iov_len;
+				next++;
+			}
+			if (next < iov.size()) {
+				iov[next].iov_base = static_cast<uint8_t*>(iov[next].iov_base) + written;
+				iov[next].iov_len -= written;
+			}
+		}
+#endif
+		owner_->bytes_written_ += total;
+	}
+
+	MavLinkFileLog* owner_;
+	FILE* file_;
+	bool drop_when_full_;
+	std::thread thread_;
+	std::mutex mutex_;
+	std::condition_variable has_data_;
+	std::condition_variable has_space_;
+	std::vector<std::unique_ptr<Block>> blocks_;
+	std::vector<Block*> free_;
+	std::deque<Block*> full_;
+	Block* current_ = nullptr;
+	bool stopping_ = false;
+};
+
 uint64_t MavLinkFileLog::getTimeStamp()
 {
     return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::high_resolution_clock::now().time_since_epoch()).count();
@@ -20,6 +215,13 @@ MavLinkFileLog::MavLinkFileLog()
 	reading_ = false;
 	writing_ = false;
 	json_ = false;
+	async_ = false;
+	drop_when_full_ = false;
+	messages_ = 0;
+	bytes_written_ = 0;
+	blocked_appends_ = 0;
+	dropped_appends_ = 0;
+	stats_time_ = 0;
 }
 
 MavLinkFileLog::~MavLinkFileLog()
@@ -56,12 +258,59 @@ void MavLinkFileLog::openForWriting(const std::string& filename, bool json)
 	if (json) {
 		fprintf(ptr_, "{ \"rows\": [\n");
 	}
+	messages_ = 0;
+	bytes_written_ = 0;
+	blocked_appends_ = 0;
+	dropped_appends_ = 0;
+	stats_time_ = getTimeStamp();
+	if (async_) {
+		writer_.reset(new AsyncWriter(this));
+	}
 	reading_ = false;
 	writing_ = true;
 }
 
+void MavLinkFileLog::setAsync(bool async, bool dropWhenFull)
+{
+	async_ = async;
+	drop_when_full_ = dropWhenFull;
+}
+
+void MavLinkFileLog::getWriterStats(MavLinkLogWriterStats& result)
+{
+	uint64_t now = getTimeStamp();
+	result = MavLinkLogWriterStats();
+	result.messages = messages_.exchange(0);
+	result.bytesWritten = bytes_written_.exchange(0);
+	result.blockedAppends = blocked_appends_.exchange(0);
+	result.droppedAppends = dropped_appends_.exchange(0);
+	if (stats_time_ != 0 && now > stats_time_) {
+		result.bytesPerSecond = static_cast<double>(result.bytesWritten) * 1E6 / static_cast<double>(now - stats_time_);
+	}
+	stats_time_ = now;
+}
+
+void MavLinkFileLog::append(const void* data, size_t size)
+{
+	if (writer_ != nullptr) {
+		writer_->append(data, size);
+	}
+	else {
+		// one fwrite per message so messages written from different threads don't get interleaved.
+		bytes_written_ += fwrite(data, 1, size, ptr_);
+	}
+}
+
 void MavLinkFileLog::close()
 {
+	if (writer_ != nullptr) {
+		// flush everything still buffered before the json trailer goes out.
+		writer_->stop();
+		writer_ = nullptr;
+		if (ptr_ != nullptr) {
+			fseek(ptr_, 0, SEEK_END);
+		}
+	}
 	FILE* temp = ptr_;
 	if (json_ && ptr_ != nullptr) {
         fprintf(ptr_, "    {}\n"); // so that trailing comma on last row isn't a problem.
@@ -100,8 +349,8 @@ void MavLinkFileLog::write(const mavlinkcom::MavLinkMessage& msg, uint64_t times
 			MavLinkMessageBase* strongTypedMsg = MavLinkMessageBase::lookup(msg);
 			if (strongTypedMsg != nullptr) {
                 strongTypedMsg->timestamp = timestamp;
-				std::string line = strongTypedMsg->toJSon();
-				fprintf(ptr_, "    %s\n", line.c_str());
+				std::string line = "    " + strongTypedMsg->toJSon() + "\n";
+				append(line.c_str(), line.size());
                 delete strongTypedMsg;
 			}
 		}
@@ -112,17 +361,24 @@ void MavLinkFileLog::write(const mavlinkcom::MavLinkMessage& msg, uint64_t times
 			// for compatibility with QGroundControl we have to save the time field in big endian.
             // todo: mavlink2 support?
             timestamp = FlipEndianness(timestamp);
-			fwrite(&timestamp, sizeof(uint64_t), 1, ptr_);
-			fwrite(&msg.magic, 1, 1, ptr_);
-			fwrite(&msg.len, 1, 1, ptr_);
-			fwrite(&msg.seq, 1, 1, ptr_);
-			fwrite(&msg.sysid, 1, 1, ptr_);
-			fwrite(&msg.compid, 1, 1, ptr_);
-            uint8_t msgid = msg.msgid & 0xff; // truncate to mavlink1 msgid
-			fwrite(&msgid, 1, 1, ptr_);
-			fwrite(&msg.payload64, 1, msg.len, ptr_);
-			fwrite(&msg.checksum, sizeof(uint16_t), 1, ptr_);
+			// frame the whole record first so it goes out with a single write.
+			uint8_t record[kMaxRecordSize];
+			size_t size = 0;
+			::memcpy(record, &timestamp, sizeof(uint64_t));
+			size += sizeof(uint64_t);
+			record[size++] = msg.magic;
+			record[size++] = msg.len;
+			record[size++] = msg.seq;
+			record[size++] = msg.sysid;
+			record[size++] = msg.compid;
+			record[size++] = msg.msgid & 0xff; // truncate to mavlink1 msgid
+			::memcpy(record + size, msg.payload64, msg.len);
+			size += msg.len;
+			::memcpy(record + size, &msg.checksum, sizeof(uint16_t));
+			size += sizeof(uint16_t);
+			append(record, size);
 		}
+		messages_++;
 	}
 }
 
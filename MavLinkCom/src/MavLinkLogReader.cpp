@@ -0,0 +1,419 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "MavLinkLogReader.hpp"
+#include "Utils.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdio.h>
+#include <errno.h>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace mavlinkcom;
+using namespace mavlink_utils;
+
+namespace {
+    // each message in the log is an 8 byte big endian timestamp, magic, len, seq, sysid, compid, msgid,
+    // len bytes of payload and a 2 byte checksum, see MavLinkFileLog::write.
+    const uint64_t kHeaderSize = 14;
+    const uint64_t kChecksumSize = 2;
+
+    const uint32_t kIndexMagic = 0x58494C4D; // "MLIX"
+    const uint32_t kIndexVersion = 1;
+
+    uint64_t readBigEndian64(const uint8_t* ptr)
+    {
+        uint64_t result = 0;
+        for (int i = 0; i < 8; i++) {
+            result = (result << 8) | ptr[i];
+        }
+        return result;
+    }
+}
+
+void MavLinkLogRecord::toMessage(MavLinkMessage& msg) const
+{
+    msg.magic = magic;
+    msg.len = len;
+    msg.seq = seq;
+    msg.sysid = sysid;
+    msg.compid = compid;
+    msg.msgid = msgid;
+    msg.checksum = checksum;
+    ::memcpy(msg.payload64, payload, len);
+}
+
+// read only view of the whole log file.
+class MavLinkLogReader::MappedFile
+{
+public:
+    MappedFile(const std::string& filename)
+    {
+#ifdef _WIN32
+        file_ = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error(Utils::stringf("Could not open the file %s, error=%d", filename.c_str(), static_cast<int>(GetLastError())));
+        }
+        LARGE_INTEGER size;
+        GetFileSizeEx(file_, &size);
+        size_ = static_cast<uint64_t>(size.QuadPart);
+        if (size_ > 0) {
+            mapping_ = CreateFileMappingA(file_, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (mapping_ != NULL) {
+                data_ = static_cast<const uint8_t*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+            }
+            if (data_ == nullptr) {
+                int hr = static_cast<int>(GetLastError());
+                close();
+                throw std::runtime_error(Utils::stringf("Could not map the file %s, error=%d", filename.c_str(), hr));
+            }
+        }
+#else
+        fd_ = ::open(filename.c_str(), O_RDONLY);
+        if (fd_ < 0) {
+            throw std::runtime_error(Utils::stringf("Could not open the file %s, error=%d", filename.c_str(), errno));
+        }
+        struct stat info;
+        fstat(fd_, &info);
+        size_ = static_cast<uint64_t>(info.st_size);
+        if (size_ > 0) {
+            void* ptr = mmap(nullptr, static_cast<size_t>(size_), PROT_READ, MAP_PRIVATE, fd_, 0);
+            if (ptr == MAP_FAILED) {
+                int hr = errno;
+                close();
+                throw std::runtime_error(Utils::stringf("Could not map the file %s, error=%d", filename.c_str(), hr));
+            }
+            data_ = static_cast<const uint8_t*>(ptr);
+        }
+#endif
+    }
+
+    ~MappedFile()
+    {
+        close();
+    }
+
+    const uint8_t* data() { return data_; }
+    uint64_t size() { return size_; }
+
+private:
+    void close()
+    {
+#ifdef _WIN32
+        if (data_ != nullptr) {
+            UnmapViewOfFile(data_);
+        }
+        if (mapping_ != NULL) {
+            CloseHandle(mapping_);
+            mapping_ = NULL;
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            CloseHandle(file_);
+            file_ = INVALID_HANDLE_VALUE;
+        }
+#else
+        if (data_ != nullptr) {
+            munmap(const_cast<uint8_t*>(data_), static_cast<size_t>(size_));
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+#endif
+        data_ = nullptr;
+    }
+
+    const uint8_t* data_ = nullptr;
+    uint64_t size_ = 0;
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = NULL;
+#else
+    int fd_ = -1;
+#endif
+};
+
+MavLinkLogReader::MavLinkLogReader()
+{
+}
+
+MavLinkLogReader::~MavLinkLogReader()
+{
+    close();
+}
+
+std::string MavLinkLogReader::getIndexFileName(const std::string& logFile)
+{
+    return logFile + ".idx";
+}
+
+void MavLinkLogReader::open(const std::string& filename, bool useIndexFile)
+{
+    close();
+    file_.reset(new MappedFile(filename));
+    file_name_ = filename;
+
+    std::string indexFile = getIndexFileName(filename);
+    if (!useIndexFile || !loadIndex(indexFile)) {
+        buildIndex();
+        if (useIndexFile) {
+            try {
+                saveIndex(indexFile);
+            }
+            catch (std::exception&) {
+                // log may be on read only media, we just have to build the index again next time.
+            }
+        }
+    }
+    buildLookups();
+}
+
+void MavLinkLogReader::close()
+{
+    file_ = nullptr;
+    offsets_.clear();
+    times_.clear();
+    msgids_.clear();
+    time_order_.clear();
+    by_msgid_.clear();
+}
+
+bool MavLinkLogReader::isOpen()
+{
+    return file_ != nullptr;
+}
+
+size_t MavLinkLogReader::size()
+{
+    return offsets_.size();
+}
+
+uint64_t MavLinkLogReader::getStartTime()
+{
+    if (times_.size() == 0) {
+        return 0;
+    }
+    return time_order_.size() > 0 ? times_[time_order_.front()] : times_.front();
+}
+
+uint64_t MavLinkLogReader::getEndTime()
+{
+    if (times_.size() == 0) {
+        return 0;
+    }
+    return time_order_.size() > 0 ? times_[time_order_.back()] : times_.back();
+}
+
+void MavLinkLogReader::buildIndex()
+{
+    const uint8_t* data = file_->data();
+    uint64_t size = file_->size();
+
+    offsets_.clear();
+    times_.clear();
+    msgids_.clear();
+
+    uint64_t offset = 0;
+    while (offset + kHeaderSize + kChecksumSize <= size)
+    {
+        const uint8_t* ptr = data + offset;
+        uint64_t length = kHeaderSize + ptr[9] + kChecksumSize;
+        if (offset + length > size) {
+            // last message was not completely written.
+            break;
+        }
+        offsets_.push_back(offset);
+        times_.push_back(readBigEndian64(ptr));
+        msgids_.push_back(ptr[13]);
+        offset += length;
+    }
+}
+
+void MavLinkLogReader::buildLookups()
+{
+    uint32_t count = static_cast<uint32_t>(offsets_.size());
+
+    time_order_.clear();
+    if (!std::is_sorted(times_.begin(), times_.end())) {
+        time_order_.resize(count);
+        for (uint32_t i = 0; i < count; i++) {
+            time_order_[i] = i;
+        }
+        std::stable_sort(time_order_.begin(), time_order_.end(), [this](uint32_t a, uint32_t b) {
+            return times_[a] < times_[b];
+        });
+    }
+
+    size_t counts[256] = { 0 };
+    for (uint8_t msgid : msgids_) {
+        counts[msgid]++;
+    }
+    by_msgid_.assign(256, std::vector<uint32_t>());
+    for (int id = 0; id < 256; id++) {
+        by_msgid_[id].reserve(counts[id]);
+    }
+    for (uint32_t i = 0; i < count; i++) {
+        by_msgid_[msgids_[i]].push_back(i);
+    }
+}
+
+bool MavLinkLogReader::loadIndex(const std::string& indexFile)
+{
+    FILE* ptr = fopen(indexFile.c_str(), "rb");
+    if (ptr == nullptr) {
+        return false;
+    }
+
+    uint32_t magic = 0, version = 0;
+    uint64_t logSize = 0, count = 0;
+    bool ok = fread(&magic, sizeof(magic), 1, ptr) == 1 && magic == kIndexMagic &&
+        fread(&version, sizeof(version), 1, ptr) == 1 && version == kIndexVersion &&
+        fread(&logSize, sizeof(logSize), 1, ptr) == 1 && logSize == file_->size() &&
+        fread(&count, sizeof(count), 1, ptr) == 1 && count <= logSize / (kHeaderSize + kChecksumSize);
+    if (ok) {
+        size_t n = static_cast<size_t>(count);
+        offsets_.resize(n);
+        times_.resize(n);
+        msgids_.resize(n);
+        ok = fread(offsets_.data(), sizeof(uint64_t), n, ptr) == n &&
+            fread(times_.data(), sizeof(uint64_t), n, ptr) == n &&
+            fread(msgids_.data(), sizeof(uint8_t), n, ptr) == n;
+    }
+    fclose(ptr);
+
+    if (ok && offsets_.size() > 0) {
+        // checking every offset would touch the whole log which is what the index is there to avoid, so just
+        // make sure the first and last message line up with the log.
+        const uint8_t* data = file_->data();
+        uint64_t last = offsets_.back();
+        ok = offsets_.front() == 0 && times_.front() == readBigEndian64(data) &&
+            last + kHeaderSize + kChecksumSize <= logSize &&
+            last + kHeaderSize + data[last + 9] + kChecksumSize <= logSize &&
+            times_.back() == readBigEndian64(data + last) && msgids_.back() == data[last + 13];
+    }
+    if (!ok) {
+        offsets_.clear();
+        times_.clear();
+        msgids_.clear();
+    }
+    return ok;
+}
+
+void MavLinkLogReader::saveIndex(const std::string& indexFile)
+{
+    if (file_ == nullptr) {
+        throw std::runtime_error("MavLinkLogReader is not open");
+    }
+    FILE* ptr = fopen(indexFile.c_str(), "wb");
+    if (ptr == nullptr) {
+        throw std::runtime_error(Utils::stringf("Could not open the file %s, error=%d", indexFile.c_str(), errno));
+    }
+    uint64_t logSize = file_->size();
+    uint64_t count = offsets_.size();
+    bool ok = fwrite(&kIndexMagic, sizeof(kIndexMagic), 1, ptr) == 1 &&
+        fwrite(&kIndexVersion, sizeof(kIndexVersion), 1, ptr) == 1 &&
+        fwrite(&logSize, sizeof(logSize), 1, ptr) == 1 &&
+        fwrite(&count, sizeof(count), 1, ptr) == 1 &&
+        fwrite(offsets_.data(), sizeof(uint64_t), offsets_.size(), ptr) == offsets_.size() &&
+        fwrite(times_.data(), sizeof(uint64_t), times_.size(), ptr) == times_.size() &&
+        fwrite(msgids_.data(), sizeof(uint8_t), msgids_.size(), ptr) == msgids_.size();
+    fclose(ptr);
+    if (!ok) {
+        remove(indexFile.c_str());
+        throw std::runtime_error(Utils::stringf("Could not write the file %s", indexFile.c_str()));
+    }
+}
+
+void MavLinkLogReader::readRecord(uint32_t index, MavLinkLogRecord& record)
+{
+    const uint8_t* ptr = file_->data() + offsets_[index];
+    record.timestamp = times_[index];
+    record.magic = ptr[8];
+    record.len = ptr[9];
+    record.seq = ptr[10];
+    record.sysid = ptr[11];
+    record.compid = ptr[12];
+    record.msgid = ptr[13];
+    record.payload = ptr + kHeaderSize;
+    ::memcpy(&record.checksum, ptr + kHeaderSize + record.len, sizeof(uint16_t));
+}
+
+bool MavLinkLogReader::getRecord(size_t i, MavLinkLogRecord& record)
+{
+    if (i >= offsets_.size()) {
+        return false;
+    }
+    readRecord(static_cast<uint32_t>(i), record);
+    return true;
+}
+
+bool MavLinkLogReader::visit(uint32_t index, const RecordCallback& callback)
+{
+    MavLinkLogRecord record;
+    readRecord(index, record);
+    return callback(record);
+}
+
+void MavLinkLogReader::forEach(uint64_t startTime, uint64_t endTime, const RecordCallback& callback, int msgid)
+{
+    if (file_ == nullptr || msgid > 255) {
+        return;
+    }
+    auto before = [this](uint32_t index, uint64_t time) {
+        return times_[index] < time;
+    };
+
+    if (time_order_.size() > 0) {
+        // log is not in timestamp order, walk the sorted copy.
+        auto it = std::lower_bound(time_order_.begin(), time_order_.end(), startTime, before);
+        for (; it != time_order_.end() && times_[*it] < endTime; it++) {
+            if (msgid >= 0 && msgids_[*it] != msgid) {
+                continue;
+            }
+            if (!visit(*it, callback)) {
+                return;
+            }
+        }
+    }
+    else if (msgid >= 0) {
+        const std::vector<uint32_t>& list = by_msgid_[msgid];
+        auto it = std::lower_bound(list.begin(), list.end(), startTime, before);
+        for (; it != list.end() && times_[*it] < endTime; it++) {
+            if (!visit(*it, callback)) {
+                return;
+            }
+        }
+    }
+    else {
+        uint32_t count = static_cast<uint32_t>(times_.size());
+        uint32_t i = static_cast<uint32_t>(std::lower_bound(times_.begin(), times_.end(), startTime) - times_.begin());
+        for (; i < count && times_[i] < endTime; i++) {
+            if (!visit(i, callback)) {
+                return;
+            }
+        }
+    }
+}
+
+void MavLinkLogReader::forEachMessage(int msgid, const RecordCallback& callback)
+{
+    if (file_ == nullptr || msgid < 0 || msgid > 255) {
+        return;
+    }
+    for (uint32_t index : by_msgid_[msgid]) {
+        if (!visit(index, callback)) {
+            return;
+        }
+    }
+}
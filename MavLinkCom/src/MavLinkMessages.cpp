@@ -1,27 +1,18 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 #include "MavLinkMessages.hpp"
+#include "MavLinkCodec.hpp"
 #include <sstream>
 using namespace mavlinkcom;
 
+constexpr MavLinkField MavLinkHeartbeat::kFields[];
+
 int MavLinkHeartbeat::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->custom_mode), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->type), 4);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->autopilot), 5);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->base_mode), 6);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->system_status), 7);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->mavlink_version), 8);
-    return 9;
+    return MavLinkCodec<MavLinkHeartbeat>::pack(*this, buffer);
 }
 
 int MavLinkHeartbeat::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->custom_mode), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->type), 4);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->autopilot), 5);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->base_mode), 6);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->system_status), 7);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->mavlink_version), 8);
- return 9;
+    return MavLinkCodec<MavLinkHeartbeat>::unpack(buffer, *this);
 }
 
 std::string MavLinkHeartbeat::toJSon() {
@@ -37,38 +28,14 @@ std::string MavLinkHeartbeat::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkSysStatus::kFields[];
+
 int MavLinkSysStatus::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->onboard_control_sensors_present), 0);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->onboard_control_sensors_enabled), 4);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->onboard_control_sensors_health), 8);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->load), 12);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->voltage_battery), 14);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->current_battery), 16);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->drop_rate_comm), 18);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->errors_comm), 20);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->errors_count1), 22);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->errors_count2), 24);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->errors_count3), 26);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->errors_count4), 28);
-    pack_int8_t(buffer, reinterpret_cast<const int8_t*>(&this->battery_remaining), 30);
-    return 31;
+    return MavLinkCodec<MavLinkSysStatus>::pack(*this, buffer);
 }
 
 int MavLinkSysStatus::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->onboard_control_sensors_present), 0);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->onboard_control_sensors_enabled), 4);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->onboard_control_sensors_health), 8);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->load), 12);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->voltage_battery), 14);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->current_battery), 16);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->drop_rate_comm), 18);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->errors_comm), 20);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->errors_count1), 22);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->errors_count2), 24);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->errors_count3), 26);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->errors_count4), 28);
-    unpack_int8_t(buffer, reinterpret_cast<int8_t*>(&this->battery_remaining), 30);
- return 31;
+    return MavLinkCodec<MavLinkSysStatus>::unpack(buffer, *this);
 }
 
 std::string MavLinkSysStatus::toJSon() {
@@ -91,16 +58,14 @@ std::string MavLinkSysStatus::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkSystemTime::kFields[];
+
 int MavLinkSystemTime::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_unix_usec), 0);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 8);
-    return 12;
+    return MavLinkCodec<MavLinkSystemTime>::pack(*this, buffer);
 }
 
 int MavLinkSystemTime::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_unix_usec), 0);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 8);
- return 12;
+    return MavLinkCodec<MavLinkSystemTime>::unpack(buffer, *this);
 }
 
 std::string MavLinkSystemTime::toJSon() {
@@ -112,20 +77,14 @@ std::string MavLinkSystemTime::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkPing::kFields[];
+
 int MavLinkPing::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->seq), 8);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 12);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 13);
-    return 14;
+    return MavLinkCodec<MavLinkPing>::pack(*this, buffer);
 }
 
 int MavLinkPing::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->seq), 8);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 12);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 13);
- return 14;
+    return MavLinkCodec<MavLinkPing>::unpack(buffer, *this);
 }
 
 std::string MavLinkPing::toJSon() {
@@ -139,20 +98,14 @@ std::string MavLinkPing::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkChangeOperatorControl::kFields[];
+
 int MavLinkChangeOperatorControl::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->control_request), 1);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->version), 2);
-    pack_char_array(25, buffer, reinterpret_cast<const char*>(&this->passkey[0]), 3);
-    return 28;
+    return MavLinkCodec<MavLinkChangeOperatorControl>::pack(*this, buffer);
 }
 
 int MavLinkChangeOperatorControl::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->control_request), 1);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->version), 2);
-    unpack_char_array(25, buffer, reinterpret_cast<char*>(&this->passkey[0]), 3);
- return 28;
+    return MavLinkCodec<MavLinkChangeOperatorControl>::unpack(buffer, *this);
 }
 
 std::string MavLinkChangeOperatorControl::toJSon() {
@@ -166,18 +119,14 @@ std::string MavLinkChangeOperatorControl::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkChangeOperatorControlAck::kFields[];
+
 int MavLinkChangeOperatorControlAck::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->gcs_system_id), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->control_request), 1);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->ack), 2);
-    return 3;
+    return MavLinkCodec<MavLinkChangeOperatorControlAck>::pack(*this, buffer);
 }
 
 int MavLinkChangeOperatorControlAck::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->gcs_system_id), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->control_request), 1);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->ack), 2);
- return 3;
+    return MavLinkCodec<MavLinkChangeOperatorControlAck>::unpack(buffer, *this);
 }
 
 std::string MavLinkChangeOperatorControlAck::toJSon() {
@@ -190,14 +139,14 @@ std::string MavLinkChangeOperatorControlAck::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkAuthKey::kFields[];
+
 int MavLinkAuthKey::pack(char* buffer) const {
-    pack_char_array(32, buffer, reinterpret_cast<const char*>(&this->key[0]), 0);
-    return 32;
+    return MavLinkCodec<MavLinkAuthKey>::pack(*this, buffer);
 }
 
 int MavLinkAuthKey::unpack(const char* buffer) {
-    unpack_char_array(32, buffer, reinterpret_cast<char*>(&this->key[0]), 0);
- return 32;
+    return MavLinkCodec<MavLinkAuthKey>::unpack(buffer, *this);
 }
 
 std::string MavLinkAuthKey::toJSon() {
@@ -208,18 +157,14 @@ std::string MavLinkAuthKey::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkSetMode::kFields[];
+
 int MavLinkSetMode::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->custom_mode), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 4);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->base_mode), 5);
-    return 6;
+    return MavLinkCodec<MavLinkSetMode>::pack(*this, buffer);
 }
 
 int MavLinkSetMode::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->custom_mode), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 4);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->base_mode), 5);
- return 6;
+    return MavLinkCodec<MavLinkSetMode>::unpack(buffer, *this);
 }
 
 std::string MavLinkSetMode::toJSon() {
@@ -232,20 +177,14 @@ std::string MavLinkSetMode::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkParamRequestRead::kFields[];
+
 int MavLinkParamRequestRead::pack(char* buffer) const {
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->param_index), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 3);
-    pack_char_array(16, buffer, reinterpret_cast<const char*>(&this->param_id[0]), 4);
-    return 20;
+    return MavLinkCodec<MavLinkParamRequestRead>::pack(*this, buffer);
 }
 
 int MavLinkParamRequestRead::unpack(const char* buffer) {
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->param_index), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 3);
-    unpack_char_array(16, buffer, reinterpret_cast<char*>(&this->param_id[0]), 4);
- return 20;
+    return MavLinkCodec<MavLinkParamRequestRead>::unpack(buffer, *this);
 }
 
 std::string MavLinkParamRequestRead::toJSon() {
@@ -259,16 +198,14 @@ std::string MavLinkParamRequestRead::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkParamRequestList::kFields[];
+
 int MavLinkParamRequestList::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 1);
-    return 2;
+    return MavLinkCodec<MavLinkParamRequestList>::pack(*this, buffer);
 }
 
 int MavLinkParamRequestList::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 1);
- return 2;
+    return MavLinkCodec<MavLinkParamRequestList>::unpack(buffer, *this);
 }
 
 std::string MavLinkParamRequestList::toJSon() {
@@ -280,22 +217,14 @@ std::string MavLinkParamRequestList::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkParamValue::kFields[];
+
 int MavLinkParamValue::pack(char* buffer) const {
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param_value), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->param_count), 4);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->param_index), 6);
-    pack_char_array(16, buffer, reinterpret_cast<const char*>(&this->param_id[0]), 8);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->param_type), 24);
-    return 25;
+    return MavLinkCodec<MavLinkParamValue>::pack(*this, buffer);
 }
 
 int MavLinkParamValue::unpack(const char* buffer) {
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param_value), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->param_count), 4);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->param_index), 6);
-    unpack_char_array(16, buffer, reinterpret_cast<char*>(&this->param_id[0]), 8);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->param_type), 24);
- return 25;
+    return MavLinkCodec<MavLinkParamValue>::unpack(buffer, *this);
 }
 
 std::string MavLinkParamValue::toJSon() {
@@ -310,22 +239,14 @@ std::string MavLinkParamValue::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkParamSet::kFields[];
+
 int MavLinkParamSet::pack(char* buffer) const {
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param_value), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 4);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 5);
-    pack_char_array(16, buffer, reinterpret_cast<const char*>(&this->param_id[0]), 6);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->param_type), 22);
-    return 23;
+    return MavLinkCodec<MavLinkParamSet>::pack(*this, buffer);
 }
 
 int MavLinkParamSet::unpack(const char* buffer) {
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param_value), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 4);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 5);
-    unpack_char_array(16, buffer, reinterpret_cast<char*>(&this->param_id[0]), 6);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->param_type), 22);
- return 23;
+    return MavLinkCodec<MavLinkParamSet>::unpack(buffer, *this);
 }
 
 std::string MavLinkParamSet::toJSon() {
@@ -340,32 +261,14 @@ std::string MavLinkParamSet::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkGpsRawInt::kFields[];
+
 int MavLinkGpsRawInt::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 8);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 12);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->alt), 16);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->eph), 20);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->epv), 22);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->vel), 24);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->cog), 26);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->fix_type), 28);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->satellites_visible), 29);
-    return 30;
+    return MavLinkCodec<MavLinkGpsRawInt>::pack(*this, buffer);
 }
 
 int MavLinkGpsRawInt::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 8);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 12);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->alt), 16);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->eph), 20);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->epv), 22);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->vel), 24);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->cog), 26);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->fix_type), 28);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->satellites_visible), 29);
- return 30;
+    return MavLinkCodec<MavLinkGpsRawInt>::unpack(buffer, *this);
 }
 
 std::string MavLinkGpsRawInt::toJSon() {
@@ -385,24 +288,14 @@ std::string MavLinkGpsRawInt::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkGpsStatus::kFields[];
+
 int MavLinkGpsStatus::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->satellites_visible), 0);
-    pack_uint8_t_array(20, buffer, reinterpret_cast<const uint8_t*>(&this->satellite_prn[0]), 1);
-    pack_uint8_t_array(20, buffer, reinterpret_cast<const uint8_t*>(&this->satellite_used[0]), 21);
-    pack_uint8_t_array(20, buffer, reinterpret_cast<const uint8_t*>(&this->satellite_elevation[0]), 41);
-    pack_uint8_t_array(20, buffer, reinterpret_cast<const uint8_t*>(&this->satellite_azimuth[0]), 61);
-    pack_uint8_t_array(20, buffer, reinterpret_cast<const uint8_t*>(&this->satellite_snr[0]), 81);
-    return 101;
+    return MavLinkCodec<MavLinkGpsStatus>::pack(*this, buffer);
 }
 
 int MavLinkGpsStatus::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->satellites_visible), 0);
-    unpack_uint8_t_array(20, buffer, reinterpret_cast<uint8_t*>(&this->satellite_prn[0]), 1);
-    unpack_uint8_t_array(20, buffer, reinterpret_cast<uint8_t*>(&this->satellite_used[0]), 21);
-    unpack_uint8_t_array(20, buffer, reinterpret_cast<uint8_t*>(&this->satellite_elevation[0]), 41);
-    unpack_uint8_t_array(20, buffer, reinterpret_cast<uint8_t*>(&this->satellite_azimuth[0]), 61);
-    unpack_uint8_t_array(20, buffer, reinterpret_cast<uint8_t*>(&this->satellite_snr[0]), 81);
- return 101;
+    return MavLinkCodec<MavLinkGpsStatus>::unpack(buffer, *this);
 }
 
 std::string MavLinkGpsStatus::toJSon() {
@@ -418,32 +311,14 @@ std::string MavLinkGpsStatus::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkScaledImu::kFields[];
+
 int MavLinkScaledImu::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xacc), 4);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->yacc), 6);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zacc), 8);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xgyro), 10);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->ygyro), 12);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zgyro), 14);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xmag), 16);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->ymag), 18);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zmag), 20);
-    return 22;
+    return MavLinkCodec<MavLinkScaledImu>::pack(*this, buffer);
 }
 
 int MavLinkScaledImu::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xacc), 4);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->yacc), 6);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zacc), 8);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xgyro), 10);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->ygyro), 12);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zgyro), 14);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xmag), 16);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->ymag), 18);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zmag), 20);
- return 22;
+    return MavLinkCodec<MavLinkScaledImu>::unpack(buffer, *this);
 }
 
 std::string MavLinkScaledImu::toJSon() {
@@ -463,32 +338,14 @@ std::string MavLinkScaledImu::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkRawImu::kFields[];
+
 int MavLinkRawImu::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xacc), 8);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->yacc), 10);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zacc), 12);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xgyro), 14);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->ygyro), 16);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zgyro), 18);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xmag), 20);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->ymag), 22);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zmag), 24);
-    return 26;
+    return MavLinkCodec<MavLinkRawImu>::pack(*this, buffer);
 }
 
 int MavLinkRawImu::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xacc), 8);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->yacc), 10);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zacc), 12);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xgyro), 14);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->ygyro), 16);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zgyro), 18);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xmag), 20);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->ymag), 22);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zmag), 24);
- return 26;
+    return MavLinkCodec<MavLinkRawImu>::unpack(buffer, *this);
 }
 
 std::string MavLinkRawImu::toJSon() {
@@ -508,22 +365,14 @@ std::string MavLinkRawImu::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkRawPressure::kFields[];
+
 int MavLinkRawPressure::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->press_abs), 8);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->press_diff1), 10);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->press_diff2), 12);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->temperature), 14);
-    return 16;
+    return MavLinkCodec<MavLinkRawPressure>::pack(*this, buffer);
 }
 
 int MavLinkRawPressure::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->press_abs), 8);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->press_diff1), 10);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->press_diff2), 12);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->temperature), 14);
- return 16;
+    return MavLinkCodec<MavLinkRawPressure>::unpack(buffer, *this);
 }
 
 std::string MavLinkRawPressure::toJSon() {
@@ -538,20 +387,14 @@ std::string MavLinkRawPressure::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkScaledPressure::kFields[];
+
 int MavLinkScaledPressure::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->press_abs), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->press_diff), 8);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->temperature), 12);
-    return 14;
+    return MavLinkCodec<MavLinkScaledPressure>::pack(*this, buffer);
 }
 
 int MavLinkScaledPressure::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->press_abs), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->press_diff), 8);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->temperature), 12);
- return 14;
+    return MavLinkCodec<MavLinkScaledPressure>::unpack(buffer, *this);
 }
 
 std::string MavLinkScaledPressure::toJSon() {
@@ -565,26 +408,14 @@ std::string MavLinkScaledPressure::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkAttitude::kFields[];
+
 int MavLinkAttitude::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->roll), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitch), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->rollspeed), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitchspeed), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yawspeed), 24);
-    return 28;
+    return MavLinkCodec<MavLinkAttitude>::pack(*this, buffer);
 }
 
 int MavLinkAttitude::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->roll), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitch), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->rollspeed), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitchspeed), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yawspeed), 24);
- return 28;
+    return MavLinkCodec<MavLinkAttitude>::unpack(buffer, *this);
 }
 
 std::string MavLinkAttitude::toJSon() {
@@ -601,28 +432,14 @@ std::string MavLinkAttitude::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkAttitudeQuaternion::kFields[];
+
 int MavLinkAttitudeQuaternion::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->q1), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->q2), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->q3), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->q4), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->rollspeed), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitchspeed), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yawspeed), 28);
-    return 32;
+    return MavLinkCodec<MavLinkAttitudeQuaternion>::pack(*this, buffer);
 }
 
 int MavLinkAttitudeQuaternion::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->q1), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->q2), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->q3), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->q4), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->rollspeed), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitchspeed), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yawspeed), 28);
- return 32;
+    return MavLinkCodec<MavLinkAttitudeQuaternion>::unpack(buffer, *this);
 }
 
 std::string MavLinkAttitudeQuaternion::toJSon() {
@@ -640,26 +457,14 @@ std::string MavLinkAttitudeQuaternion::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkLocalPositionNed::kFields[];
+
 int MavLinkLocalPositionNed::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vx), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vy), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vz), 24);
-    return 28;
+    return MavLinkCodec<MavLinkLocalPositionNed>::pack(*this, buffer);
 }
 
 int MavLinkLocalPositionNed::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vx), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vy), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vz), 24);
- return 28;
+    return MavLinkCodec<MavLinkLocalPositionNed>::unpack(buffer, *this);
 }
 
 std::string MavLinkLocalPositionNed::toJSon() {
@@ -676,30 +481,14 @@ std::string MavLinkLocalPositionNed::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkGlobalPositionInt::kFields[];
+
 int MavLinkGlobalPositionInt::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 4);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 8);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->alt), 12);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->relative_alt), 16);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->vx), 20);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->vy), 22);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->vz), 24);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->hdg), 26);
-    return 28;
+    return MavLinkCodec<MavLinkGlobalPositionInt>::pack(*this, buffer);
 }
 
 int MavLinkGlobalPositionInt::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 4);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 8);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->alt), 12);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->relative_alt), 16);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->vx), 20);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->vy), 22);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->vz), 24);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->hdg), 26);
- return 28;
+    return MavLinkCodec<MavLinkGlobalPositionInt>::unpack(buffer, *this);
 }
 
 std::string MavLinkGlobalPositionInt::toJSon() {
@@ -718,34 +507,14 @@ std::string MavLinkGlobalPositionInt::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkRcChannelsScaled::kFields[];
+
 int MavLinkRcChannelsScaled::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->chan1_scaled), 4);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->chan2_scaled), 6);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->chan3_scaled), 8);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->chan4_scaled), 10);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->chan5_scaled), 12);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->chan6_scaled), 14);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->chan7_scaled), 16);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->chan8_scaled), 18);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->port), 20);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->rssi), 21);
-    return 22;
+    return MavLinkCodec<MavLinkRcChannelsScaled>::pack(*this, buffer);
 }
 
 int MavLinkRcChannelsScaled::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->chan1_scaled), 4);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->chan2_scaled), 6);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->chan3_scaled), 8);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->chan4_scaled), 10);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->chan5_scaled), 12);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->chan6_scaled), 14);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->chan7_scaled), 16);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->chan8_scaled), 18);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->port), 20);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->rssi), 21);
- return 22;
+    return MavLinkCodec<MavLinkRcChannelsScaled>::unpack(buffer, *this);
 }
 
 std::string MavLinkRcChannelsScaled::toJSon() {
@@ -766,34 +535,14 @@ std::string MavLinkRcChannelsScaled::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkRcChannelsRaw::kFields[];
+
 int MavLinkRcChannelsRaw::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan1_raw), 4);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan2_raw), 6);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan3_raw), 8);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan4_raw), 10);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan5_raw), 12);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan6_raw), 14);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan7_raw), 16);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan8_raw), 18);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->port), 20);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->rssi), 21);
-    return 22;
+    return MavLinkCodec<MavLinkRcChannelsRaw>::pack(*this, buffer);
 }
 
 int MavLinkRcChannelsRaw::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan1_raw), 4);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan2_raw), 6);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan3_raw), 8);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan4_raw), 10);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan5_raw), 12);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan6_raw), 14);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan7_raw), 16);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan8_raw), 18);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->port), 20);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->rssi), 21);
- return 22;
+    return MavLinkCodec<MavLinkRcChannelsRaw>::unpack(buffer, *this);
 }
 
 std::string MavLinkRcChannelsRaw::toJSon() {
@@ -814,48 +563,14 @@ std::string MavLinkRcChannelsRaw::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkServoOutputRaw::kFields[];
+
 int MavLinkServoOutputRaw::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_usec), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo1_raw), 4);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo2_raw), 6);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo3_raw), 8);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo4_raw), 10);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo5_raw), 12);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo6_raw), 14);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo7_raw), 16);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo8_raw), 18);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo9_raw), 20);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo10_raw), 22);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo11_raw), 24);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo12_raw), 26);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo13_raw), 28);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo14_raw), 30);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo15_raw), 32);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->servo16_raw), 34);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->port), 36);
-    return 37;
+    return MavLinkCodec<MavLinkServoOutputRaw>::pack(*this, buffer);
 }
 
 int MavLinkServoOutputRaw::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_usec), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo1_raw), 4);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo2_raw), 6);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo3_raw), 8);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo4_raw), 10);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo5_raw), 12);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo6_raw), 14);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo7_raw), 16);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo8_raw), 18);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo9_raw), 20);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo10_raw), 22);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo11_raw), 24);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo12_raw), 26);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo13_raw), 28);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo14_raw), 30);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo15_raw), 32);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->servo16_raw), 34);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->port), 36);
- return 37;
+    return MavLinkCodec<MavLinkServoOutputRaw>::unpack(buffer, *this);
 }
 
 std::string MavLinkServoOutputRaw::toJSon() {
@@ -883,20 +598,14 @@ std::string MavLinkServoOutputRaw::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMissionRequestPartialList::kFields[];
+
 int MavLinkMissionRequestPartialList::pack(char* buffer) const {
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->start_index), 0);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->end_index), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 4);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 5);
-    return 6;
+    return MavLinkCodec<MavLinkMissionRequestPartialList>::pack(*this, buffer);
 }
 
 int MavLinkMissionRequestPartialList::unpack(const char* buffer) {
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->start_index), 0);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->end_index), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 4);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 5);
- return 6;
+    return MavLinkCodec<MavLinkMissionRequestPartialList>::unpack(buffer, *this);
 }
 
 std::string MavLinkMissionRequestPartialList::toJSon() {
@@ -910,20 +619,14 @@ std::string MavLinkMissionRequestPartialList::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMissionWritePartialList::kFields[];
+
 int MavLinkMissionWritePartialList::pack(char* buffer) const {
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->start_index), 0);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->end_index), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 4);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 5);
-    return 6;
+    return MavLinkCodec<MavLinkMissionWritePartialList>::pack(*this, buffer);
 }
 
 int MavLinkMissionWritePartialList::unpack(const char* buffer) {
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->start_index), 0);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->end_index), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 4);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 5);
- return 6;
+    return MavLinkCodec<MavLinkMissionWritePartialList>::unpack(buffer, *this);
 }
 
 std::string MavLinkMissionWritePartialList::toJSon() {
@@ -937,40 +640,14 @@ std::string MavLinkMissionWritePartialList::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMissionItem::kFields[];
+
 int MavLinkMissionItem::pack(char* buffer) const {
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param1), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param2), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param3), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param4), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 24);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->seq), 28);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->command), 30);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 32);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 33);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->frame), 34);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->current), 35);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->autocontinue), 36);
-    return 37;
+    return MavLinkCodec<MavLinkMissionItem>::pack(*this, buffer);
 }
 
 int MavLinkMissionItem::unpack(const char* buffer) {
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param1), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param2), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param3), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param4), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 24);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->seq), 28);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->command), 30);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 32);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 33);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->frame), 34);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->current), 35);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->autocontinue), 36);
- return 37;
+    return MavLinkCodec<MavLinkMissionItem>::unpack(buffer, *this);
 }
 
 std::string MavLinkMissionItem::toJSon() {
@@ -994,18 +671,14 @@ std::string MavLinkMissionItem::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMissionRequest::kFields[];
+
 int MavLinkMissionRequest::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->seq), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 3);
-    return 4;
+    return MavLinkCodec<MavLinkMissionRequest>::pack(*this, buffer);
 }
 
 int MavLinkMissionRequest::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->seq), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 3);
- return 4;
+    return MavLinkCodec<MavLinkMissionRequest>::unpack(buffer, *this);
 }
 
 std::string MavLinkMissionRequest::toJSon() {
@@ -1018,18 +691,14 @@ std::string MavLinkMissionRequest::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMissionSetCurrent::kFields[];
+
 int MavLinkMissionSetCurrent::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->seq), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 3);
-    return 4;
+    return MavLinkCodec<MavLinkMissionSetCurrent>::pack(*this, buffer);
 }
 
 int MavLinkMissionSetCurrent::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->seq), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 3);
- return 4;
+    return MavLinkCodec<MavLinkMissionSetCurrent>::unpack(buffer, *this);
 }
 
 std::string MavLinkMissionSetCurrent::toJSon() {
@@ -1042,14 +711,14 @@ std::string MavLinkMissionSetCurrent::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMissionCurrent::kFields[];
+
 int MavLinkMissionCurrent::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->seq), 0);
-    return 2;
+    return MavLinkCodec<MavLinkMissionCurrent>::pack(*this, buffer);
 }
 
 int MavLinkMissionCurrent::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->seq), 0);
- return 2;
+    return MavLinkCodec<MavLinkMissionCurrent>::unpack(buffer, *this);
 }
 
 std::string MavLinkMissionCurrent::toJSon() {
@@ -1060,16 +729,14 @@ std::string MavLinkMissionCurrent::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMissionRequestList::kFields[];
+
 int MavLinkMissionRequestList::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 1);
-    return 2;
+    return MavLinkCodec<MavLinkMissionRequestList>::pack(*this, buffer);
 }
 
 int MavLinkMissionRequestList::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 1);
- return 2;
+    return MavLinkCodec<MavLinkMissionRequestList>::unpack(buffer, *this);
 }
 
 std::string MavLinkMissionRequestList::toJSon() {
@@ -1081,18 +748,14 @@ std::string MavLinkMissionRequestList::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMissionCount::kFields[];
+
 int MavLinkMissionCount::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->count), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 3);
-    return 4;
+    return MavLinkCodec<MavLinkMissionCount>::pack(*this, buffer);
 }
 
 int MavLinkMissionCount::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->count), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 3);
- return 4;
+    return MavLinkCodec<MavLinkMissionCount>::unpack(buffer, *this);
 }
 
 std::string MavLinkMissionCount::toJSon() {
@@ -1105,16 +768,14 @@ std::string MavLinkMissionCount::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMissionClearAll::kFields[];
+
 int MavLinkMissionClearAll::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 1);
-    return 2;
+    return MavLinkCodec<MavLinkMissionClearAll>::pack(*this, buffer);
 }
 
 int MavLinkMissionClearAll::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 1);
- return 2;
+    return MavLinkCodec<MavLinkMissionClearAll>::unpack(buffer, *this);
 }
 
 std::string MavLinkMissionClearAll::toJSon() {
@@ -1126,14 +787,14 @@ std::string MavLinkMissionClearAll::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMissionItemReached::kFields[];
+
 int MavLinkMissionItemReached::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->seq), 0);
-    return 2;
+    return MavLinkCodec<MavLinkMissionItemReached>::pack(*this, buffer);
 }
 
 int MavLinkMissionItemReached::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->seq), 0);
- return 2;
+    return MavLinkCodec<MavLinkMissionItemReached>::unpack(buffer, *this);
 }
 
 std::string MavLinkMissionItemReached::toJSon() {
@@ -1144,18 +805,14 @@ std::string MavLinkMissionItemReached::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMissionAck::kFields[];
+
 int MavLinkMissionAck::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 1);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->type), 2);
-    return 3;
+    return MavLinkCodec<MavLinkMissionAck>::pack(*this, buffer);
 }
 
 int MavLinkMissionAck::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 1);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->type), 2);
- return 3;
+    return MavLinkCodec<MavLinkMissionAck>::unpack(buffer, *this);
 }
 
 std::string MavLinkMissionAck::toJSon() {
@@ -1168,20 +825,14 @@ std::string MavLinkMissionAck::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkSetGpsGlobalOrigin::kFields[];
+
 int MavLinkSetGpsGlobalOrigin::pack(char* buffer) const {
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->latitude), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->longitude), 4);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->altitude), 8);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 12);
-    return 13;
+    return MavLinkCodec<MavLinkSetGpsGlobalOrigin>::pack(*this, buffer);
 }
 
 int MavLinkSetGpsGlobalOrigin::unpack(const char* buffer) {
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->latitude), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->longitude), 4);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->altitude), 8);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 12);
- return 13;
+    return MavLinkCodec<MavLinkSetGpsGlobalOrigin>::unpack(buffer, *this);
 }
 
 std::string MavLinkSetGpsGlobalOrigin::toJSon() {
@@ -1195,18 +846,14 @@ std::string MavLinkSetGpsGlobalOrigin::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkGpsGlobalOrigin::kFields[];
+
 int MavLinkGpsGlobalOrigin::pack(char* buffer) const {
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->latitude), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->longitude), 4);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->altitude), 8);
-    return 12;
+    return MavLinkCodec<MavLinkGpsGlobalOrigin>::pack(*this, buffer);
 }
 
 int MavLinkGpsGlobalOrigin::unpack(const char* buffer) {
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->latitude), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->longitude), 4);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->altitude), 8);
- return 12;
+    return MavLinkCodec<MavLinkGpsGlobalOrigin>::unpack(buffer, *this);
 }
 
 std::string MavLinkGpsGlobalOrigin::toJSon() {
@@ -1219,30 +866,14 @@ std::string MavLinkGpsGlobalOrigin::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkParamMapRc::kFields[];
+
 int MavLinkParamMapRc::pack(char* buffer) const {
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param_value0), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->scale), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param_value_min), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param_value_max), 12);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->param_index), 16);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 18);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 19);
-    pack_char_array(16, buffer, reinterpret_cast<const char*>(&this->param_id[0]), 20);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->parameter_rc_channel_index), 36);
-    return 37;
+    return MavLinkCodec<MavLinkParamMapRc>::pack(*this, buffer);
 }
 
 int MavLinkParamMapRc::unpack(const char* buffer) {
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param_value0), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->scale), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param_value_min), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param_value_max), 12);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->param_index), 16);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 18);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 19);
-    unpack_char_array(16, buffer, reinterpret_cast<char*>(&this->param_id[0]), 20);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->parameter_rc_channel_index), 36);
- return 37;
+    return MavLinkCodec<MavLinkParamMapRc>::unpack(buffer, *this);
 }
 
 std::string MavLinkParamMapRc::toJSon() {
@@ -1261,18 +892,14 @@ std::string MavLinkParamMapRc::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMissionRequestInt::kFields[];
+
 int MavLinkMissionRequestInt::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->seq), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 3);
-    return 4;
+    return MavLinkCodec<MavLinkMissionRequestInt>::pack(*this, buffer);
 }
 
 int MavLinkMissionRequestInt::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->seq), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 3);
- return 4;
+    return MavLinkCodec<MavLinkMissionRequestInt>::unpack(buffer, *this);
 }
 
 std::string MavLinkMissionRequestInt::toJSon() {
@@ -1285,30 +912,14 @@ std::string MavLinkMissionRequestInt::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkSafetySetAllowedArea::kFields[];
+
 int MavLinkSafetySetAllowedArea::pack(char* buffer) const {
-    pack_float(buffer, reinterpret_cast<const float*>(&this->p1x), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->p1y), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->p1z), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->p2x), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->p2y), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->p2z), 20);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 24);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 25);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->frame), 26);
-    return 27;
+    return MavLinkCodec<MavLinkSafetySetAllowedArea>::pack(*this, buffer);
 }
 
 int MavLinkSafetySetAllowedArea::unpack(const char* buffer) {
-    unpack_float(buffer, reinterpret_cast<float*>(&this->p1x), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->p1y), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->p1z), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->p2x), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->p2y), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->p2z), 20);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 24);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 25);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->frame), 26);
- return 27;
+    return MavLinkCodec<MavLinkSafetySetAllowedArea>::unpack(buffer, *this);
 }
 
 std::string MavLinkSafetySetAllowedArea::toJSon() {
@@ -1327,26 +938,14 @@ std::string MavLinkSafetySetAllowedArea::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkSafetyAllowedArea::kFields[];
+
 int MavLinkSafetyAllowedArea::pack(char* buffer) const {
-    pack_float(buffer, reinterpret_cast<const float*>(&this->p1x), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->p1y), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->p1z), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->p2x), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->p2y), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->p2z), 20);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->frame), 24);
-    return 25;
+    return MavLinkCodec<MavLinkSafetyAllowedArea>::pack(*this, buffer);
 }
 
 int MavLinkSafetyAllowedArea::unpack(const char* buffer) {
-    unpack_float(buffer, reinterpret_cast<float*>(&this->p1x), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->p1y), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->p1z), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->p2x), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->p2y), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->p2z), 20);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->frame), 24);
- return 25;
+    return MavLinkCodec<MavLinkSafetyAllowedArea>::unpack(buffer, *this);
 }
 
 std::string MavLinkSafetyAllowedArea::toJSon() {
@@ -1363,24 +962,14 @@ std::string MavLinkSafetyAllowedArea::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkAttitudeQuaternionCov::kFields[];
+
 int MavLinkAttitudeQuaternionCov::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float_array(4, buffer, reinterpret_cast<const float*>(&this->q[0]), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->rollspeed), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitchspeed), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yawspeed), 32);
-    pack_float_array(9, buffer, reinterpret_cast<const float*>(&this->covariance[0]), 36);
-    return 72;
+    return MavLinkCodec<MavLinkAttitudeQuaternionCov>::pack(*this, buffer);
 }
 
 int MavLinkAttitudeQuaternionCov::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float_array(4, buffer, reinterpret_cast<float*>(&this->q[0]), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->rollspeed), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitchspeed), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yawspeed), 32);
-    unpack_float_array(9, buffer, reinterpret_cast<float*>(&this->covariance[0]), 36);
- return 72;
+    return MavLinkCodec<MavLinkAttitudeQuaternionCov>::unpack(buffer, *this);
 }
 
 std::string MavLinkAttitudeQuaternionCov::toJSon() {
@@ -1396,28 +985,14 @@ std::string MavLinkAttitudeQuaternionCov::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkNavControllerOutput::kFields[];
+
 int MavLinkNavControllerOutput::pack(char* buffer) const {
-    pack_float(buffer, reinterpret_cast<const float*>(&this->nav_roll), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->nav_pitch), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->alt_error), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->aspd_error), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->xtrack_error), 16);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->nav_bearing), 20);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->target_bearing), 22);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->wp_dist), 24);
-    return 26;
+    return MavLinkCodec<MavLinkNavControllerOutput>::pack(*this, buffer);
 }
 
 int MavLinkNavControllerOutput::unpack(const char* buffer) {
-    unpack_float(buffer, reinterpret_cast<float*>(&this->nav_roll), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->nav_pitch), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->alt_error), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->aspd_error), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->xtrack_error), 16);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->nav_bearing), 20);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->target_bearing), 22);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->wp_dist), 24);
- return 26;
+    return MavLinkCodec<MavLinkNavControllerOutput>::unpack(buffer, *this);
 }
 
 std::string MavLinkNavControllerOutput::toJSon() {
@@ -1435,32 +1010,14 @@ std::string MavLinkNavControllerOutput::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkGlobalPositionIntCov::kFields[];
+
 int MavLinkGlobalPositionIntCov::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 8);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 12);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->alt), 16);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->relative_alt), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vx), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vy), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vz), 32);
-    pack_float_array(36, buffer, reinterpret_cast<const float*>(&this->covariance[0]), 36);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->estimator_type), 180);
-    return 181;
+    return MavLinkCodec<MavLinkGlobalPositionIntCov>::pack(*this, buffer);
 }
 
 int MavLinkGlobalPositionIntCov::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 8);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 12);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->alt), 16);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->relative_alt), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vx), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vy), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vz), 32);
-    unpack_float_array(36, buffer, reinterpret_cast<float*>(&this->covariance[0]), 36);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->estimator_type), 180);
- return 181;
+    return MavLinkCodec<MavLinkGlobalPositionIntCov>::unpack(buffer, *this);
 }
 
 std::string MavLinkGlobalPositionIntCov::toJSon() {
@@ -1480,36 +1037,14 @@ std::string MavLinkGlobalPositionIntCov::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkLocalPositionNedCov::kFields[];
+
 int MavLinkLocalPositionNedCov::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vx), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vy), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vz), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->ax), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->ay), 36);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->az), 40);
-    pack_float_array(45, buffer, reinterpret_cast<const float*>(&this->covariance[0]), 44);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->estimator_type), 224);
-    return 225;
+    return MavLinkCodec<MavLinkLocalPositionNedCov>::pack(*this, buffer);
 }
 
 int MavLinkLocalPositionNedCov::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vx), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vy), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vz), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->ax), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->ay), 36);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->az), 40);
-    unpack_float_array(45, buffer, reinterpret_cast<float*>(&this->covariance[0]), 44);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->estimator_type), 224);
- return 225;
+    return MavLinkCodec<MavLinkLocalPositionNedCov>::unpack(buffer, *this);
 }
 
 std::string MavLinkLocalPositionNedCov::toJSon() {
@@ -1531,54 +1066,14 @@ std::string MavLinkLocalPositionNedCov::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkRcChannels::kFields[];
+
 int MavLinkRcChannels::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan1_raw), 4);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan2_raw), 6);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan3_raw), 8);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan4_raw), 10);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan5_raw), 12);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan6_raw), 14);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan7_raw), 16);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan8_raw), 18);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan9_raw), 20);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan10_raw), 22);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan11_raw), 24);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan12_raw), 26);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan13_raw), 28);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan14_raw), 30);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan15_raw), 32);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan16_raw), 34);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan17_raw), 36);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan18_raw), 38);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->chancount), 40);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->rssi), 41);
-    return 42;
+    return MavLinkCodec<MavLinkRcChannels>::pack(*this, buffer);
 }
 
 int MavLinkRcChannels::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan1_raw), 4);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan2_raw), 6);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan3_raw), 8);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan4_raw), 10);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan5_raw), 12);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan6_raw), 14);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan7_raw), 16);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan8_raw), 18);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan9_raw), 20);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan10_raw), 22);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan11_raw), 24);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan12_raw), 26);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan13_raw), 28);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan14_raw), 30);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan15_raw), 32);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan16_raw), 34);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan17_raw), 36);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan18_raw), 38);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->chancount), 40);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->rssi), 41);
- return 42;
+    return MavLinkCodec<MavLinkRcChannels>::unpack(buffer, *this);
 }
 
 std::string MavLinkRcChannels::toJSon() {
@@ -1609,22 +1104,14 @@ std::string MavLinkRcChannels::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkRequestDataStream::kFields[];
+
 int MavLinkRequestDataStream::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->req_message_rate), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 3);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->req_stream_id), 4);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->start_stop), 5);
-    return 6;
+    return MavLinkCodec<MavLinkRequestDataStream>::pack(*this, buffer);
 }
 
 int MavLinkRequestDataStream::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->req_message_rate), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 3);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->req_stream_id), 4);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->start_stop), 5);
- return 6;
+    return MavLinkCodec<MavLinkRequestDataStream>::unpack(buffer, *this);
 }
 
 std::string MavLinkRequestDataStream::toJSon() {
@@ -1639,18 +1126,14 @@ std::string MavLinkRequestDataStream::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkDataStream::kFields[];
+
 int MavLinkDataStream::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->message_rate), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->stream_id), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->on_off), 3);
-    return 4;
+    return MavLinkCodec<MavLinkDataStream>::pack(*this, buffer);
 }
 
 int MavLinkDataStream::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->message_rate), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->stream_id), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->on_off), 3);
- return 4;
+    return MavLinkCodec<MavLinkDataStream>::unpack(buffer, *this);
 }
 
 std::string MavLinkDataStream::toJSon() {
@@ -1663,24 +1146,14 @@ std::string MavLinkDataStream::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkManualControl::kFields[];
+
 int MavLinkManualControl::pack(char* buffer) const {
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->x), 0);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->y), 2);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->z), 4);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->r), 6);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->buttons), 8);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target), 10);
-    return 11;
+    return MavLinkCodec<MavLinkManualControl>::pack(*this, buffer);
 }
 
 int MavLinkManualControl::unpack(const char* buffer) {
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->x), 0);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->y), 2);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->z), 4);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->r), 6);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->buttons), 8);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target), 10);
- return 11;
+    return MavLinkCodec<MavLinkManualControl>::unpack(buffer, *this);
 }
 
 std::string MavLinkManualControl::toJSon() {
@@ -1696,32 +1169,14 @@ std::string MavLinkManualControl::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkRcChannelsOverride::kFields[];
+
 int MavLinkRcChannelsOverride::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan1_raw), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan2_raw), 2);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan3_raw), 4);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan4_raw), 6);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan5_raw), 8);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan6_raw), 10);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan7_raw), 12);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan8_raw), 14);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 16);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 17);
-    return 18;
+    return MavLinkCodec<MavLinkRcChannelsOverride>::pack(*this, buffer);
 }
 
 int MavLinkRcChannelsOverride::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan1_raw), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan2_raw), 2);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan3_raw), 4);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan4_raw), 6);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan5_raw), 8);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan6_raw), 10);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan7_raw), 12);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan8_raw), 14);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 16);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 17);
- return 18;
+    return MavLinkCodec<MavLinkRcChannelsOverride>::unpack(buffer, *this);
 }
 
 std::string MavLinkRcChannelsOverride::toJSon() {
@@ -1741,40 +1196,14 @@ std::string MavLinkRcChannelsOverride::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMissionItemInt::kFields[];
+
 int MavLinkMissionItemInt::pack(char* buffer) const {
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param1), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param2), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param3), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param4), 12);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->x), 16);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->y), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 24);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->seq), 28);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->command), 30);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 32);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 33);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->frame), 34);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->current), 35);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->autocontinue), 36);
-    return 37;
+    return MavLinkCodec<MavLinkMissionItemInt>::pack(*this, buffer);
 }
 
 int MavLinkMissionItemInt::unpack(const char* buffer) {
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param1), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param2), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param3), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param4), 12);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->x), 16);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->y), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 24);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->seq), 28);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->command), 30);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 32);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 33);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->frame), 34);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->current), 35);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->autocontinue), 36);
- return 37;
+    return MavLinkCodec<MavLinkMissionItemInt>::unpack(buffer, *this);
 }
 
 std::string MavLinkMissionItemInt::toJSon() {
@@ -1798,24 +1227,14 @@ std::string MavLinkMissionItemInt::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkVfrHud::kFields[];
+
 int MavLinkVfrHud::pack(char* buffer) const {
-    pack_float(buffer, reinterpret_cast<const float*>(&this->airspeed), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->groundspeed), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->alt), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->climb), 12);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->heading), 16);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->throttle), 18);
-    return 20;
+    return MavLinkCodec<MavLinkVfrHud>::pack(*this, buffer);
 }
 
 int MavLinkVfrHud::unpack(const char* buffer) {
-    unpack_float(buffer, reinterpret_cast<float*>(&this->airspeed), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->groundspeed), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->alt), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->climb), 12);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->heading), 16);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->throttle), 18);
- return 20;
+    return MavLinkCodec<MavLinkVfrHud>::unpack(buffer, *this);
 }
 
 std::string MavLinkVfrHud::toJSon() {
@@ -1831,38 +1250,14 @@ std::string MavLinkVfrHud::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkCommandInt::kFields[];
+
 int MavLinkCommandInt::pack(char* buffer) const {
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param1), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param2), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param3), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param4), 12);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->x), 16);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->y), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 24);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->command), 28);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 30);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 31);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->frame), 32);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->current), 33);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->autocontinue), 34);
-    return 35;
+    return MavLinkCodec<MavLinkCommandInt>::pack(*this, buffer);
 }
 
 int MavLinkCommandInt::unpack(const char* buffer) {
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param1), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param2), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param3), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param4), 12);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->x), 16);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->y), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 24);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->command), 28);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 30);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 31);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->frame), 32);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->current), 33);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->autocontinue), 34);
- return 35;
+    return MavLinkCodec<MavLinkCommandInt>::unpack(buffer, *this);
 }
 
 std::string MavLinkCommandInt::toJSon() {
@@ -1885,34 +1280,14 @@ std::string MavLinkCommandInt::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkCommandLong::kFields[];
+
 int MavLinkCommandLong::pack(char* buffer) const {
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param1), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param2), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param3), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param4), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param5), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param6), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->param7), 24);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->command), 28);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 30);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 31);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->confirmation), 32);
-    return 33;
+    return MavLinkCodec<MavLinkCommandLong>::pack(*this, buffer);
 }
 
 int MavLinkCommandLong::unpack(const char* buffer) {
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param1), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param2), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param3), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param4), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param5), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param6), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->param7), 24);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->command), 28);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 30);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 31);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->confirmation), 32);
- return 33;
+    return MavLinkCodec<MavLinkCommandLong>::unpack(buffer, *this);
 }
 
 std::string MavLinkCommandLong::toJSon() {
@@ -1933,16 +1308,14 @@ std::string MavLinkCommandLong::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkCommandAck::kFields[];
+
 int MavLinkCommandAck::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->command), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->result), 2);
-    return 3;
+    return MavLinkCodec<MavLinkCommandAck>::pack(*this, buffer);
 }
 
 int MavLinkCommandAck::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->command), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->result), 2);
- return 3;
+    return MavLinkCodec<MavLinkCommandAck>::unpack(buffer, *this);
 }
 
 std::string MavLinkCommandAck::toJSon() {
@@ -1954,26 +1327,14 @@ std::string MavLinkCommandAck::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkManualSetpoint::kFields[];
+
 int MavLinkManualSetpoint::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->roll), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitch), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->thrust), 16);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->mode_switch), 20);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->manual_override_switch), 21);
-    return 22;
+    return MavLinkCodec<MavLinkManualSetpoint>::pack(*this, buffer);
 }
 
 int MavLinkManualSetpoint::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->roll), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitch), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->thrust), 16);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->mode_switch), 20);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->manual_override_switch), 21);
- return 22;
+    return MavLinkCodec<MavLinkManualSetpoint>::unpack(buffer, *this);
 }
 
 std::string MavLinkManualSetpoint::toJSon() {
@@ -1990,30 +1351,14 @@ std::string MavLinkManualSetpoint::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkSetAttitudeTarget::kFields[];
+
 int MavLinkSetAttitudeTarget::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float_array(4, buffer, reinterpret_cast<const float*>(&this->q[0]), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->body_roll_rate), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->body_pitch_rate), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->body_yaw_rate), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->thrust), 32);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 36);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 37);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->type_mask), 38);
-    return 39;
+    return MavLinkCodec<MavLinkSetAttitudeTarget>::pack(*this, buffer);
 }
 
 int MavLinkSetAttitudeTarget::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float_array(4, buffer, reinterpret_cast<float*>(&this->q[0]), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->body_roll_rate), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->body_pitch_rate), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->body_yaw_rate), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->thrust), 32);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 36);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 37);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->type_mask), 38);
- return 39;
+    return MavLinkCodec<MavLinkSetAttitudeTarget>::unpack(buffer, *this);
 }
 
 std::string MavLinkSetAttitudeTarget::toJSon() {
@@ -2032,26 +1377,14 @@ std::string MavLinkSetAttitudeTarget::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkAttitudeTarget::kFields[];
+
 int MavLinkAttitudeTarget::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float_array(4, buffer, reinterpret_cast<const float*>(&this->q[0]), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->body_roll_rate), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->body_pitch_rate), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->body_yaw_rate), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->thrust), 32);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->type_mask), 36);
-    return 37;
+    return MavLinkCodec<MavLinkAttitudeTarget>::pack(*this, buffer);
 }
 
 int MavLinkAttitudeTarget::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float_array(4, buffer, reinterpret_cast<float*>(&this->q[0]), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->body_roll_rate), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->body_pitch_rate), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->body_yaw_rate), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->thrust), 32);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->type_mask), 36);
- return 37;
+    return MavLinkCodec<MavLinkAttitudeTarget>::unpack(buffer, *this);
 }
 
 std::string MavLinkAttitudeTarget::toJSon() {
@@ -2068,44 +1401,14 @@ std::string MavLinkAttitudeTarget::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkSetPositionTargetLocalNed::kFields[];
+
 int MavLinkSetPositionTargetLocalNed::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vx), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vy), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vz), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->afx), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->afy), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->afz), 36);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw), 40);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw_rate), 44);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->type_mask), 48);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 50);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 51);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->coordinate_frame), 52);
-    return 53;
+    return MavLinkCodec<MavLinkSetPositionTargetLocalNed>::pack(*this, buffer);
 }
 
 int MavLinkSetPositionTargetLocalNed::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vx), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vy), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vz), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->afx), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->afy), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->afz), 36);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw), 40);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw_rate), 44);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->type_mask), 48);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 50);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 51);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->coordinate_frame), 52);
- return 53;
+    return MavLinkCodec<MavLinkSetPositionTargetLocalNed>::unpack(buffer, *this);
 }
 
 std::string MavLinkSetPositionTargetLocalNed::toJSon() {
@@ -2131,40 +1434,14 @@ std::string MavLinkSetPositionTargetLocalNed::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkPositionTargetLocalNed::kFields[];
+
 int MavLinkPositionTargetLocalNed::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vx), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vy), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vz), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->afx), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->afy), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->afz), 36);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw), 40);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw_rate), 44);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->type_mask), 48);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->coordinate_frame), 50);
-    return 51;
+    return MavLinkCodec<MavLinkPositionTargetLocalNed>::pack(*this, buffer);
 }
 
 int MavLinkPositionTargetLocalNed::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vx), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vy), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vz), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->afx), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->afy), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->afz), 36);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw), 40);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw_rate), 44);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->type_mask), 48);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->coordinate_frame), 50);
- return 51;
+    return MavLinkCodec<MavLinkPositionTargetLocalNed>::unpack(buffer, *this);
 }
 
 std::string MavLinkPositionTargetLocalNed::toJSon() {
@@ -2188,44 +1465,14 @@ std::string MavLinkPositionTargetLocalNed::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkSetPositionTargetGlobalInt::kFields[];
+
 int MavLinkSetPositionTargetGlobalInt::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat_int), 4);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon_int), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->alt), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vx), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vy), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vz), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->afx), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->afy), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->afz), 36);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw), 40);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw_rate), 44);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->type_mask), 48);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 50);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 51);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->coordinate_frame), 52);
-    return 53;
+    return MavLinkCodec<MavLinkSetPositionTargetGlobalInt>::pack(*this, buffer);
 }
 
 int MavLinkSetPositionTargetGlobalInt::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat_int), 4);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon_int), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->alt), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vx), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vy), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vz), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->afx), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->afy), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->afz), 36);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw), 40);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw_rate), 44);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->type_mask), 48);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 50);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 51);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->coordinate_frame), 52);
- return 53;
+    return MavLinkCodec<MavLinkSetPositionTargetGlobalInt>::unpack(buffer, *this);
 }
 
 std::string MavLinkSetPositionTargetGlobalInt::toJSon() {
@@ -2251,40 +1498,14 @@ std::string MavLinkSetPositionTargetGlobalInt::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkPositionTargetGlobalInt::kFields[];
+
 int MavLinkPositionTargetGlobalInt::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat_int), 4);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon_int), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->alt), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vx), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vy), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vz), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->afx), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->afy), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->afz), 36);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw), 40);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw_rate), 44);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->type_mask), 48);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->coordinate_frame), 50);
-    return 51;
+    return MavLinkCodec<MavLinkPositionTargetGlobalInt>::pack(*this, buffer);
 }
 
 int MavLinkPositionTargetGlobalInt::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat_int), 4);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon_int), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->alt), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vx), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vy), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vz), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->afx), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->afy), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->afz), 36);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw), 40);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw_rate), 44);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->type_mask), 48);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->coordinate_frame), 50);
- return 51;
+    return MavLinkCodec<MavLinkPositionTargetGlobalInt>::unpack(buffer, *this);
 }
 
 std::string MavLinkPositionTargetGlobalInt::toJSon() {
@@ -2308,26 +1529,14 @@ std::string MavLinkPositionTargetGlobalInt::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkLocalPositionNedSystemGlobalOffset::kFields[];
+
 int MavLinkLocalPositionNedSystemGlobalOffset::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->roll), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitch), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw), 24);
-    return 28;
+    return MavLinkCodec<MavLinkLocalPositionNedSystemGlobalOffset>::pack(*this, buffer);
 }
 
 int MavLinkLocalPositionNedSystemGlobalOffset::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->roll), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitch), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw), 24);
- return 28;
+    return MavLinkCodec<MavLinkLocalPositionNedSystemGlobalOffset>::unpack(buffer, *this);
 }
 
 std::string MavLinkLocalPositionNedSystemGlobalOffset::toJSon() {
@@ -2344,44 +1553,14 @@ std::string MavLinkLocalPositionNedSystemGlobalOffset::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkHilState::kFields[];
+
 int MavLinkHilState::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->roll), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitch), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->rollspeed), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitchspeed), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yawspeed), 28);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 32);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 36);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->alt), 40);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->vx), 44);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->vy), 46);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->vz), 48);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xacc), 50);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->yacc), 52);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zacc), 54);
-    return 56;
+    return MavLinkCodec<MavLinkHilState>::pack(*this, buffer);
 }
 
 int MavLinkHilState::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->roll), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitch), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->rollspeed), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitchspeed), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yawspeed), 28);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 32);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 36);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->alt), 40);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->vx), 44);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->vy), 46);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->vz), 48);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xacc), 50);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->yacc), 52);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zacc), 54);
- return 56;
+    return MavLinkCodec<MavLinkHilState>::unpack(buffer, *this);
 }
 
 std::string MavLinkHilState::toJSon() {
@@ -2407,34 +1586,14 @@ std::string MavLinkHilState::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkHilControls::kFields[];
+
 int MavLinkHilControls::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->roll_ailerons), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitch_elevator), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw_rudder), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->throttle), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->aux1), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->aux2), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->aux3), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->aux4), 36);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->mode), 40);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->nav_mode), 41);
-    return 42;
+    return MavLinkCodec<MavLinkHilControls>::pack(*this, buffer);
 }
 
 int MavLinkHilControls::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->roll_ailerons), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitch_elevator), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw_rudder), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->throttle), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->aux1), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->aux2), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->aux3), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->aux4), 36);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->mode), 40);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->nav_mode), 41);
- return 42;
+    return MavLinkCodec<MavLinkHilControls>::unpack(buffer, *this);
 }
 
 std::string MavLinkHilControls::toJSon() {
@@ -2455,40 +1614,14 @@ std::string MavLinkHilControls::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkHilRcInputsRaw::kFields[];
+
 int MavLinkHilRcInputsRaw::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan1_raw), 8);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan2_raw), 10);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan3_raw), 12);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan4_raw), 14);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan5_raw), 16);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan6_raw), 18);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan7_raw), 20);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan8_raw), 22);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan9_raw), 24);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan10_raw), 26);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan11_raw), 28);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->chan12_raw), 30);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->rssi), 32);
-    return 33;
+    return MavLinkCodec<MavLinkHilRcInputsRaw>::pack(*this, buffer);
 }
 
 int MavLinkHilRcInputsRaw::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan1_raw), 8);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan2_raw), 10);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan3_raw), 12);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan4_raw), 14);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan5_raw), 16);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan6_raw), 18);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan7_raw), 20);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan8_raw), 22);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan9_raw), 24);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan10_raw), 26);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan11_raw), 28);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->chan12_raw), 30);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->rssi), 32);
- return 33;
+    return MavLinkCodec<MavLinkHilRcInputsRaw>::unpack(buffer, *this);
 }
 
 std::string MavLinkHilRcInputsRaw::toJSon() {
@@ -2512,20 +1645,14 @@ std::string MavLinkHilRcInputsRaw::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkHilActuatorControls::kFields[];
+
 int MavLinkHilActuatorControls::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->flags), 8);
-    pack_float_array(16, buffer, reinterpret_cast<const float*>(&this->controls[0]), 16);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->mode), 80);
-    return 81;
+    return MavLinkCodec<MavLinkHilActuatorControls>::pack(*this, buffer);
 }
 
 int MavLinkHilActuatorControls::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->flags), 8);
-    unpack_float_array(16, buffer, reinterpret_cast<float*>(&this->controls[0]), 16);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->mode), 80);
- return 81;
+    return MavLinkCodec<MavLinkHilActuatorControls>::unpack(buffer, *this);
 }
 
 std::string MavLinkHilActuatorControls::toJSon() {
@@ -2539,28 +1666,14 @@ std::string MavLinkHilActuatorControls::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkOpticalFlow::kFields[];
+
 int MavLinkOpticalFlow::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->flow_comp_m_x), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->flow_comp_m_y), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->ground_distance), 16);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->flow_x), 20);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->flow_y), 22);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->sensor_id), 24);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->quality), 25);
-    return 26;
+    return MavLinkCodec<MavLinkOpticalFlow>::pack(*this, buffer);
 }
 
 int MavLinkOpticalFlow::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->flow_comp_m_x), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->flow_comp_m_y), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->ground_distance), 16);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->flow_x), 20);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->flow_y), 22);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->sensor_id), 24);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->quality), 25);
- return 26;
+    return MavLinkCodec<MavLinkOpticalFlow>::unpack(buffer, *this);
 }
 
 std::string MavLinkOpticalFlow::toJSon() {
@@ -2578,26 +1691,14 @@ std::string MavLinkOpticalFlow::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkGlobalVisionPositionEstimate::kFields[];
+
 int MavLinkGlobalVisionPositionEstimate::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->roll), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitch), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw), 28);
-    return 32;
+    return MavLinkCodec<MavLinkGlobalVisionPositionEstimate>::pack(*this, buffer);
 }
 
 int MavLinkGlobalVisionPositionEstimate::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->roll), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitch), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw), 28);
- return 32;
+    return MavLinkCodec<MavLinkGlobalVisionPositionEstimate>::unpack(buffer, *this);
 }
 
 std::string MavLinkGlobalVisionPositionEstimate::toJSon() {
@@ -2614,26 +1715,14 @@ std::string MavLinkGlobalVisionPositionEstimate::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkVisionPositionEstimate::kFields[];
+
 int MavLinkVisionPositionEstimate::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->roll), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitch), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw), 28);
-    return 32;
+    return MavLinkCodec<MavLinkVisionPositionEstimate>::pack(*this, buffer);
 }
 
 int MavLinkVisionPositionEstimate::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->roll), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitch), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw), 28);
- return 32;
+    return MavLinkCodec<MavLinkVisionPositionEstimate>::unpack(buffer, *this);
 }
 
 std::string MavLinkVisionPositionEstimate::toJSon() {
@@ -2650,20 +1739,14 @@ std::string MavLinkVisionPositionEstimate::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkVisionSpeedEstimate::kFields[];
+
 int MavLinkVisionSpeedEstimate::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 16);
-    return 20;
+    return MavLinkCodec<MavLinkVisionSpeedEstimate>::pack(*this, buffer);
 }
 
 int MavLinkVisionSpeedEstimate::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 16);
- return 20;
+    return MavLinkCodec<MavLinkVisionSpeedEstimate>::unpack(buffer, *this);
 }
 
 std::string MavLinkVisionSpeedEstimate::toJSon() {
@@ -2677,26 +1760,14 @@ std::string MavLinkVisionSpeedEstimate::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkViconPositionEstimate::kFields[];
+
 int MavLinkViconPositionEstimate::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->roll), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitch), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw), 28);
-    return 32;
+    return MavLinkCodec<MavLinkViconPositionEstimate>::pack(*this, buffer);
 }
 
 int MavLinkViconPositionEstimate::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->roll), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitch), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw), 28);
- return 32;
+    return MavLinkCodec<MavLinkViconPositionEstimate>::unpack(buffer, *this);
 }
 
 std::string MavLinkViconPositionEstimate::toJSon() {
@@ -2713,42 +1784,14 @@ std::string MavLinkViconPositionEstimate::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkHighresImu::kFields[];
+
 int MavLinkHighresImu::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->xacc), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yacc), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->zacc), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->xgyro), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->ygyro), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->zgyro), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->xmag), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->ymag), 36);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->zmag), 40);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->abs_pressure), 44);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->diff_pressure), 48);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pressure_alt), 52);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->temperature), 56);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->fields_updated), 60);
-    return 62;
+    return MavLinkCodec<MavLinkHighresImu>::pack(*this, buffer);
 }
 
 int MavLinkHighresImu::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->xacc), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yacc), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->zacc), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->xgyro), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->ygyro), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->zgyro), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->xmag), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->ymag), 36);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->zmag), 40);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->abs_pressure), 44);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->diff_pressure), 48);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pressure_alt), 52);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->temperature), 56);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->fields_updated), 60);
- return 62;
+    return MavLinkCodec<MavLinkHighresImu>::unpack(buffer, *this);
 }
 
 std::string MavLinkHighresImu::toJSon() {
@@ -2773,36 +1816,14 @@ std::string MavLinkHighresImu::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkOpticalFlowRad::kFields[];
+
 int MavLinkOpticalFlowRad::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->integration_time_us), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->integrated_x), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->integrated_y), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->integrated_xgyro), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->integrated_ygyro), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->integrated_zgyro), 28);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_delta_distance_us), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->distance), 36);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->temperature), 40);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->sensor_id), 42);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->quality), 43);
-    return 44;
+    return MavLinkCodec<MavLinkOpticalFlowRad>::pack(*this, buffer);
 }
 
 int MavLinkOpticalFlowRad::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->integration_time_us), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->integrated_x), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->integrated_y), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->integrated_xgyro), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->integrated_ygyro), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->integrated_zgyro), 28);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_delta_distance_us), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->distance), 36);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->temperature), 40);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->sensor_id), 42);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->quality), 43);
- return 44;
+    return MavLinkCodec<MavLinkOpticalFlowRad>::unpack(buffer, *this);
 }
 
 std::string MavLinkOpticalFlowRad::toJSon() {
@@ -2824,42 +1845,14 @@ std::string MavLinkOpticalFlowRad::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkHilSensor::kFields[];
+
 int MavLinkHilSensor::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->xacc), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yacc), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->zacc), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->xgyro), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->ygyro), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->zgyro), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->xmag), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->ymag), 36);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->zmag), 40);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->abs_pressure), 44);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->diff_pressure), 48);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pressure_alt), 52);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->temperature), 56);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->fields_updated), 60);
-    return 64;
+    return MavLinkCodec<MavLinkHilSensor>::pack(*this, buffer);
 }
 
 int MavLinkHilSensor::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->xacc), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yacc), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->zacc), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->xgyro), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->ygyro), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->zgyro), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->xmag), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->ymag), 36);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->zmag), 40);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->abs_pressure), 44);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->diff_pressure), 48);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pressure_alt), 52);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->temperature), 56);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->fields_updated), 60);
- return 64;
+    return MavLinkCodec<MavLinkHilSensor>::unpack(buffer, *this);
 }
 
 std::string MavLinkHilSensor::toJSon() {
@@ -2884,54 +1877,14 @@ std::string MavLinkHilSensor::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkSimState::kFields[];
+
 int MavLinkSimState::pack(char* buffer) const {
-    pack_float(buffer, reinterpret_cast<const float*>(&this->q1), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->q2), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->q3), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->q4), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->roll), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitch), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->xacc), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yacc), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->zacc), 36);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->xgyro), 40);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->ygyro), 44);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->zgyro), 48);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->lat), 52);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->lon), 56);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->alt), 60);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->std_dev_horz), 64);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->std_dev_vert), 68);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vn), 72);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->ve), 76);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vd), 80);
-    return 84;
+    return MavLinkCodec<MavLinkSimState>::pack(*this, buffer);
 }
 
 int MavLinkSimState::unpack(const char* buffer) {
-    unpack_float(buffer, reinterpret_cast<float*>(&this->q1), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->q2), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->q3), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->q4), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->roll), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitch), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->xacc), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yacc), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->zacc), 36);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->xgyro), 40);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->ygyro), 44);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->zgyro), 48);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->lat), 52);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->lon), 56);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->alt), 60);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->std_dev_horz), 64);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->std_dev_vert), 68);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vn), 72);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->ve), 76);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vd), 80);
- return 84;
+    return MavLinkCodec<MavLinkSimState>::unpack(buffer, *this);
 }
 
 std::string MavLinkSimState::toJSon() {
@@ -2962,26 +1915,14 @@ std::string MavLinkSimState::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkRadioStatus::kFields[];
+
 int MavLinkRadioStatus::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->rxerrors), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->fixed), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->rssi), 4);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->remrssi), 5);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->txbuf), 6);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->noise), 7);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->remnoise), 8);
-    return 9;
+    return MavLinkCodec<MavLinkRadioStatus>::pack(*this, buffer);
 }
 
 int MavLinkRadioStatus::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->rxerrors), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->fixed), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->rssi), 4);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->remrssi), 5);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->txbuf), 6);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->noise), 7);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->remnoise), 8);
- return 9;
+    return MavLinkCodec<MavLinkRadioStatus>::unpack(buffer, *this);
 }
 
 std::string MavLinkRadioStatus::toJSon() {
@@ -2998,20 +1939,14 @@ std::string MavLinkRadioStatus::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkFileTransferProtocol::kFields[];
+
 int MavLinkFileTransferProtocol::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_network), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 1);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 2);
-    pack_uint8_t_array(251, buffer, reinterpret_cast<const uint8_t*>(&this->payload[0]), 3);
-    return 254;
+    return MavLinkCodec<MavLinkFileTransferProtocol>::pack(*this, buffer);
 }
 
 int MavLinkFileTransferProtocol::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_network), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 1);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 2);
-    unpack_uint8_t_array(251, buffer, reinterpret_cast<uint8_t*>(&this->payload[0]), 3);
- return 254;
+    return MavLinkCodec<MavLinkFileTransferProtocol>::unpack(buffer, *this);
 }
 
 std::string MavLinkFileTransferProtocol::toJSon() {
@@ -3025,16 +1960,14 @@ std::string MavLinkFileTransferProtocol::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkTimesync::kFields[];
+
 int MavLinkTimesync::pack(char* buffer) const {
-    pack_int64_t(buffer, reinterpret_cast<const int64_t*>(&this->tc1), 0);
-    pack_int64_t(buffer, reinterpret_cast<const int64_t*>(&this->ts1), 8);
-    return 16;
+    return MavLinkCodec<MavLinkTimesync>::pack(*this, buffer);
 }
 
 int MavLinkTimesync::unpack(const char* buffer) {
-    unpack_int64_t(buffer, reinterpret_cast<int64_t*>(&this->tc1), 0);
-    unpack_int64_t(buffer, reinterpret_cast<int64_t*>(&this->ts1), 8);
- return 16;
+    return MavLinkCodec<MavLinkTimesync>::unpack(buffer, *this);
 }
 
 std::string MavLinkTimesync::toJSon() {
@@ -3046,16 +1979,14 @@ std::string MavLinkTimesync::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkCameraTrigger::kFields[];
+
 int MavLinkCameraTrigger::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->seq), 8);
-    return 12;
+    return MavLinkCodec<MavLinkCameraTrigger>::pack(*this, buffer);
 }
 
 int MavLinkCameraTrigger::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->seq), 8);
- return 12;
+    return MavLinkCodec<MavLinkCameraTrigger>::unpack(buffer, *this);
 }
 
 std::string MavLinkCameraTrigger::toJSon() {
@@ -3067,38 +1998,14 @@ std::string MavLinkCameraTrigger::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkHilGps::kFields[];
+
 int MavLinkHilGps::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 8);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 12);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->alt), 16);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->eph), 20);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->epv), 22);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->vel), 24);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->vn), 26);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->ve), 28);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->vd), 30);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->cog), 32);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->fix_type), 34);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->satellites_visible), 35);
-    return 36;
+    return MavLinkCodec<MavLinkHilGps>::pack(*this, buffer);
 }
 
 int MavLinkHilGps::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 8);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 12);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->alt), 16);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->eph), 20);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->epv), 22);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->vel), 24);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->vn), 26);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->ve), 28);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->vd), 30);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->cog), 32);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->fix_type), 34);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->satellites_visible), 35);
- return 36;
+    return MavLinkCodec<MavLinkHilGps>::unpack(buffer, *this);
 }
 
 std::string MavLinkHilGps::toJSon() {
@@ -3121,36 +2028,14 @@ std::string MavLinkHilGps::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkHilOpticalFlow::kFields[];
+
 int MavLinkHilOpticalFlow::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->integration_time_us), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->integrated_x), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->integrated_y), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->integrated_xgyro), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->integrated_ygyro), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->integrated_zgyro), 28);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_delta_distance_us), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->distance), 36);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->temperature), 40);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->sensor_id), 42);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->quality), 43);
-    return 44;
+    return MavLinkCodec<MavLinkHilOpticalFlow>::pack(*this, buffer);
 }
 
 int MavLinkHilOpticalFlow::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->integration_time_us), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->integrated_x), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->integrated_y), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->integrated_xgyro), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->integrated_ygyro), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->integrated_zgyro), 28);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_delta_distance_us), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->distance), 36);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->temperature), 40);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->sensor_id), 42);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->quality), 43);
- return 44;
+    return MavLinkCodec<MavLinkHilOpticalFlow>::unpack(buffer, *this);
 }
 
 std::string MavLinkHilOpticalFlow::toJSon() {
@@ -3172,44 +2057,14 @@ std::string MavLinkHilOpticalFlow::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkHilStateQuaternion::kFields[];
+
 int MavLinkHilStateQuaternion::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float_array(4, buffer, reinterpret_cast<const float*>(&this->attitude_quaternion[0]), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->rollspeed), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitchspeed), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yawspeed), 32);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 36);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 40);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->alt), 44);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->vx), 48);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->vy), 50);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->vz), 52);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->ind_airspeed), 54);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->true_airspeed), 56);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xacc), 58);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->yacc), 60);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zacc), 62);
-    return 64;
+    return MavLinkCodec<MavLinkHilStateQuaternion>::pack(*this, buffer);
 }
 
 int MavLinkHilStateQuaternion::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float_array(4, buffer, reinterpret_cast<float*>(&this->attitude_quaternion[0]), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->rollspeed), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitchspeed), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yawspeed), 32);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 36);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 40);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->alt), 44);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->vx), 48);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->vy), 50);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->vz), 52);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->ind_airspeed), 54);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->true_airspeed), 56);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xacc), 58);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->yacc), 60);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zacc), 62);
- return 64;
+    return MavLinkCodec<MavLinkHilStateQuaternion>::unpack(buffer, *this);
 }
 
 std::string MavLinkHilStateQuaternion::toJSon() {
@@ -3235,32 +2090,14 @@ std::string MavLinkHilStateQuaternion::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkScaledImu2::kFields[];
+
 int MavLinkScaledImu2::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xacc), 4);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->yacc), 6);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zacc), 8);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xgyro), 10);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->ygyro), 12);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zgyro), 14);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xmag), 16);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->ymag), 18);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zmag), 20);
-    return 22;
+    return MavLinkCodec<MavLinkScaledImu2>::pack(*this, buffer);
 }
 
 int MavLinkScaledImu2::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xacc), 4);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->yacc), 6);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zacc), 8);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xgyro), 10);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->ygyro), 12);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zgyro), 14);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xmag), 16);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->ymag), 18);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zmag), 20);
- return 22;
+    return MavLinkCodec<MavLinkScaledImu2>::unpack(buffer, *this);
 }
 
 std::string MavLinkScaledImu2::toJSon() {
@@ -3280,20 +2117,14 @@ std::string MavLinkScaledImu2::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkLogRequestList::kFields[];
+
 int MavLinkLogRequestList::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->start), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->end), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 4);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 5);
-    return 6;
+    return MavLinkCodec<MavLinkLogRequestList>::pack(*this, buffer);
 }
 
 int MavLinkLogRequestList::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->start), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->end), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 4);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 5);
- return 6;
+    return MavLinkCodec<MavLinkLogRequestList>::unpack(buffer, *this);
 }
 
 std::string MavLinkLogRequestList::toJSon() {
@@ -3307,22 +2138,14 @@ std::string MavLinkLogRequestList::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkLogEntry::kFields[];
+
 int MavLinkLogEntry::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_utc), 0);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->size), 4);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->id), 8);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->num_logs), 10);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->last_log_num), 12);
-    return 14;
+    return MavLinkCodec<MavLinkLogEntry>::pack(*this, buffer);
 }
 
 int MavLinkLogEntry::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_utc), 0);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->size), 4);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->id), 8);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->num_logs), 10);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->last_log_num), 12);
- return 14;
+    return MavLinkCodec<MavLinkLogEntry>::unpack(buffer, *this);
 }
 
 std::string MavLinkLogEntry::toJSon() {
@@ -3337,22 +2160,14 @@ std::string MavLinkLogEntry::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkLogRequestData::kFields[];
+
 int MavLinkLogRequestData::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->ofs), 0);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->count), 4);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->id), 8);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 10);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 11);
-    return 12;
+    return MavLinkCodec<MavLinkLogRequestData>::pack(*this, buffer);
 }
 
 int MavLinkLogRequestData::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->ofs), 0);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->count), 4);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->id), 8);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 10);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 11);
- return 12;
+    return MavLinkCodec<MavLinkLogRequestData>::unpack(buffer, *this);
 }
 
 std::string MavLinkLogRequestData::toJSon() {
@@ -3367,20 +2182,14 @@ std::string MavLinkLogRequestData::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkLogData::kFields[];
+
 int MavLinkLogData::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->ofs), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->id), 4);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->count), 6);
-    pack_uint8_t_array(90, buffer, reinterpret_cast<const uint8_t*>(&this->data[0]), 7);
-    return 97;
+    return MavLinkCodec<MavLinkLogData>::pack(*this, buffer);
 }
 
 int MavLinkLogData::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->ofs), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->id), 4);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->count), 6);
-    unpack_uint8_t_array(90, buffer, reinterpret_cast<uint8_t*>(&this->data[0]), 7);
- return 97;
+    return MavLinkCodec<MavLinkLogData>::unpack(buffer, *this);
 }
 
 std::string MavLinkLogData::toJSon() {
@@ -3394,16 +2203,14 @@ std::string MavLinkLogData::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkLogErase::kFields[];
+
 int MavLinkLogErase::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 1);
-    return 2;
+    return MavLinkCodec<MavLinkLogErase>::pack(*this, buffer);
 }
 
 int MavLinkLogErase::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 1);
- return 2;
+    return MavLinkCodec<MavLinkLogErase>::unpack(buffer, *this);
 }
 
 std::string MavLinkLogErase::toJSon() {
@@ -3415,16 +2222,14 @@ std::string MavLinkLogErase::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkLogRequestEnd::kFields[];
+
 int MavLinkLogRequestEnd::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 1);
-    return 2;
+    return MavLinkCodec<MavLinkLogRequestEnd>::pack(*this, buffer);
 }
 
 int MavLinkLogRequestEnd::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 1);
- return 2;
+    return MavLinkCodec<MavLinkLogRequestEnd>::unpack(buffer, *this);
 }
 
 std::string MavLinkLogRequestEnd::toJSon() {
@@ -3436,20 +2241,14 @@ std::string MavLinkLogRequestEnd::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkGpsInjectData::kFields[];
+
 int MavLinkGpsInjectData::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 1);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->len), 2);
-    pack_uint8_t_array(110, buffer, reinterpret_cast<const uint8_t*>(&this->data[0]), 3);
-    return 113;
+    return MavLinkCodec<MavLinkGpsInjectData>::pack(*this, buffer);
 }
 
 int MavLinkGpsInjectData::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 1);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->len), 2);
-    unpack_uint8_t_array(110, buffer, reinterpret_cast<uint8_t*>(&this->data[0]), 3);
- return 113;
+    return MavLinkCodec<MavLinkGpsInjectData>::unpack(buffer, *this);
 }
 
 std::string MavLinkGpsInjectData::toJSon() {
@@ -3463,36 +2262,14 @@ std::string MavLinkGpsInjectData::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkGps2Raw::kFields[];
+
 int MavLinkGps2Raw::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 8);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 12);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->alt), 16);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->dgps_age), 20);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->eph), 24);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->epv), 26);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->vel), 28);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->cog), 30);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->fix_type), 32);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->satellites_visible), 33);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->dgps_numch), 34);
-    return 35;
+    return MavLinkCodec<MavLinkGps2Raw>::pack(*this, buffer);
 }
 
 int MavLinkGps2Raw::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 8);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 12);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->alt), 16);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->dgps_age), 20);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->eph), 24);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->epv), 26);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->vel), 28);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->cog), 30);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->fix_type), 32);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->satellites_visible), 33);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->dgps_numch), 34);
- return 35;
+    return MavLinkCodec<MavLinkGps2Raw>::unpack(buffer, *this);
 }
 
 std::string MavLinkGps2Raw::toJSon() {
@@ -3514,18 +2291,14 @@ std::string MavLinkGps2Raw::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkPowerStatus::kFields[];
+
 int MavLinkPowerStatus::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->Vcc), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->Vservo), 2);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->flags), 4);
-    return 6;
+    return MavLinkCodec<MavLinkPowerStatus>::pack(*this, buffer);
 }
 
 int MavLinkPowerStatus::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->Vcc), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->Vservo), 2);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->flags), 4);
- return 6;
+    return MavLinkCodec<MavLinkPowerStatus>::unpack(buffer, *this);
 }
 
 std::string MavLinkPowerStatus::toJSon() {
@@ -3538,24 +2311,14 @@ std::string MavLinkPowerStatus::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkSerialControl::kFields[];
+
 int MavLinkSerialControl::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->baudrate), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->timeout), 4);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->device), 6);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->flags), 7);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->count), 8);
-    pack_uint8_t_array(70, buffer, reinterpret_cast<const uint8_t*>(&this->data[0]), 9);
-    return 79;
+    return MavLinkCodec<MavLinkSerialControl>::pack(*this, buffer);
 }
 
 int MavLinkSerialControl::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->baudrate), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->timeout), 4);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->device), 6);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->flags), 7);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->count), 8);
-    unpack_uint8_t_array(70, buffer, reinterpret_cast<uint8_t*>(&this->data[0]), 9);
- return 79;
+    return MavLinkCodec<MavLinkSerialControl>::unpack(buffer, *this);
 }
 
 std::string MavLinkSerialControl::toJSon() {
@@ -3571,38 +2334,14 @@ std::string MavLinkSerialControl::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkGpsRtk::kFields[];
+
 int MavLinkGpsRtk::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_last_baseline_ms), 0);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->tow), 4);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->baseline_a_mm), 8);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->baseline_b_mm), 12);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->baseline_c_mm), 16);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->accuracy), 20);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->iar_num_hypotheses), 24);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->wn), 28);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->rtk_receiver_id), 30);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->rtk_health), 31);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->rtk_rate), 32);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->nsats), 33);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->baseline_coords_type), 34);
-    return 35;
+    return MavLinkCodec<MavLinkGpsRtk>::pack(*this, buffer);
 }
 
 int MavLinkGpsRtk::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_last_baseline_ms), 0);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->tow), 4);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->baseline_a_mm), 8);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->baseline_b_mm), 12);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->baseline_c_mm), 16);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->accuracy), 20);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->iar_num_hypotheses), 24);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->wn), 28);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->rtk_receiver_id), 30);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->rtk_health), 31);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->rtk_rate), 32);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->nsats), 33);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->baseline_coords_type), 34);
- return 35;
+    return MavLinkCodec<MavLinkGpsRtk>::unpack(buffer, *this);
 }
 
 std::string MavLinkGpsRtk::toJSon() {
@@ -3625,38 +2364,14 @@ std::string MavLinkGpsRtk::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkGps2Rtk::kFields[];
+
 int MavLinkGps2Rtk::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_last_baseline_ms), 0);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->tow), 4);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->baseline_a_mm), 8);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->baseline_b_mm), 12);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->baseline_c_mm), 16);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->accuracy), 20);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->iar_num_hypotheses), 24);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->wn), 28);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->rtk_receiver_id), 30);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->rtk_health), 31);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->rtk_rate), 32);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->nsats), 33);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->baseline_coords_type), 34);
-    return 35;
+    return MavLinkCodec<MavLinkGps2Rtk>::pack(*this, buffer);
 }
 
 int MavLinkGps2Rtk::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_last_baseline_ms), 0);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->tow), 4);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->baseline_a_mm), 8);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->baseline_b_mm), 12);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->baseline_c_mm), 16);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->accuracy), 20);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->iar_num_hypotheses), 24);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->wn), 28);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->rtk_receiver_id), 30);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->rtk_health), 31);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->rtk_rate), 32);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->nsats), 33);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->baseline_coords_type), 34);
- return 35;
+    return MavLinkCodec<MavLinkGps2Rtk>::unpack(buffer, *this);
 }
 
 std::string MavLinkGps2Rtk::toJSon() {
@@ -3679,32 +2394,14 @@ std::string MavLinkGps2Rtk::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkScaledImu3::kFields[];
+
 int MavLinkScaledImu3::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xacc), 4);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->yacc), 6);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zacc), 8);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xgyro), 10);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->ygyro), 12);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zgyro), 14);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->xmag), 16);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->ymag), 18);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->zmag), 20);
-    return 22;
+    return MavLinkCodec<MavLinkScaledImu3>::pack(*this, buffer);
 }
 
 int MavLinkScaledImu3::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xacc), 4);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->yacc), 6);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zacc), 8);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xgyro), 10);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->ygyro), 12);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zgyro), 14);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->xmag), 16);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->ymag), 18);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->zmag), 20);
- return 22;
+    return MavLinkCodec<MavLinkScaledImu3>::unpack(buffer, *this);
 }
 
 std::string MavLinkScaledImu3::toJSon() {
@@ -3724,26 +2421,14 @@ std::string MavLinkScaledImu3::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkDataTransmissionHandshake::kFields[];
+
 int MavLinkDataTransmissionHandshake::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->size), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->width), 4);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->height), 6);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->packets), 8);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->type), 10);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->payload), 11);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->jpg_quality), 12);
-    return 13;
+    return MavLinkCodec<MavLinkDataTransmissionHandshake>::pack(*this, buffer);
 }
 
 int MavLinkDataTransmissionHandshake::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->size), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->width), 4);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->height), 6);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->packets), 8);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->type), 10);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->payload), 11);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->jpg_quality), 12);
- return 13;
+    return MavLinkCodec<MavLinkDataTransmissionHandshake>::unpack(buffer, *this);
 }
 
 std::string MavLinkDataTransmissionHandshake::toJSon() {
@@ -3760,16 +2445,14 @@ std::string MavLinkDataTransmissionHandshake::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkEncapsulatedData::kFields[];
+
 int MavLinkEncapsulatedData::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->seqnr), 0);
-    pack_uint8_t_array(253, buffer, reinterpret_cast<const uint8_t*>(&this->data[0]), 2);
-    return 255;
+    return MavLinkCodec<MavLinkEncapsulatedData>::pack(*this, buffer);
 }
 
 int MavLinkEncapsulatedData::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->seqnr), 0);
-    unpack_uint8_t_array(253, buffer, reinterpret_cast<uint8_t*>(&this->data[0]), 2);
- return 255;
+    return MavLinkCodec<MavLinkEncapsulatedData>::unpack(buffer, *this);
 }
 
 std::string MavLinkEncapsulatedData::toJSon() {
@@ -3781,28 +2464,14 @@ std::string MavLinkEncapsulatedData::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkDistanceSensor::kFields[];
+
 int MavLinkDistanceSensor::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->min_distance), 4);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->max_distance), 6);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->current_distance), 8);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->type), 10);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->id), 11);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->orientation), 12);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->covariance), 13);
-    return 14;
+    return MavLinkCodec<MavLinkDistanceSensor>::pack(*this, buffer);
 }
 
 int MavLinkDistanceSensor::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->min_distance), 4);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->max_distance), 6);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->current_distance), 8);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->type), 10);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->id), 11);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->orientation), 12);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->covariance), 13);
- return 14;
+    return MavLinkCodec<MavLinkDistanceSensor>::unpack(buffer, *this);
 }
 
 std::string MavLinkDistanceSensor::toJSon() {
@@ -3820,20 +2489,14 @@ std::string MavLinkDistanceSensor::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkTerrainRequest::kFields[];
+
 int MavLinkTerrainRequest::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->mask), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 8);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 12);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->grid_spacing), 16);
-    return 18;
+    return MavLinkCodec<MavLinkTerrainRequest>::pack(*this, buffer);
 }
 
 int MavLinkTerrainRequest::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->mask), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 8);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 12);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->grid_spacing), 16);
- return 18;
+    return MavLinkCodec<MavLinkTerrainRequest>::unpack(buffer, *this);
 }
 
 std::string MavLinkTerrainRequest::toJSon() {
@@ -3847,22 +2510,14 @@ std::string MavLinkTerrainRequest::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkTerrainData::kFields[];
+
 int MavLinkTerrainData::pack(char* buffer) const {
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 4);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->grid_spacing), 8);
-    pack_int16_t_array(16, buffer, reinterpret_cast<const int16_t*>(&this->data[0]), 10);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->gridbit), 42);
-    return 43;
+    return MavLinkCodec<MavLinkTerrainData>::pack(*this, buffer);
 }
 
 int MavLinkTerrainData::unpack(const char* buffer) {
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 4);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->grid_spacing), 8);
-    unpack_int16_t_array(16, buffer, reinterpret_cast<int16_t*>(&this->data[0]), 10);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->gridbit), 42);
- return 43;
+    return MavLinkCodec<MavLinkTerrainData>::unpack(buffer, *this);
 }
 
 std::string MavLinkTerrainData::toJSon() {
@@ -3877,16 +2532,14 @@ std::string MavLinkTerrainData::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkTerrainCheck::kFields[];
+
 int MavLinkTerrainCheck::pack(char* buffer) const {
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 4);
-    return 8;
+    return MavLinkCodec<MavLinkTerrainCheck>::pack(*this, buffer);
 }
 
 int MavLinkTerrainCheck::unpack(const char* buffer) {
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 4);
- return 8;
+    return MavLinkCodec<MavLinkTerrainCheck>::unpack(buffer, *this);
 }
 
 std::string MavLinkTerrainCheck::toJSon() {
@@ -3898,26 +2551,14 @@ std::string MavLinkTerrainCheck::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkTerrainReport::kFields[];
+
 int MavLinkTerrainReport::pack(char* buffer) const {
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->terrain_height), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->current_height), 12);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->spacing), 16);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->pending), 18);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->loaded), 20);
-    return 22;
+    return MavLinkCodec<MavLinkTerrainReport>::pack(*this, buffer);
 }
 
 int MavLinkTerrainReport::unpack(const char* buffer) {
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->terrain_height), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->current_height), 12);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->spacing), 16);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->pending), 18);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->loaded), 20);
- return 22;
+    return MavLinkCodec<MavLinkTerrainReport>::unpack(buffer, *this);
 }
 
 std::string MavLinkTerrainReport::toJSon() {
@@ -3934,20 +2575,14 @@ std::string MavLinkTerrainReport::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkScaledPressure2::kFields[];
+
 int MavLinkScaledPressure2::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->press_abs), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->press_diff), 8);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->temperature), 12);
-    return 14;
+    return MavLinkCodec<MavLinkScaledPressure2>::pack(*this, buffer);
 }
 
 int MavLinkScaledPressure2::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->press_abs), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->press_diff), 8);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->temperature), 12);
- return 14;
+    return MavLinkCodec<MavLinkScaledPressure2>::unpack(buffer, *this);
 }
 
 std::string MavLinkScaledPressure2::toJSon() {
@@ -3961,22 +2596,14 @@ std::string MavLinkScaledPressure2::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkAttPosMocap::kFields[];
+
 int MavLinkAttPosMocap::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float_array(4, buffer, reinterpret_cast<const float*>(&this->q[0]), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 32);
-    return 36;
+    return MavLinkCodec<MavLinkAttPosMocap>::pack(*this, buffer);
 }
 
 int MavLinkAttPosMocap::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float_array(4, buffer, reinterpret_cast<float*>(&this->q[0]), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 32);
- return 36;
+    return MavLinkCodec<MavLinkAttPosMocap>::unpack(buffer, *this);
 }
 
 std::string MavLinkAttPosMocap::toJSon() {
@@ -3991,22 +2618,14 @@ std::string MavLinkAttPosMocap::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkSetActuatorControlTarget::kFields[];
+
 int MavLinkSetActuatorControlTarget::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float_array(8, buffer, reinterpret_cast<const float*>(&this->controls[0]), 8);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->group_mlx), 40);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 41);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 42);
-    return 43;
+    return MavLinkCodec<MavLinkSetActuatorControlTarget>::pack(*this, buffer);
 }
 
 int MavLinkSetActuatorControlTarget::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float_array(8, buffer, reinterpret_cast<float*>(&this->controls[0]), 8);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->group_mlx), 40);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 41);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 42);
- return 43;
+    return MavLinkCodec<MavLinkSetActuatorControlTarget>::unpack(buffer, *this);
 }
 
 std::string MavLinkSetActuatorControlTarget::toJSon() {
@@ -4021,18 +2640,14 @@ std::string MavLinkSetActuatorControlTarget::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkActuatorControlTarget::kFields[];
+
 int MavLinkActuatorControlTarget::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float_array(8, buffer, reinterpret_cast<const float*>(&this->controls[0]), 8);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->group_mlx), 40);
-    return 41;
+    return MavLinkCodec<MavLinkActuatorControlTarget>::pack(*this, buffer);
 }
 
 int MavLinkActuatorControlTarget::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float_array(8, buffer, reinterpret_cast<float*>(&this->controls[0]), 8);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->group_mlx), 40);
- return 41;
+    return MavLinkCodec<MavLinkActuatorControlTarget>::unpack(buffer, *this);
 }
 
 std::string MavLinkActuatorControlTarget::toJSon() {
@@ -4045,26 +2660,14 @@ std::string MavLinkActuatorControlTarget::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkAltitude::kFields[];
+
 int MavLinkAltitude::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->altitude_monotonic), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->altitude_amsl), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->altitude_local), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->altitude_relative), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->altitude_terrain), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->bottom_clearance), 28);
-    return 32;
+    return MavLinkCodec<MavLinkAltitude>::pack(*this, buffer);
 }
 
 int MavLinkAltitude::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->altitude_monotonic), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->altitude_amsl), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->altitude_local), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->altitude_relative), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->altitude_terrain), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->bottom_clearance), 28);
- return 32;
+    return MavLinkCodec<MavLinkAltitude>::unpack(buffer, *this);
 }
 
 std::string MavLinkAltitude::toJSon() {
@@ -4081,22 +2684,14 @@ std::string MavLinkAltitude::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkResourceRequest::kFields[];
+
 int MavLinkResourceRequest::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->request_id), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->uri_type), 1);
-    pack_uint8_t_array(120, buffer, reinterpret_cast<const uint8_t*>(&this->uri[0]), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->transfer_type), 122);
-    pack_uint8_t_array(120, buffer, reinterpret_cast<const uint8_t*>(&this->storage[0]), 123);
-    return 243;
+    return MavLinkCodec<MavLinkResourceRequest>::pack(*this, buffer);
 }
 
 int MavLinkResourceRequest::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->request_id), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->uri_type), 1);
-    unpack_uint8_t_array(120, buffer, reinterpret_cast<uint8_t*>(&this->uri[0]), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->transfer_type), 122);
-    unpack_uint8_t_array(120, buffer, reinterpret_cast<uint8_t*>(&this->storage[0]), 123);
- return 243;
+    return MavLinkCodec<MavLinkResourceRequest>::unpack(buffer, *this);
 }
 
 std::string MavLinkResourceRequest::toJSon() {
@@ -4111,20 +2706,14 @@ std::string MavLinkResourceRequest::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkScaledPressure3::kFields[];
+
 int MavLinkScaledPressure3::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->press_abs), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->press_diff), 8);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->temperature), 12);
-    return 14;
+    return MavLinkCodec<MavLinkScaledPressure3>::pack(*this, buffer);
 }
 
 int MavLinkScaledPressure3::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->press_abs), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->press_diff), 8);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->temperature), 12);
- return 14;
+    return MavLinkCodec<MavLinkScaledPressure3>::unpack(buffer, *this);
 }
 
 std::string MavLinkScaledPressure3::toJSon() {
@@ -4138,34 +2727,14 @@ std::string MavLinkScaledPressure3::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkFollowTarget::kFields[];
+
 int MavLinkFollowTarget::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->timestamp), 0);
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->custom_state), 8);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 16);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->alt), 24);
-    pack_float_array(3, buffer, reinterpret_cast<const float*>(&this->vel[0]), 28);
-    pack_float_array(3, buffer, reinterpret_cast<const float*>(&this->acc[0]), 40);
-    pack_float_array(4, buffer, reinterpret_cast<const float*>(&this->attitude_q[0]), 52);
-    pack_float_array(3, buffer, reinterpret_cast<const float*>(&this->rates[0]), 68);
-    pack_float_array(3, buffer, reinterpret_cast<const float*>(&this->position_cov[0]), 80);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->est_capabilities), 92);
-    return 93;
+    return MavLinkCodec<MavLinkFollowTarget>::pack(*this, buffer);
 }
 
 int MavLinkFollowTarget::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->timestamp), 0);
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->custom_state), 8);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 16);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->alt), 24);
-    unpack_float_array(3, buffer, reinterpret_cast<float*>(&this->vel[0]), 28);
-    unpack_float_array(3, buffer, reinterpret_cast<float*>(&this->acc[0]), 40);
-    unpack_float_array(4, buffer, reinterpret_cast<float*>(&this->attitude_q[0]), 52);
-    unpack_float_array(3, buffer, reinterpret_cast<float*>(&this->rates[0]), 68);
-    unpack_float_array(3, buffer, reinterpret_cast<float*>(&this->position_cov[0]), 80);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->est_capabilities), 92);
- return 93;
+    return MavLinkCodec<MavLinkFollowTarget>::unpack(buffer, *this);
 }
 
 std::string MavLinkFollowTarget::toJSon() {
@@ -4186,46 +2755,14 @@ std::string MavLinkFollowTarget::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkControlSystemState::kFields[];
+
 int MavLinkControlSystemState::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x_acc), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y_acc), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z_acc), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x_vel), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y_vel), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z_vel), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x_pos), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y_pos), 36);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z_pos), 40);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->airspeed), 44);
-    pack_float_array(3, buffer, reinterpret_cast<const float*>(&this->vel_variance[0]), 48);
-    pack_float_array(3, buffer, reinterpret_cast<const float*>(&this->pos_variance[0]), 60);
-    pack_float_array(4, buffer, reinterpret_cast<const float*>(&this->q[0]), 72);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->roll_rate), 88);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pitch_rate), 92);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->yaw_rate), 96);
-    return 100;
+    return MavLinkCodec<MavLinkControlSystemState>::pack(*this, buffer);
 }
 
 int MavLinkControlSystemState::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x_acc), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y_acc), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z_acc), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x_vel), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y_vel), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z_vel), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x_pos), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y_pos), 36);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z_pos), 40);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->airspeed), 44);
-    unpack_float_array(3, buffer, reinterpret_cast<float*>(&this->vel_variance[0]), 48);
-    unpack_float_array(3, buffer, reinterpret_cast<float*>(&this->pos_variance[0]), 60);
-    unpack_float_array(4, buffer, reinterpret_cast<float*>(&this->q[0]), 72);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->roll_rate), 88);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pitch_rate), 92);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->yaw_rate), 96);
- return 100;
+    return MavLinkCodec<MavLinkControlSystemState>::unpack(buffer, *this);
 }
 
 std::string MavLinkControlSystemState::toJSon() {
@@ -4252,30 +2789,14 @@ std::string MavLinkControlSystemState::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkBatteryStatus::kFields[];
+
 int MavLinkBatteryStatus::pack(char* buffer) const {
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->current_consumed), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->energy_consumed), 4);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->temperature), 8);
-    pack_uint16_t_array(10, buffer, reinterpret_cast<const uint16_t*>(&this->voltages[0]), 10);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->current_battery), 30);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->id), 32);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->battery_function), 33);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->type), 34);
-    pack_int8_t(buffer, reinterpret_cast<const int8_t*>(&this->battery_remaining), 35);
-    return 36;
+    return MavLinkCodec<MavLinkBatteryStatus>::pack(*this, buffer);
 }
 
 int MavLinkBatteryStatus::unpack(const char* buffer) {
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->current_consumed), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->energy_consumed), 4);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->temperature), 8);
-    unpack_uint16_t_array(10, buffer, reinterpret_cast<uint16_t*>(&this->voltages[0]), 10);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->current_battery), 30);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->id), 32);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->battery_function), 33);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->type), 34);
-    unpack_int8_t(buffer, reinterpret_cast<int8_t*>(&this->battery_remaining), 35);
- return 36;
+    return MavLinkCodec<MavLinkBatteryStatus>::unpack(buffer, *this);
 }
 
 std::string MavLinkBatteryStatus::toJSon() {
@@ -4294,34 +2815,14 @@ std::string MavLinkBatteryStatus::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkAutopilotVersion::kFields[];
+
 int MavLinkAutopilotVersion::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->capabilities), 0);
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->uid), 8);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->flight_sw_version), 16);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->middleware_sw_version), 20);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->os_sw_version), 24);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->board_version), 28);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->vendor_id), 32);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->product_id), 34);
-    pack_uint8_t_array(8, buffer, reinterpret_cast<const uint8_t*>(&this->flight_custom_version[0]), 36);
-    pack_uint8_t_array(8, buffer, reinterpret_cast<const uint8_t*>(&this->middleware_custom_version[0]), 44);
-    pack_uint8_t_array(8, buffer, reinterpret_cast<const uint8_t*>(&this->os_custom_version[0]), 52);
-    return 60;
+    return MavLinkCodec<MavLinkAutopilotVersion>::pack(*this, buffer);
 }
 
 int MavLinkAutopilotVersion::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->capabilities), 0);
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->uid), 8);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->flight_sw_version), 16);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->middleware_sw_version), 20);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->os_sw_version), 24);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->board_version), 28);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->vendor_id), 32);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->product_id), 34);
-    unpack_uint8_t_array(8, buffer, reinterpret_cast<uint8_t*>(&this->flight_custom_version[0]), 36);
-    unpack_uint8_t_array(8, buffer, reinterpret_cast<uint8_t*>(&this->middleware_custom_version[0]), 44);
-    unpack_uint8_t_array(8, buffer, reinterpret_cast<uint8_t*>(&this->os_custom_version[0]), 52);
- return 60;
+    return MavLinkCodec<MavLinkAutopilotVersion>::unpack(buffer, *this);
 }
 
 std::string MavLinkAutopilotVersion::toJSon() {
@@ -4342,28 +2843,14 @@ std::string MavLinkAutopilotVersion::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkLandingTarget::kFields[];
+
 int MavLinkLandingTarget::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->angle_x), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->angle_y), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->distance), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->size_x), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->size_y), 24);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_num), 28);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->frame), 29);
-    return 30;
+    return MavLinkCodec<MavLinkLandingTarget>::pack(*this, buffer);
 }
 
 int MavLinkLandingTarget::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->angle_x), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->angle_y), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->distance), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->size_x), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->size_y), 24);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_num), 28);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->frame), 29);
- return 30;
+    return MavLinkCodec<MavLinkLandingTarget>::unpack(buffer, *this);
 }
 
 std::string MavLinkLandingTarget::toJSon() {
@@ -4381,32 +2868,14 @@ std::string MavLinkLandingTarget::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkEstimatorStatus::kFields[];
+
 int MavLinkEstimatorStatus::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vel_ratio), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pos_horiz_ratio), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pos_vert_ratio), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->mag_ratio), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->hagl_ratio), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->tas_ratio), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pos_horiz_accuracy), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->pos_vert_accuracy), 36);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->flags), 40);
-    return 42;
+    return MavLinkCodec<MavLinkEstimatorStatus>::pack(*this, buffer);
 }
 
 int MavLinkEstimatorStatus::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vel_ratio), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pos_horiz_ratio), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pos_vert_ratio), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->mag_ratio), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->hagl_ratio), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->tas_ratio), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pos_horiz_accuracy), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->pos_vert_accuracy), 36);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->flags), 40);
- return 42;
+    return MavLinkCodec<MavLinkEstimatorStatus>::unpack(buffer, *this);
 }
 
 std::string MavLinkEstimatorStatus::toJSon() {
@@ -4426,30 +2895,14 @@ std::string MavLinkEstimatorStatus::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkWindCov::kFields[];
+
 int MavLinkWindCov::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->wind_x), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->wind_y), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->wind_z), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->var_horiz), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->var_vert), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->wind_alt), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->horiz_accuracy), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vert_accuracy), 36);
-    return 40;
+    return MavLinkCodec<MavLinkWindCov>::pack(*this, buffer);
 }
 
 int MavLinkWindCov::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->wind_x), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->wind_y), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->wind_z), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->var_horiz), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->var_vert), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->wind_alt), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->horiz_accuracy), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vert_accuracy), 36);
- return 40;
+    return MavLinkCodec<MavLinkWindCov>::unpack(buffer, *this);
 }
 
 std::string MavLinkWindCov::toJSon() {
@@ -4468,48 +2921,14 @@ std::string MavLinkWindCov::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkGpsInput::kFields[];
+
 int MavLinkGpsInput::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_week_ms), 8);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 12);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->alt), 20);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->hdop), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vdop), 28);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vn), 32);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->ve), 36);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vd), 40);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->speed_accuracy), 44);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->horiz_accuracy), 48);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vert_accuracy), 52);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->ignore_flags), 56);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->time_week), 58);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->gps_id), 60);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->fix_type), 61);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->satellites_visible), 62);
-    return 63;
+    return MavLinkCodec<MavLinkGpsInput>::pack(*this, buffer);
 }
 
 int MavLinkGpsInput::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_week_ms), 8);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 12);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->alt), 20);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->hdop), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vdop), 28);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vn), 32);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->ve), 36);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vd), 40);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->speed_accuracy), 44);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->horiz_accuracy), 48);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vert_accuracy), 52);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->ignore_flags), 56);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->time_week), 58);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->gps_id), 60);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->fix_type), 61);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->satellites_visible), 62);
- return 63;
+    return MavLinkCodec<MavLinkGpsInput>::unpack(buffer, *this);
 }
 
 std::string MavLinkGpsInput::toJSon() {
@@ -4537,18 +2956,14 @@ std::string MavLinkGpsInput::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkGpsRtcmData::kFields[];
+
 int MavLinkGpsRtcmData::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->flags), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->len), 1);
-    pack_uint8_t_array(180, buffer, reinterpret_cast<const uint8_t*>(&this->data[0]), 2);
-    return 182;
+    return MavLinkCodec<MavLinkGpsRtcmData>::pack(*this, buffer);
 }
 
 int MavLinkGpsRtcmData::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->flags), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->len), 1);
-    unpack_uint8_t_array(180, buffer, reinterpret_cast<uint8_t*>(&this->data[0]), 2);
- return 182;
+    return MavLinkCodec<MavLinkGpsRtcmData>::unpack(buffer, *this);
 }
 
 std::string MavLinkGpsRtcmData::toJSon() {
@@ -4561,68 +2976,14 @@ std::string MavLinkGpsRtcmData::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkHighLatency::kFields[];
+
 int MavLinkHighLatency::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->custom_mode), 8);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->latitude), 12);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->longitude), 16);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->roll), 20);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->pitch), 22);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->heading), 24);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->roll_sp), 26);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->pitch_sp), 28);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->heading_sp), 30);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->altitude_home), 32);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->altitude_amsl), 34);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->altitude_sp), 36);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->wp_distance), 38);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->base_mode), 40);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->landed_state), 41);
-    pack_int8_t(buffer, reinterpret_cast<const int8_t*>(&this->throttle), 42);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->airspeed), 43);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->airspeed_sp), 44);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->groundspeed), 45);
-    pack_int8_t(buffer, reinterpret_cast<const int8_t*>(&this->climb_rate), 46);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->gps_nsat), 47);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->gps_fix_type), 48);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->battery_remaining), 49);
-    pack_int8_t(buffer, reinterpret_cast<const int8_t*>(&this->temperature), 50);
-    pack_int8_t(buffer, reinterpret_cast<const int8_t*>(&this->temperature_air), 51);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->failsafe), 52);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->wp_num), 53);
-    return 54;
+    return MavLinkCodec<MavLinkHighLatency>::pack(*this, buffer);
 }
 
 int MavLinkHighLatency::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->custom_mode), 8);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->latitude), 12);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->longitude), 16);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->roll), 20);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->pitch), 22);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->heading), 24);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->roll_sp), 26);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->pitch_sp), 28);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->heading_sp), 30);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->altitude_home), 32);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->altitude_amsl), 34);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->altitude_sp), 36);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->wp_distance), 38);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->base_mode), 40);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->landed_state), 41);
-    unpack_int8_t(buffer, reinterpret_cast<int8_t*>(&this->throttle), 42);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->airspeed), 43);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->airspeed_sp), 44);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->groundspeed), 45);
-    unpack_int8_t(buffer, reinterpret_cast<int8_t*>(&this->climb_rate), 46);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->gps_nsat), 47);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->gps_fix_type), 48);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->battery_remaining), 49);
-    unpack_int8_t(buffer, reinterpret_cast<int8_t*>(&this->temperature), 50);
-    unpack_int8_t(buffer, reinterpret_cast<int8_t*>(&this->temperature_air), 51);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->failsafe), 52);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->wp_num), 53);
- return 54;
+    return MavLinkCodec<MavLinkHighLatency>::unpack(buffer, *this);
 }
 
 std::string MavLinkHighLatency::toJSon() {
@@ -4660,26 +3021,14 @@ std::string MavLinkHighLatency::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkVibration::kFields[];
+
 int MavLinkVibration::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vibration_x), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vibration_y), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->vibration_z), 16);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->clipping_0), 20);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->clipping_1), 24);
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->clipping_2), 28);
-    return 32;
+    return MavLinkCodec<MavLinkVibration>::pack(*this, buffer);
 }
 
 int MavLinkVibration::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vibration_x), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vibration_y), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->vibration_z), 16);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->clipping_0), 20);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->clipping_1), 24);
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->clipping_2), 28);
- return 32;
+    return MavLinkCodec<MavLinkVibration>::unpack(buffer, *this);
 }
 
 std::string MavLinkVibration::toJSon() {
@@ -4696,32 +3045,14 @@ std::string MavLinkVibration::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkHomePosition::kFields[];
+
 int MavLinkHomePosition::pack(char* buffer) const {
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->latitude), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->longitude), 4);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->altitude), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 20);
-    pack_float_array(4, buffer, reinterpret_cast<const float*>(&this->q[0]), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->approach_x), 40);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->approach_y), 44);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->approach_z), 48);
-    return 52;
+    return MavLinkCodec<MavLinkHomePosition>::pack(*this, buffer);
 }
 
 int MavLinkHomePosition::unpack(const char* buffer) {
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->latitude), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->longitude), 4);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->altitude), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 20);
-    unpack_float_array(4, buffer, reinterpret_cast<float*>(&this->q[0]), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->approach_x), 40);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->approach_y), 44);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->approach_z), 48);
- return 52;
+    return MavLinkCodec<MavLinkHomePosition>::unpack(buffer, *this);
 }
 
 std::string MavLinkHomePosition::toJSon() {
@@ -4741,34 +3072,14 @@ std::string MavLinkHomePosition::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkSetHomePosition::kFields[];
+
 int MavLinkSetHomePosition::pack(char* buffer) const {
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->latitude), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->longitude), 4);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->altitude), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 16);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 20);
-    pack_float_array(4, buffer, reinterpret_cast<const float*>(&this->q[0]), 24);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->approach_x), 40);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->approach_y), 44);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->approach_z), 48);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 52);
-    return 53;
+    return MavLinkCodec<MavLinkSetHomePosition>::pack(*this, buffer);
 }
 
 int MavLinkSetHomePosition::unpack(const char* buffer) {
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->latitude), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->longitude), 4);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->altitude), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 16);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 20);
-    unpack_float_array(4, buffer, reinterpret_cast<float*>(&this->q[0]), 24);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->approach_x), 40);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->approach_y), 44);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->approach_z), 48);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 52);
- return 53;
+    return MavLinkCodec<MavLinkSetHomePosition>::unpack(buffer, *this);
 }
 
 std::string MavLinkSetHomePosition::toJSon() {
@@ -4789,16 +3100,14 @@ std::string MavLinkSetHomePosition::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMessageInterval::kFields[];
+
 int MavLinkMessageInterval::pack(char* buffer) const {
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->interval_us), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->message_id), 4);
-    return 6;
+    return MavLinkCodec<MavLinkMessageInterval>::pack(*this, buffer);
 }
 
 int MavLinkMessageInterval::unpack(const char* buffer) {
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->interval_us), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->message_id), 4);
- return 6;
+    return MavLinkCodec<MavLinkMessageInterval>::unpack(buffer, *this);
 }
 
 std::string MavLinkMessageInterval::toJSon() {
@@ -4810,16 +3119,14 @@ std::string MavLinkMessageInterval::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkExtendedSysState::kFields[];
+
 int MavLinkExtendedSysState::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->vtol_state), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->landed_state), 1);
-    return 2;
+    return MavLinkCodec<MavLinkExtendedSysState>::pack(*this, buffer);
 }
 
 int MavLinkExtendedSysState::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->vtol_state), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->landed_state), 1);
- return 2;
+    return MavLinkCodec<MavLinkExtendedSysState>::unpack(buffer, *this);
 }
 
 std::string MavLinkExtendedSysState::toJSon() {
@@ -4831,38 +3138,14 @@ std::string MavLinkExtendedSysState::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkAdsbVehicle::kFields[];
+
 int MavLinkAdsbVehicle::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->ICAO_address), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lat), 4);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->lon), 8);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->altitude), 12);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->heading), 16);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->hor_velocity), 18);
-    pack_int16_t(buffer, reinterpret_cast<const int16_t*>(&this->ver_velocity), 20);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->flags), 22);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->squawk), 24);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->altitude_type), 26);
-    pack_char_array(9, buffer, reinterpret_cast<const char*>(&this->callsign[0]), 27);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->emitter_type), 36);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->tslc), 37);
-    return 38;
+    return MavLinkCodec<MavLinkAdsbVehicle>::pack(*this, buffer);
 }
 
 int MavLinkAdsbVehicle::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->ICAO_address), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lat), 4);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->lon), 8);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->altitude), 12);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->heading), 16);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->hor_velocity), 18);
-    unpack_int16_t(buffer, reinterpret_cast<int16_t*>(&this->ver_velocity), 20);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->flags), 22);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->squawk), 24);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->altitude_type), 26);
-    unpack_char_array(9, buffer, reinterpret_cast<char*>(&this->callsign[0]), 27);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->emitter_type), 36);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->tslc), 37);
- return 38;
+    return MavLinkCodec<MavLinkAdsbVehicle>::unpack(buffer, *this);
 }
 
 std::string MavLinkAdsbVehicle::toJSon() {
@@ -4885,26 +3168,14 @@ std::string MavLinkAdsbVehicle::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkCollision::kFields[];
+
 int MavLinkCollision::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->id), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->time_to_minimum_delta), 4);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->altitude_minimum_delta), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->horizontal_minimum_delta), 12);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->src), 16);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->action), 17);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->threat_level), 18);
-    return 19;
+    return MavLinkCodec<MavLinkCollision>::pack(*this, buffer);
 }
 
 int MavLinkCollision::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->id), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->time_to_minimum_delta), 4);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->altitude_minimum_delta), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->horizontal_minimum_delta), 12);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->src), 16);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->action), 17);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->threat_level), 18);
- return 19;
+    return MavLinkCodec<MavLinkCollision>::unpack(buffer, *this);
 }
 
 std::string MavLinkCollision::toJSon() {
@@ -4921,22 +3192,14 @@ std::string MavLinkCollision::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkV2Extension::kFields[];
+
 int MavLinkV2Extension::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->message_type), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_network), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_system), 3);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->target_component), 4);
-    pack_uint8_t_array(249, buffer, reinterpret_cast<const uint8_t*>(&this->payload[0]), 5);
-    return 254;
+    return MavLinkCodec<MavLinkV2Extension>::pack(*this, buffer);
 }
 
 int MavLinkV2Extension::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->message_type), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_network), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_system), 3);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->target_component), 4);
-    unpack_uint8_t_array(249, buffer, reinterpret_cast<uint8_t*>(&this->payload[0]), 5);
- return 254;
+    return MavLinkCodec<MavLinkV2Extension>::unpack(buffer, *this);
 }
 
 std::string MavLinkV2Extension::toJSon() {
@@ -4951,20 +3214,14 @@ std::string MavLinkV2Extension::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkMemoryVect::kFields[];
+
 int MavLinkMemoryVect::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->address), 0);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->ver), 2);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->type), 3);
-    pack_int8_t_array(32, buffer, reinterpret_cast<const int8_t*>(&this->value[0]), 4);
-    return 36;
+    return MavLinkCodec<MavLinkMemoryVect>::pack(*this, buffer);
 }
 
 int MavLinkMemoryVect::unpack(const char* buffer) {
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->address), 0);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->ver), 2);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->type), 3);
-    unpack_int8_t_array(32, buffer, reinterpret_cast<int8_t*>(&this->value[0]), 4);
- return 36;
+    return MavLinkCodec<MavLinkMemoryVect>::unpack(buffer, *this);
 }
 
 std::string MavLinkMemoryVect::toJSon() {
@@ -4978,22 +3235,14 @@ std::string MavLinkMemoryVect::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkDebugVect::kFields[];
+
 int MavLinkDebugVect::pack(char* buffer) const {
-    pack_uint64_t(buffer, reinterpret_cast<const uint64_t*>(&this->time_usec), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->x), 8);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->y), 12);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->z), 16);
-    pack_char_array(10, buffer, reinterpret_cast<const char*>(&this->name[0]), 20);
-    return 30;
+    return MavLinkCodec<MavLinkDebugVect>::pack(*this, buffer);
 }
 
 int MavLinkDebugVect::unpack(const char* buffer) {
-    unpack_uint64_t(buffer, reinterpret_cast<uint64_t*>(&this->time_usec), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->x), 8);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->y), 12);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->z), 16);
-    unpack_char_array(10, buffer, reinterpret_cast<char*>(&this->name[0]), 20);
- return 30;
+    return MavLinkCodec<MavLinkDebugVect>::unpack(buffer, *this);
 }
 
 std::string MavLinkDebugVect::toJSon() {
@@ -5008,18 +3257,14 @@ std::string MavLinkDebugVect::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkNamedValueFloat::kFields[];
+
 int MavLinkNamedValueFloat::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->value), 4);
-    pack_char_array(10, buffer, reinterpret_cast<const char*>(&this->name[0]), 8);
-    return 18;
+    return MavLinkCodec<MavLinkNamedValueFloat>::pack(*this, buffer);
 }
 
 int MavLinkNamedValueFloat::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->value), 4);
-    unpack_char_array(10, buffer, reinterpret_cast<char*>(&this->name[0]), 8);
- return 18;
+    return MavLinkCodec<MavLinkNamedValueFloat>::unpack(buffer, *this);
 }
 
 std::string MavLinkNamedValueFloat::toJSon() {
@@ -5032,18 +3277,14 @@ std::string MavLinkNamedValueFloat::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkNamedValueInt::kFields[];
+
 int MavLinkNamedValueInt::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_int32_t(buffer, reinterpret_cast<const int32_t*>(&this->value), 4);
-    pack_char_array(10, buffer, reinterpret_cast<const char*>(&this->name[0]), 8);
-    return 18;
+    return MavLinkCodec<MavLinkNamedValueInt>::pack(*this, buffer);
 }
 
 int MavLinkNamedValueInt::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_int32_t(buffer, reinterpret_cast<int32_t*>(&this->value), 4);
-    unpack_char_array(10, buffer, reinterpret_cast<char*>(&this->name[0]), 8);
- return 18;
+    return MavLinkCodec<MavLinkNamedValueInt>::unpack(buffer, *this);
 }
 
 std::string MavLinkNamedValueInt::toJSon() {
@@ -5056,16 +3297,14 @@ std::string MavLinkNamedValueInt::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkStatustext::kFields[];
+
 int MavLinkStatustext::pack(char* buffer) const {
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->severity), 0);
-    pack_char_array(50, buffer, reinterpret_cast<const char*>(&this->text[0]), 1);
-    return 51;
+    return MavLinkCodec<MavLinkStatustext>::pack(*this, buffer);
 }
 
 int MavLinkStatustext::unpack(const char* buffer) {
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->severity), 0);
-    unpack_char_array(50, buffer, reinterpret_cast<char*>(&this->text[0]), 1);
- return 51;
+    return MavLinkCodec<MavLinkStatustext>::unpack(buffer, *this);
 }
 
 std::string MavLinkStatustext::toJSon() {
@@ -5077,18 +3316,14 @@ std::string MavLinkStatustext::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkDebug::kFields[];
+
 int MavLinkDebug::pack(char* buffer) const {
-    pack_uint32_t(buffer, reinterpret_cast<const uint32_t*>(&this->time_boot_ms), 0);
-    pack_float(buffer, reinterpret_cast<const float*>(&this->value), 4);
-    pack_uint8_t(buffer, reinterpret_cast<const uint8_t*>(&this->ind), 8);
-    return 9;
+    return MavLinkCodec<MavLinkDebug>::pack(*this, buffer);
 }
 
 int MavLinkDebug::unpack(const char* buffer) {
-    unpack_uint32_t(buffer, reinterpret_cast<uint32_t*>(&this->time_boot_ms), 0);
-    unpack_float(buffer, reinterpret_cast<float*>(&this->value), 4);
-    unpack_uint8_t(buffer, reinterpret_cast<uint8_t*>(&this->ind), 8);
- return 9;
+    return MavLinkCodec<MavLinkDebug>::unpack(buffer, *this);
 }
 
 std::string MavLinkDebug::toJSon() {
@@ -5101,22 +3336,13 @@ std::string MavLinkDebug::toJSon() {
  return ss.str();
 }
 
+constexpr MavLinkField MavLinkProtocolVersion::kFields[];
+
 int MavLinkProtocolVersion::pack(char* buffer) const {
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->version), 0);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->min_version), 2);
-    pack_uint16_t(buffer, reinterpret_cast<const uint16_t*>(&this->max_version), 4);
-    pack_uint8_t_array(8, buffer, reinterpret_cast<const uint8_t*>(&this->spec_version_hash[0]), 6);
-    pack_uint8_t_array(8, buffer, reinterpret_cast<const uint8_t*>(&this->library_version_hash[0]), 14);
-    return 22;
+    return MavLinkCodec<MavLinkProtocolVersion>::pack(*this, buffer);
 }
 int MavLinkProtocolVersion::unpack(const char* buffer) {
-
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->version), 0);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->min_version), 2);
-    unpack_uint16_t(buffer, reinterpret_cast<uint16_t*>(&this->max_version), 4);
-    unpack_uint8_t_array(8, buffer, reinterpret_cast<uint8_t*>(&this->spec_version_hash[0]), 6);
-    unpack_uint8_t_array(8, buffer, reinterpret_cast<uint8_t*>(&this->library_version_hash[0]), 14);
-    return 22;
+    return MavLinkCodec<MavLinkProtocolVersion>::unpack(buffer, *this);
 }
 
 std::string MavLinkProtocolVersion::toJSon() {
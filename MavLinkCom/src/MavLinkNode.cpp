@@ -45,6 +45,16 @@ std::vector<MavLinkParameter> MavLinkNode::getParamList()
 	return pImpl->getParamList();
 }
 
+void MavLinkNode::setParamCacheFolder(const std::string& folder)
+{
+	pImpl->setParamCacheFolder(folder);
+}
+
+std::vector<MavLinkParameter> MavLinkNode::getParameters(const std::vector<std::string>& names)
+{
+	return pImpl->getParameters(names);
+}
+
 MavLinkParameter MavLinkNode::getCachedParameter(const std::string& name)
 {
 	return pImpl->getCachedParameter(name);
@@ -108,6 +118,11 @@ void MavLinkNode::sendMessage(MavLinkMessage& msg)
 	pImpl->sendMessage(msg);
 }
 
+void MavLinkNode::sendMessages(std::vector<MavLinkMessage>& messages)
+{
+	pImpl->sendMessages(messages);
+}
+
 // send a command to the remote node
 void MavLinkNode::sendCommand(MavLinkCommand& cmd)
 {
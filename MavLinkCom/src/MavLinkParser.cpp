@@ -0,0 +1,53 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "MavLinkParser.hpp"
+#include "impl/MavLinkParserImpl.hpp"
+#include <cstring>
+
+using namespace mavlinkcom;
+using namespace mavlinkcom_impl;
+
+MavLinkParser::MavLinkParser()
+{
+    pImpl.reset(new MavLinkParserImpl());
+}
+
+MavLinkParser::~MavLinkParser()
+{
+    pImpl = nullptr;
+}
+
+void MavLinkParser::setFastPath(bool enabled)
+{
+    pImpl->setFastPath(enabled);
+}
+
+int MavLinkParser::parse(const uint8_t* buffer, int count, const MessageHandler& handler)
+{
+    int messages = 0;
+    pImpl->parse(buffer, count, [&](uint8_t frameState, const mavlink_message_t& msg) {
+        if (frameState != MAVLINK_FRAMING_OK) {
+            crc_errors_++;
+            return;
+        }
+        message_.compid = msg.compid;
+        message_.sysid = msg.sysid;
+        message_.len = msg.len;
+        message_.checksum = msg.checksum;
+        message_.magic = msg.magic;
+        message_.incompat_flags = msg.incompat_flags;
+        message_.compat_flags = msg.compat_flags;
+        message_.seq = msg.seq;
+        message_.msgid = msg.msgid;
+        message_.protocol_version = msg.magic == MAVLINK_STX_MAVLINK1 ? 1 : 2;
+        ::memcpy(message_.ck, msg.ck, 2);
+        ::memcpy(message_.signature, msg.signature, 13);
+        // zero the rest so the message doesn't depend on what was parsed before.
+        ::memcpy(message_.payload64, msg.payload64, msg.len);
+        ::memset(reinterpret_cast<uint8_t*>(message_.payload64) + msg.len, 0, sizeof(message_.payload64) - msg.len);
+        messages++;
+        handler(message_);
+    });
+    return messages;
+}
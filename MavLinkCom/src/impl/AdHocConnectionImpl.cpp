@@ -99,6 +99,16 @@ void AdHocConnectionImpl::startListening(std::shared_ptr<AdHocConnection> parent
     closed = false;
     port = connectedPort;
 
+    // with the event loop enabled the port is read by a shared loop thread instead of our own threads.
+    std::shared_ptr<EventLoop> eventLoop = EventLoop::getShared();
+    if (eventLoop != nullptr && connectedPort->getReadHandle() >= 0) {
+        reader_id_ = eventLoop->addReader(connectedPort->getReadHandle(), [this]() { readAvailable(); }, [this]() { readerClosed(); });
+        if (reader_id_ >= 0) {
+            event_loop_ = eventLoop;
+            return;
+        }
+    }
+
     Utils::cleanupThread(read_thread);
     read_thread = std::thread{ &AdHocConnectionImpl::readPackets, this };
     Utils::cleanupThread(publish_thread_);
@@ -108,6 +118,12 @@ void AdHocConnectionImpl::startListening(std::shared_ptr<AdHocConnection> parent
 void AdHocConnectionImpl::close()
 {
     closed = true;
+    if (event_loop_ != nullptr) {
+        // after this returns readAvailable is not running and won't be called again.
+        event_loop_->removeReader(reader_id_);
+        reader_id_ = -1;
+        event_loop_ = nullptr;
+    }
     if (port != nullptr) {
         port->close();
         port = nullptr;
@@ -245,29 +261,66 @@ void AdHocConnectionImpl::drainQueue()
         }
         // publish the message from this thread, this is safer than publishing from the readPackets thread
         // as it ensures we don't lose messages if the listener is slow.
-        if (snapshot_stale) {
-            // this is tricky, the clear has to be done outside the lock because it is destructing the handlers
-            // and the handler might try and call unsubscribe, which needs to be able to grab the lock, otherwise
-            // we would get a deadlock.
-            snapshot.clear();
-
-            std::lock_guard<std::mutex> guard(listener_mutex);
-            snapshot = listeners;
-            snapshot_stale = false;
+        publishMessage(std::shared_ptr<AdHocConnection>(this->con_), message);
+    }
+}
+
+void AdHocConnectionImpl::readAvailable()
+{
+    // called on an event loop thread when the port has data, instead of readPackets and publishPackets.
+    std::shared_ptr<Port> safePort = this->port;
+    std::shared_ptr<AdHocConnection> sharedPtr = this->con_;
+    if (safePort == nullptr || sharedPtr == nullptr || closed) {
+        return;
+    }
+
+    const int MAXBUFFER = 512;
+    uint8_t buffer[MAXBUFFER];
+    // read a bounded amount so one busy port can't starve the others on this loop thread.
+    const int maxReads = 16;
+    for (int i = 0; i < maxReads && !closed; i++)
+    {
+        int count = safePort->readNonBlocking(buffer, MAXBUFFER);
+        if (count <= 0) {
+            break;
         }
-        auto end = snapshot.end();
+        std::vector<uint8_t> message(buffer, buffer + count);
+        publishMessage(sharedPtr, message);
+    }
+}
 
-        auto startTime = std::chrono::system_clock::now();
-        std::shared_ptr<AdHocConnection> sharedPtr = std::shared_ptr<AdHocConnection>(this->con_);
-        for (auto ptr = snapshot.begin(); ptr != end; ptr++)
-        {
-            try {
-                (*ptr).handler(sharedPtr, message);
-            }
-            catch (std::exception& e) {
-                Utils::log(Utils::stringf("AdHocConnectionImpl: Error handling message on connection '%s', details: %s",
-                    name.c_str(), e.what()), Utils::kLogLevelError);
-            }
+void AdHocConnectionImpl::readerClosed()
+{
+    // the event loop has stopped reading the port because the other side hung up or the handle failed,
+    // report it like a closed connection so senders stop and the owner can close or reconnect.
+    if (!closed) {
+        closed = true;
+        Utils::log(Utils::stringf("AdHocConnectionImpl: port of connection '%s' was closed by the other side", name.c_str()), Utils::kLogLevelError);
+    }
+}
+
+void AdHocConnectionImpl::publishMessage(const std::shared_ptr<AdHocConnection>& sharedPtr, const std::vector<uint8_t>& message)
+{
+    if (snapshot_stale) {
+        // this is tricky, the clear has to be done outside the lock because it is destructing the handlers
+        // and the handler might try and call unsubscribe, which needs to be able to grab the lock, otherwise
+        // we would get a deadlock.
+        snapshot.clear();
+
+        std::lock_guard<std::mutex> guard(listener_mutex);
+        snapshot = listeners;
+        snapshot_stale = false;
+    }
+    auto end = snapshot.end();
+
+    for (auto ptr = snapshot.begin(); ptr != end; ptr++)
+    {
+        try {
+            (*ptr).handler(sharedPtr, message);
+        }
+        catch (std::exception& e) {
+            Utils::log(Utils::stringf("AdHocConnectionImpl: Error handling message on connection '%s', details: %s",
+                name.c_str(), e.what()), Utils::kLogLevelError);
         }
     }
 }
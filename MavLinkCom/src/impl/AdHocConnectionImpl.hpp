@@ -13,6 +13,7 @@
 #include "AdHocConnection.hpp"
 //#include "MavLinkMessageBase.hpp"
 #include "Semaphore.hpp"
+#include "EventLoop.hpp"
 #include "../serial_com/TcpClientPort.hpp"
 #include "StrictMode.hpp"
 #define MAVLINK_PACKED
@@ -53,6 +54,9 @@ namespace mavlinkcom_impl {
         void publishPackets();
         void readPackets();
         void drainQueue();
+        void readAvailable();
+        void readerClosed();
+        void publishMessage(const std::shared_ptr<AdHocConnection>& sharedPtr, const std::vector<uint8_t>& message);
         std::string name;
         std::shared_ptr<Port> port;
         std::shared_ptr<AdHocConnection> con_;
@@ -77,6 +81,9 @@ namespace mavlinkcom_impl {
         std::mutex msg_queue_mutex_;
         mavlink_utils::Semaphore msg_available_;
         bool waiting_for_msg_ = false;
+        // set instead of the reader and publisher threads when the port is served by the shared event loop.
+        std::shared_ptr<EventLoop> event_loop_;
+        int reader_id_ = -1;
         bool supports_mavlink2_ = false;
         bool signing_ = false;
         mavlink_status_t mavlink_intermediate_status_;
@@ -0,0 +1,362 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "EventLoop.hpp"
+#include "Utils.hpp"
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <unordered_map>
+#include <condition_variable>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include <errno.h>
+#endif
+
+using namespace mavlink_utils;
+using namespace mavlinkcom_impl;
+
+std::mutex EventLoop::shared_mutex_;
+std::shared_ptr<EventLoop> EventLoop::shared_;
+
+#ifdef __linux__
+
+class EventLoop::Loop
+{
+public:
+    Loop()
+    {
+        epoll_fd_ = epoll_create1(EPOLL_CLOEXEC);
+        wake_fd_ = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (epoll_fd_ < 0 || wake_fd_ < 0) {
+            throw std::runtime_error(Utils::stringf("EventLoop could not create epoll instance, error=%d", errno));
+        }
+        epoll_event ev = {};
+        ev.events = EPOLLIN;
+        ev.data.u64 = 0;
+        epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wake_fd_, &ev);
+
+        running_ = true;
+        thread_ = std::thread{ &Loop::run, this };
+    }
+
+    ~Loop()
+    {
+        running_ = false;
+        wake();
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        ::close(wake_fd_);
+        ::close(epoll_fd_);
+    }
+
+    bool addReader(int id, int handle, const Callback& onReadable, const Callback& onClosed)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        epoll_event ev = {};
+        ev.events = EPOLLIN | EPOLLRDHUP;
+        ev.data.u64 = static_cast<uint64_t>(id);
+        if (epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, handle, &ev) != 0) {
+            return false;
+        }
+        readers_[id] = Reader{ handle, std::make_shared<Callback>(onReadable),
+            onClosed ? std::make_shared<Callback>(onClosed) : nullptr };
+        return true;
+    }
+
+    void removeReader(int id)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto it = readers_.find(id);
+        if (it != readers_.end()) {
+            epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, it->second.handle, nullptr);
+            readers_.erase(it);
+        }
+        waitUntilIdle(lock, id);
+    }
+
+    void addTimer(int id, int periodMilliseconds, const Callback& callback)
+    {
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            std::chrono::milliseconds period(periodMilliseconds);
+            timers_[id] = Timer{ std::chrono::steady_clock::now() + period, period, std::make_shared<Callback>(callback) };
+        }
+        // loop may be sleeping with a longer timeout.
+        wake();
+    }
+
+    void removeTimer(int id)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        timers_.erase(id);
+        waitUntilIdle(lock, id);
+    }
+
+private:
+    struct Reader {
+        int handle;
+        std::shared_ptr<Callback> onReadable;
+        std::shared_ptr<Callback> onClosed;
+    };
+    struct Timer {
+        std::chrono::steady_clock::time_point next;
+        std::chrono::milliseconds period;
+        std::shared_ptr<Callback> callback;
+    };
+
+    void wake()
+    {
+        uint64_t one = 1;
+        ssize_t rc = ::write(wake_fd_, &one, sizeof(one));
+        unused(rc);
+    }
+
+    // callbacks run without mutex_ held so they can add and remove readers and timers on this or any
+    // other loop, removing one that is running waits here instead, except on its own loop thread.
+    void waitUntilIdle(std::unique_lock<std::mutex>& lock, int id)
+    {
+        if (std::this_thread::get_id() != thread_.get_id()) {
+            idle_.wait(lock, [this, id]() { return running_id_ != id; });
+        }
+    }
+
+    void invoke(int id, const std::shared_ptr<Callback>& callback)
+    {
+        // mutex_ is held by the caller, callback is held by shared_ptr so it can remove itself while running.
+        running_id_ = id;
+        mutex_.unlock();
+        try {
+            (*callback)();
+        }
+        catch (std::exception& e) {
+            Utils::log(Utils::stringf("EventLoop: Error in callback, details: %s", e.what()), Utils::kLogLevelError);
+        }
+        mutex_.lock();
+        running_id_ = 0;
+        idle_.notify_all();
+    }
+
+    int getTimeout()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (timers_.empty()) {
+            return -1;
+        }
+        auto next = std::chrono::steady_clock::time_point::max();
+        for (auto& pair : timers_) {
+            if (pair.second.next < next) {
+                next = pair.second.next;
+            }
+        }
+        auto now = std::chrono::steady_clock::now();
+        if (next <= now) {
+            return 0;
+        }
+        // round up so we don't wake up just before the deadline and spin.
+        return static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(next - now).count()) + 1;
+    }
+
+    void runTimers()
+    {
+        auto now = std::chrono::steady_clock::now();
+        due_timers_.clear();
+        for (auto& pair : timers_) {
+            if (pair.second.next <= now) {
+                due_timers_.push_back(pair.first);
+            }
+        }
+        for (int id : due_timers_) {
+            auto it = timers_.find(id);
+            if (it == timers_.end()) {
+                // removed by an earlier callback.
+                continue;
+            }
+            Timer& timer = it->second;
+            timer.next += timer.period;
+            if (timer.next <= now) {
+                // we fell behind, don't try to catch up with a burst of calls.
+                timer.next = now + timer.period;
+            }
+            std::shared_ptr<Callback> callback = timer.callback;
+            invoke(id, callback);
+        }
+    }
+
+    void run()
+    {
+        const int maxEvents = 64;
+        epoll_event events[maxEvents];
+        while (running_) {
+            int count = epoll_wait(epoll_fd_, events, maxEvents, getTimeout());
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                Utils::log(Utils::stringf("EventLoop: epoll_wait failed, error=%d", errno), Utils::kLogLevelError);
+                break;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            for (int i = 0; i < count; i++) {
+                int id = static_cast<int>(events[i].data.u64);
+                if (id == 0) {
+                    uint64_t value;
+                    ssize_t rc = ::read(wake_fd_, &value, sizeof(value));
+                    unused(rc);
+                    continue;
+                }
+                auto it = readers_.find(id);
+                if (it == readers_.end()) {
+                    // removed by an earlier callback in this batch.
+                    continue;
+                }
+                std::shared_ptr<Callback> onReadable = it->second.onReadable;
+                std::shared_ptr<Callback> onClosed;
+                bool hangup = (events[i].events & (EPOLLHUP | EPOLLRDHUP | EPOLLERR)) != 0;
+                if (hangup) {
+                    // other side is gone or the handle failed, stop watching or level triggered epoll would keep
+                    // reporting it, then let the owner drain what is left and find out the handle is done.
+                    onClosed = it->second.onClosed;
+                    epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, it->second.handle, nullptr);
+                    readers_.erase(it);
+                }
+                invoke(id, onReadable);
+                if (hangup) {
+                    if (onClosed != nullptr) {
+                        invoke(id, onClosed);
+                    }
+                    else {
+                        Utils::log(Utils::stringf("EventLoop: reader %d was closed, events=0x%x", id, events[i].events), Utils::kLogLevelWarn);
+                    }
+                }
+            }
+            runTimers();
+        }
+    }
+
+private:
+    int epoll_fd_ = -1;
+    int wake_fd_ = -1;
+    std::thread thread_;
+    std::atomic<bool> running_;
+    std::mutex mutex_;
+    std::condition_variable idle_;
+    int running_id_ = 0;
+    std::unordered_map<int, Reader> readers_;
+    std::unordered_map<int, Timer> timers_;
+    std::vector<int> due_timers_;
+};
+
+bool EventLoop::isSupported()
+{
+    return true;
+}
+
+#else
+
+// placeholder so EventLoop compiles everywhere, configure() refuses to enable it.
+class EventLoop::Loop
+{
+public:
+    bool addReader(int, int, const Callback&, const Callback&) { return false; }
+    void removeReader(int) {}
+    void addTimer(int, int, const Callback&) {}
+    void removeTimer(int) {}
+};
+
+bool EventLoop::isSupported()
+{
+    return false;
+}
+
+#endif
+
+bool EventLoop::configure(int threadCount)
+{
+    if (threadCount > 0 && !isSupported()) {
+        return false;
+    }
+    std::shared_ptr<EventLoop> pool = threadCount > 0 ? std::make_shared<EventLoop>(threadCount) : nullptr;
+
+    std::lock_guard<std::mutex> guard(shared_mutex_);
+    shared_ = pool;
+    return true;
+}
+
+std::shared_ptr<EventLoop> EventLoop::getShared()
+{
+    std::lock_guard<std::mutex> guard(shared_mutex_);
+    return shared_;
+}
+
+EventLoop::EventLoop(int threadCount)
+{
+    for (int i = 0; i < threadCount; i++) {
+        loops_.push_back(std::unique_ptr<Loop>(new Loop()));
+    }
+}
+
+EventLoop::~EventLoop()
+{
+    loops_.clear();
+}
+
+int EventLoop::getThreadCount()
+{
+    return static_cast<int>(loops_.size());
+}
+
+EventLoop::Loop* EventLoop::getLoop(int id)
+{
+    return loops_[id % loops_.size()].get();
+}
+
+int EventLoop::addReader(int handle, Callback onReadable, Callback onClosed)
+{
+    if (handle < 0 || loops_.size() == 0) {
+        return -1;
+    }
+    int id;
+    {
+        // ids are handed out round robin across loops.
+        std::lock_guard<std::mutex> guard(mutex_);
+        id = next_id_++;
+    }
+    if (!getLoop(id)->addReader(id, handle, onReadable, onClosed)) {
+        return -1;
+    }
+    return id;
+}
+
+void EventLoop::removeReader(int id)
+{
+    if (id > 0) {
+        getLoop(id)->removeReader(id);
+    }
+}
+
+int EventLoop::addTimer(int periodMilliseconds, Callback onTimer)
+{
+    if (loops_.size() == 0) {
+        return -1;
+    }
+    int id;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        id = next_id_++;
+    }
+    getLoop(id)->addTimer(id, periodMilliseconds, onTimer);
+    return id;
+}
+
+void EventLoop::removeTimer(int id)
+{
+    if (id > 0) {
+        getLoop(id)->removeTimer(id);
+    }
+}
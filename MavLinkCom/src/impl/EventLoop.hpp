@@ -0,0 +1,67 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef MavLinkCom_EventLoop_hpp
+#define MavLinkCom_EventLoop_hpp
+
+#include <memory>
+#include <functional>
+#include <vector>
+#include <mutex>
+
+namespace mavlinkcom_impl {
+
+    // A small fixed pool of threads that wait on the read handles of many ports at once (epoll on Linux)
+    // and run periodic timers, so connections and nodes don't need dedicated reader, publisher and
+    // heartbeat threads. Each port or timer is pinned to one loop thread, so its callbacks never run
+    // concurrently with each other.
+    //
+    // Callbacks run on the loop thread and must not block for long since that delays every other
+    // port on the same thread.  They run without the loop's lock held so they may add and remove readers
+    // and timers on any loop.  Removing a reader or timer waits for its callback to finish unless it
+    // is called from that callback's own loop thread.
+    class EventLoop
+    {
+    public:
+        typedef std::function<void()> Callback;
+
+        // Sets how many loop threads new connections share, 0 goes back to dedicated threads.
+        // Connections already using the previous pool keep it until they are closed.
+        // Returns false if event loop is not supported on this platform.
+        static bool configure(int threadCount);
+
+        // the pool new connections should use or nullptr if event loop is not enabled.
+        static std::shared_ptr<EventLoop> getShared();
+
+        static bool isSupported();
+
+        explicit EventLoop(int threadCount);
+        ~EventLoop();
+
+        // calls onReadable on a loop thread whenever handle has data to read.  If the other side
+        // hangs up or the handle reports an error, the handle is removed, onReadable gets one last call
+        // to drain remaining data and then onClosed is called so the owner can close its end.
+        // returns id for removeReader or -1 on error.
+        int addReader(int handle, Callback onReadable, Callback onClosed = nullptr);
+        void removeReader(int id);
+
+        // calls onTimer every periodMilliseconds on a loop thread, first call is one period from now.
+        int addTimer(int periodMilliseconds, Callback onTimer);
+        void removeTimer(int id);
+
+        int getThreadCount();
+
+    private:
+        class Loop;
+        Loop* getLoop(int id);
+
+        std::vector<std::unique_ptr<Loop>> loops_;
+        std::mutex mutex_;
+        int next_id_ = 1;
+
+        static std::mutex shared_mutex_;
+        static std::shared_ptr<EventLoop> shared_;
+    };
+}
+
+#endif
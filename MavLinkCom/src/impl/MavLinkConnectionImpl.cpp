@@ -9,6 +9,7 @@
 #include "../serial_com/SerialPort.hpp"
 #include "../serial_com/UdpClientPort.hpp"
 #include "../serial_com/TcpClientPort.hpp"
+#include "../serial_com/SharedMemoryPort.hpp"
 
 using namespace mavlink_utils;
 using namespace mavlinkcom_impl;
@@ -16,6 +17,7 @@ using namespace mavlinkcom_impl;
 MavLinkConnectionImpl::MavLinkConnectionImpl()
 {
     // add our custom telemetry message length.
+    // the counters live in atomics, see getTelemetry.
     telemetry_.crcErrors = 0;
     telemetry_.handlerMicroseconds = 0;
     telemetry_.messagesHandled = 0;
@@ -23,10 +25,11 @@ MavLinkConnectionImpl::MavLinkConnectionImpl()
     telemetry_.messagesSent = 0;
     telemetry_.renderTime = 0;
     closed = true;
-    ::memset(&mavlink_intermediate_status_, 0, sizeof(mavlink_status_t));
+    read_batch_buffer_.resize(kReadBatchPackets * kReadPacketSize);
+    send_batch_buffer_.resize(kSendBatchPackets * MAVLINK_MAX_PACKET_LEN);
     ::memset(&mavlink_status_, 0, sizeof(mavlink_status_t));
     // todo: if we support signing then initialize
-    // mavlink_intermediate_status_.signing callbacks
+    // mavlink_status_.signing callbacks
 }
 std::string MavLinkConnectionImpl::getName() {
     return name;
@@ -85,6 +88,21 @@ std::shared_ptr<MavLinkConnection>  MavLinkConnectionImpl::connectTcp(const std:
     return createConnection(nodeName, socket);
 }
 
+std::shared_ptr<MavLinkConnection>  MavLinkConnectionImpl::connectSharedMemory(const std::string& nodeName, const std::string& segmentName, bool create)
+{
+    if (!SharedMemoryPort::isSupported()) {
+        throw std::runtime_error("Shared memory connections are not supported on this platform");
+    }
+
+    std::shared_ptr<SharedMemoryPort> shm = std::make_shared<SharedMemoryPort>();
+
+    int hr = create ? shm->create(segmentName) : shm->open(segmentName);
+    if (hr != 0)
+        throw std::runtime_error(Utils::stringf("Could not %s the shared memory segment %s, error=%d", create ? "create" : "open", segmentName.c_str(), hr));
+
+    return createConnection(nodeName, shm);
+}
+
 std::shared_ptr<MavLinkConnection>  MavLinkConnectionImpl::connectSerial(const std::string& nodeName, const std::string& portName, int baudRate, const std::string& initString)
 {
     std::shared_ptr<SerialPort> serial = std::make_shared<SerialPort>();
@@ -109,6 +127,17 @@ void MavLinkConnectionImpl::startListening(std::shared_ptr<MavLinkConnection> pa
     closed = false;
     port = connectedPort;
 
+    // with the event loop enabled the port is read by a shared loop thread instead of our own threads.
+    std::shared_ptr<EventLoop> eventLoop = EventLoop::getShared();
+    if (eventLoop != nullptr && connectedPort->getReadHandle() >= 0) {
+        parser_.reset();
+        reader_id_ = eventLoop->addReader(connectedPort->getReadHandle(), [this]() { readAvailable(); }, [this]() { readerClosed(); });
+        if (reader_id_ >= 0) {
+            event_loop_ = eventLoop;
+            return;
+        }
+    }
+
     Utils::cleanupThread(read_thread);
     read_thread = std::thread{ &MavLinkConnectionImpl::readPackets, this };
     Utils::cleanupThread(publish_thread_);
@@ -129,6 +158,12 @@ void MavLinkConnectionImpl::stopLoggingSendMessage()
 void MavLinkConnectionImpl::close()
 {
     closed = true;
+    if (event_loop_ != nullptr) {
+        // after this returns readAvailable is not running and won't be called again.
+        event_loop_->removeReader(reader_id_);
+        reader_id_ = -1;
+        event_loop_ = nullptr;
+    }
     if (port != nullptr) {
         port->close();
         port = nullptr;
@@ -169,41 +204,50 @@ void MavLinkConnectionImpl::ignoreMessage(uint8_t message_id)
     ignored_messageids.insert(message_id);
 }
 
-void MavLinkConnectionImpl::sendMessage(const MavLinkMessage& m)
+// gives the message its sequence number and signature and logs it, returns false if it is not to be sent.
+bool MavLinkConnectionImpl::encodeForSending(const MavLinkMessage& m, mavlink_message_t& message)
 {
     if (ignored_messageids.find(m.msgid) != ignored_messageids.end())
-        return;
+        return false;
+
+    MavLinkMessage msg;
+    ::memcpy(&msg, &m, sizeof(MavLinkMessage));
+    prepareForSending(msg);
+
+    if (sendLog_ != nullptr)
+    {
+        sendLog_->write(msg);
+    }
 
+    message.compid = msg.compid;
+    message.sysid = msg.sysid;
+    message.len = msg.len;
+    message.checksum = msg.checksum;
+    message.magic = msg.magic;
+    message.incompat_flags = msg.incompat_flags;
+    message.compat_flags = msg.compat_flags;
+    message.seq = msg.seq;
+    message.msgid = msg.msgid;
+    ::memcpy(message.signature, msg.signature, 13);
+    ::memcpy(message.payload64, msg.payload64, PayloadSize * sizeof(uint64_t));
+    return true;
+}
+
+void MavLinkConnectionImpl::sendMessage(const MavLinkMessage& m)
+{
     if (closed) {
         return;
     }
 
-    {
-        MavLinkMessage msg;
-        ::memcpy(&msg, &m, sizeof(MavLinkMessage));
-        prepareForSending(msg);
-
-        if (sendLog_ != nullptr)
-        {
-            sendLog_->write(msg);
-        }
+    mavlink_message_t message;
+    if (!encodeForSending(m, message))
+        return;
 
-        mavlink_message_t message;
-        message.compid = msg.compid;
-        message.sysid = msg.sysid;
-        message.len = msg.len;
-        message.checksum = msg.checksum;
-        message.magic = msg.magic;
-        message.incompat_flags = msg.incompat_flags;
-        message.compat_flags = msg.compat_flags;
-        message.seq = msg.seq;
-        message.msgid = msg.msgid;
-        ::memcpy(message.signature, msg.signature, 13);
-        ::memcpy(message.payload64, msg.payload64, PayloadSize * sizeof(uint64_t));
-        
+    {
         std::lock_guard<std::mutex> guard(buffer_mutex);
         unsigned len = mavlink_msg_to_send_buffer(message_buf, &message);
 
+        port_writes_.fetch_add(1, std::memory_order_relaxed);
         try {
             port->write(message_buf, len);
         }
@@ -211,11 +255,53 @@ void MavLinkConnectionImpl::sendMessage(const MavLinkMessage& m)
             throw std::runtime_error(Utils::stringf("MavLinkConnectionImpl: Error sending message on connection '%s', details: %s", name.c_str(), e.what()));
         }
     }
-    {
-        std::lock_guard<std::mutex> guard(telemetry_mutex_);
-        telemetry_.messagesSent++;
+    messages_sent_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MavLinkConnectionImpl::sendMessages(const std::vector<MavLinkMessage>& messages)
+{
+    if (closed) {
+        return;
     }
 
+    // the batch buffer belongs to this call until it returns, other threads' sendMessage calls are not part of it.
+    std::lock_guard<std::mutex> batch_guard(send_batch_mutex_);
+    int count = 0;
+    int size = 0;
+    for (const MavLinkMessage& m : messages) {
+        mavlink_message_t message;
+        if (!encodeForSending(m, message))
+            continue;
+        unsigned len = mavlink_msg_to_send_buffer(send_batch_buffer_.data() + size, &message);
+        send_batch_lengths_[count++] = static_cast<int>(len);
+        size += static_cast<int>(len);
+        if (count == kSendBatchPackets) {
+            writeSendBatch(count);
+            count = 0;
+            size = 0;
+        }
+    }
+    writeSendBatch(count);
+}
+
+void MavLinkConnectionImpl::writeSendBatch(int count)
+{
+    // caller holds send_batch_mutex_.
+    if (count == 0) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(buffer_mutex);
+        port_writes_.fetch_add(1, std::memory_order_relaxed);
+        try {
+            port->writeBatch(send_batch_buffer_.data(), send_batch_lengths_, count);
+        }
+        catch (std::exception& e) {
+            throw std::runtime_error(Utils::stringf("MavLinkConnectionImpl: Error sending message on connection '%s', details: %s", name.c_str(), e.what()));
+        }
+    }
+    messages_sent_.fetch_add(count, std::memory_order_relaxed);
 }
 
 int MavLinkConnectionImpl::prepareForSending(MavLinkMessage& msg)
@@ -374,16 +460,9 @@ void MavLinkConnectionImpl::readPackets()
 {
     //CurrentThread::setMaximumPriority();
     std::shared_ptr<Port> safePort = this->port;
-    mavlink_message_t msg;
-    mavlink_message_t msgBuffer; // intermediate state.
-    const int MAXBUFFER = 512;
-    uint8_t* buffer = new uint8_t[MAXBUFFER];
-    mavlink_intermediate_status_.parse_state = MAVLINK_PARSE_STATE_IDLE;
-    int channel = 0;
-    int hr = 0;
-    while (hr == 0 && con_ != nullptr && !closed)
+    parser_.reset();
+    while (con_ != nullptr && !closed)
     {
-        int read = 0;
         if (safePort->isClosed())
         {
             // hmmm, wait till it is opened?
@@ -391,146 +470,204 @@ void MavLinkConnectionImpl::readPackets()
             continue;
         }
 
-        int count = safePort->read(buffer, MAXBUFFER);
-        if (count <= 0) {
+        // udp ports hand us every datagram that is already waiting in one call.
+        int packets = safePort->readBatch(read_batch_buffer_.data(), kReadPacketSize, read_batch_lengths_, kReadBatchPackets, true);
+        port_reads_.fetch_add(1, std::memory_order_relaxed);
+        if (packets <= 0) {
             // error? well let's try again, but we should be careful not to spin too fast and kill the CPU
             std::this_thread::sleep_for(std::chrono::milliseconds(1));
             continue;
         }
-        for (int i = 0; i < count; i++)
-        {
-            uint8_t frame_state = mavlink_frame_char_buffer(&msgBuffer, &mavlink_intermediate_status_, buffer[i], &msg, &mavlink_status_);
-
-            if (frame_state == MAVLINK_FRAMING_INCOMPLETE) {
-                continue;
-            }
-            else if (frame_state == MAVLINK_FRAMING_BAD_CRC) {
-                std::lock_guard<std::mutex> guard(telemetry_mutex_);
-                telemetry_.crcErrors++;
-            }
-            else if (frame_state == MAVLINK_FRAMING_OK)
-            {
-                int msgId = msg.msgid;
-
-                // pick up the sysid/compid of the remote node we are connected to.
-                if (other_system_id == -1) {
-                    other_system_id = msg.sysid;
-                    other_component_id = msg.compid;
-                }
-
-                if (mavlink_intermediate_status_.flags & MAVLINK_STATUS_FLAG_IN_MAVLINK1)
-                {
-                    // then this is a mavlink 1 message
-                } else if (!supports_mavlink2_) {
-                    // then this mavlink sender supports mavlink 2
-                    supports_mavlink2_ = true;
-                }
-
-                if (con_ != nullptr && !closed)
-                {
-                    {
-                        std::lock_guard<std::mutex> guard(telemetry_mutex_);
-                        telemetry_.messagesReceived++;
-                    }
-                    // queue event for publishing.
-                    {
-                        std::lock_guard<std::mutex> guard(msg_queue_mutex_);
-                        MavLinkMessage message;
-                        message.compid = msg.compid;
-                        message.sysid = msg.sysid;
-                        message.len = msg.len;
-                        message.checksum = msg.checksum;
-                        message.magic = msg.magic;
-                        message.incompat_flags = msg.incompat_flags;
-                        message.compat_flags = msg.compat_flags;
-                        message.seq = msg.seq;
-                        message.msgid = msg.msgid;
-                        message.protocol_version = supports_mavlink2_ ? 2 : 1;
-                        ::memcpy(message.signature, msg.signature, 13);
-                        ::memcpy(message.payload64, msg.payload64, PayloadSize * sizeof(uint64_t));
-                        msg_queue_.push(message);
-                    }
-                    if (waiting_for_msg_) {
-                        msg_available_.post();
-                    }
-                }
-            }
-            else {
-                std::lock_guard<std::mutex> guard(telemetry_mutex_);
-                telemetry_.crcErrors++;
-            }
-        }	
+        processBatch(packets, nullptr);
 
     } //while
 
-    delete[]  buffer;
-
 } //readPackets
 
-void MavLinkConnectionImpl::drainQueue()
+void MavLinkConnectionImpl::readAvailable()
 {
-    MavLinkMessage message;
-    bool hasMsg = true;
-    while (hasMsg) {
-        hasMsg = false;
-        {
-            std::lock_guard<std::mutex> guard(msg_queue_mutex_);
-            if (!msg_queue_.empty()) {
-                message = msg_queue_.front();
-                msg_queue_.pop();
-                hasMsg = true;
-            }
+    // called on an event loop thread when the port has data, instead of readPackets and publishPackets.
+    std::shared_ptr<Port> safePort = this->port;
+    std::shared_ptr<MavLinkConnection> sharedPtr = this->con_;
+    if (safePort == nullptr || sharedPtr == nullptr || closed) {
+        return;
+    }
+
+    // read a bounded amount so one busy port can't starve the others on this loop thread,
+    // epoll will tell us again if there is more.
+    const int maxReads = 4;
+    for (int i = 0; i < maxReads && !closed; i++)
+    {
+        int packets = safePort->readBatch(read_batch_buffer_.data(), kReadPacketSize, read_batch_lengths_, kReadBatchPackets, false);
+        port_reads_.fetch_add(1, std::memory_order_relaxed);
+        if (packets <= 0) {
+            break;
         }
-        if (!hasMsg)
-        {
+        processBatch(packets, &sharedPtr);
+    }
+}
+
+void MavLinkConnectionImpl::readerClosed()
+{
+    // the event loop has stopped reading the port because the other side hung up or the handle failed,
+    // report it like a closed connection so senders stop and the owner can close or reconnect.
+    if (!closed) {
+        closed = true;
+        Utils::log(Utils::stringf("MavLinkConnectionImpl: port of connection '%s' was closed by the other side", name.c_str()), Utils::kLogLevelError);
+    }
+}
+
+void MavLinkConnectionImpl::processBatch(int packets, const std::shared_ptr<MavLinkConnection>* publishTo)
+{
+    for (int i = 0; i < packets; i++)
+    {
+        processBytes(read_batch_buffer_.data() + i * kReadPacketSize, read_batch_lengths_[i], publishTo);
+    }
+}
+
+void MavLinkConnectionImpl::processBytes(const uint8_t* buffer, int count, const std::shared_ptr<MavLinkConnection>* publishTo)
+{
+    parser_.parse(buffer, count, [this, publishTo](uint8_t frame_state, const mavlink_message_t& msg) {
+        if (frame_state == MAVLINK_FRAMING_OK) {
+            processMessage(msg, publishTo);
+        }
+        else {
+            // bad crc or signature.
+            crc_errors_.fetch_add(1, std::memory_order_relaxed);
+        }
+    });
+}
+
+void MavLinkConnectionImpl::processMessage(const mavlink_message_t& msg, const std::shared_ptr<MavLinkConnection>* publishTo)
+{
+    // pick up the sysid/compid of the remote node we are connected to.
+    if (other_system_id == -1) {
+        other_system_id = msg.sysid;
+        other_component_id = msg.compid;
+    }
+
+    if (parser_.getStatus().flags & MAVLINK_STATUS_FLAG_IN_MAVLINK1)
+    {
+        // then this is a mavlink 1 message
+    } else if (!supports_mavlink2_) {
+        // then this mavlink sender supports mavlink 2
+        supports_mavlink2_ = true;
+    }
+
+    if (con_ != nullptr && !closed)
+    {
+        messages_received_.fetch_add(1, std::memory_order_relaxed);
+        if (publishTo != nullptr) {
+            // on event loop there is no publisher thread, handlers run right here.
+            convertMessage(msg, loop_message_);
+            publishMessage(*publishTo, loop_message_);
+        }
+        else {
+            // queue event for publishing.
+            queueMessage(msg);
+        }
+    }
+}
+
+void MavLinkConnectionImpl::convertMessage(const mavlink_message_t& msg, MavLinkMessage& message)
+{
+    message.compid = msg.compid;
+    message.sysid = msg.sysid;
+    message.len = msg.len;
+    message.checksum = msg.checksum;
+    message.magic = msg.magic;
+    message.incompat_flags = msg.incompat_flags;
+    message.compat_flags = msg.compat_flags;
+    message.seq = msg.seq;
+    message.msgid = msg.msgid;
+    message.protocol_version = supports_mavlink2_ ? 2 : 1;
+    ::memcpy(message.signature, msg.signature, 13);
+    ::memcpy(message.payload64, msg.payload64, PayloadSize * sizeof(uint64_t));
+}
+
+void MavLinkConnectionImpl::queueMessage(const mavlink_message_t& msg)
+{
+    // only readPackets produces and only publishPackets consumes, so the ring needs no lock.
+    MavLinkMessage* message = msg_queue_.beginWrite();
+    while (message == nullptr) {
+        // publisher is falling behind, hold off reading from the port rather than losing messages.
+        if (closed) {
             return;
         }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        message = msg_queue_.beginWrite();
+    }
+
+    convertMessage(msg, *message);
+    msg_queue_.commitWrite();
+
+    // pairs with the fence in publishPackets so either the publisher sees the new message
+    // before going to sleep or we see that it is waiting and wake it up.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_for_msg_.load(std::memory_order_relaxed)) {
+        msg_available_.post();
+    }
+}
+
+void MavLinkConnectionImpl::drainQueue()
+{
+    MavLinkMessage* message = msg_queue_.beginRead();
+    if (message == nullptr) {
+        return;
+    }
+
+    std::shared_ptr<MavLinkConnection> sharedPtr = std::shared_ptr<MavLinkConnection>(this->con_);
+    for (; message != nullptr; message = msg_queue_.beginRead())
+    {
         // publish the message from this thread, this is safer than publishing from the readPackets thread
         // as it ensures we don't lose messages if the listener is slow.
-        if (snapshot_stale) {
-            // this is tricky, the clear has to be done outside the lock because it is destructing the handlers
-            // and the handler might try and call unsubscribe, which needs to be able to grab the lock, otherwise
-            // we would get a deadlock.
-            snapshot.clear();
-
-            std::lock_guard<std::mutex> guard(listener_mutex);
-            snapshot = listeners;
-            snapshot_stale = false;
-        }
-        auto end = snapshot.end();
+        // handlers get the message in place, the slot is not reused until popRead.
+        publishMessage(sharedPtr, *message);
+        msg_queue_.popRead();
+    }
+}
 
-        if (message.msgid == static_cast<uint8_t>(MavLinkMessageIds::MAVLINK_MSG_ID_AUTOPILOT_VERSION))
-        {
-            MavLinkAutopilotVersion cap;
-            cap.decode(message);
-            if ((cap.capabilities & MAV_PROTOCOL_CAPABILITY_MAVLINK2) != 0)
-            {
-                this->supports_mavlink2_ = true;
-            }
-        }
+void MavLinkConnectionImpl::publishMessage(const std::shared_ptr<MavLinkConnection>& sharedPtr, const MavLinkMessage& message)
+{
+    if (snapshot_stale) {
+        // this is tricky, the clear has to be done outside the lock because it is destructing the handlers
+        // and the handler might try and call unsubscribe, which needs to be able to grab the lock, otherwise
+        // we would get a deadlock.
+        snapshot.clear();
+
+        std::lock_guard<std::mutex> guard(listener_mutex);
+        snapshot = listeners;
+        snapshot_stale = false;
+    }
+    auto end = snapshot.end();
 
-        auto startTime = std::chrono::system_clock::now();
-        std::shared_ptr<MavLinkConnection> sharedPtr = std::shared_ptr<MavLinkConnection>(this->con_);
-        for (auto ptr = snapshot.begin(); ptr != end; ptr++)
+    if (message.msgid == static_cast<uint8_t>(MavLinkMessageIds::MAVLINK_MSG_ID_AUTOPILOT_VERSION))
+    {
+        MavLinkAutopilotVersion cap;
+        cap.decode(message);
+        if ((cap.capabilities & MAV_PROTOCOL_CAPABILITY_MAVLINK2) != 0)
         {
-            try {
-                (*ptr).handler(sharedPtr, message);
-            }
-            catch (std::exception& e) {
-                Utils::log(Utils::stringf("MavLinkConnectionImpl: Error handling message %d on connection '%s', details: %s",
-                    message.msgid, name.c_str(), e.what()), Utils::kLogLevelError);
-            }
+            this->supports_mavlink2_ = true;
         }
+    }
 
-        {
-            auto endTime = std::chrono::system_clock::now();
-            auto diff = endTime - startTime;
-            long microseconds = static_cast<long>(std::chrono::duration_cast<std::chrono::microseconds>(diff).count());
-            std::lock_guard<std::mutex> guard(telemetry_mutex_);
-            telemetry_.messagesHandled++;
-            telemetry_.handlerMicroseconds += microseconds;
+    auto startTime = std::chrono::steady_clock::now();
+    for (auto ptr = snapshot.begin(); ptr != end; ptr++)
+    {
+        try {
+            (*ptr).handler(sharedPtr, message);
+        }
+        catch (std::exception& e) {
+            Utils::log(Utils::stringf("MavLinkConnectionImpl: Error handling message %d on connection '%s', details: %s",
+                message.msgid, name.c_str(), e.what()), Utils::kLogLevelError);
         }
     }
+
+    auto endTime = std::chrono::steady_clock::now();
+    auto diff = endTime - startTime;
+    uint32_t microseconds = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(diff).count());
+    messages_handled_.fetch_add(1, std::memory_order_relaxed);
+    handler_microseconds_.fetch_add(microseconds, std::memory_order_relaxed);
 }
 
 void MavLinkConnectionImpl::publishPackets()
@@ -539,9 +676,12 @@ void MavLinkConnectionImpl::publishPackets()
     while (!closed) {
 
         drainQueue();
-        
+
         waiting_for_msg_ = true;
-        msg_available_.wait();
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (msg_queue_.empty() && !closed) {
+            msg_available_.wait();
+        }
         waiting_for_msg_ = false;
     }
 }
@@ -550,12 +690,14 @@ void MavLinkConnectionImpl::getTelemetry(MavLinkTelemetry& result)
 {
     std::lock_guard<std::mutex> guard(telemetry_mutex_);
     result = telemetry_;
-    // reset counters 
-    telemetry_.crcErrors = 0;
-    telemetry_.handlerMicroseconds = 0;
-    telemetry_.messagesHandled = 0;
-    telemetry_.messagesReceived = 0;
-    telemetry_.messagesSent = 0;
+    // read and reset counters 
+    result.crcErrors = crc_errors_.exchange(0, std::memory_order_relaxed);
+    result.handlerMicroseconds = handler_microseconds_.exchange(0, std::memory_order_relaxed);
+    result.messagesHandled = messages_handled_.exchange(0, std::memory_order_relaxed);
+    result.messagesReceived = messages_received_.exchange(0, std::memory_order_relaxed);
+    result.messagesSent = messages_sent_.exchange(0, std::memory_order_relaxed);
+    result.portReads = port_reads_.exchange(0, std::memory_order_relaxed);
+    result.portWrites = port_writes_.exchange(0, std::memory_order_relaxed);
     telemetry_.renderTime = 0;
     if (telemetry_.wifiInterfaceName != nullptr) {
         telemetry_.wifiRssi = port->getRssi(telemetry_.wifiInterfaceName);
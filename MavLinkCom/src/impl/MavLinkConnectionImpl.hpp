@@ -6,13 +6,16 @@
 
 #include <memory>
 #include <vector>
-#include <queue>
 #include <thread>
 #include <mutex>
+#include <atomic>
 #include <unordered_set>
 #include "MavLinkConnection.hpp"
 #include "MavLinkMessageBase.hpp"
 #include "Semaphore.hpp"
+#include "SpscRing.hpp"
+#include "EventLoop.hpp"
+#include "MavLinkParserImpl.hpp"
 #include "../serial_com/TcpClientPort.hpp"
 #include "StrictMode.hpp"
 #define MAVLINK_PACKED
@@ -36,6 +39,7 @@ namespace mavlinkcom_impl {
         static std::shared_ptr<MavLinkConnection>  connectLocalUdp(const std::string& nodeName, const std::string& localAddr, int localPort);
         static std::shared_ptr<MavLinkConnection>  connectRemoteUdp(const std::string& nodeName, const std::string& localAddr, const std::string& remoteAddr, int remotePort);
         static std::shared_ptr<MavLinkConnection>  connectTcp(const std::string& nodeName, const std::string& localAddr, const std::string& remoteIpAddr, int remotePort);
+        static std::shared_ptr<MavLinkConnection>  connectSharedMemory(const std::string& nodeName, const std::string& segmentName, bool create);
 
         std::string getName();
         int getTargetComponentId();
@@ -48,6 +52,7 @@ namespace mavlinkcom_impl {
         bool isOpen();
         void sendMessage(const MavLinkMessageBase& msg);
         void sendMessage(const MavLinkMessage& msg);
+        void sendMessages(const std::vector<MavLinkMessage>& messages);
         int subscribe(MessageHandler handler);
         void unsubscribe(int id);		
         uint8_t getNextSequence();
@@ -62,6 +67,16 @@ namespace mavlinkcom_impl {
         void publishPackets();
         void readPackets();
         void drainQueue();
+        void readAvailable();
+        void readerClosed();
+        void processBytes(const uint8_t* buffer, int count, const std::shared_ptr<MavLinkConnection>* publishTo);
+        void processMessage(const mavlink_message_t& msg, const std::shared_ptr<MavLinkConnection>* publishTo);
+        void convertMessage(const mavlink_message_t& msg, MavLinkMessage& message);
+        void queueMessage(const mavlink_message_t& msg);
+        void publishMessage(const std::shared_ptr<MavLinkConnection>& sharedPtr, const MavLinkMessage& message);
+        void processBatch(int packets, const std::shared_ptr<MavLinkConnection>* publishTo);
+        bool encodeForSending(const MavLinkMessage& m, mavlink_message_t& message);
+        void writeSendBatch(int count);
         std::string name;
         std::shared_ptr<Port> port;
         std::shared_ptr<MavLinkConnection> con_;
@@ -86,14 +101,39 @@ namespace mavlinkcom_impl {
         std::mutex buffer_mutex;
         bool closed;
         std::thread publish_thread_;
-        std::queue<MavLinkMessage> msg_queue_;
-        std::mutex msg_queue_mutex_;
+        // messages parsed by read_thread waiting to be published by publish_thread_
+        static const size_t kMessageQueueCapacity = 4096;
+        SpscRing<MavLinkMessage> msg_queue_{ kMessageQueueCapacity };
         mavlink_utils::Semaphore msg_available_;
-        bool waiting_for_msg_ = false;
+        std::atomic<bool> waiting_for_msg_{ false };
+        // set instead of the two threads above when the port is served by the shared event loop.
+        std::shared_ptr<EventLoop> event_loop_;
+        int reader_id_ = -1;
+        MavLinkMessage loop_message_;
+        // packets from one Port::readBatch call, used by whichever thread reads the port.
+        static const int kReadBatchPackets = 32;
+        static const int kReadPacketSize = 512;
+        std::vector<uint8_t> read_batch_buffer_;
+        int read_batch_lengths_[kReadBatchPackets];
+        // messages packed by sendMessages, guarded by send_batch_mutex_.
+        static const int kSendBatchPackets = 32;
+        std::mutex send_batch_mutex_;
+        std::vector<uint8_t> send_batch_buffer_;
+        int send_batch_lengths_[kSendBatchPackets];
+        // only touched by whichever thread reads the port.
+        MavLinkParserImpl parser_;
         bool supports_mavlink2_ = false;
         bool signing_ = false;
-        mavlink_status_t mavlink_intermediate_status_;
         mavlink_status_t mavlink_status_;
+        // counters are updated for every message so they are atomics instead of being guarded by a mutex,
+        // telemetry_ only holds the remaining wifi fields.
+        std::atomic<uint32_t> messages_sent_{ 0 };
+        std::atomic<uint32_t> messages_received_{ 0 };
+        std::atomic<uint32_t> messages_handled_{ 0 };
+        std::atomic<uint32_t> crc_errors_{ 0 };
+        std::atomic<uint32_t> handler_microseconds_{ 0 };
+        std::atomic<uint32_t> port_reads_{ 0 };
+        std::atomic<uint32_t> port_writes_{ 0 };
         std::mutex telemetry_mutex_;
         MavLinkTelemetry telemetry_;
         std::unordered_set<uint8_t> ignored_messageids;
@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "MavLinkCrc.hpp"
+
+using namespace mavlinkcom_impl;
+
+namespace {
+    struct CrcTables
+    {
+        uint16_t tables[8][256];
+
+        CrcTables()
+        {
+            // table 0 is the classic byte at a time table for the reflected polynomial 0x8408, table k
+            // advances the crc of a byte followed by k zero bytes so 8 lookups cover 8 bytes.
+            for (int i = 0; i < 256; i++) {
+                uint16_t crc = static_cast<uint16_t>(i);
+                for (int bit = 0; bit < 8; bit++) {
+                    crc = (crc & 1) ? static_cast<uint16_t>((crc >> 1) ^ 0x8408) : static_cast<uint16_t>(crc >> 1);
+                }
+                tables[0][i] = crc;
+            }
+            for (int k = 1; k < 8; k++) {
+                for (int i = 0; i < 256; i++) {
+                    uint16_t prev = tables[k - 1][i];
+                    tables[k][i] = static_cast<uint16_t>((prev >> 8) ^ tables[0][prev & 0xff]);
+                }
+            }
+        }
+    };
+}
+
+const MavLinkCrc::Tables& MavLinkCrc::getTables()
+{
+    static const CrcTables crcTables;
+    return crcTables.tables;
+}
+
+uint16_t MavLinkCrc::accumulate(uint16_t crc, const uint8_t* data, size_t length)
+{
+    const Tables& t = getTables();
+    while (length >= 8) {
+        // only the first two bytes mix with the 16 bit crc, the rest go straight through their tables.
+        uint16_t low = static_cast<uint16_t>(crc ^ (data[0] | (data[1] << 8)));
+        crc = static_cast<uint16_t>(t[7][low & 0xff] ^ t[6][low >> 8] ^ t[5][data[2]] ^ t[4][data[3]] ^
+            t[3][data[4]] ^ t[2][data[5]] ^ t[1][data[6]] ^ t[0][data[7]]);
+        data += 8;
+        length -= 8;
+    }
+    while (length-- > 0) {
+        crc = static_cast<uint16_t>((crc >> 8) ^ t[0][(crc ^ *data++) & 0xff]);
+    }
+    return crc;
+}
@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef MavLinkCom_MavLinkCrc_hpp
+#define MavLinkCom_MavLinkCrc_hpp
+
+#include <stdint.h>
+#include <cstddef>
+
+namespace mavlinkcom_impl {
+
+    // The X.25 crc mavlink puts on every frame, computed with lookup tables 8 bytes at a time
+    // (slicing by 8) instead of a handful of shifts per byte like crc_accumulate.  Gives exactly the
+    // same result as crc_accumulate_buffer so the two can be mixed.
+    class MavLinkCrc
+    {
+    public:
+        static const uint16_t kInitial = 0xffff;
+
+        static uint16_t accumulate(uint16_t crc, const uint8_t* data, size_t length);
+
+        static uint16_t accumulate(uint16_t crc, uint8_t value)
+        {
+            return static_cast<uint16_t>((crc >> 8) ^ getTables()[0][(crc ^ value) & 0xff]);
+        }
+
+    private:
+        typedef uint16_t Tables[8][256];
+        static const Tables& getTables();
+    };
+}
+
+#endif
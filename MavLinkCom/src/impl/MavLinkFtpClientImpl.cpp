@@ -6,6 +6,8 @@
 #include "Utils.hpp"
 #include "FileSystem.hpp"
 #include <sys/stat.h>
+#include <cstddef>
+#include <algorithm>
 
 using namespace mavlink_utils;
 using namespace mavlinkcom;
@@ -79,6 +81,21 @@ enum ErrorCode : uint8_t {
     kErrUnknownCommand		///< Unknown command opcode
 };
 
+/// largest block of file data in one message.
+static const uint32_t kMaxDataLength = 251 - offsetof(FtpPayload, data);
+/// sends of one read or write request before giving up.
+static const int kMaxAttempts = 10;
+
+static std::chrono::milliseconds getRequestTimeout(int attempts)
+{
+    // double the timeout each time a request has to be sent again.
+    int timeout = MAXIMUM_ROUND_TRIP_TIME;
+    for (int i = 1; i < attempts && timeout < MAXIMUM_ROUND_TRIP_TIME * TIMEOUT_INTERVAL; i++) {
+        timeout *= 2;
+    }
+    return std::chrono::milliseconds(std::min(timeout, MAXIMUM_ROUND_TRIP_TIME * TIMEOUT_INTERVAL));
+}
+
 static const char	kDirentFile = 'F';	///< Identifies File returned from List command
 static const char	kDirentDir = 'D';	///< Identifies Directory returned from List command
 static const char	kDirentSkip = 'S';	///< Identifies Skipped entry from List command
@@ -103,6 +120,16 @@ bool MavLinkFtpClientImpl::isSupported()
     return (ver.capabilities & static_cast<int>(MAV_PROTOCOL_CAPABILITY::MAV_PROTOCOL_CAPABILITY_FTP)) != 0;
 }
 
+void MavLinkFtpClientImpl::setWindowSize(int window)
+{
+    window_size_ = std::max(window, 1);
+}
+
+void MavLinkFtpClientImpl::setBurstRead(bool enabled)
+{
+    burst_read_ = enabled;
+}
+
 void MavLinkFtpClientImpl::subscribe() 
 {
     if (subscription_ == 0) {
@@ -234,10 +261,14 @@ void MavLinkFtpClientImpl::runStateMachine()
     progress_->complete = false;
     progress_->longest_delay = 0;
     progress_->message_count = 0;
+    progress_->resend_count = 0;
 
     int before = 0;
     subscribe();
-    nextStep();
+    {
+        std::lock_guard<std::recursive_mutex> guard(state_mutex_);
+        nextStep();
+    }
 
     const int monitorInterval = 30; // milliseconds between monitoring progress.
     double rate = 0;
@@ -247,6 +278,7 @@ void MavLinkFtpClientImpl::runStateMachine()
     {
         std::this_thread::sleep_for(std::chrono::milliseconds(monitorInterval));
         totalSleep += monitorInterval;
+        checkTimeouts();
 
         int after = 0;
         {
@@ -442,28 +474,115 @@ void MavLinkFtpClientImpl::readFile()
     }
     else
     {
-        if (createLocalFile())
-        {
-            // use last_message_ so we preserve the sessionid.
-            FtpPayload* payload = reinterpret_cast<FtpPayload*>(&last_message_.payload[0]);
-            payload->opcode = kCmdReadFile;
-            payload->offset = bytes_read_;
-            last_message_.target_component = getTargetComponentId();
-            last_message_.target_system = getTargetSystemId();
-            sendMessage(last_message_);
-            recordMessageSent();
-            if (progress_ != nullptr) {
-                progress_->current = bytes_read_;
-            }
+        fillReadWindow();
+    }
+}
+
+void MavLinkFtpClientImpl::startBurst(uint32_t offset)
+{
+    // the vehicle streams the file from offset without waiting for more requests, anything lost on the way
+    // is fetched afterwards by fillReadWindow.
+    burst_running_ = true;
+    burst_packets_ = 0;
+    burst_deadline_ = std::chrono::steady_clock::now() + getRequestTimeout(1);
+    sendRead(kCmdBurstreadFile, offset, kMaxDataLength);
+}
+
+void MavLinkFtpClientImpl::fillReadWindow()
+{
+    if (file_ptr_ == nullptr) {
+        return;
+    }
+    uint32_t size = static_cast<uint32_t>(file_size_);
+    if (static_cast<uint32_t>(bytes_read_) >= size) {
+        finishTransfer();
+        return;
+    }
+    if (burst_running_) {
+        return;
+    }
+
+    // if the last burst stopped early, burst the rest of the file again rather than reading it a window at a time.
+    uint32_t end = received_.size() > 0 ? received_.rbegin()->second : 0;
+    if (burst_read_ && burst_packets_ > 0 && pending_.size() == 0 && size - end > window_size_ * kMaxDataLength) {
+        startBurst(end);
+        return;
+    }
+
+    // request the gaps in what we have received so far, oldest first.
+    auto now = std::chrono::steady_clock::now();
+    auto range = received_.begin();
+    uint32_t offset = 0;
+    while (offset < size && static_cast<int>(pending_.size()) < window_size_) {
+        if (range != received_.end() && range->first <= offset) {
+            offset = std::max(offset, range->second);
+            range++;
+            continue;
         }
-        else
-        {
-            // could not create the local file, so stop.
-            waiting_ = false;
+        uint32_t gapEnd = range != received_.end() ? std::min(range->first, size) : size;
+        uint32_t chunk = std::min(kMaxDataLength, gapEnd - offset);
+        if (pending_.find(offset) == pending_.end()) {
+            pending_[offset] = PendingRequest{ chunk, 1, now + getRequestTimeout(1) };
+            sendRead(kCmdReadFile, offset, chunk);
         }
+        offset += chunk;
+    }
+    if (progress_ != nullptr) {
+        progress_->current = bytes_read_;
     }
 }
 
+void MavLinkFtpClientImpl::sendRead(uint8_t opcode, uint32_t offset, uint32_t size)
+{
+    MavLinkFileTransferProtocol ftp;
+    FtpPayload* payload = reinterpret_cast<FtpPayload*>(&ftp.payload[0]);
+    ftp.target_component = getTargetComponentId();
+    ftp.target_system = getTargetSystemId();
+    payload->opcode = opcode;
+    payload->session = session_;
+    payload->seq_number = static_cast<uint16_t>(++sequence_);
+    payload->offset = offset;
+    payload->size = static_cast<uint8_t>(size);
+    sendMessage(ftp);
+    recordMessageSent();
+}
+
+uint32_t MavLinkFtpClientImpl::addReceived(uint32_t offset, uint32_t size)
+{
+    // merge [offset, offset + size) in to received_ and return how many of those bytes are new.
+    uint32_t start = offset;
+    uint32_t end = offset + size;
+    uint32_t overlap = 0;
+    auto it = received_.upper_bound(start);
+    if (it != received_.begin()) {
+        auto prev = std::prev(it);
+        if (prev->second >= start) {
+            it = prev;
+        }
+    }
+    while (it != received_.end() && it->first <= end) {
+        overlap += std::min(end, it->second) - std::max(start, it->first);
+        start = std::min(start, it->first);
+        end = std::max(end, it->second);
+        it = received_.erase(it);
+    }
+    received_[start] = end;
+    return size - std::min(overlap, size);
+}
+
+void MavLinkFtpClientImpl::finishTransfer()
+{
+    pending_.clear();
+    burst_running_ = false;
+    if (file_ptr_ != nullptr) {
+        fclose(file_ptr_);
+        file_ptr_ = nullptr;
+    }
+    success_ = true;
+    reset();
+    waiting_ = false;
+}
+
 void MavLinkFtpClientImpl::writeFile()
 {
 
@@ -481,40 +600,99 @@ void MavLinkFtpClientImpl::writeFile()
     }
     else
     {
-        // must use last_message_ so we preserve the session id.
-        MavLinkFileTransferProtocol& ftp = last_message_;
-        FtpPayload* payload = reinterpret_cast<FtpPayload*>(&ftp.payload[0]);
-        payload->opcode = kCmdWriteFile;
-        payload->seq_number = sequence_;
-        fseek(file_ptr_, bytes_written_, SEEK_SET);
-        uint8_t* data = &payload->data;
-        size_t bytes = fread(data, 1, 251 - 12, file_ptr_);
-        if (progress_ != nullptr) {
-            progress_->current = bytes_written_;
+        fillWriteWindow();
+    }
+}
+
+void MavLinkFtpClientImpl::fillWriteWindow()
+{
+    if (file_ptr_ == nullptr) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    while (static_cast<int>(pending_.size()) < window_size_ && next_write_offset_ < file_size_)
+    {
+        uint32_t size = static_cast<uint32_t>(std::min(static_cast<uint64_t>(kMaxDataLength), file_size_ - next_write_offset_));
+        pending_[next_write_offset_] = PendingRequest{ size, 1, now + getRequestTimeout(1) };
+        sendWrite(next_write_offset_, size);
+        next_write_offset_ += size;
+    }
+    if (progress_ != nullptr) {
+        progress_->current = bytes_written_;
+    }
+    if (pending_.size() == 0 && next_write_offset_ >= file_size_)
+    {
+        int err = ferror(file_ptr_);
+        if (err != 0) {
+            if (progress_ != nullptr) {
+                progress_->error = err;
+                progress_->message = Utils::stringf("error reading local file, errno=%d", err);
+            }
         }
-        if (bytes == 0)
-        {
-            success_ = true;
-            reset();
-            int err = ferror(file_ptr_);
-            if (err != 0) {
-                if (progress_ != nullptr) {
-                    progress_->error = err;
-                    progress_->message = Utils::stringf("error reading local file, errno=%d", err);
-                }
+        finishTransfer();
+    }
+}
+
+void MavLinkFtpClientImpl::sendWrite(uint32_t offset, uint32_t size)
+{
+    MavLinkFileTransferProtocol ftp;
+    FtpPayload* payload = reinterpret_cast<FtpPayload*>(&ftp.payload[0]);
+    ftp.target_component = getTargetComponentId();
+    ftp.target_system = getTargetSystemId();
+    payload->opcode = kCmdWriteFile;
+    payload->session = session_;
+    payload->seq_number = static_cast<uint16_t>(++sequence_);
+    payload->offset = offset;
+    fseek(file_ptr_, offset, SEEK_SET);
+    size_t bytes = fread(&payload->data, 1, size, file_ptr_);
+    payload->size = static_cast<uint8_t>(bytes);
+    sendMessage(ftp);
+    recordMessageSent();
+}
+
+void MavLinkFtpClientImpl::checkTimeouts()
+{
+    std::lock_guard<std::recursive_mutex> guard(state_mutex_);
+    if (!waiting_ || !remote_file_open_) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (burst_running_ && now >= burst_deadline_) {
+        // the burst has gone quiet, either it is done and the last packet was lost or the vehicle stopped
+        // sending, so read whatever is missing.
+        burst_running_ = false;
+        fillReadWindow();
+        if (!waiting_) {
+            return;
+        }
+    }
+    for (auto& pair : pending_) {
+        PendingRequest& request = pair.second;
+        if (now < request.deadline) {
+            continue;
+        }
+        if (request.attempts >= kMaxAttempts) {
+            errorCode_ = kErrRetriesExhausted;
+            success_ = false;
+            if (progress_ != nullptr) {
+                progress_->error = kErrRetriesExhausted;
+                progress_->message = Utils::stringf("ftp gave up on offset %d after %d attempts", static_cast<int>(pair.first), request.attempts);
             }
-            fclose(file_ptr_);
-            file_ptr_ = nullptr;
+            pending_.clear();
             waiting_ = false;
+            reset();
+            return;
         }
-        else
-        {
-            payload->offset = bytes_written_;
-            payload->size = static_cast<uint8_t>(bytes);
-            ftp.target_component = getTargetComponentId();
-            ftp.target_system = getTargetSystemId();
-            sendMessage(ftp);
-            recordMessageSent();
+        request.attempts++;
+        request.deadline = now + getRequestTimeout(request.attempts);
+        if (command_ == FtpCommandGet) {
+            sendRead(kCmdReadFile, pair.first, request.size);
+        }
+        else {
+            sendWrite(pair.first, request.size);
+        }
+        if (progress_ != nullptr) {
+            progress_->resend_count++;
         }
     }
 }
@@ -623,35 +801,88 @@ void MavLinkFtpClientImpl::handleReadResponse()
 {
     FtpPayload* payload = reinterpret_cast<FtpPayload*>(&last_message_.payload[0]);
     if (payload->req_opcode == kCmdOpenFileRO) {
+        if (remote_file_open_) {
+            // answer to an open we sent again.
+            return;
+        }
+        if (!createLocalFile()) {
+            // could not create the local file, so stop.
+            waiting_ = false;
+            reset();
+            return;
+        }
         remote_file_open_ = true;
         bytes_read_ = 0;
         retries_ = 0;
+        session_ = payload->session;
         sequence_ = payload->seq_number;
+        pending_.clear();
+        received_.clear();
         uint32_t* size = reinterpret_cast<uint32_t*>(&payload->data);
         file_size_ = static_cast<uint64_t>(*size);
         if (progress_ != nullptr) {
             progress_->goal = file_size_;
         }
-        nextStep();
+        if (burst_read_ && file_size_ > 0) {
+            startBurst(0);
+        }
+        else {
+            nextStep();
+        }
     }
-    else if (payload->req_opcode == kCmdReadFile) 
+    else if ((payload->req_opcode == kCmdReadFile || payload->req_opcode == kCmdBurstreadFile) && file_ptr_ != nullptr)
     {
-        int seq = static_cast<int>(payload->seq_number);
-        if (seq != sequence_ + 1)
-        {
-            Utils::log(Utils::stringf("packet %d is out of sequence, expecting number %d\n", seq, sequence_ + 1), Utils::kLogLevelError);
-            // perhaps this was a late response after we did a retry, so ignore it.
-            return;
+        // answers can arrive in any order, each one says where its data goes.
+        uint32_t offset = payload->offset;
+        uint32_t size = std::min(static_cast<uint32_t>(payload->size), kMaxDataLength);
+        if (payload->req_opcode == kCmdReadFile) {
+            pending_.erase(offset);
         }
-        else if (file_ptr_ != nullptr)
-        {
-            sequence_ = payload->seq_number;
-            fwrite(&payload->data, payload->size, 1, file_ptr_);
-            bytes_read_ += payload->size;
-            retries_ = 0;
-            nextStep();
+        else {
+            burst_packets_++;
+            burst_deadline_ = std::chrono::steady_clock::now() + getRequestTimeout(1);
+            if (payload->burst_complete != 0 || offset + size >= file_size_) {
+                burst_running_ = false;
+            }
+        }
+        uint32_t added = addReceived(offset, size);
+        if (added > 0) {
+            fseek(file_ptr_, offset, SEEK_SET);
+            fwrite(&payload->data, size, 1, file_ptr_);
+            bytes_read_ += added;
+        }
+        retries_ = 0;
+        fillReadWindow();
+    }
+}
+
+bool MavLinkFtpClientImpl::handleReadNak(FtpPayload* payload)
+{
+    // returns true if this nak is part of a windowed read rather than the end of the command.
+    if (command_ != FtpCommandGet || !remote_file_open_ || file_ptr_ == nullptr) {
+        return false;
+    }
+    int error = static_cast<int>(payload->data);
+    if (payload->req_opcode == kCmdBurstreadFile) {
+        if (error == kErrUnknownCommand) {
+            // older vehicle, stick to ReadFile from now on.
+            burst_read_ = false;
+        }
+        else if (error != kErrEOF) {
+            return false;
         }
+        burst_running_ = false;
+        fillReadWindow();
+        return true;
     }
+    if (payload->req_opcode == kCmdReadFile && error == kErrEOF) {
+        // the file is shorter than the vehicle said when it was opened.
+        pending_.erase(payload->offset);
+        file_size_ = std::min(file_size_, static_cast<uint64_t>(payload->offset));
+        fillReadWindow();
+        return true;
+    }
+    return false;
 }
 
 void MavLinkFtpClientImpl::handleWriteResponse()
@@ -659,27 +890,32 @@ void MavLinkFtpClientImpl::handleWriteResponse()
     FtpPayload* payload = reinterpret_cast<FtpPayload*>(&last_message_.payload[0]);
     if (payload->req_opcode == kCmdOpenFileWO)
     {
+        if (remote_file_open_) {
+            // answer to an open we sent again.
+            return;
+        }
         remote_file_open_ = true;
         bytes_written_ = 0;
         retries_ = 0;
+        session_ = payload->session;
         sequence_ = payload->seq_number;
+        next_write_offset_ = 0;
+        pending_.clear();
         nextStep();
     }
     else if (payload->req_opcode == kCmdWriteFile)
     {
-        int seq = static_cast<int>(payload->seq_number);
-        if (seq != sequence_ + 1)
-        {
-            Utils::log(Utils::stringf("packet %d is out of sequence, expecting number %d\n", seq, sequence_ + 1), Utils::kLogLevelError); 
-            // perhaps this was a late response after we did a retry, so ignore it.
+        // the ack carries the offset of the write it answers, a late answer to a write we already resent
+        // and got an answer for is ignored.
+        auto it = pending_.find(payload->offset);
+        if (it == pending_.end()) {
             return;
         }
-
         uint32_t* size = reinterpret_cast<uint32_t*>(&payload->data);
         // payload->size contains the bytes_written from PX4, so that's how much we advance.	
         bytes_written_ += static_cast<int>(*size);
+        pending_.erase(it);
         retries_ = 0;
-        sequence_++;
         nextStep();
     }
 }
@@ -706,11 +942,15 @@ void MavLinkFtpClientImpl::handleResponse(const MavLinkMessage& msg)
 {
     if (msg.msgid == static_cast<int>(MavLinkMessageIds::MAVLINK_MSG_ID_FILE_TRANSFER_PROTOCOL)) {
 
+        std::lock_guard<std::recursive_mutex> guard(state_mutex_);
         last_message_.decode(msg);
         recordMessageReceived();
 
         FtpPayload* payload = reinterpret_cast<FtpPayload*>(&last_message_.payload[0]);
-        if (payload->opcode == kRspNak) {
+        if (payload->opcode == kRspNak && handleReadNak(payload)) {
+            // more of the file is on its way.
+        }
+        else if (payload->opcode == kRspNak) {
 
             // reached the end of the list or the file.
             if (file_ptr_ != nullptr) {
@@ -756,6 +996,7 @@ void MavLinkFtpClientImpl::handleResponse(const MavLinkMessage& msg)
                 break;
             case kCmdOpenFileRO:
             case kCmdReadFile:
+            case kCmdBurstreadFile:
                 handleReadResponse();
                 break;
             case kCmdOpenFileWO:
@@ -785,6 +1026,7 @@ void MavLinkFtpClientImpl::handleResponse(const MavLinkMessage& msg)
 
 void MavLinkFtpClientImpl::MavLinkFtpClientImpl::retry()
 {
+    std::lock_guard<std::recursive_mutex> guard(state_mutex_);
     retries_++;
     if (retries_ < 10) 
     {
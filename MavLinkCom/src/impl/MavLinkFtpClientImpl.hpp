@@ -9,12 +9,15 @@
 #include <vector>
 #include <mutex>
 #include <chrono>
+#include <map>
 #include "MavLinkNode.hpp"
 #include "MavLinkNodeImpl.hpp"
 #include "MavLinkFtpClient.hpp"
 #include <stdio.h>
 #include <string>
 
+struct FtpPayload;
+
 namespace mavlinkcom_impl {
 
 	class MavLinkFtpClientImpl : public MavLinkNodeImpl
@@ -31,6 +34,8 @@ namespace mavlinkcom_impl {
         void mkdir(MavLinkFtpProgress& progress, const std::string& remotePath);
         void rmdir(MavLinkFtpProgress& progress, const std::string& remotePath);
 		void cancel();
+		void setWindowSize(int window);
+		void setBurstRead(bool enabled);
 	private:
 		void nextStep();
 		void listDirectory();
@@ -42,6 +47,7 @@ namespace mavlinkcom_impl {
 		void handleListResponse();
 		void handleReadResponse();
 		void handleWriteResponse();
+		bool handleReadNak(FtpPayload* payload);
 		void handleRemoveResponse();
         void handleRmdirResponse();
         void handleMkdirResponse();
@@ -55,6 +61,14 @@ namespace mavlinkcom_impl {
 		void recordMessageReceived();
 		void runStateMachine();
 		void retry();
+		void fillReadWindow();
+		void fillWriteWindow();
+		void startBurst(uint32_t offset);
+		void sendRead(uint8_t opcode, uint32_t offset, uint32_t size);
+		void sendWrite(uint32_t offset, uint32_t size);
+		void checkTimeouts();
+		uint32_t addReceived(uint32_t offset, uint32_t size);
+		void finishTransfer();
 		std::string replaceAll(std::string s, char toFind, char toReplace);
 		std::string normalize(std::string arg);
 		std::string toPX4Path(std::string arg);
@@ -87,6 +101,26 @@ namespace mavlinkcom_impl {
 		std::mutex mutex_;
 		std::vector<mavlinkcom::MavLinkFileInfo>* files_ = nullptr;
 		MavLinkFtpProgress* progress_ = nullptr;
+
+		// reads and writes keep up to window_size_ requests outstanding, by file offset, and resend each one
+		// that times out on its own.
+		struct PendingRequest {
+			uint32_t size;
+			int attempts;
+			std::chrono::steady_clock::time_point deadline;
+		};
+		std::map<uint32_t, PendingRequest> pending_;
+		// parts of the remote file received so far, start offset -> end offset.
+		std::map<uint32_t, uint32_t> received_;
+		uint32_t next_write_offset_ = 0;
+		uint8_t session_ = 0;
+		int window_size_ = 8;
+		bool burst_read_ = true;
+		bool burst_running_ = false;
+		int burst_packets_ = 0;
+		std::chrono::steady_clock::time_point burst_deadline_;
+		// handleResponse runs on the connection thread, checkTimeouts and retry on the thread waiting for the command.
+		std::recursive_mutex state_mutex_;
 	};
 }
 
@@ -5,6 +5,10 @@
 #include "Utils.hpp"
 #include "MavLinkMessages.hpp"
 #include "Semaphore.hpp"
+#include "FileSystem.hpp"
+#include "MavLinkParamFetcher.hpp"
+#include <fstream>
+#include <algorithm>
 
 using namespace mavlink_utils;
 
@@ -40,6 +44,18 @@ void MavLinkNodeImpl::startHeartbeat()
 {
     if (!heartbeat_running_) {
         heartbeat_running_ = true;
+
+        // with the event loop enabled the heartbeat is a timer on a shared loop thread.
+        std::shared_ptr<EventLoop> eventLoop = EventLoop::getShared();
+        if (eventLoop != nullptr) {
+            sendOneHeartbeat();
+            heartbeat_timer_ = eventLoop->addTimer(heartbeatMilliseconds, [this]() { sendOneHeartbeat(); });
+            if (heartbeat_timer_ >= 0) {
+                event_loop_ = eventLoop;
+                return;
+            }
+        }
+
         Utils::cleanupThread(heartbeat_thread_);
         heartbeat_thread_ = std::thread{ &MavLinkNodeImpl::sendHeartbeat, this };
     }
@@ -49,29 +65,33 @@ void MavLinkNodeImpl::startHeartbeat()
 void MavLinkNodeImpl::sendHeartbeat()
 {
     while (heartbeat_running_) {
-        MavLinkHeartbeat heartbeat;
-        // send a heart beat so that the remote node knows we are still alive
-        // (otherwise drone will trigger a failsafe operation).	
-        heartbeat.autopilot = static_cast<uint8_t>(MAV_AUTOPILOT::MAV_AUTOPILOT_GENERIC);
-        heartbeat.type = static_cast<uint8_t>(MAV_TYPE::MAV_TYPE_GCS);
-        heartbeat.mavlink_version = 3;
-        heartbeat.base_mode = 0; // ignored by PX4
-        heartbeat.custom_mode = 0; // ignored by PX4
-        heartbeat.system_status = 0; // ignored by PX4
-        try 
-        {
-            sendMessage(heartbeat);
-        }
-        catch (std::exception& e)
-        {
-            // ignore any failures here because we are running in our own thread here.
-            Utils::log(Utils::stringf("Caught and ignoring exception sending heartbeat: %s", e.what()));
-        }
-        
+        sendOneHeartbeat();
         std::this_thread::sleep_for(std::chrono::milliseconds(heartbeatMilliseconds));
     }
 }
 
+void MavLinkNodeImpl::sendOneHeartbeat()
+{
+    MavLinkHeartbeat heartbeat;
+    // send a heart beat so that the remote node knows we are still alive
+    // (otherwise drone will trigger a failsafe operation).	
+    heartbeat.autopilot = static_cast<uint8_t>(MAV_AUTOPILOT::MAV_AUTOPILOT_GENERIC);
+    heartbeat.type = static_cast<uint8_t>(MAV_TYPE::MAV_TYPE_GCS);
+    heartbeat.mavlink_version = 3;
+    heartbeat.base_mode = 0; // ignored by PX4
+    heartbeat.custom_mode = 0; // ignored by PX4
+    heartbeat.system_status = 0; // ignored by PX4
+    try 
+    {
+        sendMessage(heartbeat);
+    }
+    catch (std::exception& e)
+    {
+        // ignore any failures here because we are running in a background thread here.
+        Utils::log(Utils::stringf("Caught and ignoring exception sending heartbeat: %s", e.what()));
+    }
+}
+
 // this is called for all messages received on the connection.
 void MavLinkNodeImpl::handleMessage(std::shared_ptr<MavLinkConnection> connection, const MavLinkMessage& msg)
 {
@@ -90,8 +110,10 @@ void MavLinkNodeImpl::handleMessage(std::shared_ptr<MavLinkConnection> connectio
         }
         break;
     case static_cast<uint8_t>(MavLinkMessageIds::MAVLINK_MSG_ID_AUTOPILOT_VERSION):
-        cap_.decode(msg);
-        has_cap_ = true;
+        if (!has_cap_) {
+            cap_.decode(msg);
+            has_cap_ = true;
+        }
         break;
     }
 
@@ -108,6 +130,11 @@ void MavLinkNodeImpl::close()
     }
     if (heartbeat_running_) {
         heartbeat_running_ = false;
+        if (event_loop_ != nullptr) {
+            event_loop_->removeTimer(heartbeat_timer_);
+            heartbeat_timer_ = -1;
+            event_loop_ = nullptr;
+        }
         if (heartbeat_thread_.joinable()) {
             heartbeat_thread_.join();
         }
@@ -136,7 +163,11 @@ AsyncResult<MavLinkAutopilotVersion> MavLinkNodeImpl::getCapabilities()
 
     int subscription = con->subscribe([=](std::shared_ptr<MavLinkConnection> connection, const MavLinkMessage& m) {
         unused(connection);
-        result.setResult(cap_);
+        if (m.msgid == MavLinkAutopilotVersion::kMessageId) {
+            MavLinkAutopilotVersion cap;
+            cap.decode(m);
+            result.setResult(cap);
+        }
     });
 
     result.setState(subscription);
@@ -291,99 +322,111 @@ float PackParameter(uint8_t type, float param_value)
 
 std::vector<MavLinkParameter> MavLinkNodeImpl::getParamList()
 {
-    std::vector<MavLinkParameter> result;
-    bool done = false;
-    Semaphore paramReceived;
-    bool waiting = false;
-    size_t paramCount = 0;
-
     auto con = ensureConnection();
-    int subscription = con->subscribe([&](std::shared_ptr<MavLinkConnection> connection, const MavLinkMessage& message) {
-        unused(connection);
-        if (message.msgid == MavLinkParamValue::kMessageId)
-        {
-            MavLinkParamValue param;
-            param.decode(message);
-            MavLinkParameter  p;
-            p.index = param.param_index;
-            p.type = param.param_type;
-            char buf[17];
-            std::memset(buf, 0, 17);
-            std::memcpy(buf, param.param_id, 16);
-            p.name = buf;
-            p.value = param.param_value;
-            result.push_back(p);
-            paramCount = param.param_count;
-            if (param.param_index == param.param_count - 1)
-            {
-                done = true;
-            }
-            if (waiting) {
-                paramReceived.post();
-            }
-        }
+    MavLinkParamFetcher fetcher(con, getTargetSystemId(), getTargetComponentId(), [this](MavLinkMessageBase& msg) {
+        sendMessage(msg);
     });
 
-    //MAVLINK_MSG_ID_PARAM_REQUEST_LIST	
-    MavLinkParamRequestList cmd;
-    cmd.target_system = getTargetSystemId();
-    cmd.target_component = getTargetComponentId();
-    sendMessage(cmd);
-
-    while (!done) {
-        waiting = true;
-        if (!paramReceived.timed_wait(3000))
-        {
-            // timeout, so we'll drop through to the code below which will try and fix this...
-            done = true;
-        }
-        waiting = false;
-    }
-    con->unsubscribe(subscription);
-
-    // note that UDP does not guarantee delivery of messages, so we have to also check if some parameters are missing and get them individually.
-    std::vector<size_t> missing;
-
-    for (size_t i = 0; i < paramCount; i++)
-    {		
-        // nested loop is inefficient, but it is needed because UDP also doesn't guarantee in-order delivery
-        bool found = false;
-        for (auto iter = result.begin(), end = result.end(); iter != end; iter++)
-        {
-            MavLinkParameter p = *iter;
-            if (static_cast<size_t>(p.index) == i) {
-                found = true;
-                break;
-            }
-        }
-        if (!found) {
-            missing.push_back(i);
-        }
-    }
-
-    // ok, now fetch the missing parameters.
-    for (auto iter = missing.begin(), end = missing.end(); iter != end; iter++)
-    {
-        size_t index = *iter;
-        MavLinkParameter r;
-        if (getParameterByIndex(static_cast<int16_t>(*iter)).wait(2000, &r)) {
-            result.push_back(r);
-        }
-        else {
-            Utils::log(Utils::stringf("Paremter %d does not seem to exist", index), Utils::kLogLevelWarn);
+    // the hash covers every parameter, so if it matches the one we saved with the cache nothing has changed.
+    std::string cacheFile = getParamCacheFile();
+    uint32_t hash = 0;
+    bool hasHash = false;
+    std::vector<MavLinkParameter> result;
+    if (cacheFile.size() > 0) {
+        hasHash = fetcher.fetchHash(hash);
+        if (hasHash && loadParamCache(cacheFile, hash, result)) {
+            this->parameters_ = result;
+            return result;
         }
     }
 
+    result = fetcher.fetchAll();
 
     std::sort(result.begin(), result.end(), [&](const MavLinkParameter & p1, const MavLinkParameter & p2) {
         return p1.name.compare(p2.name) < 0;
     });
 
+    if (hasHash) {
+        // only save the list if nothing changed while we were downloading it.
+        uint32_t after = 0;
+        if (fetcher.fetchHash(after) && after == hash) {
+            saveParamCache(cacheFile, hash, result);
+        }
+    }
+
     this->parameters_ = result;
 
     return result;
 }
 
+void MavLinkNodeImpl::setParamCacheFolder(const std::string& folder)
+{
+    param_cache_folder_ = folder;
+}
+
+std::string MavLinkNodeImpl::getParamCacheFile()
+{
+    if (param_cache_folder_.size() == 0) {
+        return "";
+    }
+    // one file per vehicle, told apart by its uid and firmware version when it has already reported them
+    // (we ask for them on the first heartbeat).  We don't wait for them here, the cache is checked
+    // against the parameter hash anyway so the plain system id is a safe fallback.
+    if (has_cap_) {
+        return FileSystem::combine(param_cache_folder_, Utils::stringf("params_%d_%llx_%x.txt", getTargetSystemId(),
+            static_cast<unsigned long long>(cap_.uid), cap_.flight_sw_version));
+    }
+    return FileSystem::combine(param_cache_folder_, Utils::stringf("params_%d.txt", getTargetSystemId()));
+}
+
+bool MavLinkNodeImpl::loadParamCache(const std::string& file, uint32_t hash, std::vector<MavLinkParameter>& result)
+{
+    // first line is the hash and the number of parameters, then one "name index type value" line per
+    // parameter with the value as the hex bits of the float so it comes back exactly as it was received.
+    std::ifstream stream(file);
+    if (!stream.good()) {
+        return false;
+    }
+    uint32_t savedHash = 0;
+    size_t count = 0;
+    stream >> std::hex >> savedHash >> std::dec >> count;
+    if (!stream.good() || savedHash != hash) {
+        return false;
+    }
+    result.clear();
+    for (size_t i = 0; i < count; i++) {
+        MavLinkParameter p;
+        int type = 0;
+        uint32_t bits = 0;
+        stream >> p.name >> std::dec >> p.index >> type >> std::hex >> bits;
+        if (stream.fail()) {
+            Utils::log(Utils::stringf("Ignoring damaged parameter cache '%s'", file.c_str()), Utils::kLogLevelWarn);
+            result.clear();
+            return false;
+        }
+        p.type = static_cast<uint8_t>(type);
+        std::memcpy(&p.value, &bits, sizeof(bits));
+        result.push_back(p);
+    }
+    return true;
+}
+
+void MavLinkNodeImpl::saveParamCache(const std::string& file, uint32_t hash, const std::vector<MavLinkParameter>& params)
+{
+    std::ofstream stream(file);
+    if (!stream.good()) {
+        // the cache only saves time, so this is not an error.
+        Utils::log(Utils::stringf("Could not write parameter cache '%s'", file.c_str()), Utils::kLogLevelWarn);
+        return;
+    }
+    stream << std::hex << hash << " " << std::dec << params.size() << "\n";
+    for (const MavLinkParameter& p : params) {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &p.value, sizeof(bits));
+        stream << p.name << " " << std::dec << p.index << " " << static_cast<int>(p.type) << " " << std::hex << bits << "\n";
+    }
+}
+
 
 MavLinkParameter MavLinkNodeImpl::getCachedParameter(const std::string& name)
 {
@@ -448,43 +491,12 @@ AsyncResult<MavLinkParameter> MavLinkNodeImpl::getParameter(const std::string& n
     return asyncResult;
 }
 
-AsyncResult<MavLinkParameter> MavLinkNodeImpl::getParameterByIndex(int16_t index)
+std::vector<MavLinkParameter> MavLinkNodeImpl::getParameters(const std::vector<std::string>& names)
 {
-    auto con = ensureConnection();
-    AsyncResult<MavLinkParameter> asyncResult([=](int state) {
-        con->unsubscribe(state);
-    });
-
-    MavLinkParamRequestRead cmd;
-    cmd.param_id[0] = '\0';
-    cmd.param_index = index;
-    cmd.target_component = getTargetComponentId();
-    cmd.target_system = getTargetSystemId();
-
-    int subscription = con->subscribe([=](std::shared_ptr<MavLinkConnection> connection, const MavLinkMessage& message) {
-        unused(connection);
-        if (message.msgid == MavLinkParamValue::kMessageId)
-        {
-            MavLinkParamValue param;
-            param.decode(message);
-            if (param.param_index == index)
-            {
-                MavLinkParameter  result;
-                char buf[17];
-                std::memset(buf, 0, 17);
-                std::memcpy(buf, param.param_id, 16);
-                result.name = buf;
-                result.type = param.param_type;
-                result.index = param.param_index;
-                result.value = UnpackParameter(param.param_type, param.param_value);
-                asyncResult.setResult(result);
-            }
-        }
+    MavLinkParamFetcher fetcher(ensureConnection(), getTargetSystemId(), getTargetComponentId(), [this](MavLinkMessageBase& msg) {
+        sendMessage(msg);
     });
-    asyncResult.setState(subscription);
-    sendMessage(cmd);
-
-    return asyncResult;
+    return fetcher.fetchByName(names);
 }
 
 AsyncResult<bool> MavLinkNodeImpl::setParameter(MavLinkParameter  p)
@@ -500,16 +512,8 @@ AsyncResult<bool> MavLinkNodeImpl::setParameter(MavLinkParameter  p)
     AsyncResult<bool> result([=](int state) {
         con->unsubscribe(state);
     });
-    bool gotit = false;
-    MavLinkParameter q;
-    for (size_t i = 0; i < 3; i++)
-    {
-        if (getParameter(p.name).wait(2000, &q)) {
-            gotit = true;
-            break;
-        }
-    }
-    if (!gotit) {
+    MavLinkParameter q = getParameters(std::vector<std::string>{ p.name })[0];
+    if (q.index < 0) {
         throw std::runtime_error(Utils::stringf("Error: parameter name '%s' was not found", p.name.c_str()));
     }
     MavLinkParamSet setparam;
@@ -553,6 +557,15 @@ void MavLinkNodeImpl::sendMessage(MavLinkMessage& msg)
     ensureConnection()->sendMessage(msg);
 }
 
+void MavLinkNodeImpl::sendMessages(std::vector<MavLinkMessage>& messages)
+{
+    for (MavLinkMessage& msg : messages) {
+        msg.compid = local_component_id;
+        msg.sysid = local_system_id;
+    }
+    ensureConnection()->sendMessages(messages);
+}
+
 void MavLinkNodeImpl::sendCommand(MavLinkCommand& command)
 {
     MavLinkCommandLong cmd{};
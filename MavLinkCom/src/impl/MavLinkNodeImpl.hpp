@@ -6,6 +6,8 @@
 
 #include "MavLinkNode.hpp"
 #include "MavLinkConnection.hpp"
+#include "EventLoop.hpp"
+#include <atomic>
 
 using namespace mavlinkcom;
 
@@ -25,12 +27,14 @@ namespace mavlinkcom_impl {
         void startHeartbeat();
 
         std::vector<MavLinkParameter> getParamList();
+        void setParamCacheFolder(const std::string& folder);
 
         // get the parameter value cached from last getParamList call.
         MavLinkParameter getCachedParameter(const std::string& name);
 
         // get up to date value of this parametr
         AsyncResult<MavLinkParameter> getParameter(const std::string& name);
+        std::vector<MavLinkParameter> getParameters(const std::vector<std::string>& names);
 
         AsyncResult<bool> setParameter(MavLinkParameter p);
         AsyncResult<MavLinkAutopilotVersion> getCapabilities();
@@ -75,6 +79,9 @@ namespace mavlinkcom_impl {
         // Send an already encoded messge to connected node 
         void sendMessage(MavLinkMessage& msg);
 
+        // Send already encoded messages to the connected node together
+        void sendMessages(std::vector<MavLinkMessage>& messages);
+
         // send a command to the remote node
         void sendCommand(MavLinkCommand& cmd);
 
@@ -86,18 +93,26 @@ namespace mavlinkcom_impl {
         virtual void handleMessage(std::shared_ptr<MavLinkConnection> connection, const MavLinkMessage& message);
     private:
         void sendHeartbeat();
-        AsyncResult<MavLinkParameter> getParameterByIndex(int16_t index);
+        void sendOneHeartbeat();
+        std::string getParamCacheFile();
+        bool loadParamCache(const std::string& file, uint32_t hash, std::vector<MavLinkParameter>& result);
+        void saveParamCache(const std::string& file, uint32_t hash, const std::vector<MavLinkParameter>& params);
         bool inside_handle_message_;
         std::shared_ptr<MavLinkConnection> connection_;
         int subscription_ = 0;
         int local_system_id;
         int local_component_id;
         std::vector<MavLinkParameter> parameters_; //cached snapshot.
+        std::string param_cache_folder_;
         MavLinkAutopilotVersion cap_;
-        bool has_cap_ = false;
+        // set once cap_ holds the first AUTOPILOT_VERSION, cap_ is not written after that.
+        std::atomic<bool> has_cap_{ false };
         bool req_cap_ = false;
         bool heartbeat_running_ = false;
         std::thread heartbeat_thread_;
+        // used instead of heartbeat_thread_ when the event loop is enabled.
+        std::shared_ptr<EventLoop> event_loop_;
+        int heartbeat_timer_ = -1;
     };
 }
 
@@ -0,0 +1,293 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "MavLinkParamFetcher.hpp"
+#include "Utils.hpp"
+#include <cstring>
+#include <algorithm>
+
+using namespace mavlink_utils;
+using namespace mavlinkcom_impl;
+
+const int MavLinkParamFetcher::kWindow;
+const int MavLinkParamFetcher::kMaxAttempts;
+const int MavLinkParamFetcher::kFirstTimeoutMilliseconds;
+const int MavLinkParamFetcher::kMaxTimeoutMilliseconds;
+const int MavLinkParamFetcher::kStreamIdleMilliseconds;
+
+// in MavLinkNodeImpl.cpp
+float UnpackParameter(uint8_t type, float param_value);
+
+namespace {
+    const char* kHashCheckName = "_HASH_CHECK";
+
+    std::chrono::milliseconds getTimeout(int attempts)
+    {
+        int timeout = MavLinkParamFetcher::kFirstTimeoutMilliseconds;
+        for (int i = 1; i < attempts && timeout < MavLinkParamFetcher::kMaxTimeoutMilliseconds; i++) {
+            timeout *= 2;
+        }
+        return std::chrono::milliseconds(std::min(timeout, MavLinkParamFetcher::kMaxTimeoutMilliseconds));
+    }
+}
+
+MavLinkParamFetcher::MavLinkParamFetcher(std::shared_ptr<MavLinkConnection> connection, int targetSystem, int targetComponent, SendHandler send)
+    : connection_(connection), target_system_(targetSystem), target_component_(targetComponent), send_(send)
+{
+    subscription_ = connection_->subscribe([this](std::shared_ptr<MavLinkConnection> con, const MavLinkMessage& message) {
+        unused(con);
+        handleMessage(message);
+    });
+}
+
+MavLinkParamFetcher::~MavLinkParamFetcher()
+{
+    connection_->unsubscribe(subscription_);
+}
+
+MavLinkParameter MavLinkParamFetcher::toParameter(const MavLinkParamValue& param)
+{
+    MavLinkParameter p;
+    char buf[17];
+    std::memset(buf, 0, 17);
+    std::memcpy(buf, param.param_id, 16);
+    p.name = buf;
+    p.index = param.param_index;
+    p.type = param.param_type;
+    p.value = param.param_value;
+    return p;
+}
+
+void MavLinkParamFetcher::handleMessage(const MavLinkMessage& message)
+{
+    if (message.msgid != MavLinkParamValue::kMessageId) {
+        return;
+    }
+    MavLinkParamValue param;
+    param.decode(message);
+    MavLinkParameter p = toParameter(param);
+
+    std::lock_guard<std::mutex> guard(mutex_);
+    received_++;
+    last_received_ = std::chrono::steady_clock::now();
+
+    if (p.name == kHashCheckName) {
+        // the hash is a uint32 sent in the float.
+        std::memcpy(&hash_, &param.param_value, sizeof(hash_));
+        has_hash_ = true;
+    }
+    else {
+        if (param.param_count > 0 && param.param_count != param_count_) {
+            param_count_ = param.param_count;
+            params_.resize(param_count_);
+        }
+        if (p.index >= 0 && p.index < static_cast<int>(params_.size())) {
+            if (params_[p.index].index < 0) {
+                have_++;
+            }
+            params_[p.index] = p;
+        }
+        for (auto& named : named_) {
+            if (named.name == p.name) {
+                named.index = p.index;
+                named.type = p.type;
+                named.value = UnpackParameter(p.type, p.value);
+            }
+        }
+    }
+    changed_.notify_all();
+}
+
+size_t MavLinkParamFetcher::getReceivedCount()
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    return received_;
+}
+
+bool MavLinkParamFetcher::requestList()
+{
+    // resend PARAM_REQUEST_LIST until the first PARAM_VALUE tells us how many parameters there are.
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (int attempts = 1; attempts <= kMaxAttempts && param_count_ < 0; attempts++) {
+        lock.unlock();
+        MavLinkParamRequestList cmd;
+        cmd.target_system = static_cast<uint8_t>(target_system_);
+        cmd.target_component = static_cast<uint8_t>(target_component_);
+        send_(cmd);
+        lock.lock();
+        auto deadline = std::chrono::steady_clock::now() + getTimeout(attempts);
+        changed_.wait_until(lock, deadline, [this] { return param_count_ >= 0; });
+    }
+    if (param_count_ < 0) {
+        return false;
+    }
+
+    // then let the stream run until it has everything or goes quiet.
+    while (have_ < params_.size()) {
+        auto idle = last_received_ + std::chrono::milliseconds(kStreamIdleMilliseconds);
+        if (std::chrono::steady_clock::now() >= idle) {
+            break;
+        }
+        changed_.wait_until(lock, idle);
+    }
+    return true;
+}
+
+std::vector<MavLinkParameter> MavLinkParamFetcher::fetchAll()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        param_count_ = -1;
+        have_ = 0;
+        params_.clear();
+    }
+    std::vector<MavLinkParameter> result;
+    if (!requestList()) {
+        Utils::log("Vehicle did not answer PARAM_REQUEST_LIST", Utils::kLogLevelWarn);
+        return result;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    // note that UDP does not guarantee delivery of messages, so fetch the missing ones individually.
+    std::vector<Request> requests;
+    for (size_t i = 0; i < params_.size(); i++) {
+        if (params_[i].index < 0) {
+            Request r;
+            r.index = static_cast<int16_t>(i);
+            requests.push_back(r);
+        }
+    }
+    run(requests, lock);
+
+    for (size_t i = 0; i < params_.size(); i++) {
+        if (params_[i].index < 0) {
+            Utils::log(Utils::stringf("Parameter %d does not seem to exist", static_cast<int>(i)), Utils::kLogLevelWarn);
+        }
+        else {
+            result.push_back(params_[i]);
+        }
+    }
+    return result;
+}
+
+std::vector<MavLinkParameter> MavLinkParamFetcher::fetchByName(const std::vector<std::string>& names)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    named_.clear();
+    std::vector<Request> requests;
+    for (size_t i = 0; i < names.size(); i++) {
+        if (names[i].size() > 16) {
+            throw std::runtime_error(Utils::stringf("Error: parameter name '%s' is too long, must be <= 16 chars", names[i].c_str()));
+        }
+        MavLinkParameter p;
+        p.name = names[i];
+        named_.push_back(p);
+
+        Request r;
+        r.index = -1;
+        r.name = names[i];
+        r.slot = i;
+        requests.push_back(r);
+    }
+    run(requests, lock);
+
+    std::vector<MavLinkParameter> result;
+    result.swap(named_);
+    return result;
+}
+
+bool MavLinkParamFetcher::fetchHash(uint32_t& hash)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    has_hash_ = false;
+    std::vector<Request> requests(1);
+    requests[0].index = -1;
+    requests[0].name = kHashCheckName;
+    run(requests, lock);
+    hash = hash_;
+    return has_hash_;
+}
+
+bool MavLinkParamFetcher::isAnswered(const Request& request)
+{
+    if (request.index >= 0) {
+        return static_cast<size_t>(request.index) < params_.size() && params_[request.index].index >= 0;
+    }
+    if (request.name == kHashCheckName) {
+        return has_hash_;
+    }
+    return named_[request.slot].index >= 0;
+}
+
+void MavLinkParamFetcher::sendRead(const Request& request)
+{
+    MavLinkParamRequestRead cmd;
+    std::memset(cmd.param_id, 0, sizeof(cmd.param_id));
+    // param_id is not null terminated when the name fills all of it.
+    std::memcpy(cmd.param_id, request.name.data(), std::min(request.name.size(), sizeof(cmd.param_id)));
+    cmd.param_index = request.index;
+    cmd.target_system = static_cast<uint8_t>(target_system_);
+    cmd.target_component = static_cast<uint8_t>(target_component_);
+    send_(cmd);
+}
+
+void MavLinkParamFetcher::run(std::vector<Request>& requests, std::unique_lock<std::mutex>& lock)
+{
+    std::vector<size_t> sends;
+    while (true) {
+        auto now = std::chrono::steady_clock::now();
+        auto wake = time_point::max();
+        int outstanding = 0;
+        sends.clear();
+
+        for (size_t i = 0; i < requests.size(); i++) {
+            Request& r = requests[i];
+            if (r.done) {
+                continue;
+            }
+            if (isAnswered(r)) {
+                r.done = true;
+                continue;
+            }
+            if (r.attempts > 0 && r.deadline > now) {
+                outstanding++;
+                wake = std::min(wake, r.deadline);
+                continue;
+            }
+            if (r.attempts >= kMaxAttempts) {
+                // give up on this one.
+                r.done = true;
+                continue;
+            }
+            // never sent, or timed out and due for a retry.
+            sends.push_back(i);
+        }
+
+        if (sends.size() == 0 && outstanding == 0) {
+            break;
+        }
+
+        // fill the window in request order, so retries of the early gaps go ahead of new requests.
+        size_t room = outstanding < kWindow ? static_cast<size_t>(kWindow - outstanding) : 0;
+        if (sends.size() > room) {
+            sends.resize(room);
+        }
+        for (size_t i : sends) {
+            Request& r = requests[i];
+            r.attempts++;
+            r.deadline = now + getTimeout(r.attempts);
+            wake = std::min(wake, r.deadline);
+        }
+
+        size_t received = received_;
+        if (sends.size() > 0) {
+            lock.unlock();
+            for (size_t i : sends) {
+                sendRead(requests[i]);
+            }
+            lock.lock();
+        }
+        // answers that came in while we were sending have already been notified.
+        changed_.wait_until(lock, wake, [&] { return received_ != received; });
+    }
+}
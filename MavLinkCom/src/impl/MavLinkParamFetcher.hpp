@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef MavLinkCom_MavLinkParamFetcher_hpp
+#define MavLinkCom_MavLinkParamFetcher_hpp
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <functional>
+#include "MavLinkNode.hpp"
+#include "MavLinkConnection.hpp"
+#include "MavLinkMessages.hpp"
+
+using namespace mavlinkcom;
+
+namespace mavlinkcom_impl {
+
+    // Downloads parameters from a vehicle.  PARAM_REQUEST_LIST streams the whole list but on a lossy link some
+    // of it goes missing, so the gaps are then requested by index with PARAM_REQUEST_READ, keeping up to
+    // kWindow requests outstanding at a time instead of waiting for each answer in turn.  A request that gets
+    // no answer is sent again with its timeout doubled each time, up to kMaxAttempts sends.
+    class MavLinkParamFetcher
+    {
+    public:
+        static const int kWindow = 16;
+        static const int kMaxAttempts = 5;
+        static const int kFirstTimeoutMilliseconds = 200;
+        static const int kMaxTimeoutMilliseconds = 1000;
+        // how long the PARAM_REQUEST_LIST stream can go quiet before we start filling the gaps.
+        static const int kStreamIdleMilliseconds = 500;
+
+        typedef std::function<void(MavLinkMessageBase& msg)> SendHandler;
+
+        MavLinkParamFetcher(std::shared_ptr<MavLinkConnection> connection, int targetSystem, int targetComponent, SendHandler send);
+        ~MavLinkParamFetcher();
+
+        // fetch every parameter, values are left packed as they arrive in PARAM_VALUE and the result is in
+        // index order.  Indexes that never arrived are logged and left out.
+        std::vector<MavLinkParameter> fetchAll();
+
+        // fetch the given parameters by name, values are unpacked.  The result is in the same order as names
+        // and parameters that were not found have index -1.
+        std::vector<MavLinkParameter> fetchByName(const std::vector<std::string>& names);
+
+        // ask for the "_HASH_CHECK" pseudo parameter PX4 uses to tell whether its parameters have changed.
+        // Returns false if the vehicle does not answer.
+        bool fetchHash(uint32_t& hash);
+
+        // number of PARAM_VALUE messages received so far.
+        size_t getReceivedCount();
+
+        static MavLinkParameter toParameter(const MavLinkParamValue& param);
+
+    private:
+        typedef std::chrono::steady_clock::time_point time_point;
+        struct Request {
+            int16_t index;
+            std::string name;
+            // position in named_ for requests made by fetchByName.
+            size_t slot = 0;
+            int attempts = 0;
+            time_point deadline;
+            bool done = false;
+        };
+
+        void handleMessage(const MavLinkMessage& message);
+        bool requestList();
+        // runs the window over requests until each one is answered or runs out of attempts.
+        void run(std::vector<Request>& requests, std::unique_lock<std::mutex>& lock);
+        bool isAnswered(const Request& request);
+        void sendRead(const Request& request);
+
+        std::shared_ptr<MavLinkConnection> connection_;
+        int subscription_ = 0;
+        int target_system_;
+        int target_component_;
+        SendHandler send_;
+
+        std::mutex mutex_;
+        std::condition_variable changed_;
+        size_t received_ = 0;
+        time_point last_received_;
+        int param_count_ = -1;
+        size_t have_ = 0;
+        // by index, params_[i].index is -1 until it arrives.
+        std::vector<MavLinkParameter> params_;
+        // answers to fetchByName, unpacked.
+        std::vector<MavLinkParameter> named_;
+        bool has_hash_ = false;
+        uint32_t hash_ = 0;
+    };
+}
+
+#endif
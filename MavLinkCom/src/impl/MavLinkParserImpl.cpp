@@ -0,0 +1,102 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "MavLinkParserImpl.hpp"
+#include "MavLinkCrc.hpp"
+#include <cstring>
+
+using namespace mavlinkcom_impl;
+
+MavLinkParserImpl::MavLinkParserImpl()
+{
+    ::memset(&buffer_, 0, sizeof(buffer_));
+    ::memset(&msg_, 0, sizeof(msg_));
+    ::memset(&status_, 0, sizeof(status_));
+    ::memset(&msg_status_, 0, sizeof(msg_status_));
+    reset();
+}
+
+void MavLinkParserImpl::reset()
+{
+    status_.parse_state = MAVLINK_PARSE_STATE_IDLE;
+}
+
+int MavLinkParserImpl::parseFrame(const uint8_t* buffer, int count)
+{
+    bool mavlink1 = buffer[0] == MAVLINK_STX_MAVLINK1;
+    int header_len = mavlink1 ? MAVLINK_CORE_HEADER_MAVLINK1_LEN + 1 : MAVLINK_CORE_HEADER_LEN + 1;
+    if (count < header_len) {
+        return 0;
+    }
+    uint8_t len = buffer[1];
+    int frame_len = header_len + len + 2;
+    // any incompat flag means signing or something we don't understand, leave those to the byte parser.
+    // So are empty payloads, which mavlink never sends (mavlink2 trimming keeps at least one byte) and
+    // which the byte parser doesn't handle, it takes the crc for the first payload byte.
+    if (count < frame_len || len == 0 || (!mavlink1 && buffer[2] != 0)) {
+        return 0;
+    }
+
+    uint32_t msgid = mavlink1 ? buffer[5] : (buffer[7] | (buffer[8] << 8) | (buffer[9] << 16));
+    const mavlink_msg_entry_t* entry = mavlink_get_msg_entry(msgid);
+    const uint8_t* payload = buffer + header_len;
+    uint16_t checksum = MavLinkCrc::accumulate(MavLinkCrc::kInitial, buffer + 1, header_len - 1 + len);
+    checksum = MavLinkCrc::accumulate(checksum, entry != nullptr ? entry->crc_extra : 0);
+    uint8_t ck0 = payload[len];
+    uint8_t ck1 = payload[len + 1];
+    if (ck0 != (checksum & 0xFF) || ck1 != (checksum >> 8)) {
+        return 0;
+    }
+
+    // fill in the message and status exactly the way mavlink_frame_char_buffer would.
+    msg_.magic = buffer[0];
+    msg_.len = len;
+    if (mavlink1) {
+        msg_.incompat_flags = 0;
+        msg_.compat_flags = 0;
+        msg_.seq = buffer[2];
+        msg_.sysid = buffer[3];
+        msg_.compid = buffer[4];
+    }
+    else {
+        msg_.incompat_flags = buffer[2];
+        msg_.compat_flags = buffer[3];
+        msg_.seq = buffer[4];
+        msg_.sysid = buffer[5];
+        msg_.compid = buffer[6];
+    }
+    msg_.msgid = msgid;
+    char* msg_payload = reinterpret_cast<char*>(msg_.payload64);
+    ::memcpy(msg_payload, payload, len);
+    if (entry != nullptr && len < entry->msg_len) {
+        // zero-fill the payload to cope with mavlink2 trimming trailing zeros.
+        ::memset(msg_payload + len, 0, entry->msg_len - len);
+    }
+    msg_.checksum = checksum;
+    msg_.ck[0] = ck0;
+    msg_.ck[1] = ck1;
+
+    if (mavlink1) {
+        status_.flags |= MAVLINK_STATUS_FLAG_IN_MAVLINK1;
+    }
+    else {
+        status_.flags &= ~MAVLINK_STATUS_FLAG_IN_MAVLINK1;
+    }
+    status_.msg_received = MAVLINK_FRAMING_OK;
+    status_.parse_state = MAVLINK_PARSE_STATE_IDLE;
+    status_.packet_idx = len;
+    status_.current_rx_seq = msg_.seq;
+    if (status_.packet_rx_success_count == 0) {
+        status_.packet_rx_drop_count = 0;
+    }
+    status_.packet_rx_success_count++;
+    status_.parse_error = 0;
+
+    msg_status_.parse_state = status_.parse_state;
+    msg_status_.packet_idx = status_.packet_idx;
+    msg_status_.current_rx_seq = status_.current_rx_seq + 1;
+    msg_status_.packet_rx_success_count = status_.packet_rx_success_count;
+    msg_status_.packet_rx_drop_count = 0;
+    msg_status_.flags = status_.flags;
+    return frame_len;
+}
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef MavLinkCom_MavLinkParserImpl_hpp
+#define MavLinkCom_MavLinkParserImpl_hpp
+
+#include "StrictMode.hpp"
+#define MAVLINK_PACKED
+
+STRICT_MODE_OFF
+#include "../mavlink/common/mavlink.h"
+#include "../mavlink/mavlink_helpers.h"
+#include "../mavlink/mavlink_types.h"
+STRICT_MODE_ON
+
+namespace mavlinkcom_impl {
+
+    // Turns the bytes read from a port in to mavlink messages.  When it is between frames it looks for the
+    // next start marker and, if the whole frame is in the buffer, checks it in one go with MavLinkCrc.
+    // Anything else (a frame split across two reads, a bad crc, signed frames, garbage) goes through
+    // mavlink_frame_char_buffer a byte at a time until that is back between frames, so the messages and
+    // errors reported are the same as feeding every byte to mavlink_frame_char_buffer.
+    class MavLinkParserImpl
+    {
+    public:
+        MavLinkParserImpl();
+
+        // forget any partly parsed frame.
+        void reset();
+
+        // turning this off feeds every byte to mavlink_frame_char_buffer, for comparison.
+        void setFastPath(bool enabled) { fast_path_ = enabled; }
+
+        // calls onFrame(uint8_t frameState, const mavlink_message_t& msg) for every frame that completes,
+        // frameState is MAVLINK_FRAMING_OK, MAVLINK_FRAMING_BAD_CRC or MAVLINK_FRAMING_BAD_SIGNATURE.
+        // msg is only valid during the call.
+        template <typename THandler>
+        void parse(const uint8_t* buffer, int count, THandler&& onFrame)
+        {
+            int i = 0;
+            while (i < count) {
+                if (fast_path_ && isBetweenFrames()) {
+                    // the byte parser ignores everything up to the next start marker.
+                    while (i < count && buffer[i] != MAVLINK_STX && buffer[i] != MAVLINK_STX_MAVLINK1) {
+                        i++;
+                    }
+                    if (i == count) {
+                        break;
+                    }
+                    int used = parseFrame(buffer + i, count - i);
+                    if (used > 0) {
+                        i += used;
+                        onFrame(static_cast<uint8_t>(MAVLINK_FRAMING_OK), static_cast<const mavlink_message_t&>(msg_));
+                        continue;
+                    }
+                }
+                uint8_t frameState = mavlink_frame_char_buffer(&buffer_, &status_, buffer[i++], &msg_, &msg_status_);
+                if (frameState != MAVLINK_FRAMING_INCOMPLETE) {
+                    onFrame(frameState, static_cast<const mavlink_message_t&>(msg_));
+                }
+            }
+        }
+
+        // status of the last frame, flags tell whether it was mavlink1.
+        const mavlink_status_t& getStatus() { return status_; }
+
+    private:
+        bool isBetweenFrames()
+        {
+            return (status_.parse_state == MAVLINK_PARSE_STATE_IDLE || status_.parse_state == MAVLINK_PARSE_STATE_UNINIT) &&
+                status_.signing == nullptr;
+        }
+
+        // returns the length of the frame at the start of buffer if it is complete, unsigned and has a good crc,
+        // otherwise 0 and the byte parser takes over.
+        int parseFrame(const uint8_t* buffer, int count);
+
+        bool fast_path_ = true;
+        mavlink_message_t buffer_;
+        mavlink_message_t msg_;
+        mavlink_status_t status_;
+        mavlink_status_t msg_status_;
+    };
+}
+
+#endif
@@ -0,0 +1,84 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef MavLinkCom_SpscRing_hpp
+#define MavLinkCom_SpscRing_hpp
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+namespace mavlinkcom_impl {
+
+    // Bounded lock-free queue for exactly one producer thread and one consumer thread.
+    // Slots are allocated once up front and items are written and read in place, so
+    // handing off a message costs two atomic index updates and no allocation or locking.
+    // Capacity is rounded up to a power of two.
+    template <typename T>
+    class SpscRing
+    {
+    public:
+        explicit SpscRing(size_t capacity)
+        {
+            size_t size = 1;
+            while (size < capacity) {
+                size <<= 1;
+            }
+            slots_.resize(size);
+            mask_ = size - 1;
+        }
+
+        // producer: returns slot to fill or nullptr if ring is full. The slot is only
+        // visible to consumer after commitWrite().
+        T* beginWrite()
+        {
+            size_t head = head_.load(std::memory_order_relaxed);
+            if (head - tail_.load(std::memory_order_acquire) > mask_) {
+                return nullptr;
+            }
+            return &slots_[head & mask_];
+        }
+
+        void commitWrite()
+        {
+            head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        // consumer: returns oldest item or nullptr if ring is empty. The item stays valid
+        // until popRead().
+        T* beginRead()
+        {
+            size_t tail = tail_.load(std::memory_order_relaxed);
+            if (tail == head_.load(std::memory_order_acquire)) {
+                return nullptr;
+            }
+            return &slots_[tail & mask_];
+        }
+
+        void popRead()
+        {
+            tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        }
+
+        bool empty() const
+        {
+            return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+        }
+
+        size_t capacity() const
+        {
+            return mask_ + 1;
+        }
+
+    private:
+        std::vector<T> slots_;
+        size_t mask_;
+        // padding keeps indexes on separate cache lines so producer and consumer don't fight over one line.
+        char pad0_[64];
+        std::atomic<size_t> head_{ 0 };
+        char pad1_[64];
+        std::atomic<size_t> tail_{ 0 };
+    };
+}
+
+#endif
@@ -22,5 +22,41 @@ public:
 
     virtual int getRssi(const char* ifaceName) = 0;
 
+	// OS handle that becomes readable when data arrives, used to wait on many ports from one thread.
+	// returns -1 if this port can't be waited on that way.
+	virtual int getReadHandle() { return -1; }
+
+	// like read() but returns 0 instead of blocking when no data is available.
+	virtual int readNonBlocking(uint8_t* buffer, int bytesToRead) { return read(buffer, bytesToRead); }
+
+	// read up to maxPackets packets with as few system calls as possible.  Packet i is stored at
+	// buffer + i * packetSize and its length in lengths[i].  Returns the number of packets read, 0 if
+	// blocking is false and nothing is available, or -1 if error.  Ports that are not packet based
+	// return what one read gives them as a single packet.
+	virtual int readBatch(uint8_t* buffer, int packetSize, int* lengths, int maxPackets, bool blocking)
+	{
+		if (maxPackets <= 0) {
+			return 0;
+		}
+		int rc = blocking ? read(buffer, packetSize) : readNonBlocking(buffer, packetSize);
+		if (rc <= 0) {
+			return rc;
+		}
+		lengths[0] = rc;
+		return 1;
+	}
+
+	// write count packets stored back to back in buffer with the given lengths, with as few system
+	// calls as possible.  Packet based ports send each one as its own packet, streams can write the
+	// whole buffer at once which is what this default does.  Returns total bytes written or -1 if error.
+	virtual int writeBatch(const uint8_t* buffer, const int* lengths, int count)
+	{
+		int total = 0;
+		for (int i = 0; i < count; i++) {
+			total += lengths[i];
+		}
+		return total > 0 ? write(buffer, total) : 0;
+	}
+
 };
 #endif // !PORT_H
@@ -280,6 +280,7 @@ public:
 #include <termios.h>
 #include <unistd.h>
 #include <fcntl.h> 
+#include <poll.h>
 #include <errno.h>
 #include <string.h>
 
@@ -339,6 +340,24 @@ public:
 		return ::read(fd, buffer, bytesToRead);
 	}
 
+	int readNonBlocking(uint8_t* buffer, int bytesToRead)
+	{
+		if (closed_) {
+			return -1;
+		}
+		struct pollfd pfd = { fd, POLLIN, 0 };
+		int rc = poll(&pfd, 1, 0);
+		if (rc <= 0) {
+			return rc;
+		}
+		return ::read(fd, buffer, bytesToRead);
+	}
+
+	int getReadHandle()
+	{
+		return closed_ ? -1 : fd;
+	}
+
 	void close()
 	{
 		closed_ = true;
@@ -672,6 +691,27 @@ SerialPort::read(uint8_t* buffer, int bytesToRead)
 	return impl_->read(buffer, bytesToRead);
 }
 
+int
+SerialPort::readNonBlocking(uint8_t* buffer, int bytesToRead)
+{
+#ifdef _WIN32
+	// windows ports are not used with the event loop, see Port::getReadHandle.
+	return impl_->read(buffer, bytesToRead);
+#else
+	return impl_->readNonBlocking(buffer, bytesToRead);
+#endif
+}
+
+int
+SerialPort::getReadHandle()
+{
+#ifdef _WIN32
+	return -1;
+#else
+	return impl_->getReadHandle();
+#endif
+}
+
 void
 SerialPort::close()
 {
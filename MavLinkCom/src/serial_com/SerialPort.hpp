@@ -48,6 +48,12 @@ public:
 	// read a given number of bytes from the port.
 	virtual int read(uint8_t* buffer, int bytesToRead);
 
+	// same as read but returns 0 if nothing has been received yet.
+	virtual int readNonBlocking(uint8_t* buffer, int bytesToRead);
+
+	// file descriptor of the port on posix systems, -1 on Windows.
+	virtual int getReadHandle();
+
 	// close the port.
 	virtual void close();
 
@@ -0,0 +1,576 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "SharedMemoryPort.hpp"
+#include "Utils.hpp"
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cerrno>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <climits>
+#include <ctime>
+#include <csignal>
+#endif
+
+using namespace mavlink_utils;
+
+const int SharedMemoryPort::kDefaultCapacity;
+
+#ifdef __linux__
+
+namespace {
+	const uint32_t kMagic = 0x4D534850; // "PHSM"
+	const uint32_t kVersion = 2;
+	// a blocked reader or writer wakes up this often to check whether the port was closed.
+	const long kWaitNanoseconds = 100 * 1000 * 1000;
+	// a writer gives up if the other side has not made any room for this long, and after that drops
+	// writes that don't fit instead of waiting again until the other side reads something.
+	const int kWriteTimeoutMilliseconds = 100;
+	// how often a waiting reader or writer checks whether the process on the other side still exists.
+	const int64_t kLivenessCheckNanoseconds = 100 * 1000 * 1000;
+
+	// the indexes live on their own cache lines so the two processes don't keep taking the line from each other.
+	struct Ring
+	{
+		alignas(64) std::atomic<uint64_t> head; // total bytes written
+		alignas(64) std::atomic<uint64_t> tail; // total bytes read
+		alignas(64) std::atomic<uint32_t> data_seq; // futex the reader sleeps on
+		std::atomic<uint32_t> reader_waiting;
+		std::atomic<uint32_t> space_seq; // futex the writer sleeps on when the ring is full
+		std::atomic<uint32_t> writer_waiting;
+	};
+
+	struct Segment
+	{
+		std::atomic<uint32_t> magic; // written last by create
+		uint32_t version;
+		uint32_t capacity;
+		std::atomic<uint32_t> closed; // set when the creator closes
+		std::atomic<uint32_t> attached; // set while the other side has it open
+		// pid of the creator and of the opener while attached, and the pid namespace it is valid in.
+		std::atomic<int32_t> pids[2];
+		uint64_t pid_namespaces[2];
+		// ring 0 carries bytes from the creator to the opener, ring 1 the other way.
+		Ring rings[2];
+		// followed by capacity bytes of data for ring 0 and then for ring 1.
+	};
+
+	static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "futex needs a plain 32 bit word");
+
+	size_t segmentSize(uint32_t capacity)
+	{
+		return sizeof(Segment) + 2 * static_cast<size_t>(capacity);
+	}
+
+	void futexWait(std::atomic<uint32_t>& word, uint32_t expected)
+	{
+		timespec timeout;
+		timeout.tv_sec = 0;
+		timeout.tv_nsec = kWaitNanoseconds;
+		// no FUTEX_PRIVATE_FLAG since the word is shared with another process.
+		syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, &timeout, nullptr, 0);
+	}
+
+	void futexWake(std::atomic<uint32_t>& word)
+	{
+		syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+	}
+
+	void wakeAll(std::atomic<uint32_t>& word)
+	{
+		word.fetch_add(1, std::memory_order_release);
+		futexWake(word);
+	}
+
+	// a pid only means something to processes in the same pid namespace, for example not across containers
+	// that share /dev/shm, so each side also records which namespace its pid is from.  0 if unknown.
+	uint64_t pidNamespace()
+	{
+		struct stat info;
+		if (stat("/proc/self/ns/pid", &info) != 0) {
+			return 0;
+		}
+		return static_cast<uint64_t>(info.st_ino);
+	}
+
+	int64_t nowNanoseconds()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+}
+
+class SharedMemoryPort::SharedMemoryImpl
+{
+	std::string name_;
+	Segment* segment_ = nullptr;
+	size_t size_ = 0;
+	bool owner_ = false;
+	std::atomic<bool> closed_{ true };
+	uint32_t capacity_ = 0;
+	Ring* tx_ = nullptr;
+	uint8_t* tx_data_ = nullptr;
+	Ring* rx_ = nullptr;
+	uint8_t* rx_data_ = nullptr;
+	std::mutex write_mutex_;
+	// the writer timed out on a full ring and drops writes that don't fit until the tail moves past this.
+	bool write_stalled_ = false;
+	uint64_t stalled_tail_ = 0;
+	uint64_t pid_namespace_ = 0;
+	std::atomic<int64_t> last_liveness_check_{ 0 };
+	std::atomic<bool> peer_died_{ false };
+
+	static std::string toShmName(const std::string& name)
+	{
+		return name.size() > 0 && name[0] == '/' ? name : "/" + name;
+	}
+
+	void attach(bool owner)
+	{
+		owner_ = owner;
+		write_stalled_ = false;
+		peer_died_ = false;
+		last_liveness_check_ = 0;
+		pid_namespace_ = pidNamespace();
+		capacity_ = segment_->capacity;
+		uint8_t* data = reinterpret_cast<uint8_t*>(segment_ + 1);
+		int tx = owner ? 0 : 1;
+		tx_ = &segment_->rings[tx];
+		tx_data_ = data + tx * static_cast<size_t>(capacity_);
+		rx_ = &segment_->rings[1 - tx];
+		rx_data_ = data + (1 - tx) * static_cast<size_t>(capacity_);
+		closed_ = false;
+	}
+
+	void unmap()
+	{
+		if (segment_ != nullptr) {
+			munmap(segment_, size_);
+			segment_ = nullptr;
+			size_ = 0;
+		}
+	}
+
+	void publishPid(int side)
+	{
+		segment_->pid_namespaces[side] = pid_namespace_;
+		segment_->pids[side].store(static_cast<int32_t>(getpid()), std::memory_order_release);
+	}
+
+	// true if the other side crashed or was killed without closing, checked at most every
+	// kLivenessCheckNanoseconds unless force is set.  An opener whose creator died sees the port as
+	// closed.  A creator whose opener died treats it as detached, so writes are dropped until the
+	// other side, for example a restarted PX4 SITL, opens the segment again.
+	bool peerDied(bool force)
+	{
+		if (peer_died_) {
+			return true;
+		}
+		int64_t now = nowNanoseconds();
+		if (!force && now - last_liveness_check_.load(std::memory_order_relaxed) < kLivenessCheckNanoseconds) {
+			return false;
+		}
+		last_liveness_check_.store(now, std::memory_order_relaxed);
+
+		int peer = owner_ ? 1 : 0;
+		int32_t pid = segment_->pids[peer].load(std::memory_order_acquire);
+		if (pid <= 0 || pid_namespace_ == 0 || segment_->pid_namespaces[peer] != pid_namespace_) {
+			// not attached, or we can't see its process from here.
+			return false;
+		}
+		if (::kill(pid, 0) == 0 || errno != ESRCH) {
+			return false;
+		}
+		if (owner_) {
+			// a new opener may already have replaced it, only detach the one that died.
+			if (segment_->pids[1].compare_exchange_strong(pid, 0, std::memory_order_acq_rel)) {
+				segment_->attached.store(0, std::memory_order_release);
+				Utils::log(Utils::stringf("SharedMemoryPort %s: process %d on the other side is gone", name_.c_str(), static_cast<int>(pid)), Utils::kLogLevelWarn);
+			}
+			return false;
+		}
+		Utils::log(Utils::stringf("SharedMemoryPort %s: process %d that created it is gone", name_.c_str(), static_cast<int>(pid)), Utils::kLogLevelWarn);
+		peer_died_ = true;
+		return true;
+	}
+
+	bool peerClosed(bool forceLivenessCheck = false)
+	{
+		if (!owner_ && segment_->closed.load(std::memory_order_acquire) != 0) {
+			return true;
+		}
+		return peerDied(forceLivenessCheck);
+	}
+
+	int take(uint8_t* buffer, int bytesToRead)
+	{
+		uint64_t tail = rx_->tail.load(std::memory_order_relaxed);
+		uint64_t head = rx_->head.load(std::memory_order_acquire);
+		size_t count = static_cast<size_t>(std::min<uint64_t>(head - tail, static_cast<uint64_t>(bytesToRead)));
+		if (count == 0) {
+			return 0;
+		}
+		size_t pos = static_cast<size_t>(tail % capacity_);
+		size_t first = std::min(count, capacity_ - pos);
+		std::memcpy(buffer, rx_data_ + pos, first);
+		std::memcpy(buffer + first, rx_data_, count - first);
+		rx_->tail.store(tail + count, std::memory_order_release);
+
+		// pairs with the fence in write, either the writer sees the new tail or we see that it is waiting.
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		if (rx_->writer_waiting.load(std::memory_order_relaxed) != 0) {
+			wakeAll(rx_->space_seq);
+		}
+		return static_cast<int>(count);
+	}
+
+	void waitForData()
+	{
+		uint32_t seq = rx_->data_seq.load(std::memory_order_acquire);
+		rx_->reader_waiting.store(1, std::memory_order_seq_cst);
+		bool empty = rx_->head.load(std::memory_order_seq_cst) == rx_->tail.load(std::memory_order_relaxed);
+		if (empty && !closed_ && !peerClosed()) {
+			futexWait(rx_->data_seq, seq);
+		}
+		rx_->reader_waiting.store(0, std::memory_order_relaxed);
+	}
+
+public:
+	~SharedMemoryImpl()
+	{
+		close();
+		unmap();
+	}
+
+	bool isClosed()
+	{
+		return closed_ || peerClosed();
+	}
+
+	int create(const std::string& name, int capacity)
+	{
+		if (capacity <= 0) {
+			return EINVAL;
+		}
+		close();
+		unmap();
+		name_ = toShmName(name);
+
+		// a segment left behind by a crashed process would have stale indexes, so always start fresh.
+		shm_unlink(name_.c_str());
+		int fd = shm_open(name_.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+		if (fd < 0) {
+			return errno;
+		}
+		size_t size = segmentSize(static_cast<uint32_t>(capacity));
+		if (ftruncate(fd, static_cast<off_t>(size)) != 0) {
+			int hr = errno;
+			::close(fd);
+			shm_unlink(name_.c_str());
+			return hr;
+		}
+		void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (ptr == MAP_FAILED) {
+			int hr = errno;
+			shm_unlink(name_.c_str());
+			return hr;
+		}
+
+		// ftruncate zero filled it, which is the right initial state for every index and flag.
+		segment_ = static_cast<Segment*>(ptr);
+		size_ = size;
+		segment_->version = kVersion;
+		segment_->capacity = static_cast<uint32_t>(capacity);
+		attach(true);
+		publishPid(0);
+		segment_->magic.store(kMagic, std::memory_order_release);
+		return 0;
+	}
+
+	int open(const std::string& name)
+	{
+		close();
+		unmap();
+		name_ = toShmName(name);
+
+		int fd = shm_open(name_.c_str(), O_RDWR, 0);
+		if (fd < 0) {
+			return errno;
+		}
+		struct stat info;
+		if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(Segment)) {
+			// the creator has not sized it yet.
+			::close(fd);
+			return EAGAIN;
+		}
+		size_t size = static_cast<size_t>(info.st_size);
+		void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+		::close(fd);
+		if (ptr == MAP_FAILED) {
+			return errno;
+		}
+		segment_ = static_cast<Segment*>(ptr);
+		size_ = size;
+
+		if (segment_->magic.load(std::memory_order_acquire) != kMagic || segment_->version != kVersion ||
+			segmentSize(segment_->capacity) > size || segment_->closed.load(std::memory_order_acquire) != 0) {
+			unmap();
+			return EAGAIN;
+		}
+		attach(false);
+		// an earlier opener that crashed may have left bytes unread, this side owns the tail of ring 0.
+		rx_->tail.store(rx_->head.load(std::memory_order_acquire), std::memory_order_release);
+		publishPid(1);
+		segment_->attached.store(1, std::memory_order_release);
+		return 0;
+	}
+
+	int write(const uint8_t* ptr, int count)
+	{
+		std::lock_guard<std::mutex> lock(write_mutex_);
+		if (closed_ || peerClosed()) {
+			return -1;
+		}
+		if (owner_ && segment_->attached.load(std::memory_order_acquire) == 0) {
+			// nobody is listening yet, drop it the same way an unconnected udp port does.
+			return 0;
+		}
+
+		// a message is copied whole or not at all, half a frame left in the stream would also break
+		// parsing of the frame after it.
+		if (count <= 0 || static_cast<size_t>(count) > capacity_) {
+			return count == 0 ? 0 : -1;
+		}
+		auto start = std::chrono::steady_clock::now();
+		while (true) {
+			uint64_t head = tx_->head.load(std::memory_order_relaxed);
+			uint64_t tail = tx_->tail.load(std::memory_order_acquire);
+			if (write_stalled_ && tail != stalled_tail_) {
+				write_stalled_ = false;
+			}
+			size_t space = capacity_ - static_cast<size_t>(head - tail);
+			if (space >= static_cast<size_t>(count)) {
+				size_t pos = static_cast<size_t>(head % capacity_);
+				size_t first = std::min(static_cast<size_t>(count), capacity_ - pos);
+				std::memcpy(tx_data_ + pos, ptr, first);
+				std::memcpy(tx_data_, ptr + first, count - first);
+				tx_->head.store(head + count, std::memory_order_release);
+
+				// pairs with the fence in take, only make the futex call when the reader is actually asleep.
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (tx_->reader_waiting.load(std::memory_order_relaxed) != 0) {
+					wakeAll(tx_->data_seq);
+				}
+				return count;
+			}
+
+			// the sim loop must not stall on a reader that is gone or stuck, so check for a dead peer
+			// before waiting and only wait once until the reader makes progress again.
+			if (peerClosed(true)) {
+				return -1;
+			}
+			if (owner_ && segment_->attached.load(std::memory_order_acquire) == 0) {
+				return -1;
+			}
+			if (write_stalled_) {
+				return -1;
+			}
+			if (std::chrono::steady_clock::now() - start > std::chrono::milliseconds(kWriteTimeoutMilliseconds)) {
+				Utils::log(Utils::stringf("SharedMemoryPort %s is full, the other side is not reading", name_.c_str()), Utils::kLogLevelWarn);
+				write_stalled_ = true;
+				stalled_tail_ = tail;
+				return -1;
+			}
+			uint32_t seq = tx_->space_seq.load(std::memory_order_acquire);
+			tx_->writer_waiting.store(1, std::memory_order_seq_cst);
+			if (tx_->tail.load(std::memory_order_seq_cst) == tail) {
+				futexWait(tx_->space_seq, seq);
+			}
+			tx_->writer_waiting.store(0, std::memory_order_relaxed);
+			if (closed_ || peerClosed()) {
+				return -1;
+			}
+		}
+	}
+
+	int read(uint8_t* buffer, int bytesToRead, bool blocking)
+	{
+		while (!closed_ && !peerClosed()) {
+			int n = take(buffer, bytesToRead);
+			if (n > 0 || !blocking) {
+				return n;
+			}
+			waitForData();
+		}
+		return -1;
+	}
+
+	int readBatch(uint8_t* buffer, int packetSize, int* lengths, int maxPackets, bool blocking)
+	{
+		if (maxPackets <= 0) {
+			return 0;
+		}
+		int rc = read(buffer, packetSize, blocking);
+		if (rc <= 0) {
+			return rc;
+		}
+		lengths[0] = rc;
+		int packets = 1;
+		// then whatever else is already there, without waiting.
+		while (packets < maxPackets && rc == packetSize) {
+			rc = take(buffer + packets * packetSize, packetSize);
+			if (rc <= 0) {
+				break;
+			}
+			lengths[packets++] = rc;
+		}
+		return packets;
+	}
+
+	void close()
+	{
+		if (closed_ || segment_ == nullptr) {
+			return;
+		}
+		closed_ = true;
+		if (owner_) {
+			segment_->closed.store(1, std::memory_order_release);
+			shm_unlink(name_.c_str());
+		}
+		else {
+			segment_->pids[1].store(0, std::memory_order_release);
+			segment_->attached.store(0, std::memory_order_release);
+		}
+		// wake up our own reader and writer as well as the other side's.  The mapping stays until we are
+		// destroyed or reconnected because our read thread may still be touching it.
+		for (int i = 0; i < 2; i++) {
+			wakeAll(segment_->rings[i].data_seq);
+			wakeAll(segment_->rings[i].space_seq);
+		}
+	}
+};
+
+bool SharedMemoryPort::isSupported()
+{
+	return true;
+}
+
+#else
+
+// futex and the shm_open naming used here are Linux only.
+class SharedMemoryPort::SharedMemoryImpl
+{
+public:
+	int create(const std::string& name, int capacity)
+	{
+		unused(name);
+		unused(capacity);
+		return -1;
+	}
+	int open(const std::string& name)
+	{
+		unused(name);
+		return -1;
+	}
+	int write(const uint8_t* ptr, int count)
+	{
+		unused(ptr);
+		unused(count);
+		return -1;
+	}
+	int read(uint8_t* buffer, int bytesToRead, bool blocking)
+	{
+		unused(buffer);
+		unused(bytesToRead);
+		unused(blocking);
+		return -1;
+	}
+	int readBatch(uint8_t* buffer, int packetSize, int* lengths, int maxPackets, bool blocking)
+	{
+		unused(buffer);
+		unused(packetSize);
+		unused(lengths);
+		unused(maxPackets);
+		unused(blocking);
+		return -1;
+	}
+	bool isClosed()
+	{
+		return true;
+	}
+	void close()
+	{
+	}
+};
+
+bool SharedMemoryPort::isSupported()
+{
+	return false;
+}
+
+#endif
+
+SharedMemoryPort::SharedMemoryPort()
+{
+	impl_.reset(new SharedMemoryImpl());
+}
+
+SharedMemoryPort::~SharedMemoryPort()
+{
+}
+
+int SharedMemoryPort::create(const std::string& name, int capacity)
+{
+	return impl_->create(name, capacity);
+}
+
+int SharedMemoryPort::open(const std::string& name)
+{
+	return impl_->open(name);
+}
+
+int SharedMemoryPort::write(const uint8_t* ptr, int count)
+{
+	return impl_->write(ptr, count);
+}
+
+int SharedMemoryPort::read(uint8_t* buffer, int bytesToRead)
+{
+	return impl_->read(buffer, bytesToRead, true);
+}
+
+int SharedMemoryPort::readNonBlocking(uint8_t* buffer, int bytesToRead)
+{
+	return impl_->read(buffer, bytesToRead, false);
+}
+
+int SharedMemoryPort::readBatch(uint8_t* buffer, int packetSize, int* lengths, int maxPackets, bool blocking)
+{
+	return impl_->readBatch(buffer, packetSize, lengths, maxPackets, blocking);
+}
+
+void SharedMemoryPort::close()
+{
+	impl_->close();
+}
+
+bool SharedMemoryPort::isClosed()
+{
+	return impl_->isClosed();
+}
+
+int SharedMemoryPort::getRssi(const char* ifaceName)
+{
+	unused(ifaceName);
+	return 0; // not supported on shared memory.
+}
@@ -0,0 +1,62 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef SERIAL_COM_SHAREDMEMORYPORT_HPP
+#define SERIAL_COM_SHAREDMEMORYPORT_HPP
+
+#include <string>
+#include <memory>
+#include "Port.h"
+
+// A byte stream between two processes on the same machine, for example the simulator and a PX4 SITL
+// build, without going through the network stack.  The segment holds one single producer single consumer
+// ring for each direction and a reader with nothing to read sleeps on a futex in the segment, so an idle
+// port costs nothing and a write wakes the other side directly.  One side calls create and owns the
+// segment, the other side calls open with the same name.  Currently only available on Linux.
+class SharedMemoryPort : public Port
+{
+public:
+	static const int kDefaultCapacity = 1024 * 1024;
+
+	SharedMemoryPort();
+	~SharedMemoryPort();
+
+	// create the named segment with capacity bytes in each direction, replacing any stale segment
+	// left behind by a process that did not close it.  The segment is removed when this port is closed.
+	// Returns 0 or an error code.
+	int create(const std::string& name, int capacity = kDefaultCapacity);
+
+	// open a segment that the other side has already created.  Returns 0 or an error code.
+	int open(const std::string& name);
+
+	// write all of the given bytes or none of them, waiting briefly for the other side to make room for the
+	// whole message if the ring is full.  Never waits on a process that has died, and once a wait times out
+	// later writes that don't fit are dropped without waiting until the other side reads again.  Returns
+	// count or -1 if the message was dropped.
+	int write(const uint8_t* ptr, int count);
+
+	// read whatever is available up to bytesToRead, waiting until there is something.
+	// return the number of bytes read or -1 if the port is closed.
+	int read(uint8_t* buffer, int bytesToRead);
+
+	// same as read but returns 0 if nothing is available.
+	int readNonBlocking(uint8_t* buffer, int bytesToRead);
+
+	// drain up to maxPackets * packetSize bytes in one go, see Port::readBatch.
+	int readBatch(uint8_t* buffer, int packetSize, int* lengths, int maxPackets, bool blocking);
+
+	// close the port, this also wakes the other side which then sees the port as closed.
+	void close();
+
+	bool isClosed();
+
+	int getRssi(const char* ifaceName);
+
+	static bool isSupported();
+
+private:
+	class SharedMemoryImpl;
+	std::unique_ptr<SharedMemoryImpl> impl_;
+};
+
+#endif // SERIAL_COM_SHAREDMEMORYPORT_HPP
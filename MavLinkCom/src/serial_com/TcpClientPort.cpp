@@ -174,15 +174,30 @@ public:
 		return hr;
 	}
 
-	int read(uint8_t* result, int bytesToRead)
+	int getReadHandle()
+	{
+#ifdef _WIN32
+		return -1;
+#else
+		return closed_ ? -1 : static_cast<int>(sock);
+#endif
+	}
+
+	int read(uint8_t* result, int bytesToRead, bool blocking = true)
 	{
 		int bytesRead = 0;
+		int flags = 0;
+#ifndef _WIN32
+		if (!blocking) {
+			flags = MSG_DONTWAIT;
+		}
+#endif
 		// try and receive something, up until port is closed anyway.
 
 		while (!closed_)
 		{
 			socklen_t addrlen = sizeof(sockaddr_in);
-			int rc = recv(sock, reinterpret_cast<char*>(result), bytesToRead, 0);
+			int rc = recv(sock, reinterpret_cast<char*>(result), bytesToRead, flags);
 			if (rc < 0)
 			{
 #ifdef _WIN32
@@ -204,6 +219,9 @@ public:
 					// skip this, it is was interrupted.
 					continue;
 				}
+				else if (!blocking && (hr == EAGAIN || hr == EWOULDBLOCK)) {
+					return 0;
+				}
 				else
 #endif
 				{
@@ -287,6 +305,16 @@ TcpClientPort::read(uint8_t* buffer, int bytesToRead)
 	return impl_->read(buffer, bytesToRead);
 }
 
+int TcpClientPort::readNonBlocking(uint8_t* buffer, int bytesToRead)
+{
+	return impl_->read(buffer, bytesToRead, false);
+}
+
+int TcpClientPort::getReadHandle()
+{
+	return impl_->getReadHandle();
+}
+
 bool TcpClientPort::isClosed()
 {
 	return impl_->isClosed();
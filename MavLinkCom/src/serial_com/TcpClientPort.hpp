@@ -26,6 +26,12 @@ public:
 	// read some bytes from the port, return the number of bytes read or -1 if error.
 	int read(uint8_t* buffer, int bytesToRead);
 
+	// same as read but returns 0 if nothing has been received yet.
+	int readNonBlocking(uint8_t* buffer, int bytesToRead);
+
+	// the socket, so it can be waited on along with other ports.
+	int getReadHandle();
+
 	// close the port.
 	void close();
 
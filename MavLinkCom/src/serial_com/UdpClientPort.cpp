@@ -5,6 +5,7 @@
 #include "UdpClientPort.hpp"
 #include <stdio.h>
 #include <string.h>
+#include <vector>
 #include "SocketInit.hpp"
 #include "wifi.h"
 
@@ -55,6 +56,14 @@ class UdpClientPort::UdpSocketImpl
 	sockaddr_in remoteaddr;
 	bool hasRemote = false;
 	bool closed_ = true;
+#ifdef __linux__
+	// reused by readBatch and writeBatch, which are each only called from one thread at a time.
+	std::vector<mmsghdr> recv_msgs_;
+	std::vector<iovec> recv_iov_;
+	std::vector<sockaddr_in> recv_addrs_;
+	std::vector<mmsghdr> send_msgs_;
+	std::vector<iovec> send_iov_;
+#endif
 public:
 
 	bool isClosed() {
@@ -173,17 +182,32 @@ public:
 		return hr;
 	}
 
-	int read(uint8_t* result, int bytesToRead)
+	int getReadHandle()
+	{
+#ifdef _WIN32
+		return -1;
+#else
+		return closed_ ? -1 : static_cast<int>(sock);
+#endif
+	}
+
+	int read(uint8_t* result, int bytesToRead, bool blocking = true)
 	{
 		sockaddr_in other;
 
 		int bytesRead = 0;
+		int flags = 0;
+#ifndef _WIN32
+		if (!blocking) {
+			flags = MSG_DONTWAIT;
+		}
+#endif
 		// try and receive something, up until port is closed anyway.
 
 		while (!closed_)
 		{
 			socklen_t addrlen = sizeof(sockaddr_in);
-			int rc = recvfrom(sock, reinterpret_cast<char*>(result), bytesToRead, 0, reinterpret_cast<sockaddr*>(&other), &addrlen);
+			int rc = recvfrom(sock, reinterpret_cast<char*>(result), bytesToRead, flags, reinterpret_cast<sockaddr*>(&other), &addrlen);
 			if (rc < 0)
 			{
 				int hr = WSAGetLastError();
@@ -212,6 +236,9 @@ public:
 					// try again - this can happen if server recreates the socket on their side.
 					continue;
 				}
+				else if (!blocking && (hr == EAGAIN || hr == EWOULDBLOCK)) {
+					return 0;
+				}
 				else
 #endif
 				{
@@ -220,14 +247,7 @@ public:
 				}
 			}
 
-			if (remoteaddr.sin_port == 0)
-			{
-				// we now have it.
-				remoteaddr.sin_family = other.sin_family;
-				remoteaddr.sin_addr = other.sin_addr;
-				remoteaddr.sin_port = other.sin_port;
-			}
-			else if (other.sin_addr.s_addr != remoteaddr.sin_addr.s_addr)
+			if (!acceptSender(other))
 			{
 				// this is from someone we are not interested in.
 				continue;
@@ -246,6 +266,151 @@ public:
 		return -1;
 	}
 
+	// remember where a packet came from, returns false if it is from someone we are not interested in.
+	bool acceptSender(const sockaddr_in& other)
+	{
+		if (remoteaddr.sin_port == 0)
+		{
+			// we now have it.
+			remoteaddr.sin_family = other.sin_family;
+			remoteaddr.sin_addr = other.sin_addr;
+			remoteaddr.sin_port = other.sin_port;
+		}
+		else if (other.sin_addr.s_addr != remoteaddr.sin_addr.s_addr)
+		{
+			return false;
+		}
+		return true;
+	}
+
+	int readBatch(uint8_t* buffer, int packetSize, int* lengths, int maxPackets, bool blocking)
+	{
+#ifdef __linux__
+		if (maxPackets <= 0) {
+			return 0;
+		}
+		// unsigned indices and offsets, the packet loops below can't overflow.
+		size_t packets = static_cast<size_t>(maxPackets);
+		size_t stride = static_cast<size_t>(packetSize);
+		if (recv_msgs_.size() < packets) {
+			recv_msgs_.resize(packets);
+			recv_iov_.resize(packets);
+			recv_addrs_.resize(packets);
+		}
+		// blocking waits for the first packet only and then takes whatever else is already queued.
+		int flags = blocking ? MSG_WAITFORONE : MSG_DONTWAIT;
+
+		while (!closed_)
+		{
+			for (size_t i = 0; i < packets; i++) {
+				recv_iov_[i].iov_base = buffer + i * stride;
+				recv_iov_[i].iov_len = stride;
+				mmsghdr& hdr = recv_msgs_[i];
+				memset(&hdr, 0, sizeof(hdr));
+				hdr.msg_hdr.msg_iov = &recv_iov_[i];
+				hdr.msg_hdr.msg_iovlen = 1;
+				hdr.msg_hdr.msg_name = &recv_addrs_[i];
+				hdr.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+			}
+			int rc = recvmmsg(sock, recv_msgs_.data(), static_cast<unsigned int>(packets), flags, nullptr);
+			if (rc < 0)
+			{
+				int hr = errno;
+				if (hr == EINTR || hr == ECONNRESET) {
+					// see read() for why these are retried.
+					continue;
+				}
+				else if (!blocking && (hr == EAGAIN || hr == EWOULDBLOCK)) {
+					return 0;
+				}
+				return -1;
+			}
+
+			// drop packets from other senders and empty ones, moving the rest down to keep them contiguous.
+			size_t count = 0;
+			size_t received = static_cast<size_t>(rc);
+			for (size_t i = 0; i < received; i++) {
+				size_t len = recv_msgs_[i].msg_len;
+				if (len == 0 || !acceptSender(recv_addrs_[i])) {
+					continue;
+				}
+				if (count != i) {
+					memmove(buffer + count * stride, buffer + i * stride, len);
+				}
+				lengths[count++] = static_cast<int>(len);
+			}
+			if (count > 0 || !blocking) {
+				return static_cast<int>(count);
+			}
+		}
+		return -1;
+#else
+		if (maxPackets <= 0) {
+			return 0;
+		}
+		int rc = read(buffer, packetSize, blocking);
+		if (rc <= 0) {
+			return rc;
+		}
+		lengths[0] = rc;
+		return 1;
+#endif
+	}
+
+	int writeBatch(const uint8_t* buffer, const int* lengths, int count)
+	{
+		if (remoteaddr.sin_port == 0)
+		{
+			// same as write(), nobody to send to yet.
+			return 0;
+		}
+#ifdef __linux__
+		if (static_cast<int>(send_msgs_.size()) < count) {
+			send_msgs_.resize(count);
+			send_iov_.resize(count);
+		}
+		int total = 0;
+		for (int i = 0; i < count; i++) {
+			send_iov_[i].iov_base = const_cast<uint8_t*>(buffer + total);
+			send_iov_[i].iov_len = lengths[i];
+			total += lengths[i];
+			mmsghdr& hdr = send_msgs_[i];
+			memset(&hdr, 0, sizeof(hdr));
+			hdr.msg_hdr.msg_iov = &send_iov_[i];
+			hdr.msg_hdr.msg_iovlen = 1;
+			hdr.msg_hdr.msg_name = &remoteaddr;
+			hdr.msg_hdr.msg_namelen = sizeof(sockaddr_in);
+		}
+		// sendmmsg can stop early, keep going until every packet is out.
+		int sent = 0;
+		while (sent < count)
+		{
+			int rc = sendmmsg(sock, send_msgs_.data() + sent, count - sent, 0);
+			if (rc < 0)
+			{
+				int hr = errno;
+				if (hr == EINTR) {
+					continue;
+				}
+				// perhaps the client is gone, and may want to come back on a different port, in which case let's reset our remote port to allow that.
+				remoteaddr.sin_port = 0;
+				throw std::runtime_error(Utils::stringf("UdpClientPort socket send failed with error: %d\n", hr));
+			}
+			sent += rc;
+		}
+		return total;
+#else
+		int total = 0;
+		for (int i = 0; i < count; i++) {
+			int rc = write(buffer + total, lengths[i]);
+			if (rc < 0) {
+				return rc;
+			}
+			total += lengths[i];
+		}
+		return total;
+#endif
+	}
 
 	void close()
 	{
@@ -256,6 +421,8 @@ public:
 			closesocket(sock);
 #else
 			int fd = static_cast<int>(sock);
+			// on linux close() alone doesn't wake up a thread blocked in recvfrom.
+			::shutdown(fd, SHUT_RDWR);
 			::close(fd);
 #endif
 		}
@@ -304,6 +471,26 @@ UdpClientPort::read(uint8_t* buffer, int bytesToRead)
 	return impl_->read(buffer, bytesToRead);
 }
 
+int UdpClientPort::readNonBlocking(uint8_t* buffer, int bytesToRead)
+{
+	return impl_->read(buffer, bytesToRead, false);
+}
+
+int UdpClientPort::readBatch(uint8_t* buffer, int packetSize, int* lengths, int maxPackets, bool blocking)
+{
+	return impl_->readBatch(buffer, packetSize, lengths, maxPackets, blocking);
+}
+
+int UdpClientPort::writeBatch(const uint8_t* buffer, const int* lengths, int count)
+{
+	return impl_->writeBatch(buffer, lengths, count);
+}
+
+int UdpClientPort::getReadHandle()
+{
+	return impl_->getReadHandle();
+}
+
 bool UdpClientPort::isClosed()
 {
 	return impl_->isClosed();
@@ -25,6 +25,18 @@ public:
 	// read some bytes from the port, return the number of bytes read or -1 if error.
 	int read(uint8_t* buffer, int bytesToRead);
 
+	// same as read but returns 0 if nothing has been received yet.
+	int readNonBlocking(uint8_t* buffer, int bytesToRead);
+
+	// receive several datagrams with one recvmmsg call on Linux, see Port::readBatch.
+	int readBatch(uint8_t* buffer, int packetSize, int* lengths, int maxPackets, bool blocking);
+
+	// send each packet as its own datagram with one sendmmsg call on Linux.
+	int writeBatch(const uint8_t* buffer, const int* lengths, int count);
+
+	// the socket, so it can be waited on along with other ports.
+	int getReadHandle();
+
 	// close the port.
 	void close();
 
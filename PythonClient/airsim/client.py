@@ -46,6 +46,27 @@ class VehicleClient:
         return self.client.call("simIsPaused")
     def simContinueForTime(self, seconds):
         self.client.call('simContinueForTime', seconds)
+    def simStep(self, steps = 1):
+        # server runs at most 1000 steps per call (WorldSimApiBase::kMaxStepsPerCall)
+        while steps > 0:
+            call_steps = min(steps, 1000)
+            self.client.call('simStep', call_steps)
+            steps -= call_steps
+
+    def simGetTickProfile(self):
+        """Returns per-phase duration statistics (milliseconds) of simulation tick recorded since last simResetTickProfile"""
+        stats = self.client.call('simGetTickProfile')
+        return [TickPhaseStats.from_msgpack(item) for item in stats]
+    def simResetTickProfile(self):
+        self.client.call('simResetTickProfile')
+    def simGetTickTrace(self):
+        """Returns recent tick phases as Chrome trace-event JSON"""
+        return self.client.call('simGetTickTrace')
+    def simDumpTickTrace(self, file_path):
+        """Saves simGetTickTrace() to a file on this machine, open it in chrome://tracing"""
+        with open(file_path, 'w') as trace_file:
+            trace_file.write(self.simGetTickTrace())
+        return True
 
     def getHomeGeoPoint(self, vehicle_name = ''):
         return GeoPoint.from_msgpack(self.client.call('getHomeGeoPoint', vehicle_name))
@@ -111,6 +132,9 @@ class VehicleClient:
     def simGetVehiclePose(self, vehicle_name = ''):
         pose = self.client.call('simGetVehiclePose', vehicle_name)
         return Pose.from_msgpack(pose)
+    def simGetVehiclePoseBatch(self, vehicle_names):
+        poses = self.client.call('simGetVehiclePoseBatch', vehicle_names) if len(vehicle_names) > 0 else []
+        return [Pose.from_msgpack(pose) for pose in poses]
     def simGetObjectPose(self, object_name):
         pose = self.client.call('simGetObjectPose', object_name)
         return Pose.from_msgpack(pose)
@@ -135,6 +159,9 @@ class VehicleClient:
         kinematics_state = self.client.call('simGetGroundTruthKinematics', vehicle_name)
         return KinematicsState.from_msgpack(kinematics_state)
     simGetGroundTruthKinematics.__annotations__ = {'return': KinematicsState}
+    def simGetGroundTruthKinematicsBatch(self, vehicle_names):
+        states = self.client.call('simGetGroundTruthKinematicsBatch', vehicle_names) if len(vehicle_names) > 0 else []
+        return [KinematicsState.from_msgpack(state) for state in states]
     def simGetGroundTruthEnvironment(self, vehicle_name = ''):
         env_state = self.client.call('simGetGroundTruthEnvironment', vehicle_name)
         return EnvironmentState.from_msgpack(env_state)
@@ -142,7 +169,7 @@ class VehicleClient:
 
     # lidar APIs
     def getLidarData(self, lidar_name = '', vehicle_name = ''):
-        return LidarData.from_msgpack(self.client.call('getLidarData', lidar_name, vehicle_name))
+        return LidarData.from_msgpack(self.client.call('getLidarData', lidar_name, vehicle_name)).decode_channels()
 
     #----------- APIs to control ACharacter in scene ----------/
     def simCharSetFaceExpression(self, expression_name, value, character_name = ""):
@@ -267,6 +294,15 @@ class MultirotorClient(VehicleClient, object):
         return self.client.call_async('moveByVelocity', vx, vy, vz, duration, drivetrain, yaw_mode, vehicle_name)
     def moveByVelocityZAsync(self, vx, vy, z, duration, drivetrain = DrivetrainType.MaxDegreeOfFreedom, yaw_mode = YawMode(), vehicle_name = ''):
         return self.client.call_async('moveByVelocityZ', vx, vy, z, duration, drivetrain, yaw_mode, vehicle_name)
+
+    # batch versions take one command per vehicle in vehicle_names, commands run in parallel in simulator
+    def moveByAngleZBatchAsync(self, commands, duration, vehicle_names):
+        return self.client.call_async('moveByAngleZBatch', commands, duration, vehicle_names)
+    def moveByAngleThrottleBatchAsync(self, commands, duration, vehicle_names):
+        return self.client.call_async('moveByAngleThrottleBatch', commands, duration, vehicle_names)
+    def moveByVelocityBatchAsync(self, commands, duration, drivetrain, vehicle_names):
+        return self.client.call_async('moveByVelocityBatch', commands, duration, drivetrain, vehicle_names)
+
     def moveOnPathAsync(self, path, velocity, timeout_sec = 3e+38, drivetrain = DrivetrainType.MaxDegreeOfFreedom, yaw_mode = YawMode(), 
         lookahead = -1, adaptive_lookahead = 1, vehicle_name = ''):
         return self.client.call_async('moveOnPath', path, velocity, timeout_sec, drivetrain, yaw_mode, lookahead, adaptive_lookahead, vehicle_name)
@@ -304,6 +340,9 @@ class MultirotorClient(VehicleClient, object):
     def getMultirotorState(self, vehicle_name = ''):
         return MultirotorState.from_msgpack(self.client.call('getMultirotorState', vehicle_name))
     getMultirotorState.__annotations__ = {'return': MultirotorState}
+    def getMultirotorStateBatch(self, vehicle_names):
+        states = self.client.call('getMultirotorStateBatch', vehicle_names) if len(vehicle_names) > 0 else []
+        return [MultirotorState.from_msgpack(state) for state in states]
 
 
 # -----------------------------------  Car APIs ---------------------------------------------
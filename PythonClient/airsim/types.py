@@ -228,6 +228,39 @@ class YawMode(MsgpackMixin):
         self.is_rate = is_rate
         self.yaw_or_rate = yaw_or_rate
 
+class VelocityCommand(MsgpackMixin):
+    vx = 0.0
+    vy = 0.0
+    vz = 0.0
+    yaw_mode = YawMode()
+    def __init__(self, vx = 0.0, vy = 0.0, vz = 0.0, yaw_mode = YawMode()):
+        self.vx = vx
+        self.vy = vy
+        self.vz = vz
+        self.yaw_mode = yaw_mode
+
+class AngleZCommand(MsgpackMixin):
+    pitch = 0.0
+    roll = 0.0
+    z = 0.0
+    yaw = 0.0
+    def __init__(self, pitch = 0.0, roll = 0.0, z = 0.0, yaw = 0.0):
+        self.pitch = pitch
+        self.roll = roll
+        self.z = z
+        self.yaw = yaw
+
+class AngleThrottleCommand(MsgpackMixin):
+    pitch = 0.0
+    roll = 0.0
+    throttle = 0.0
+    yaw_rate = 0.0
+    def __init__(self, pitch = 0.0, roll = 0.0, throttle = 0.0, yaw_rate = 0.0):
+        self.pitch = pitch
+        self.roll = roll
+        self.throttle = throttle
+        self.yaw_rate = yaw_rate
+
 class RCData(MsgpackMixin):
     timestamp = 0
     pitch, roll, throttle, yaw = (0.0,)*4 #init 4 variable to 0.0
@@ -356,3 +389,31 @@ class LidarData(MsgpackMixin):
     point_cloud = 0.0
     time_stamp = np.uint64(0)
     pose = Pose()
+    ring = 0
+    time_offset = 0.0
+
+    # server sends point cloud and optional channels as packed binary blobs,
+    # this decodes them to numpy arrays (point_cloud has x, y, z for each point)
+    def decode_channels(self):
+        self.point_cloud = LidarData._unpack(self.point_cloud, np.float32)
+        self.ring = LidarData._unpack(self.ring, np.uint16)
+        self.time_offset = LidarData._unpack(self.time_offset, np.float32)
+        return self
+
+    @staticmethod
+    def _unpack(packed, dtype):
+        if not isinstance(packed, (bytes, bytearray)):
+            # older servers send point cloud as list of floats and no other channels
+            return np.array(packed if isinstance(packed, list) else [], dtype=dtype)
+        # empty channel is sent as single byte
+        itemsize = np.dtype(dtype).itemsize
+        return np.frombuffer(packed[:len(packed) - len(packed) % itemsize], dtype=dtype)
+
+class TickPhaseStats(MsgpackMixin):
+    name = ''
+    count = 0
+    mean = 0.0
+    p50 = 0.0
+    p90 = 0.0
+    p99 = 0.0
+    max = 0.0
@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef sgm_aggregation_benchmark_h
+#define sgm_aggregation_benchmark_h
+
+#include "SgmTestBase.h"
+#include "SyntheticStereo.h"
+#include "sgmstereo.h"
+#include <vector>
+#include <string>
+#include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// ms/frame of SGMStereo::Run with 1 to 16 threads for the original horizontal + vertical mode and for
+// AGGREGATION_PATHS with 4 and 8 directions, and how well each matches the synthetic scene.
+class AggregationBenchmark : public SgmTestBase
+{
+public:
+	virtual void run() override
+	{
+		printf("AggregationBenchmark\n");
+#ifndef _OPENMP
+		printf("  built without OpenMP, only 1 thread\n");
+#endif
+		runSize(640, 480, 128);
+		runSize(1280, 720, 128);
+#ifdef _OPENMP
+		omp_set_num_threads(omp_get_num_procs());
+#endif
+	}
+
+private:
+	void runSize(int w, int h, int ndisps)
+	{
+		printf("  %dx%d, %d disparities, %d cores\n", w, h, ndisps, cores());
+		SyntheticStereo pair(w, h, ndisps);
+
+		runMode(pair, ndisps, 4, AGGREGATION_HOR_VERT, "hor+vert 4 paths");
+		runMode(pair, ndisps, 4, AGGREGATION_PATHS, "parallel 4 paths");
+		runMode(pair, ndisps, 8, AGGREGATION_PATHS, "parallel 8 paths");
+	}
+
+	void runMode(SyntheticStereo& pair, int ndisps, int directions, AggregationMode mode, const std::string& name)
+	{
+		int w = pair.w, h = pair.h;
+		SGMStereo sgm(w, h, -ndisps, 0, directions, 16, 1, 200.0f, 1.0f, 8.0f, 10.0f, 0);
+		sgm.setAggregation(mode);
+		std::vector<float> disp(w * h);
+		std::vector<unsigned char> conf(w * h);
+
+		int threads[] = { 1, 2, 4, 8, 16 };
+		for (int n : threads)
+		{
+#ifdef _OPENMP
+			omp_set_num_threads(n);
+#else
+			if (n > 1)
+				break;
+#endif
+			sgm.Run(pair.left.data(), pair.right.data(), disp.data(), conf.data());
+			int frames = 0;
+			double start = now();
+			while (frames < 3 || now() - start < 0.5)
+			{
+				sgm.Run(pair.left.data(), pair.right.data(), disp.data(), conf.data());
+				frames++;
+			}
+			report(name + ", " + std::to_string(n) + " threads", (now() - start) * 1000 / frames, "ms/frame");
+		}
+
+		size_t valid = 0, good = 0, interior = 0;
+		for (int y = 1; y < h - 1; y++)
+		{
+			for (int x = 1; x < w - 1; x++)
+			{
+				int i = y * w + x;
+				interior++;
+				if (conf[i] != 0)
+				{
+					valid++;
+					if (fabsf(disp[i] + pair.disparity[i]) <= 1.0f)
+						good++;
+				}
+			}
+		}
+		report(name + " valid", 100.0 * valid / interior, "% of pixels");
+		report(name + " within 1px of ground truth", 100.0 * good / interior, "% of pixels");
+		report(name + " wrong by more than 1px", 100.0 * (valid - good) / valid, "% of valid");
+		sgm.free();
+	}
+
+	static int cores()
+	{
+#ifdef _OPENMP
+		return omp_get_num_procs();
+#else
+		return 1;
+#endif
+	}
+};
+
+#endif
@@ -0,0 +1,78 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef sgm_aggregation_test_h
+#define sgm_aggregation_test_h
+
+#include "SgmTestBase.h"
+#include "SyntheticStereo.h"
+#include "sgmstereo.h"
+#include <vector>
+#include <string.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+// AGGREGATION_PATHS adds up the same path costs as the older modes, only in a different order, so it has to give
+// the same result as AGGREGATION_HOR_VERT with 4 directions and AGGREGATION_SEQUENTIAL with 8, for any number of
+// threads.
+class AggregationTest : public SgmTestBase
+{
+public:
+	virtual void run() override
+	{
+		printf("AggregationTest\n");
+		testPair(256, 144, 64, 4, AGGREGATION_HOR_VERT);
+		testPair(256, 144, 64, 8, AGGREGATION_SEQUENTIAL);
+		testPair(203, 61, 40, 8, AGGREGATION_SEQUENTIAL);
+	}
+
+private:
+	struct Result
+	{
+		std::vector<float> disp;
+		std::vector<unsigned char> conf;
+
+		bool operator==(const Result& other) const
+		{
+			return memcmp(disp.data(), other.disp.data(), disp.size() * sizeof(float)) == 0 && conf == other.conf;
+		}
+	};
+
+	void runMode(SGMStereo& sgm, AggregationMode mode, SyntheticStereo& pair, Result& result)
+	{
+		sgm.setAggregation(mode);
+		result.disp.resize(pair.w * pair.h);
+		result.conf.resize(pair.w * pair.h);
+		sgm.Run(pair.left.data(), pair.right.data(), result.disp.data(), result.conf.data());
+	}
+
+	void testPair(int w, int h, int ndisps, int directions, AggregationMode expectedMode)
+	{
+		SyntheticStereo pair(w, h, ndisps);
+		SGMStereo sgm(w, h, -ndisps, 0, directions, 16, 1, 200.0f, 1.0f, 8.0f, 10.0f, 0);
+
+		Result expected;
+		runMode(sgm, expectedMode, pair, expected);
+
+		int threads[] = { 1, 3, 8 };
+		for (int n : threads)
+		{
+#ifdef _OPENMP
+			omp_set_num_threads(n);
+#endif
+			Result result;
+			runMode(sgm, AGGREGATION_PATHS, pair, result);
+			testAssert(result == expected, std::string("aggregated paths differ with ") + std::to_string(directions) + " directions and "
+				+ std::to_string(n) + " threads");
+		}
+#ifdef _OPENMP
+		omp_set_num_threads(omp_get_num_procs());
+#endif
+		printf("    %dx%d, %d directions: paths match\n", w, h, directions);
+
+		sgm.free();
+	}
+};
+
+#endif
@@ -0,0 +1,13 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef sgm_allocation_counter_h
+#define sgm_allocation_counter_h
+
+#include <stddef.h>
+
+// Counts the calls to the global operator new, which AllocationCounter.cpp replaces for the whole test program.
+// malloc is not counted, SGMStereo only uses _aligned_malloc when it allocates its buffers.
+size_t allocationCount();
+
+#endif
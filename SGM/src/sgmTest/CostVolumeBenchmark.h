@@ -0,0 +1,73 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef sgm_cost_volume_benchmark_h
+#define sgm_cost_volume_benchmark_h
+
+#include "SgmTestBase.h"
+#include "SyntheticStereo.h"
+#include "sgmstereo.h"
+#include <vector>
+
+// ms/frame of the cost volume alone and of the whole of SGMStereo::Run for each cost kernel.
+class CostVolumeBenchmark : public SgmTestBase
+{
+public:
+	virtual void run() override
+	{
+		printf("CostVolumeBenchmark\n");
+		runSize(256, 144, 64);
+		runSize(640, 480, 128);
+		runSize(1280, 720, 128);
+	}
+
+private:
+	void runSize(int w, int h, int ndisps)
+	{
+		printf("  %dx%d, %d disparities\n", w, h, ndisps);
+		SyntheticStereo pair(w, h, ndisps);
+		SGMStereo sgm(w, h, -ndisps, 0, 4, 16, 1, 200.0f, 1.0f, 8.0f, 10.0f, 0);
+		std::vector<float> disp(w * h);
+		std::vector<unsigned char> conf(w * h);
+
+		CostKernel kernels[] = { COST_KERNEL_REFERENCE, COST_KERNEL_SCALAR, COST_KERNEL_SSE41, COST_KERNEL_AVX2 };
+		double referenceMs = 0;
+		for (CostKernel kernel : kernels)
+		{
+			if (!costKernelSupported(kernel))
+				continue;
+			sgm.setCostKernel(kernel);
+			std::string name = costKernelName(kernel);
+
+			double ms = timeFrames([&] { sgm.RunCostVolume(pair.left.data(), pair.right.data()); });
+			if (kernel == COST_KERNEL_REFERENCE)
+				referenceMs = ms;
+			report(name + " cost volume", ms, "ms/frame");
+			if (kernel != COST_KERNEL_REFERENCE)
+				report(name + " speedup", referenceMs / ms, "x");
+
+			ms = timeFrames([&] { sgm.Run(pair.left.data(), pair.right.data(), disp.data(), conf.data()); });
+			report(name + " Run", ms, "ms/frame");
+		}
+		sgm.free();
+	}
+
+	// average over at least 3 frames and half a second
+	template <typename TFunc>
+	double timeFrames(TFunc frame)
+	{
+		frame();
+		int frames = 0;
+		double start = now();
+		double elapsed = 0;
+		while (frames < 3 || elapsed < 0.5)
+		{
+			frame();
+			frames++;
+			elapsed = now() - start;
+		}
+		return elapsed * 1000 / frames;
+	}
+};
+
+#endif
@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef sgm_cost_volume_test_h
+#define sgm_cost_volume_test_h
+
+#include "SgmTestBase.h"
+#include "SyntheticStereo.h"
+#include "sgmstereo.h"
+#include <vector>
+#include <string.h>
+
+// The integer cost kernels must agree with each other bit for bit, and with the original float kernel
+// (calculateDSI_sse) up to rounding of the last bit before the cost is truncated to an integer.
+class CostVolumeTest : public SgmTestBase
+{
+public:
+	virtual void run() override
+	{
+		printf("CostVolumeTest\n");
+		testPair(256, 144, 64);
+		// odd sizes and a disparity range that is not a multiple of 16 exercise every tail case in the kernels
+		testPair(203, 61, 40);
+	}
+
+private:
+	struct Result
+	{
+		std::vector<short> costs;
+		std::vector<float> disp;
+		std::vector<unsigned char> conf;
+	};
+
+	void runKernel(SGMStereo& sgm, CostKernel kernel, SyntheticStereo& pair, Result& result)
+	{
+		testAssert(sgm.setCostKernel(kernel) == kernel, std::string("cost kernel not supported: ") + costKernelName(kernel));
+		result.disp.resize(pair.w * pair.h);
+		result.conf.resize(pair.w * pair.h);
+		sgm.Run(pair.left.data(), pair.right.data(), result.disp.data(), result.conf.data());
+		const DSI& dsi = sgm.getCostVolume();
+		result.costs.assign(dsi.m_data, dsi.m_data + dsi.m_cols * dsi.m_rows * dsi.m_planes);
+	}
+
+	void testPair(int w, int h, int ndisps)
+	{
+		SyntheticStereo pair(w, h, ndisps);
+		SGMStereo sgm(w, h, -ndisps, 0, 4, 16, 1, 200.0f, 1.0f, 8.0f, 10.0f, 0);
+
+		Result reference, scalar;
+		runKernel(sgm, COST_KERNEL_REFERENCE, pair, reference);
+		runKernel(sgm, COST_KERNEL_SCALAR, pair, scalar);
+
+		CostKernel simd[] = { COST_KERNEL_SSE41, COST_KERNEL_AVX2 };
+		for (CostKernel kernel : simd)
+		{
+			if (!costKernelSupported(kernel))
+			{
+				printf("    %s is not supported by this cpu, skipped\n", costKernelName(kernel));
+				continue;
+			}
+			Result result;
+			runKernel(sgm, kernel, pair, result);
+			testAssert(result.costs == scalar.costs, std::string(costKernelName(kernel)) + " cost volume differs from scalar");
+			testAssert(memcmp(result.disp.data(), scalar.disp.data(), result.disp.size() * sizeof(float)) == 0 && result.conf == scalar.conf,
+				std::string(costKernelName(kernel)) + " disparity differs from scalar");
+		}
+
+		// against the float kernel
+		size_t costDiffs = 0;
+		int maxCostDiff = 0;
+		for (size_t i = 0; i < scalar.costs.size(); i++)
+		{
+			int diff = abs(scalar.costs[i] - reference.costs[i]);
+			if (diff != 0)
+				costDiffs++;
+			if (diff > maxCostDiff)
+				maxCostDiff = diff;
+		}
+		size_t dispDiffs = 0;
+		for (size_t i = 0; i < scalar.disp.size(); i++)
+		{
+			if (scalar.conf[i] != reference.conf[i] || fabsf(scalar.disp[i] - reference.disp[i]) > 0.01f)
+				dispDiffs++;
+		}
+		double dispDiffPercent = 100.0 * dispDiffs / scalar.disp.size();
+		printf("    %dx%d: %.4f%% costs and %.3f%% disparities differ from reference, max cost difference %d\n",
+			w, h, 100.0 * costDiffs / scalar.costs.size(), dispDiffPercent, maxCostDiff);
+		testAssert(maxCostDiff <= 1, "cost volume differs from reference by more than rounding");
+		testAssert(dispDiffPercent < 1.0, "disparity differs from reference");
+
+		// and the result has to make sense
+		size_t good = 0, valid = 0;
+		for (size_t i = 0; i < scalar.disp.size(); i++)
+		{
+			if (scalar.conf[i] != 0)
+			{
+				valid++;
+				if (fabsf(scalar.disp[i] + pair.disparity[i]) <= 1.0f)
+					good++;
+			}
+		}
+		printf("    %dx%d: %.1f%% of pixels valid, %.1f%% of those within 1 pixel of ground truth\n",
+			w, h, 100.0 * valid / scalar.disp.size(), 100.0 * good / valid);
+		testAssert(good > 0.8 * valid, "disparity does not match the synthetic scene");
+
+		sgm.free();
+	}
+};
+
+#endif
@@ -0,0 +1,173 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef sgm_frame_buffer_test_h
+#define sgm_frame_buffer_test_h
+
+#include "SgmTestBase.h"
+#include "SyntheticStereo.h"
+#include "AllocationCounter.h"
+#include "StateStereo.h"
+#include <vector>
+#include <random>
+#include <string.h>
+
+// CStateStereo on strided RGB, RGBA and gray views: the gray scale images have to be the ones the scalar
+// downsampling always made, with and without SSE4.1, the disparities the ones SGMStereo finds on those, and once the
+// first frame has allocated the SGM buffers no frame may allocate.
+class FrameBufferTest : public SgmTestBase
+{
+public:
+	virtual void run() override
+	{
+		printf("FrameBufferTest\n");
+		testResample(256, 144, 3, 0, 256);
+		testResample(256, 144, 4, 16, 128);
+		testResample(203, 61, 3, 5, 100);
+		testResample(203, 61, 1, 3, 203);
+		testResample(97, 40, 4, 0, 64);
+
+		SGMOptions options;
+		options.maxDisparity = 32;
+		testFrames("4 paths", options, 256, 144, 4, 128);
+		testFrames("4 paths, full size", options, 256, 144, 3, -1);
+		options.numDirections = 8;
+		testFrames("8 paths", options, 256, 144, 3, 128);
+		options.tileRows = 16;
+		testFrames("8 paths, tiles", options, 256, 144, 4, 128);
+		options.tileRows = 0;
+		options.doSequential = 1;
+		testFrames("8 paths, sequential", options, 256, 144, 3, 128);
+	}
+
+private:
+	// a color image of a gray one padded to stride, with the channels spread around the gray value
+	struct ColorImage
+	{
+		std::vector<unsigned char> pixels;
+		ImageView view;
+
+		ColorImage(const std::vector<uint8_t>& gray, int w, int h, int channels, int padding, unsigned int seed)
+		{
+			std::mt19937 random(seed);
+			std::uniform_int_distribution<int> spread(-40, 40);
+			int stride = w * channels + padding;
+			pixels.assign((size_t)stride * h, 0xcd);
+			for (int y = 0; y < h; y++)
+			{
+				for (int x = 0; x < w; x++)
+				{
+					unsigned char* p = &pixels[(size_t)y * stride + x * channels];
+					int g = gray[y * w + x];
+					for (int c = 0; c < channels; c++)
+						p[c] = (unsigned char)__min(__max(c == 0 || c == 3 ? g : g + spread(random), 0), 255);
+				}
+			}
+			view = ImageView(pixels.data(), w, h, stride, channels);
+		}
+	};
+
+	// the downsampling CStateStereo::PrepareFrame did one pixel at a time
+	static std::vector<unsigned char> referenceGray(const ImageView& in, int outW, int outH)
+	{
+		std::vector<unsigned char> out((size_t)outW * outH);
+		float scale = in.width / (1.0f * outW);
+		for (int y = 0; y < outH; y++)
+		{
+			int y0 = __min((int)(y * scale), in.height - 1);
+			int y1 = __min(__max((int)((y + 1) * scale), y0 + 1), in.height);
+			for (int x = 0; x < outW; x++)
+			{
+				int x0 = __min((int)(x * scale), in.width - 1);
+				int x1 = __min(__max((int)((x + 1) * scale), x0 + 1), in.width);
+				int sum = 0;
+				for (int sy = y0; sy < y1; sy++)
+				{
+					for (int sx = x0; sx < x1; sx++)
+					{
+						const unsigned char* p = in.row(sy) + sx * in.channels;
+						sum += in.channels >= 3 ? p[0] + p[1] + p[2] : 3 * p[0];
+					}
+				}
+				out[y * outW + x] = (unsigned char)(sum / (3 * (y1 - y0) * (x1 - x0)));
+			}
+		}
+		return out;
+	}
+
+	void testResample(int w, int h, int channels, int padding, int outW)
+	{
+		SyntheticStereo pair(w, h, 16);
+		ColorImage image(pair.left, w, h, channels, padding, 7);
+		int outH = outW == w ? h : (int)(outW / (1.0f * w) * h + 0.5f);
+		std::vector<unsigned char> expected = referenceGray(image.view, outW, outH);
+
+		CFrameResampler resampler;
+		resampler.Initialize(w, h, outW, outH);
+		std::string name = std::to_string(w) + "x" + std::to_string(h) + "x" + std::to_string(channels) + " to " +
+			std::to_string(outW) + "x" + std::to_string(outH);
+		bool simd[] = { false, true };
+		for (bool useSimd : simd)
+		{
+			if (resampler.SetSimd(useSimd) != useSimd)
+				continue;
+			std::vector<unsigned char> gray((size_t)outW * outH, 0);
+			testAssert(resampler.Resample(image.view, gray.data()), name + " was rejected");
+			testAssert(gray == expected, name + (useSimd ? " with SSE4.1" : "") + " differs from the scalar downsampling");
+		}
+		ImageView wrongSize(image.view.data, w - 1, h, image.view.stride, channels);
+		std::vector<unsigned char> gray((size_t)outW * outH, 0);
+		testAssert(!resampler.Resample(wrongSize, gray.data()), name + " took a " + std::to_string(w - 1) + " pixel wide image");
+		printf("    %s: gray scale matches%s\n", name.c_str(), resampler.GetSimd() ? ", SSE4.1 too" : "");
+	}
+
+	void testFrames(const char* name, SGMOptions options, int w, int h, int channels, int maxWidth)
+	{
+		SyntheticStereo pair(w, h, 2 * options.maxDisparity);
+		ColorImage left(pair.left, w, h, channels, 8, 1);
+		ColorImage right(pair.right, w, h, channels, 8, 2);
+
+		options.maxImageDimensionWidth = maxWidth;
+		CStateStereo stereo;
+		stereo.Initialize(options, h, w);
+		int pw = stereo.processingFrameWidth, ph = stereo.processingFrameHeight;
+
+		// SGMStereo on the gray images the views should come down to
+		std::vector<unsigned char> grayLeft = referenceGray(left.view, pw, ph);
+		std::vector<unsigned char> grayRight = referenceGray(right.view, pw, ph);
+		int ndisps = (options.maxDisparity - options.minDisparity + 7) / 8 * 8;
+		SGMStereo sgm(pw, ph, -(options.minDisparity + ndisps), -options.minDisparity, options.numDirections,
+			options.sgmConfidenceThreshold, options.doSubPixRefinement, options.smoothness, options.penalty1,
+			options.penalty2, options.alpha, options.doSequential);
+		if (options.tileRows > 0)
+			sgm.setTiling(options.tileRows, options.tileHalo);
+		std::vector<float> disp((size_t)pw * ph);
+		std::vector<unsigned char> conf((size_t)pw * ph);
+		sgm.Run(grayLeft.data(), grayRight.data(), disp.data(), conf.data());
+		sgm.free();
+
+		testAssert(stereo.ProcessFrame(left.view, right.view), std::string(name) + ": the views were rejected");
+		const int frames = 3;
+		size_t before = allocationCount();
+		for (int i = 0; i < frames; i++)
+			stereo.ProcessFrame(left.view, right.view);
+		size_t allocations = allocationCount() - before;
+		testAssert(allocations == 0, std::string(name) + ": " + std::to_string(allocations) + " allocations in " +
+			std::to_string(frames) + " frames");
+
+		MapView<float> dispView = stereo.GetDisparity();
+		MapView<unsigned char> confView = stereo.GetConfidence();
+		testAssert(dispView.width == pw && dispView.height == ph && confView.width == pw && confView.height == ph,
+			std::string(name) + ": the maps are not at processing resolution");
+		for (int y = 0; y < ph; y++)
+		{
+			testAssert(memcmp(dispView.row(y), &disp[y * pw], pw * sizeof(float)) == 0 &&
+				memcmp(confView.row(y), &conf[y * pw], pw) == 0,
+				std::string(name) + ": disparities differ from SGMStereo in row " + std::to_string(y));
+		}
+		stereo.CleanUp();
+		printf("    %s, %dx%dx%d to %dx%d: same disparities, no allocations per frame\n", name, w, h, channels, pw, ph);
+	}
+};
+
+#endif
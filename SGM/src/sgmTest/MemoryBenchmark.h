@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef sgm_memory_benchmark_h
+#define sgm_memory_benchmark_h
+
+#include "SgmTestBase.h"
+#include "SyntheticStereo.h"
+#include "sgmstereo.h"
+#include <vector>
+#include <string>
+#include <math.h>
+
+// Memory, peak RSS above what the process had before, and ms/frame of SGMStereo::Run with the whole image 16 bit volumes and with tiling, and how well each
+// matches the synthetic scene.  Peak RSS comes from the kernel's high water mark, which is reset before each mode,
+// so it is only reported on Linux.
+class MemoryBenchmark : public SgmTestBase
+{
+public:
+	virtual void run() override
+	{
+		printf("MemoryBenchmark\n");
+		runSize(640, 480, 128);
+		runSize(1280, 720, 128);
+	}
+
+private:
+	void runSize(int w, int h, int ndisps)
+	{
+		printf("  %dx%d, %d disparities\n", w, h, ndisps);
+		SyntheticStereo pair(w, h, ndisps);
+
+		runMode(pair, ndisps, 0, 0, "16 bit");
+		runMode(pair, ndisps, h, 0, "8 bit, 1 tile");
+		runMode(pair, ndisps, 64, 32, "8 bit, tiles 64 + 32 halo");
+		runMode(pair, ndisps, 32, 16, "8 bit, tiles 32 + 16 halo");
+	}
+
+	void runMode(SyntheticStereo& pair, int ndisps, int tileRows, int haloRows, const std::string& name)
+	{
+		int w = pair.w, h = pair.h;
+		std::vector<float> disp(w * h);
+		std::vector<unsigned char> conf(w * h);
+		bool haveRss = resetPeakRss();
+		double baseRss = readStatusMB("VmRSS:");
+
+		SGMStereo sgm(w, h, -ndisps, 0, 8, 16, 1, 200.0f, 1.0f, 8.0f, 10.0f, 0);
+		sgm.setTiling(tileRows, haloRows);
+		sgm.Run(pair.left.data(), pair.right.data(), disp.data(), conf.data());
+		int frames = 0;
+		double start = now();
+		while (frames < 3 || now() - start < 0.5)
+		{
+			sgm.Run(pair.left.data(), pair.right.data(), disp.data(), conf.data());
+			frames++;
+		}
+		report(name, (now() - start) * 1000 / frames, "ms/frame");
+		report(name + " buffers", sgm.getBufferBytes() / (1024.0 * 1024.0), "MB");
+		if (haveRss)
+			report(name + " peak RSS", readStatusMB("VmHWM:") - baseRss, "MB");
+
+		size_t good = 0, interior = 0;
+		for (int y = 1; y < h - 1; y++)
+		{
+			for (int x = 1; x < w - 1; x++)
+			{
+				int i = y * w + x;
+				interior++;
+				if (conf[i] != 0 && fabsf(disp[i] + pair.disparity[i]) <= 1.0f)
+					good++;
+			}
+		}
+		report(name + " within 1px", 100.0 * good / interior, "% of pixels");
+		sgm.free();
+	}
+
+	// writing 5 to clear_refs sets VmHWM back to the current RSS
+	static bool resetPeakRss()
+	{
+#ifdef __linux__
+		FILE* f = fopen("/proc/self/clear_refs", "w");
+		if (f == NULL)
+			return false;
+		bool ok = fputs("5", f) >= 0;
+		ok = fclose(f) == 0 && ok;
+		return ok && readStatusMB("VmHWM:") >= 0;
+#else
+		return false;
+#endif
+	}
+
+	// a line of /proc/self/status in MB, -1 if it is not there
+	static double readStatusMB(const char* field)
+	{
+		double mb = -1;
+#ifdef __linux__
+		FILE* f = fopen("/proc/self/status", "r");
+		if (f == NULL)
+			return mb;
+		char line[256];
+		size_t len = strlen(field);
+		while (fgets(line, sizeof(line), f) != NULL)
+		{
+			if (strncmp(line, field, len) == 0)
+			{
+				mb = atof(line + len) / 1024.0;
+				break;
+			}
+		}
+		fclose(f);
+#else
+		(void)field;
+#endif
+		return mb;
+	}
+};
+
+#endif
@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef sgm_test_base_h
+#define sgm_test_base_h
+
+#include <stdio.h>
+#include <string>
+#include <chrono>
+#include <stdexcept>
+
+class SgmTestBase
+{
+public:
+	virtual void run() = 0;
+	virtual ~SgmTestBase() {}
+
+protected:
+	void testAssert(bool condition, const std::string& message)
+	{
+		if (!condition)
+			throw std::runtime_error(message.c_str());
+	}
+
+	void report(const std::string& name, double value, const std::string& unit)
+	{
+		printf("    %-48s %14.2f %s\n", name.c_str(), value, unit.c_str());
+	}
+
+	static double now()
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+};
+
+#endif
@@ -0,0 +1,134 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef sgm_synthetic_stereo_h
+#define sgm_synthetic_stereo_h
+
+#include <vector>
+#include <random>
+#include <stdint.h>
+#include <math.h>
+
+// Rectified grayscale pair of a scene made of a background plane that slants away towards the top of the image and
+// a few fronto-parallel boxes in front of it, each with its own random texture.  Pixel x in the left image is
+// pixel x - disparity in the right image, so SGMStereo should find -disparity.
+struct SyntheticStereo
+{
+	int w, h;
+	std::vector<uint8_t> left, right;
+	std::vector<float> disparity;		// ground truth in the left image
+
+	SyntheticStereo(int width, int height, int maxDisparity, unsigned int seed = 42)
+		: w(width), h(height), left(width * height), right(width * height), disparity(width * height)
+	{
+		std::mt19937 random(seed);
+
+		struct Layer
+		{
+			int x0, y0, x1, y1;		// left image rectangle
+			float d;
+			std::vector<float> texture;
+		};
+		std::vector<Layer> layers(4);
+		layers[0].x0 = 0; layers[0].y0 = 0; layers[0].x1 = w; layers[0].y1 = h; layers[0].d = 0;
+		layers[1].x0 = w / 8; layers[1].y0 = h / 5; layers[1].x1 = w / 2; layers[1].y1 = h / 2; layers[1].d = 0.45f * maxDisparity;
+		layers[2].x0 = w / 3; layers[2].y0 = h / 2; layers[2].x1 = 3 * w / 4; layers[2].y1 = 7 * h / 8; layers[2].d = 0.7f * maxDisparity;
+		layers[3].x0 = 5 * w / 8; layers[3].y0 = h / 6; layers[3].x1 = 7 * w / 8; layers[3].y1 = 2 * h / 5; layers[3].d = 0.3f * maxDisparity;
+		for (Layer& layer : layers)
+		{
+			layer.texture = makeTexture(w + maxDisparity + 2, h, random);
+		}
+
+		std::normal_distribution<float> noise(0.0f, 1.5f);
+		for (int y = 0; y < h; y++)
+		{
+			// background disparity drops from 0.2 to 0.05 of the range towards the top
+			float background = maxDisparity * (0.05f + 0.15f * y / h);
+			for (int x = 0; x < w; x++)
+			{
+				// front most layer in the left image
+				int k = frontLayer(layers, x, y);
+				float d = k == 0 ? background : layers[k].d;
+				disparity[y * w + x] = d;
+				left[y * w + x] = toByte(sample(layers[k].texture, w + maxDisparity + 2, x, y) + noise(random));
+
+				// front most layer that the right image pixel sees
+				float value = 0;
+				for (int j = (int)layers.size() - 1; j >= 0; j--)
+				{
+					float dj = j == 0 ? background : layers[j].d;
+					float xl = x + dj;
+					if (j == 0 || frontLayer(layers, (int)(xl + 0.5f), y) == j)
+					{
+						value = sample(layers[j].texture, w + maxDisparity + 2, xl, y);
+						break;
+					}
+				}
+				right[y * w + x] = toByte(value + noise(random));
+			}
+		}
+	}
+
+private:
+	template <typename TLayers>
+	static int frontLayer(const TLayers& layers, int x, int y)
+	{
+		for (int k = (int)layers.size() - 1; k > 0; k--)
+		{
+			if (x >= layers[k].x0 && x < layers[k].x1 && y >= layers[k].y0 && y < layers[k].y1)
+				return k;
+		}
+		return 0;
+	}
+
+	static uint8_t toByte(float v)
+	{
+		return (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v + 0.5f);
+	}
+
+	// white noise smoothed a little so it has structure at a few pixel scales, plus stripes
+	static std::vector<float> makeTexture(int tw, int th, std::mt19937& random)
+	{
+		std::uniform_real_distribution<float> uniform(0.0f, 255.0f);
+		std::vector<float> noise(tw * th), texture(tw * th);
+		for (float& v : noise)
+			v = uniform(random);
+		float frequency = uniform(random) / 2000.0f + 0.02f;
+		for (int y = 0; y < th; y++)
+		{
+			for (int x = 0; x < tw; x++)
+			{
+				float s = 0;
+				int n = 0;
+				for (int dy = -1; dy <= 1; dy++)
+				{
+					for (int dx = -1; dx <= 1; dx++)
+					{
+						int xx = x + dx, yy = y + dy;
+						if (xx >= 0 && xx < tw && yy >= 0 && yy < th)
+						{
+							s += noise[yy * tw + xx];
+							n++;
+						}
+					}
+				}
+				texture[y * tw + x] = 0.5f * (s / n) + 0.5f * noise[y * tw + x] * 0.5f + 40.0f * sinf(frequency * (x + 2 * y));
+			}
+		}
+		return texture;
+	}
+
+	static float sample(const std::vector<float>& texture, int tw, float x, int y)
+	{
+		if (x < 0)
+			x = 0;
+		if (x > tw - 2)
+			x = (float)(tw - 2);
+		int x0 = (int)x;
+		float f = x - x0;
+		const float* row = &texture[y * tw];
+		return row[x0] * (1 - f) + row[x0 + 1] * f;
+	}
+};
+
+#endif
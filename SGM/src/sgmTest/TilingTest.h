@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef sgm_tiling_test_h
+#define sgm_tiling_test_h
+
+#include "SgmTestBase.h"
+#include "SyntheticStereo.h"
+#include "sgmstereo.h"
+#include <vector>
+#include <string.h>
+#include <math.h>
+
+// Tiling stores the costs in 8 bits, which loses nothing, so when the halo reaches the top and bottom of the image
+// the paths are the same as without tiling and so is the result, however many bands there are.  With a smaller
+// halo the vertical paths are cut off and the result has to stay close.
+class TilingTest : public SgmTestBase
+{
+public:
+	virtual void run() override
+	{
+		printf("TilingTest\n");
+		testPair(256, 144, 64, 4);
+		testPair(256, 144, 64, 8);
+		testPair(203, 61, 40, 8);
+	}
+
+private:
+	struct Result
+	{
+		std::vector<float> disp;
+		std::vector<unsigned char> conf;
+
+		bool operator==(const Result& other) const
+		{
+			return memcmp(disp.data(), other.disp.data(), disp.size() * sizeof(float)) == 0 && conf == other.conf;
+		}
+	};
+
+	void runTiling(SGMStereo& sgm, int tileRows, int haloRows, SyntheticStereo& pair, Result& result)
+	{
+		sgm.setTiling(tileRows, haloRows);
+		result.disp.assign(pair.w * pair.h, 0.0f);
+		result.conf.assign(pair.w * pair.h, 1);
+		sgm.Run(pair.left.data(), pair.right.data(), result.disp.data(), result.conf.data());
+	}
+
+	void testPair(int w, int h, int ndisps, int directions)
+	{
+		SyntheticStereo pair(w, h, ndisps);
+		SGMStereo sgm(w, h, -ndisps, 0, directions, 16, 1, 200.0f, 1.0f, 8.0f, 10.0f, 0);
+
+		Result expected;
+		runTiling(sgm, 0, 0, pair, expected);
+
+		int exactTiles[][2] = { { h, 0 }, { 2 * h, 0 }, { 16, h }, { 7, h } };
+		for (auto& tile : exactTiles)
+		{
+			Result result;
+			runTiling(sgm, tile[0], tile[1], pair, result);
+			testAssert(result == expected, "tiles of " + std::to_string(tile[0]) + " rows with a " + std::to_string(tile[1]) +
+				" row halo differ from the whole image with " + std::to_string(directions) + " directions");
+			// and again with the buffers of the first frame
+			runTiling(sgm, tile[0], tile[1], pair, result);
+			testAssert(result == expected, "second frame with tiles of " + std::to_string(tile[0]) + " rows differs");
+		}
+
+		Result tiled;
+		runTiling(sgm, 16, 16, pair, tiled);
+		size_t same = 0, valid = 0;
+		for (int i = 0; i < w * h; i++)
+		{
+			if (expected.conf[i] != 0)
+			{
+				valid++;
+				if (tiled.conf[i] != 0 && fabsf(tiled.disp[i] - expected.disp[i]) <= 1.0f)
+					same++;
+			}
+		}
+		double agree = 100.0 * same / valid;
+		testAssert(agree > 95.0, "tiles of 16 rows with a 16 row halo only agree on " + std::to_string(agree) + "% of pixels");
+		printf("    %dx%d, %d directions: tiles match, %.1f%% agree with a 16 row halo\n", w, h, directions, agree);
+
+		sgm.free();
+	}
+};
+
+#endif
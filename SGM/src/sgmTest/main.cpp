@@ -0,0 +1,49 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <memory>
+#include <string.h>
+#include "CostVolumeTest.h"
+#include "AggregationTest.h"
+#include "TilingTest.h"
+#include "FrameBufferTest.h"
+#include "CostVolumeBenchmark.h"
+#include "AggregationBenchmark.h"
+#include "MemoryBenchmark.h"
+
+// runs the SGM tests, "sgmTest -benchmark" runs the benchmarks as well.
+int main(int argc, char* argv[])
+{
+	bool benchmark = argc > 1 && strcmp(argv[1], "-benchmark") == 0;
+
+	std::unique_ptr<SgmTestBase> tests[] = {
+		std::unique_ptr<SgmTestBase>(new CostVolumeTest()),
+		std::unique_ptr<SgmTestBase>(new AggregationTest()),
+		std::unique_ptr<SgmTestBase>(new TilingTest()),
+		std::unique_ptr<SgmTestBase>(new FrameBufferTest())
+	};
+	std::unique_ptr<SgmTestBase> benchmarks[] = {
+		std::unique_ptr<SgmTestBase>(new CostVolumeBenchmark()),
+		std::unique_ptr<SgmTestBase>(new AggregationBenchmark()),
+		std::unique_ptr<SgmTestBase>(new MemoryBenchmark())
+	};
+
+	try
+	{
+		for (auto& test : tests)
+			test->run();
+		printf("all tests passed\n");
+
+		if (benchmark)
+		{
+			for (auto& b : benchmarks)
+				b->run();
+		}
+	}
+	catch (std::exception& e)
+	{
+		printf("FAILED: %s\n", e.what());
+		return 1;
+	}
+	return 0;
+}
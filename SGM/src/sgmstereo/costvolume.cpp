@@ -0,0 +1,416 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "costvolume.h"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define SGM_TARGET_SSE41
+#define SGM_TARGET_AVX2
+#else
+// the SIMD kernels are compiled for their instruction set one function at a time, so the library itself
+// still runs on any x64 cpu and picks a kernel at run time.
+#define SGM_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define SGM_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#include <immintrin.h>
+
+namespace
+{
+	bool cpuHasSSE41()
+	{
+#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 1);
+		return (info[2] & (1 << 19)) != 0;
+#else
+		return __builtin_cpu_supports("sse4.1") != 0;
+#endif
+	}
+
+	bool cpuHasAVX2()
+	{
+#if defined(_MSC_VER)
+		int info[4];
+		__cpuid(info, 1);
+		// the OS has to save the ymm registers too
+		if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 6) != 6)
+			return false;
+		__cpuidex(info, 7, 0);
+		return (info[1] & (1 << 5)) != 0;
+#else
+		return __builtin_cpu_supports("avx2") != 0;
+#endif
+	}
+
+	// the 3x3 left window around (x, y) in row major order
+	inline void loadWindow(const unsigned char* img, int w, int x, int y, int* l)
+	{
+		const unsigned char* p = img + (y - 1) * w + x - 1;
+		for (int r = 0; r < 3; r++, p += w)
+		{
+			l[3 * r] = p[0];
+			l[3 * r + 1] = p[1];
+			l[3 * r + 2] = p[2];
+		}
+	}
+
+	// whether every group of 4 disparities in [disp, disp + count) is one calculateDSI_sse would compute
+	inline bool groupsValid(int x, int disp, int count, int w)
+	{
+		return x + disp - 1 >= 0 && x + disp + count + 1 < w;
+	}
+
+	// ncc = (9 sumLR - sumL sumR) / sqrt(devL devR), the vector kernels do the same float operations in the same order
+	inline short nccCost(int sumLR, int sumL, int devL, int sumR, int devR)
+	{
+		float num = (float)(9 * sumLR - sumL * sumR);
+		float den = (float)devL * (float)devR;
+		float ncc = num / sqrtf(den < 0.81f ? 0.81f : den);
+		float score = (1.0f - ncc) * 255.0f;
+		return (short)(score < 255.0f ? score : 255.0f);
+	}
+
+	// one group of 4 disparities starting at disp, pDSI points at the group's first plane
+	template <typename T>
+	inline void costGroupScalar(const CostVolumeInput& in, const int* l, int x, int y, int disp, T* pDSI)
+	{
+		const int w = in.w;
+		if (!groupsValid(x, disp, 4, w))
+		{
+			pDSI[0] = pDSI[1] = pDSI[2] = pDSI[3] = 255;
+			return;
+		}
+
+		int sumL = in.leftStats->sumRow(y)[x];
+		int devL = in.leftStats->devRow(y)[x];
+		const int* sumR = in.rightStats->sumRow(y) + x + disp;
+		const int* devR = in.rightStats->devRow(y) + x + disp;
+		for (int j = 0; j < 4; j++)
+		{
+			const unsigned char* r0 = in.right + (y - 1) * w + x + disp + j;
+			const unsigned char* r1 = r0 + w;
+			const unsigned char* r2 = r1 + w;
+			int sumLR = l[0] * r0[-1] + l[1] * r0[0] + l[2] * r0[1]
+				+ l[3] * r1[-1] + l[4] * r1[0] + l[5] * r1[1]
+				+ l[6] * r2[-1] + l[7] * r2[0] + l[8] * r2[1];
+			pDSI[j] = (T)nccCost(sumLR, sumL, devL, sumR[j], devR[j]);
+		}
+	}
+
+	// pRow points at the costs of pixel 0 of row y
+	template <typename T>
+	void costRowScalar(const CostVolumeInput& in, int y, T* pRow)
+	{
+		int l[9];
+		int planes = in.maxDisparity - in.minDisparity;
+		for (int x = 1; x < in.w - 1; x++)
+		{
+			loadWindow(in.left, in.w, x, y, l);
+			T* pDSI = pRow + (size_t)x * planes;
+			for (int disp = in.minDisparity; disp < in.maxDisparity; disp += 4)
+			{
+				costGroupScalar(in, l, x, y, disp, pDSI + disp - in.minDisparity);
+			}
+		}
+	}
+
+	// costs for 4 disparities from their cross terms
+	SGM_TARGET_SSE41 inline __m128i nccCost4(__m128i sumLR, __m128i sumL, __m128 devL, const int* sumR, const int* devR)
+	{
+		__m128i sr = _mm_loadu_si128((const __m128i*)sumR);
+		__m128 dr = _mm_cvtepi32_ps(_mm_loadu_si128((const __m128i*)devR));
+		__m128i num = _mm_sub_epi32(_mm_add_epi32(_mm_slli_epi32(sumLR, 3), sumLR), _mm_mullo_epi32(sumL, sr));
+		__m128 den = _mm_max_ps(_mm_mul_ps(devL, dr), _mm_set1_ps(0.81f));
+		__m128 ncc = _mm_div_ps(_mm_cvtepi32_ps(num), _mm_sqrt_ps(den));
+		__m128 score = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(_mm_set1_ps(1.0f), ncc), _mm_set1_ps(255.0f)), _mm_set1_ps(255.0f));
+		return _mm_cvttps_epi32(score);
+	}
+
+	SGM_TARGET_SSE41 inline void storeCosts8(short* p, __m128i c0, __m128i c1)
+	{
+		_mm_storeu_si128((__m128i*)p, _mm_packs_epi32(c0, c1));
+	}
+
+	SGM_TARGET_SSE41 inline void storeCosts8(unsigned char* p, __m128i c0, __m128i c1)
+	{
+		__m128i c = _mm_packs_epi32(c0, c1);
+		_mm_storel_epi64((__m128i*)p, _mm_packus_epi16(c, c));
+	}
+
+	// 8 disparities starting at disp.  The 9 right pixels of each disparity are widened to 16 bits and paired up so
+	// that one multiply-add gives two products of the cross term per disparity, weights holds the matching left pixel
+	// pairs.
+	template <typename T>
+	SGM_TARGET_SSE41 inline void costBlock8(const CostVolumeInput& in, const __m128i* weights, __m128i sumL, __m128 devL, int x, int y, int disp, T* pDSI)
+	{
+		const int w = in.w;
+		const unsigned char* r0 = in.right + (y - 1) * w + x + disp - 1;
+		const unsigned char* r1 = r0 + w;
+		const unsigned char* r2 = r1 + w;
+
+		__m128i v[9];
+		for (int k = 0; k < 3; k++)
+		{
+			v[k] = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*)(r0 + k)));
+			v[3 + k] = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*)(r1 + k)));
+			v[6 + k] = _mm_cvtepu8_epi16(_mm_loadl_epi64((const __m128i*)(r2 + k)));
+		}
+
+		__m128i zero = _mm_setzero_si128();
+		__m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(v[8], zero), weights[4]);
+		__m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(v[8], zero), weights[4]);
+		for (int k = 0; k < 4; k++)
+		{
+			lo = _mm_add_epi32(lo, _mm_madd_epi16(_mm_unpacklo_epi16(v[2 * k], v[2 * k + 1]), weights[k]));
+			hi = _mm_add_epi32(hi, _mm_madd_epi16(_mm_unpackhi_epi16(v[2 * k], v[2 * k + 1]), weights[k]));
+		}
+
+		const int* sumR = in.rightStats->sumRow(y) + x + disp;
+		const int* devR = in.rightStats->devRow(y) + x + disp;
+		__m128i c0 = nccCost4(lo, sumL, devL, sumR, devR);
+		__m128i c1 = nccCost4(hi, sumL, devL, sumR + 4, devR + 4);
+		storeCosts8(pDSI, c0, c1);
+	}
+
+	template <typename T>
+	SGM_TARGET_SSE41 void costRowSSE41(const CostVolumeInput& in, int y, T* pRow)
+	{
+		int l[9];
+		__m128i weights[5];
+		int planes = in.maxDisparity - in.minDisparity;
+		for (int x = 1; x < in.w - 1; x++)
+		{
+			loadWindow(in.left, in.w, x, y, l);
+			for (int k = 0; k < 4; k++)
+			{
+				weights[k] = _mm_set1_epi32(l[2 * k] | (l[2 * k + 1] << 16));
+			}
+			weights[4] = _mm_set1_epi32(l[8]);
+			__m128i sumL = _mm_set1_epi32(in.leftStats->sumRow(y)[x]);
+			__m128 devL = _mm_set1_ps((float)in.leftStats->devRow(y)[x]);
+
+			T* pDSI = pRow + (size_t)x * planes - in.minDisparity;
+			int disp = in.minDisparity;
+			while (disp < in.maxDisparity)
+			{
+				if (disp + 8 <= in.maxDisparity && groupsValid(x, disp, 8, in.w))
+				{
+					costBlock8(in, weights, sumL, devL, x, y, disp, pDSI + disp);
+					disp += 8;
+				}
+				else
+				{
+					costGroupScalar(in, l, x, y, disp, pDSI + disp);
+					disp += 4;
+				}
+			}
+		}
+	}
+
+	SGM_TARGET_AVX2 inline __m256i nccCost8(__m256i sumLR, __m256i sumL, __m256 devL, const int* sumR, const int* devR)
+	{
+		__m256i sr = _mm256_loadu_si256((const __m256i*)sumR);
+		__m256 dr = _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*)devR));
+		__m256i num = _mm256_sub_epi32(_mm256_add_epi32(_mm256_slli_epi32(sumLR, 3), sumLR), _mm256_mullo_epi32(sumL, sr));
+		__m256 den = _mm256_max_ps(_mm256_mul_ps(devL, dr), _mm256_set1_ps(0.81f));
+		__m256 ncc = _mm256_div_ps(_mm256_cvtepi32_ps(num), _mm256_sqrt_ps(den));
+		__m256 score = _mm256_min_ps(_mm256_mul_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), ncc), _mm256_set1_ps(255.0f)), _mm256_set1_ps(255.0f));
+		return _mm256_cvttps_epi32(score);
+	}
+
+	// c holds 16 costs in order
+	SGM_TARGET_AVX2 inline void storeCosts16(short* p, __m256i c)
+	{
+		_mm256_storeu_si256((__m256i*)p, c);
+	}
+
+	SGM_TARGET_AVX2 inline void storeCosts16(unsigned char* p, __m256i c)
+	{
+		_mm_storeu_si128((__m128i*)p, _mm_packus_epi16(_mm256_castsi256_si128(c), _mm256_extracti128_si256(c, 1)));
+	}
+
+	// same as costBlock8 for 16 disparities.  The unpacks work inside each 128 bit half, so lo holds disparities
+	// 0-3 and 8-11 and hi holds 4-7 and 12-15 until they are put back in order.
+	template <typename T>
+	SGM_TARGET_AVX2 inline void costBlock16(const CostVolumeInput& in, const __m256i* weights, __m256i sumL, __m256 devL, int x, int y, int disp, T* pDSI)
+	{
+		const int w = in.w;
+		const unsigned char* r0 = in.right + (y - 1) * w + x + disp - 1;
+		const unsigned char* r1 = r0 + w;
+		const unsigned char* r2 = r1 + w;
+
+		__m256i v[9];
+		for (int k = 0; k < 3; k++)
+		{
+			v[k] = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(r0 + k)));
+			v[3 + k] = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(r1 + k)));
+			v[6 + k] = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(r2 + k)));
+		}
+
+		__m256i zero = _mm256_setzero_si256();
+		__m256i lo = _mm256_madd_epi16(_mm256_unpacklo_epi16(v[8], zero), weights[4]);
+		__m256i hi = _mm256_madd_epi16(_mm256_unpackhi_epi16(v[8], zero), weights[4]);
+		for (int k = 0; k < 4; k++)
+		{
+			lo = _mm256_add_epi32(lo, _mm256_madd_epi16(_mm256_unpacklo_epi16(v[2 * k], v[2 * k + 1]), weights[k]));
+			hi = _mm256_add_epi32(hi, _mm256_madd_epi16(_mm256_unpackhi_epi16(v[2 * k], v[2 * k + 1]), weights[k]));
+		}
+		__m256i s0 = _mm256_permute2x128_si256(lo, hi, 0x20);
+		__m256i s1 = _mm256_permute2x128_si256(lo, hi, 0x31);
+
+		const int* sumR = in.rightStats->sumRow(y) + x + disp;
+		const int* devR = in.rightStats->devRow(y) + x + disp;
+		__m256i c0 = nccCost8(s0, sumL, devL, sumR, devR);
+		__m256i c1 = nccCost8(s1, sumL, devL, sumR + 8, devR + 8);
+		storeCosts16(pDSI, _mm256_permute4x64_epi64(_mm256_packs_epi32(c0, c1), _MM_SHUFFLE(3, 1, 2, 0)));
+	}
+
+	template <typename T>
+	SGM_TARGET_AVX2 void costRowAVX2(const CostVolumeInput& in, int y, T* pRow)
+	{
+		int l[9];
+		__m128i weights8[5];
+		__m256i weights16[5];
+		int planes = in.maxDisparity - in.minDisparity;
+		for (int x = 1; x < in.w - 1; x++)
+		{
+			loadWindow(in.left, in.w, x, y, l);
+			for (int k = 0; k < 5; k++)
+			{
+				int pair = k < 4 ? l[2 * k] | (l[2 * k + 1] << 16) : l[8];
+				weights8[k] = _mm_set1_epi32(pair);
+				weights16[k] = _mm256_set1_epi32(pair);
+			}
+			int sum = in.leftStats->sumRow(y)[x];
+			float dev = (float)in.leftStats->devRow(y)[x];
+
+			T* pDSI = pRow + (size_t)x * planes - in.minDisparity;
+			int disp = in.minDisparity;
+			while (disp < in.maxDisparity)
+			{
+				if (disp + 16 <= in.maxDisparity && groupsValid(x, disp, 16, in.w))
+				{
+					costBlock16(in, weights16, _mm256_set1_epi32(sum), _mm256_set1_ps(dev), x, y, disp, pDSI + disp);
+					disp += 16;
+				}
+				else if (disp + 8 <= in.maxDisparity && groupsValid(x, disp, 8, in.w))
+				{
+					costBlock8(in, weights8, _mm_set1_epi32(sum), _mm_set1_ps(dev), x, y, disp, pDSI + disp);
+					disp += 8;
+				}
+				else
+				{
+					costGroupScalar(in, l, x, y, disp, pDSI + disp);
+					disp += 4;
+				}
+			}
+		}
+	}
+
+	template <typename T>
+	void costRows(CostKernel kernel, const CostVolumeInput& in, int rowBegin, int rowEnd, T* costs, int firstRow)
+	{
+		size_t rowSize = (size_t)in.w * (in.maxDisparity - in.minDisparity);
+		if (rowBegin < 1)
+			rowBegin = 1;
+		if (rowEnd > in.h - 1)
+			rowEnd = in.h - 1;
+
+#pragma omp parallel for schedule(dynamic,1)
+		for (int y = rowBegin; y < rowEnd; y++)
+		{
+			T* pRow = costs + (y - firstRow) * rowSize;
+			if (kernel == COST_KERNEL_AVX2)
+				costRowAVX2(in, y, pRow);
+			else if (kernel == COST_KERNEL_SSE41)
+				costRowSSE41(in, y, pRow);
+			else
+				costRowScalar(in, y, pRow);
+		}
+	}
+}
+
+const char* costKernelName(CostKernel kernel)
+{
+	switch (kernel)
+	{
+	case COST_KERNEL_AUTO: return "auto";
+	case COST_KERNEL_REFERENCE: return "reference";
+	case COST_KERNEL_SCALAR: return "scalar";
+	case COST_KERNEL_SSE41: return "sse4.1";
+	case COST_KERNEL_AVX2: return "avx2";
+	default: return "unknown";
+	}
+}
+
+bool costKernelSupported(CostKernel kernel)
+{
+	switch (kernel)
+	{
+	case COST_KERNEL_SSE41: return cpuHasSSE41();
+	case COST_KERNEL_AVX2: return cpuHasAVX2();
+	default: return true;
+	}
+}
+
+void WindowStats::compute(const unsigned char* img, int width, int h, int rowBegin, int rowEnd)
+{
+	w = width;
+	firstRow = rowBegin;
+	rows = rowEnd - rowBegin;
+	size_t size = (size_t)w * rows;
+	if (sum.size() < size)
+	{
+		sum.resize(size);
+		dev.resize(size);
+		colSum.resize(w);
+		colSq.resize(w);
+	}
+
+	// vertical sums of 3 rows, then a running sum of 3 of those along the row
+	for (int y = rowBegin; y < rowEnd; y++)
+	{
+		int* pSum = &sum[(size_t)(y - firstRow) * w];
+		int* pDev = &dev[(size_t)(y - firstRow) * w];
+		if (y < 1 || y >= h - 1)
+		{
+			memset(pSum, 0, w * sizeof(int));
+			memset(pDev, 0, w * sizeof(int));
+			continue;
+		}
+
+		const unsigned char* p0 = img + (y - 1) * w;
+		const unsigned char* p1 = p0 + w;
+		const unsigned char* p2 = p1 + w;
+		for (int x = 0; x < w; x++)
+		{
+			int a = p0[x], b = p1[x], c = p2[x];
+			colSum[x] = a + b + c;
+			colSq[x] = a * a + b * b + c * c;
+		}
+
+		int s = colSum[0] + colSum[1];
+		int q = colSq[0] + colSq[1];
+		pSum[0] = pDev[0] = pSum[w - 1] = pDev[w - 1] = 0;
+		for (int x = 1; x < w - 1; x++)
+		{
+			s += colSum[x + 1];
+			q += colSq[x + 1];
+			pSum[x] = s;
+			pDev[x] = 9 * q - s * s;
+			s -= colSum[x - 1];
+			q -= colSq[x - 1];
+		}
+	}
+}
+
+void computeCostVolume(CostKernel kernel, const CostVolumeInput& in, int rowBegin, int rowEnd, short* costs, int firstRow)
+{
+	costRows(kernel, in, rowBegin, rowEnd, costs, firstRow);
+}
+
+void computeCostVolume(CostKernel kernel, const CostVolumeInput& in, int rowBegin, int rowEnd, unsigned char* costs, int firstRow)
+{
+	costRows(kernel, in, rowBegin, rowEnd, costs, firstRow);
+}
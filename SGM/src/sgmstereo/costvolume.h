@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#ifndef sgm_costvolume_h
+#define sgm_costvolume_h
+
+#include <vector>
+#include "dsimage.h"
+
+// Matching cost volume for SGMStereo: 3x3 zero mean normalized cross correlation, cost = min((1 - ncc) * 255, 255).
+//
+// The window sums that only depend on one image (sum and sum of squares) are computed once per frame with box filters
+// and shared by every disparity, which leaves the 9 products of the cross term per pixel and disparity.  Those are
+// done on 16 bit pixel lanes with 32 bit multiply-add, so everything up to the final division is exact integer math
+// and the scalar, SSE4.1 and AVX2 kernels produce bit identical volumes.
+enum CostKernel
+{
+	COST_KERNEL_AUTO,		// fastest kernel the cpu supports
+	COST_KERNEL_REFERENCE,	// original float kernel, SGMStereo::calculateDSI_sse
+	COST_KERNEL_SCALAR,
+	COST_KERNEL_SSE41,
+	COST_KERNEL_AVX2
+};
+
+const char* costKernelName(CostKernel kernel);
+bool costKernelSupported(CostKernel kernel);
+
+// 3x3 window sums of rows [firstRow, firstRow + rows) of an 8 bit image, zero on the image border.  Storage is
+// kept from one frame to the next.
+struct WindowStats
+{
+	int w, firstRow, rows;
+	std::vector<int> sum;	// sum of the 9 pixels
+	std::vector<int> dev;	// 9 * sum of squares - sum^2, which is 81 times the window variance
+	std::vector<int> colSum, colSq;
+
+	WindowStats() : w(0), firstRow(0), rows(0) {}
+
+	void compute(const unsigned char* img, int width, int h, int rowBegin, int rowEnd);
+	void compute(const unsigned char* img, int width, int h) { compute(img, width, h, 0, h); }
+
+	const int* sumRow(int y) const { return &sum[(size_t)(y - firstRow) * w]; }
+	const int* devRow(int y) const { return &dev[(size_t)(y - firstRow) * w]; }
+};
+
+struct CostVolumeInput
+{
+	const unsigned char* left;
+	const unsigned char* right;
+	const WindowStats* leftStats;
+	const WindowStats* rightStats;
+	int w, h;
+	int minDisparity, maxDisparity;
+};
+
+// Costs of rows [rowBegin, rowEnd) of the image, skipping the border pixels, which are never written.  The costs of
+// pixel (x, y) go to costs + ((y - firstRow) * w + x) * planes, and the window stats have to cover the rows.
+// Disparities are handled in groups of 4 like calculateDSI_sse, a group gets 255 unless its whole right window range
+// is inside the image.  Costs never go over 255, so they fit in 8 bits without loss.
+void computeCostVolume(CostKernel kernel, const CostVolumeInput& in, int rowBegin, int rowEnd, short* costs, int firstRow);
+void computeCostVolume(CostKernel kernel, const CostVolumeInput& in, int rowBegin, int rowEnd, unsigned char* costs, int firstRow);
+
+#endif
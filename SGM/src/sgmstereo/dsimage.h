@@ -14,6 +14,123 @@
 #include <string.h>
 #include <math.h>
 
+#ifndef _MSC_VER
+// MSVC runtime functions used throughout the SGM code
+#ifndef __min
+#define __min(a, b) (((a) < (b)) ? (a) : (b))
+#endif
+#ifndef __max
+#define __max(a, b) (((a) > (b)) ? (a) : (b))
+#endif
+
+inline void* _aligned_malloc(size_t size, size_t alignment)
+{
+	void* p = NULL;
+	if (posix_memalign(&p, alignment, size) != 0)
+		return NULL;
+	return p;
+}
+
+inline void _aligned_free(void* p)
+{
+	free(p);
+}
+#endif
+
+
+// Rows [firstRow, ...) of a cost volume laid out like DSI, which does not own the data.  Lets the aggregation
+// run on a band of rows and on 8 bit costs as well as on a whole DSI.
+template <typename T>
+struct VolumeRows
+{
+	T* data;
+	int firstRow;
+	int cols;
+	int planes;
+
+	T* operator()(int x, int y) const
+	{
+		return data + ((size_t)(y - firstRow) * cols + x) * planes;
+	}
+};
+
+// One aligned allocation handed out in pieces, so the scratch buffers of a frame are allocated once and reused by
+// every frame after it.
+class BufferArena
+{
+public:
+	BufferArena()
+	{
+		m_data = NULL;
+		m_size = 0;
+		m_used = 0;
+	}
+
+	~BufferArena()
+	{
+		free();
+	}
+
+	// forget everything handed out so far and make sure there is room for size bytes
+	void reset(size_t size)
+	{
+		if (size > m_size)
+		{
+			free();
+			m_data = (char*)_aligned_malloc(size, 64);
+			if (!m_data)
+			{
+				printf("[ERROR] not enough memory!\n");
+				exit(1);
+			}
+			m_size = size;
+		}
+		m_used = 0;
+	}
+
+	template <typename T>
+	T* take(size_t count)
+	{
+		size_t bytes = alignedSize(count * sizeof(T));
+		if (m_used + bytes > m_size)
+		{
+			printf("[ERROR] buffer arena is too small!\n");
+			exit(1);
+		}
+		T* p = (T*)(m_data + m_used);
+		m_used += bytes;
+		return p;
+	}
+
+	// what take uses up for a piece of the given size, each piece starts on a cache line
+	static size_t alignedSize(size_t bytes)
+	{
+		return (bytes + 63) & ~(size_t)63;
+	}
+
+	size_t size() const
+	{
+		return m_size;
+	}
+
+	void free()
+	{
+		if (m_data != NULL)
+			_aligned_free(m_data);
+		m_data = NULL;
+		m_size = 0;
+		m_used = 0;
+	}
+
+private:
+	char *m_data;
+	size_t m_size;
+	size_t m_used;
+};
+
+// disparity and confidence of one row of aggregated costs, pRow points at the costs of the first pixel.  The
+// first and last pixel of the row get no disparity.
+void getDispMapRow(const short * pRow, int cols, int planes, int confThreshold, int doSubPixRefinement, float * pDisp, unsigned char * pConf);
 
 class DSI
 {
@@ -47,6 +164,13 @@ public:
 		memset(m_data, 0, pixelCount*sizeof(short));
 	}
 
+	void fill(short value)
+	{
+		uint64_t pixelCount = m_cols * m_rows * m_planes;
+		for (uint64_t i = 0; i < pixelCount; i++)
+			m_data[i] = value;
+	}
+
 	short operator()(uint64_t x, uint64_t y, uint64_t z) const
 	{
 		return m_data[(x + y * m_cols)*m_planes + z];
@@ -101,76 +225,11 @@ public:
 			}
 		}
 		
+#pragma omp parallel for schedule(dynamic,1)
 		for (int y = 1; y < m_rows-1; y++)
 		{
 			uint64_t offset = y * m_cols;
-			float *pDisp = &(dispMap[offset]);
-			unsigned char *pConf = &(confMap[offset]);
-
-#pragma omp parallel for schedule(dynamic,1)
-
-			for (int x = 1; x < m_cols-1; x++)
-			{
-				int bestplane = (int)m_planes - 1;
-				short minval = SHRT_MAX;
-				short secondminval = SHRT_MAX;
-				short * pV = (*this)(x, y);
-				for (int d = 0; d < m_planes; d++)
-				{
-					short val = pV[d];
-					if (val < minval)
-					{
-						minval = val;
-						bestplane = d;
-					}
-				}
-
-				for (int d = 0; d < m_planes; d++)
-				{
-					if (abs(d - bestplane) > 2)
-					{
-						short val = pV[d];
-						if (val < secondminval)
-						{
-							secondminval = val;
-						}
-					}
-				}
-
-				float distinctiveness1 = float(minval) / float(secondminval + 1e-9f);
-				float conf = (float) __min(__max(20.0f * log(1.0f / (distinctiveness1*distinctiveness1)), 0.0f), 255.0f);
-				int Dim = (int)m_planes;
-				if (conf >= confThreshold)
-				{
-					// Local quadratic fit of cost and subpixel refinement.
-					double rDisp = bestplane;
-					double rCost = minval;
-					if (doSubPixRefinement)
-					{
-						if (bestplane >= 1 && bestplane < m_planes - 1)
-						{
-							double yl = pV[bestplane - 1];
-							double xc = bestplane;
-							double yc = minval;
-							double yu = pV[bestplane + 1];
-							double d2 = yu - yc + yl - yc;
-							double d1 = 0.5 * (yu - yl);
-							if (fabs(d2) > fabs(d1))
-							{
-								rDisp = xc - d1 / d2;
-								rCost = yc + 0.5 * d1 * (rDisp - xc);
-							}
-						}
-					}
-					pDisp[x] = (float)(rDisp - Dim);
-					pConf[x] = (unsigned char)conf;
-				}
-				else
-				{
-					pDisp[x] = FLT_MAX;
-					pConf[x] = 0;
-				}
-			}
+			getDispMapRow((*this)(0, y), (int)m_cols, (int)m_planes, confThreshold, doSubPixRefinement, &(dispMap[offset]), &(confMap[offset]));
 		}
 	}
 
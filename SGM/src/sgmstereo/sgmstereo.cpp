@@ -5,6 +5,7 @@
 
 #include <stdint.h>
 #include <vector>
+#include <algorithm>
 
 #include "sgmstereo.h"
 #include "dsimage.h"
@@ -37,26 +38,159 @@ SGMStereo::SGMStereo(int _w, int _h, int minDisparity, int maxDisparity, int num
 	}
 
 
-	int dispRange = maxDisparity - minDisparity;
-	
-	m_dsi.create(_w, _h, dispRange);
+	setCostKernel(COST_KERNEL_AUTO);
+
+	// the volumes and buffers are allocated by the first Run, once the mode is known
+	m_tileRows = 0;
+	m_tileHalo = 0;
+	m_buffersReady = false;
+	m_tileCosts = NULL;
+	m_tileMessages = NULL;
+	m_rowBuffers = m_sweepBuffers = m_zeroBuffer = m_sweepMins = NULL;
+	setAggregation(m_doSequential ? AGGREGATION_SEQUENTIAL : AGGREGATION_PATHS);
+
+	float rec_penalty2 = 1.0f / m_penalty2;
+	wLUT = new float[256];
+	for (int i = 0; i < 256; i++)
+	{
+		wLUT[i] = m_penalty1 + m_alpha * exp(-i * rec_penalty2);
+	}
+}
 
-	if (m_doSequential)
+void SGMStereo::setAggregation(AggregationMode mode)
+{
+	m_aggregation = mode;
+	m_buffersReady = false;
+}
+
+void SGMStereo::setTiling(int tileRows, int haloRows)
+{
+	m_tileRows = __max(tileRows, 0);
+	m_tileHalo = __max(haloRows, 0);
+	m_buffersReady = false;
+}
+
+// The volumes and scratch buffers the aggregation mode and tiling need, allocated on the first Run after either of
+// them changes and reused by every frame after that.
+void SGMStereo::allocateBuffers()
+{
+	int planes = m_maxDisparity - m_minDisparity;
+	int bufferRows = m_h;
+	int costRows = 0;
+	if (m_tileRows > 0)
 	{
-		messages.create(_w, _h, dispRange);
+		m_dsi.free();
+		messages.free();
+		messages_hor.free();
+		messages_ver.free();
+		bufferRows = __min(m_tileRows, m_h);
+		costRows = __min(bufferRows + 2 * m_tileHalo, m_h);
 	}
 	else
 	{
-		messages_hor.create(_w, _h, dispRange);
-		messages_ver.create(_w, _h, dispRange);
+		if (m_dsi.m_data == NULL)
+		{
+			m_dsi.create(m_w, m_h, planes);
+			// the cost kernels never write the image border
+			m_dsi.fill(255);
+		}
+		if (m_aggregation == AGGREGATION_HOR_VERT)
+		{
+			if (messages_hor.m_data == NULL)
+			{
+				messages_hor.create(m_w, m_h, planes);
+				messages_ver.create(m_w, m_h, planes);
+			}
+		}
+		else if (messages.m_data == NULL)
+			messages.create(m_w, m_h, planes);
 	}
 
-	float rec_penalty2 = 1.0f / m_penalty2;
-	wLUT = new float[256];
-	for (int i = 0; i < 256; i++)
+	// the tile's costs and aggregated costs, then the scanline buffers for AGGREGATION_PATHS: one per row for the
+	// horizontal paths, and the previous and current row of each path in a vertical sweep.  The other modes use the
+	// first two row buffers, and the diagonal paths the start points list, so no frame allocates.
+	int rowBufferRows = __max(bufferRows, 2);
+	size_t bytes = BufferArena::alignedSize((size_t)costRows * m_w * planes) +
+		BufferArena::alignedSize((size_t)(costRows > 0 ? bufferRows : 0) * m_w * planes * sizeof(short)) +
+		BufferArena::alignedSize((size_t)rowBufferRows * planes * sizeof(short)) +
+		BufferArena::alignedSize((size_t)6 * m_w * planes * sizeof(short)) +
+		BufferArena::alignedSize((size_t)planes * sizeof(short)) +
+		BufferArena::alignedSize((size_t)6 * m_w * sizeof(short));
+	m_arena.reset(bytes);
+	m_tileCosts = NULL;
+	m_tileMessages = NULL;
+	if (m_tileRows > 0)
 	{
-		wLUT[i] = m_penalty1 + m_alpha * exp(-i * rec_penalty2);
+		m_tileCosts = m_arena.take<unsigned char>((size_t)costRows * m_w * planes);
+		m_tileMessages = m_arena.take<short>((size_t)bufferRows * m_w * planes);
 	}
+	m_rowBuffers = m_arena.take<short>((size_t)rowBufferRows * planes);
+	m_sweepBuffers = m_arena.take<short>((size_t)6 * m_w * planes);
+	m_zeroBuffer = m_arena.take<short>(planes);
+	memset(m_zeroBuffer, 0, planes * sizeof(short));
+	m_sweepMins = m_arena.take<short>((size_t)6 * m_w);
+	m_pathStartX.reserve(2 * m_w + 2 * m_h);
+	m_pathStartY.reserve(2 * m_w + 2 * m_h);
+
+	m_buffersReady = true;
+}
+
+size_t SGMStereo::getBufferBytes() const
+{
+	size_t bytes = m_arena.size();
+	const DSI* volumes[] = { &m_dsi, &messages, &messages_hor, &messages_ver };
+	for (const DSI* v : volumes)
+	{
+		if (v->m_data != NULL)
+			bytes += (size_t)(v->m_cols * v->m_rows * v->m_planes * sizeof(short));
+	}
+	const WindowStats* stats[] = { &m_leftStats, &m_rightStats };
+	for (const WindowStats* st : stats)
+		bytes += (st->sum.capacity() + st->dev.capacity() + st->colSum.capacity() + st->colSq.capacity()) * sizeof(int);
+	return bytes;
+}
+
+CostKernel SGMStereo::setCostKernel(CostKernel kernel)
+{
+	if (kernel == COST_KERNEL_AUTO || !costKernelSupported(kernel))
+	{
+		if (costKernelSupported(COST_KERNEL_AVX2))
+			kernel = COST_KERNEL_AVX2;
+		else if (costKernelSupported(COST_KERNEL_SSE41))
+			kernel = COST_KERNEL_SSE41;
+		else
+			kernel = COST_KERNEL_SCALAR;
+	}
+	m_costKernel = kernel;
+	return m_costKernel;
+}
+
+
+void SGMStereo::calculateDSI(unsigned char *L, unsigned char * R)
+{
+	if (m_costKernel == COST_KERNEL_REFERENCE)
+	{
+		calculateDSI_sse(L, R);
+		return;
+	}
+
+	m_leftStats.compute(L, m_w, m_h);
+	m_rightStats.compute(R, m_w, m_h);
+	computeCostVolume(m_costKernel, costVolumeInput(L, R), 1, m_h - 1, m_dsi.m_data, 0);
+}
+
+CostVolumeInput SGMStereo::costVolumeInput(unsigned char *L, unsigned char * R)
+{
+	CostVolumeInput in;
+	in.left = L;
+	in.right = R;
+	in.leftStats = &m_leftStats;
+	in.rightStats = &m_rightStats;
+	in.w = m_w;
+	in.h = m_h;
+	in.minDisparity = m_minDisparity;
+	in.maxDisparity = m_maxDisparity;
+	return in;
 }
 
 
@@ -191,114 +325,80 @@ void SGMStereo::calculateDSI_sse(unsigned char *L, unsigned char * R)
 
 
 
-void subtractMinVal(short *pMessage, int size)
+// minimum of the 8 lanes
+static inline short horizontalMin(__m128i v)
 {
-	__m128i* pM = (__m128i*)pMessage;
-	__m128i  minval = *pM;
-	for (int i = 1; i < size / 8; i++)
-	{
-		pM++;
-		minval = _mm_min_epi16(*pM, minval);
-	}
-
-	union u
-	{
-		__m128i m;
-		short s[8];
-	} x;
-
-	x.m = minval;
-	short val = __min(__min(__min(x.s[0], x.s[1]), __min(x.s[2], x.s[3])), __min(__min(x.s[4], x.s[5]), __min(x.s[6], x.s[7])));
+	v = _mm_min_epi16(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+	v = _mm_min_epi16(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+	v = _mm_min_epi16(v, _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1)));
+	return (short)_mm_extract_epi16(v, 0);
+}
 
-	minval = _mm_set1_epi16(val);
 
-	for (int i = 0; i < size / 8; i++)
-	{
-		*pM = _mm_sub_epi16(*pM, minval);
-		pM--;
-	}
+static inline __m128i loadCosts(const short* p)
+{
+	return _mm_load_si128((const __m128i*)p);
 }
 
+// 8 bit costs are widened to 16 bits as they are read
+static inline __m128i loadCosts(const unsigned char* p)
+{
+	return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)p), _mm_setzero_si128());
+}
 
-void SGMStereo::messagePassing(short *pData, short *pBuffer1, short *pDMessage, int size, float weight, short smoothness)
+// One step along a path.  pPrev holds the previous step's costs and minPrev their minimum, which is subtracted
+// here instead of in a separate pass over pPrev.  The new costs go to pCur (which may be pPrev) and are added to
+// pDMessage unless it is NULL, their minimum is returned for the next step.
+template <typename TCost>
+short SGMStereo::messagePassing(const TCost *pData, const short *pPrev, short minPrev, short *pCur, short *pDMessage, int size, float weight, short smoothness)
 {
 	short pen1 = smoothness;
 	short pen2 = (short)(smoothness*weight);
 
-#if 1
-	__m128i* pB1 = (__m128i*)pBuffer1;
+	const __m128i* pB1 = (const __m128i*)pPrev;
+	__m128i* pOut = (__m128i*)pCur;
 	__m128i* pDM = (__m128i*)pDMessage;
-	__m128i* pD = (__m128i*)pData;
 	__m128i penalty1 = _mm_set1_epi16(pen1);
-	__m128i penalty2 = _mm_set1_epi16(pen2);
+	__m128i penalty2 = _mm_set1_epi16(minPrev + pen2);
+	__m128i prevMin = _mm_set1_epi16(minPrev);
+	__m128i newMin = _mm_set1_epi16(SHRT_MAX);
 	__m128i buffer1, buffer2, buffer3;
 
-	subtractMinVal(pBuffer1, size);
-
 	short newval(255*64), newval2(255*64);
 	for (int i = 0; i < size/8; i++)
 	{
-		buffer1 = _mm_slli_si128(*pB1, 2);
+		__m128i prev = *pB1;
+		buffer1 = _mm_slli_si128(prev, 2);
 		buffer3 = _mm_insert_epi16(buffer1, newval, 0);
 		buffer1 = _mm_add_epi16(buffer3,penalty1);
 
-		buffer2 = _mm_srli_si128(*pB1, 2);
+		buffer2 = _mm_srli_si128(prev, 2);
 		if (i*8+8 < size)
 		{
-			newval  = pBuffer1[i*8+7];
-			newval2 = pBuffer1[i*8+8];
+			newval  = pPrev[i*8+7];
+			newval2 = pPrev[i*8+8];
 		}
 		else
 			newval2 = 255*64;
 
 		buffer3 = _mm_insert_epi16(buffer2, newval2, 7);
 		buffer2 = _mm_add_epi16(buffer3,penalty1);
-		buffer3 = _mm_min_epi16(buffer1, _mm_min_epi16(buffer2, _mm_min_epi16(*pB1, penalty2)));
-
-		*pB1 = _mm_add_epi16(buffer3, *pD);
-		*pDM = _mm_add_epi16(*pDM, *pB1);
-
-		pB1++;
-		pDM++;
-		pD++;
-	}
-#else
-    int limit = 32768;
-	short mem[2048];
-	short minval = limit - 1;
-	
-	for (int i = 0; i < size; i++)
-	{
-		minval = __min(minval, pBuffer1[i]);
-	}
+		buffer3 = _mm_min_epi16(buffer1, _mm_min_epi16(buffer2, _mm_min_epi16(prev, penalty2)));
 
-	for (int i = 0; i < size; i++)
-	{
-		pBuffer1[i] -= minval;
-	}
-
-	for (int i = 0; i < size; i++)
-	{
-		short minval1 = __min(pBuffer1[__max(i - 1, 0)], pBuffer1[__min(i + 1, size - 1)]) + pen1;
-		short minval2 = __min(pBuffer1[i], pen2);
-		mem[i] = __min(minval1, minval2);
-	}
-
-	for (int i = 0; i < size; i++)
-	{
-		short val = mem[i] + pData[i];
-		if (val + pDMessage[i] >= limit)
-		{
-			pDMessage[i] = limit - 1;
-		}
-		else
+		__m128i out = _mm_add_epi16(_mm_sub_epi16(buffer3, prevMin), loadCosts(pData + i * 8));
+		newMin = _mm_min_epi16(newMin, out);
+		*pOut = out;
+		if (pDM != NULL)
 		{
-			pDMessage[i] += val;
+			*pDM = _mm_add_epi16(*pDM, out);
+			pDM++;
 		}
-		pBuffer1[i] = val;
+
+		pB1++;
+		pOut++;
 	}
-#endif
 
+	return horizontalMin(newMin);
 }
 
 
@@ -308,10 +408,10 @@ void SGMStereo::scanlineOptimization(DSI &dv, DSI &msgs, unsigned char* img, flo
 	int rows = (int)dv.m_rows;
 	int planes = (int)dv.m_planes;
 
-	std::vector<float> startx;
-	std::vector<float> starty;
-	startx.reserve(2 * rows + 2 * cols);
-	starty.reserve(2 * rows + 2 * cols);
+	std::vector<int>& startx = m_pathStartX;
+	std::vector<int>& starty = m_pathStartY;
+	startx.clear();
+	starty.clear();
 
 	for (int ys = 0; ys < rows; ys++)
 	{
@@ -319,20 +419,21 @@ void SGMStereo::scanlineOptimization(DSI &dv, DSI &msgs, unsigned char* img, flo
 		{
 			if ((xs == 0 && dx_ == 1) || (ys == 0 && dy_ == 1) || (ys == rows-1 && dy_ == -1) || (xs == cols-1 && dx_ == -1))
 			{
-				startx.push_back(float(xs));
-				starty.push_back(float(ys));
+				startx.push_back(xs);
+				starty.push_back(ys);
 			}
 		}
 	}
 
-	short * buffervec = (short*)_aligned_malloc(planes * sizeof(short), 16);
+	// only runs with AGGREGATION_SEQUENTIAL, so nothing else uses the row buffers
+	short * buffervec = m_rowBuffers;
 
 	float dist = sqrt((float)(dx_*dx_+dy_*dy_));
 
 	for (int j = 0; j < (int)startx.size(); j++)
 	{
-		int x = (int)startx[j];
-		int y = (int)starty[j];
+		int x = startx[j];
+		int y = starty[j];
 		//uint64_t x64 = (uint64_t)x;
 		//uint64_t y64 = (uint64_t)y;
 
@@ -343,6 +444,7 @@ void SGMStereo::scanlineOptimization(DSI &dv, DSI &msgs, unsigned char* img, flo
 		{
 			buffervec[i] = 0;
 		}
+		short minval = 0;
 
 		short smoothness = (short)(m_smoothness / dist); 
 		bool forward = true;
@@ -355,7 +457,7 @@ void SGMStereo::scanlineOptimization(DSI &dv, DSI &msgs, unsigned char* img, flo
 			oldColor = newIntensity;
 			float weight = lut[diff];
 				
-			messagePassing(dv(x,y), buffervec, msgs(x,y), planes, weight, smoothness);
+			minval = messagePassing(dv(x,y), buffervec, minval, buffervec, msgs(x,y), planes, weight, smoothness);
 
 			y+=dy;
 			x+=dx;
@@ -368,6 +470,7 @@ void SGMStereo::scanlineOptimization(DSI &dv, DSI &msgs, unsigned char* img, flo
 				x+=dx;
 				for (int i = 0; i < planes; i++) 
 					buffervec[i] = 0;
+				minval = 0;
 				forward = false;
 			}
 		} 
@@ -376,8 +479,6 @@ void SGMStereo::scanlineOptimization(DSI &dv, DSI &msgs, unsigned char* img, flo
 		dx*=-1;
 		dy*=-1;
 	}
-
-	_aligned_free(buffervec);
 }
 
 
@@ -388,34 +489,37 @@ void SGMStereo::scanlineOptimization_hor(DSI &dv, DSI &msgs, unsigned char *img,
 	int rows = (int)dv.m_rows;
 	int planes = (int)dv.m_planes;
 	int bufsize = planes * sizeof(short);
-	short * buf = (short*)_aligned_malloc(bufsize, 16);
+	// the vertical paths may be running at the same time on the second row buffer
+	short * buf = m_rowBuffers;
 	short smoothness = (short)(m_smoothness);
+	short minval = 0;
 	
 	for (int y = 0; y < rows; y++)
 	{
 		int offset = y * cols;
 		int oldIntensity = 0;
 		memset(buf, 0, bufsize);
+		minval = 0;
 		for (int x = 0; x < cols; x++)
 		{
 			int newIntensity = img[offset + x];
 			int diff = abs(newIntensity - oldIntensity);
 			oldIntensity = newIntensity;
 			float weight = lut[diff];
-			messagePassing(dv(x, y), buf, msgs(x, y), int(planes), weight, smoothness);
+			minval = messagePassing(dv(x, y), buf, minval, buf, msgs(x, y), int(planes), weight, smoothness);
 		}
 		oldIntensity = 0;
 		memset(buf, 0, bufsize);
+		minval = 0;
 		for (int x = cols-1; x >= 0; x--)
 		{
 			int newIntensity = img[offset + x];
 			int diff = abs(newIntensity - oldIntensity);
 			oldIntensity = newIntensity;
 			float weight = lut[diff];
-			messagePassing(dv(x, y), buf, msgs(x, y), planes, weight, smoothness);
+			minval = messagePassing(dv(x, y), buf, minval, buf, msgs(x, y), planes, weight, smoothness);
 		}
 	}
-	_aligned_free(buf);
 }
 
 void SGMStereo::scanlineOptimization_vert(DSI &dv, DSI &msgs, unsigned char *img, float *lut)
@@ -424,37 +528,135 @@ void SGMStereo::scanlineOptimization_vert(DSI &dv, DSI &msgs, unsigned char *img
 	int rows = (int)dv.m_rows;
 	int planes = (int)dv.m_planes;
 	int bufsize = planes * sizeof(short);
-	short * buf = (short*)_aligned_malloc(bufsize, 16);
+	short * buf = m_rowBuffers + planes;
 	short smoothness = (short)(m_smoothness);
+	short minval = 0;
 	for (int x = 0; x < cols; x++)
 	{
 		int offset = x;
 		int oldIntensity = 0;
 		memset(buf, 0, bufsize);
+		minval = 0;
 		for (int y = 0; y < rows; y++)
 		{
 			int newIntensity = img[offset];
 			int diff = abs(newIntensity - oldIntensity);
 			oldIntensity = newIntensity;
 			float weight = lut[diff];
-			messagePassing(dv(x, y), buf, msgs(x, y), planes, weight, smoothness);
+			minval = messagePassing(dv(x, y), buf, minval, buf, msgs(x, y), planes, weight, smoothness);
 			offset += cols;
 		}
 
 		offset = cols * (rows - 1) + x;
 		oldIntensity = 0;
 		memset(buf, 0, bufsize);
+		minval = 0;
 		for (int y = rows - 1; y > 0; y--)
 		{
 			int newIntensity = img[offset];
 			int diff = abs(newIntensity - oldIntensity);
 			oldIntensity = newIntensity;
 			float weight = lut[diff];
-			messagePassing(dv(x, y), buf, msgs(x, y), planes, weight, smoothness);
+			minval = messagePassing(dv(x, y), buf, minval, buf, msgs(x, y), planes, weight, smoothness);
 			offset -= cols;
 		}
 	}
-	_aligned_free(buf);
+}
+
+
+// both horizontal paths of rows [rowBegin, rowEnd), the rows are independent so they are done in parallel.
+template <typename TCost>
+void SGMStereo::scanlineOptimization_rows(const VolumeRows<TCost> &dv, const VolumeRows<short> &msgs, unsigned char *img, float *lut, int rowBegin, int rowEnd)
+{
+	int cols = dv.cols;
+	int planes = dv.planes;
+	short smoothness = (short)(m_smoothness);
+
+#pragma omp parallel for schedule(dynamic,1)
+	for (int y = rowBegin; y < rowEnd; y++)
+	{
+		short * buf = m_rowBuffers + (size_t)(y - rowBegin) * planes;
+		unsigned char * row = img + y * cols;
+
+		short minval = messagePassing(dv(0, y), m_zeroBuffer, 0, buf, msgs(0, y), planes, lut[row[0]], smoothness);
+		for (int x = 1; x < cols; x++)
+		{
+			float weight = lut[abs(row[x] - row[x - 1])];
+			minval = messagePassing(dv(x, y), buf, minval, buf, msgs(x, y), planes, weight, smoothness);
+		}
+
+		minval = messagePassing(dv(cols - 1, y), m_zeroBuffer, 0, buf, msgs(cols - 1, y), planes, lut[row[cols - 1]], smoothness);
+		for (int x = cols - 2; x >= 0; x--)
+		{
+			float weight = lut[abs(row[x] - row[x + 1])];
+			minval = messagePassing(dv(x, y), buf, minval, buf, msgs(x, y), planes, weight, smoothness);
+		}
+	}
+}
+
+// The vertical path going down (dy = 1) or up (dy = -1) and with 8 directions the two diagonal paths going the same
+// way, in one sweep over rows [rowBegin, rowEnd), where the paths start.  A row only depends on the one before it, so
+// the pixels of each row are done in parallel, each path keeping its previous and current row of costs.  Only rows
+// [messageBegin, messageEnd) add their costs to msgs.
+template <typename TCost>
+void SGMStereo::scanlineOptimization_sweep(const VolumeRows<TCost> &dv, const VolumeRows<short> &msgs, unsigned char *img, float *lut, int dy,
+	int rowBegin, int rowEnd, int messageBegin, int messageEnd)
+{
+	int cols = dv.cols;
+	int planes = dv.planes;
+	int numPaths = m_numDirections == 8 ? 3 : 1;
+
+	// horizontal step of each path, and its smoothness the same way scanlineOptimization scales it
+	const int stepX[3] = { 0, 1, -1 };
+	short smoothness[3];
+	smoothness[0] = (short)(m_smoothness);
+	smoothness[1] = smoothness[2] = (short)(m_smoothness / sqrt(2.0f));
+
+	short * prev[3];
+	short * cur[3];
+	short * prevMin[3];
+	short * curMin[3];
+	for (int p = 0; p < 3; p++)
+	{
+		prev[p] = m_sweepBuffers + (size_t)(2 * p) * cols * planes;
+		cur[p] = prev[p] + (size_t)cols * planes;
+		prevMin[p] = m_sweepMins + 2 * p * cols;
+		curMin[p] = prevMin[p] + cols;
+	}
+
+	int y0 = dy > 0 ? rowBegin : rowEnd - 1;
+	for (int y = y0; y >= rowBegin && y < rowEnd; y += dy)
+	{
+		unsigned char * row = img + y * cols;
+		bool addMessages = y >= messageBegin && y < messageEnd;
+
+#pragma omp parallel for schedule(static)
+		for (int x = 0; x < cols; x++)
+		{
+			for (int p = 0; p < numPaths; p++)
+			{
+				// where the path came from, paths start on the image border with no previous costs
+				int px = x - stepX[p];
+				short * pPrev = m_zeroBuffer;
+				short minval = 0;
+				int oldIntensity = 0;
+				if (y != y0 && px >= 0 && px < cols)
+				{
+					pPrev = prev[p] + (size_t)px * planes;
+					minval = prevMin[p][px];
+					oldIntensity = img[(y - dy) * cols + px];
+				}
+				float weight = lut[abs(row[x] - oldIntensity)];
+				curMin[p][x] = messagePassing(dv(x, y), pPrev, minval, cur[p] + (size_t)x * planes, addMessages ? msgs(x, y) : NULL, planes, weight, smoothness[p]);
+			}
+		}
+
+		for (int p = 0; p < numPaths; p++)
+		{
+			std::swap(prev[p], cur[p]);
+			std::swap(prevMin[p], curMin[p]);
+		}
+	}
 }
 
 
@@ -464,9 +666,29 @@ void SGMStereo::Run(
 	float* dispMap, 
 	unsigned char* confMap)
 {
-	calculateDSI_sse(iLeft, iRight);
+	if (!m_buffersReady)
+		allocateBuffers();
 
-	if (m_doSequential)
+	if (m_tileRows > 0)
+	{
+		runTiled(iLeft, iRight, dispMap, confMap);
+		return;
+	}
+
+	calculateDSI(iLeft, iRight);
+
+	if (m_aggregation == AGGREGATION_PATHS)
+	{
+		int planes = (int)m_dsi.m_planes;
+		VolumeRows<short> costs = { m_dsi.m_data, 0, m_w, planes };
+		VolumeRows<short> msgs = { messages.m_data, 0, m_w, planes };
+		messages.setzero();
+		scanlineOptimization_rows(costs, msgs, iLeft, wLUT, 0, m_h);
+		scanlineOptimization_sweep(costs, msgs, iLeft, wLUT, 1, 0, m_h, 0, m_h);
+		scanlineOptimization_sweep(costs, msgs, iLeft, wLUT, -1, 0, m_h, 0, m_h);
+		messages.getDispMap(m_sgmConfidenceThreshold, m_doSubPixRefinement, dispMap, confMap);
+	}
+	else if (m_aggregation == AGGREGATION_SEQUENTIAL)
 	{
 		messages.setzero();
 		scanlineOptimization_hor(m_dsi, messages, iLeft, wLUT);
@@ -496,21 +718,91 @@ void SGMStereo::Run(
 }
 
 
-void SGMStereo::free()
+// Tiling runs AGGREGATION_PATHS one band of rows at a time: the band and its halo get their costs, the band's rows
+// their horizontal paths, and the vertical sweeps start at the edges of the halo but only add up in the band.
+void SGMStereo::runTiled(unsigned char * iLeft, unsigned char * iRight, float* dispMap, unsigned char* confMap)
 {
-	m_dsi.free();
-	
-	if (m_doSequential)
+	int planes = m_maxDisparity - m_minDisparity;
+	// the reference kernel only writes m_dsi, the integer kernels give the same costs to within 1
+	CostKernel kernel = m_costKernel == COST_KERNEL_REFERENCE ? COST_KERNEL_SCALAR : m_costKernel;
+	CostVolumeInput in = costVolumeInput(iLeft, iRight);
+
+	for (int y0 = 0; y0 < m_h; y0 += m_tileRows)
 	{
-		messages.free();
+		int y1 = __min(y0 + m_tileRows, m_h);
+		int costBegin = __max(y0 - m_tileHalo, 0);
+		int costEnd = __min(y1 + m_tileHalo, m_h);
+		VolumeRows<unsigned char> costs = { m_tileCosts, costBegin, m_w, planes };
+		VolumeRows<short> msgs = { m_tileMessages, y0, m_w, planes };
+
+		m_leftStats.compute(iLeft, m_w, m_h, costBegin, costEnd);
+		m_rightStats.compute(iRight, m_w, m_h, costBegin, costEnd);
+		computeCostVolume(kernel, in, costBegin, costEnd, m_tileCosts, costBegin);
+		// the kernels never write the image border, which gets 255 like the border of m_dsi
+		for (int y = costBegin; y < costEnd; y++)
+		{
+			if (y == 0 || y == m_h - 1)
+				memset(costs(0, y), 255, (size_t)m_w * planes);
+			else
+			{
+				memset(costs(0, y), 255, planes);
+				memset(costs(m_w - 1, y), 255, planes);
+			}
+		}
+		memset(m_tileMessages, 0, (size_t)(y1 - y0) * m_w * planes * sizeof(short));
+
+		scanlineOptimization_rows(costs, msgs, iLeft, wLUT, y0, y1);
+		scanlineOptimization_sweep(costs, msgs, iLeft, wLUT, 1, costBegin, costEnd, y0, y1);
+		scanlineOptimization_sweep(costs, msgs, iLeft, wLUT, -1, costBegin, costEnd, y0, y1);
+
+#pragma omp parallel for schedule(dynamic,1)
+		for (int y = y0; y < y1; y++)
+		{
+			float *pDisp = dispMap + (size_t)y * m_w;
+			unsigned char *pConf = confMap + (size_t)y * m_w;
+			if (y == 0 || y == m_h - 1)
+			{
+				for (int x = 0; x < m_w; x++)
+				{
+					pDisp[x] = FLT_MAX;
+					pConf[x] = 0;
+				}
+			}
+			else
+				getDispMapRow(msgs(0, y), m_w, planes, m_sgmConfidenceThreshold, m_doSubPixRefinement, pDisp, pConf);
+		}
 	}
-	else
+}
+
+
+void SGMStereo::RunCostVolume(unsigned char * iLeft, unsigned char * iRight)
+{
+	if (m_tileRows > 0)
 	{
-		messages_hor.free();
-		messages_ver.free();
+		printf("[ERROR] There is no whole image cost volume with tiling ...\n");
+		return;
 	}
+	if (!m_buffersReady)
+		allocateBuffers();
+	calculateDSI(iLeft, iRight);
+}
+
+
+void SGMStereo::free()
+{
+	m_dsi.free();
+	messages.free();
+	messages_hor.free();
+	messages_ver.free();
+
+	m_arena.free();
+	m_tileCosts = NULL;
+	m_tileMessages = NULL;
+	m_rowBuffers = m_sweepBuffers = m_zeroBuffer = m_sweepMins = NULL;
+	m_buffersReady = false;
 
 	delete[] wLUT;
+	wLUT = NULL;
 }
 
 
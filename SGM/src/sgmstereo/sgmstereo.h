@@ -7,20 +7,57 @@
 #define sgm_stereo_h
 
 #include "dsimage.h"
+#include "costvolume.h"
+
+// how the costs are aggregated along the scanline paths
+enum AggregationMode
+{
+	AGGREGATION_PATHS,			// one path after another, each one in parallel over its scanlines
+	AGGREGATION_HOR_VERT,		// the horizontal and the vertical paths on one thread each, 4 directions only
+	AGGREGATION_SEQUENTIAL		// one path after another on one thread
+};
 
 class SGMStereo
 {
 private:
+	void calculateDSI(unsigned char *refImage, unsigned char * nbrImage);
 	void calculateDSI_sse(unsigned char *refImage, unsigned char * nbrImage);
-	void messagePassing(short *pData, short *pBuffer1, short *pDMessage, int size, float weight, short smoothness);
+	template <typename TCost>
+	short messagePassing(const TCost *pData, const short *pPrev, short minPrev, short *pCur, short *pDMessage, int size, float weight, short smoothness);
 	void scanlineOptimization(DSI &dv, DSI &messages, unsigned char * img, float *lut, int dx_, int dy_);
 	void scanlineOptimization_hor(DSI &dv, DSI &messages, unsigned char *img, float *lut);
 	void scanlineOptimization_vert(DSI &dv, DSI &messages, unsigned char *img, float *lut);
+	template <typename TCost>
+	void scanlineOptimization_rows(const VolumeRows<TCost> &dv, const VolumeRows<short> &messages, unsigned char *img, float *lut, int rowBegin, int rowEnd);
+	template <typename TCost>
+	void scanlineOptimization_sweep(const VolumeRows<TCost> &dv, const VolumeRows<short> &messages, unsigned char *img, float *lut, int dy,
+		int rowBegin, int rowEnd, int messageBegin, int messageEnd);
+	void allocateBuffers();
+	void runTiled(unsigned char * iLeft, unsigned char * iRight, float* dispMap, unsigned char* confMap);
+	CostVolumeInput costVolumeInput(unsigned char *L, unsigned char * R);
 
 	DSI m_dsi, messages;
 
+	CostKernel m_costKernel;
+	WindowStats m_leftStats, m_rightStats;
+
 	DSI messages_hor, messages_ver;
 
+	AggregationMode m_aggregation;
+	int m_tileRows;
+	int m_tileHalo;
+	bool m_buffersReady;
+
+	// scratch buffers, and with tiling the 8 bit costs and the aggregated costs of a tile
+	BufferArena m_arena;
+	unsigned char * m_tileCosts;
+	short * m_tileMessages;
+	short * m_rowBuffers;
+	short * m_sweepBuffers;
+	short * m_zeroBuffer;
+	short * m_sweepMins;
+	std::vector<int> m_pathStartX, m_pathStartY;
+
 	float * wLUT;
 
 	int m_w, m_h;
@@ -46,6 +83,30 @@ public:
 
 	void Run(unsigned char * iLeft, unsigned char * iRight, float* dispMap, unsigned char* confMap);
 
+	// choose the matching cost kernel, kernels the cpu does not support fall back to the fastest one it does.
+	// Returns the kernel that will be used.
+	CostKernel setCostKernel(CostKernel kernel);
+	CostKernel getCostKernel() const { return m_costKernel; }
+
+	// doSequential picks AGGREGATION_SEQUENTIAL or AGGREGATION_PATHS, this overrides it.
+	void setAggregation(AggregationMode mode);
+	AggregationMode getAggregation() const { return m_aggregation; }
+
+	// Process the image in bands of tileRows rows instead of all at once, which keeps only the band's costs, as 8
+	// bits, and its aggregated costs in memory instead of two 16 bit volumes of the whole image.  The vertical and
+	// diagonal paths run over haloRows more rows on either side of the band to get into step before they reach it,
+	// and are cut off there, so the result is close to but not the same as without tiling unless the halo reaches
+	// the top and bottom of the image.  tileRows 0 turns tiling off.
+	void setTiling(int tileRows, int haloRows);
+	int getTileRows() const { return m_tileRows; }
+
+	// bytes held by the cost volumes and scratch buffers, once Run has allocated them
+	size_t getBufferBytes() const;
+
+	// only compute the matching cost volume, which getCostVolume returns.  Not available with tiling.
+	void RunCostVolume(unsigned char * iLeft, unsigned char * iRight);
+	const DSI& getCostVolume() const { return m_dsi; }
+
 	void free();
 };
 #endif
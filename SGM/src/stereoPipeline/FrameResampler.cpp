@@ -0,0 +1,184 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "FrameResampler.h"
+#include "costvolume.h"
+
+#if defined(_MSC_VER)
+#define SGM_TARGET_SSE41
+#else
+// compiled for SSE4.1 one function at a time like the cost kernels, and only called when the cpu has it
+#define SGM_TARGET_SSE41 __attribute__((target("sse4.1")))
+#endif
+#include <immintrin.h>
+
+namespace
+{
+	// r + g + b of 16 pixels at a time: the 4 pixels of each load are spread to 4 bytes each with the fourth byte
+	// zeroed, then maddubs adds r + g and b + 0 and hadd adds those.  Returns the pixels done.
+	SGM_TARGET_SSE41 int channelSums_sse41(const unsigned char* row, int width, int channels, uint16_t* sums)
+	{
+		if (channels != 3 && channels != 4)
+			return 0;
+		const __m128i spread = channels == 3 ?
+			_mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1) :
+			_mm_setr_epi8(0, 1, 2, -1, 4, 5, 6, -1, 8, 9, 10, -1, 12, 13, 14, -1);
+		const __m128i ones = _mm_set1_epi8(1);
+		int x = 0;
+		// the last load is the 16 bytes from pixel x + 12 on, which for RGB reaches 4 bytes past pixel x + 15
+		for (; (x + 12) * channels + 16 <= width * channels; x += 16)
+		{
+			const unsigned char* p = row + x * channels;
+			__m128i a = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)p), spread), ones);
+			__m128i b = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p + 4 * channels)), spread), ones);
+			__m128i c = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p + 8 * channels)), spread), ones);
+			__m128i d = _mm_maddubs_epi16(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(p + 12 * channels)), spread), ones);
+			_mm_storeu_si128((__m128i*)(sums + x), _mm_hadd_epi16(a, b));
+			_mm_storeu_si128((__m128i*)(sums + x + 8), _mm_hadd_epi16(c, d));
+		}
+		return x;
+	}
+
+	// s / 3 is (s * 21846) >> 16 for every s up to 3 * 255
+	SGM_TARGET_SSE41 int divideBy3_sse41(const uint16_t* sums, int width, unsigned char* out)
+	{
+		const __m128i k = _mm_set1_epi16(21846);
+		int x = 0;
+		for (; x + 16 <= width; x += 16)
+		{
+			__m128i lo = _mm_mulhi_epu16(_mm_loadu_si128((const __m128i*)(sums + x)), k);
+			__m128i hi = _mm_mulhi_epu16(_mm_loadu_si128((const __m128i*)(sums + x + 8)), k);
+			_mm_storeu_si128((__m128i*)(out + x), _mm_packus_epi16(lo, hi));
+		}
+		return x;
+	}
+
+	SGM_TARGET_SSE41 int addRow_sse41(const uint16_t* sums, int width, uint32_t* blockSums, bool firstRow)
+	{
+		int x = 0;
+		for (; x + 8 <= width; x += 8)
+		{
+			__m128i s = _mm_loadu_si128((const __m128i*)(sums + x));
+			__m128i lo = _mm_cvtepu16_epi32(s);
+			__m128i hi = _mm_cvtepu16_epi32(_mm_srli_si128(s, 8));
+			if (!firstRow)
+			{
+				lo = _mm_add_epi32(lo, _mm_loadu_si128((const __m128i*)(blockSums + x)));
+				hi = _mm_add_epi32(hi, _mm_loadu_si128((const __m128i*)(blockSums + x + 4)));
+			}
+			_mm_storeu_si128((__m128i*)(blockSums + x), lo);
+			_mm_storeu_si128((__m128i*)(blockSums + x + 4), hi);
+		}
+		return x;
+	}
+}
+
+CFrameResampler::CFrameResampler()
+	: inputWidth(0), inputHeight(0), outputWidth(0), outputHeight(0), useSimd(false)
+{
+	SetSimd(true);
+}
+
+// The blocks are the ones the stereo pipeline always used: the scale of the width for both axes, at least one pixel
+// per block, and the last blocks clamped to the image.
+void CFrameResampler::Initialize(int _inputWidth, int _inputHeight, int _outputWidth, int _outputHeight)
+{
+	inputWidth = _inputWidth;
+	inputHeight = _inputHeight;
+	outputWidth = _outputWidth;
+	outputHeight = _outputHeight;
+
+	float scale = inputWidth / (1.0f * outputWidth);
+	blockX0.resize(outputWidth);
+	blockX1.resize(outputWidth);
+	for (int x = 0; x < outputWidth; x++)
+	{
+		blockX0[x] = __min((int)(x * scale), inputWidth - 1);
+		blockX1[x] = __min(__max((int)((x + 1) * scale), blockX0[x] + 1), inputWidth);
+	}
+	blockY0.resize(outputHeight);
+	blockY1.resize(outputHeight);
+	for (int y = 0; y < outputHeight; y++)
+	{
+		blockY0[y] = __min((int)(y * scale), inputHeight - 1);
+		blockY1[y] = __min(__max((int)((y + 1) * scale), blockY0[y] + 1), inputHeight);
+	}
+
+	rowSums.assign(inputWidth, 0);
+	blockSums.assign(inputWidth, 0);
+}
+
+void CFrameResampler::CleanUp()
+{
+	std::vector<int>().swap(blockX0);
+	std::vector<int>().swap(blockX1);
+	std::vector<int>().swap(blockY0);
+	std::vector<int>().swap(blockY1);
+	std::vector<uint16_t>().swap(rowSums);
+	std::vector<uint32_t>().swap(blockSums);
+}
+
+bool CFrameResampler::SetSimd(bool simd)
+{
+	useSimd = simd && costKernelSupported(COST_KERNEL_SSE41);
+	return useSimd;
+}
+
+void CFrameResampler::channelSums(const unsigned char* row, int channels)
+{
+	uint16_t* sums = rowSums.data();
+	int x = useSimd ? channelSums_sse41(row, inputWidth, channels, sums) : 0;
+	if (channels >= 3)
+	{
+		for (const unsigned char* p = row + x * channels; x < inputWidth; x++, p += channels)
+			sums[x] = (uint16_t)(p[0] + p[1] + p[2]);
+	}
+	else
+	{
+		for (const unsigned char* p = row + x * channels; x < inputWidth; x++, p += channels)
+			sums[x] = (uint16_t)(3 * p[0]);
+	}
+}
+
+bool CFrameResampler::Resample(const ImageView& input, unsigned char* output)
+{
+	if (input.data == NULL || input.width != inputWidth || input.height != inputHeight || input.channels < 1 ||
+		input.stride < input.width * input.channels)
+		return false;
+
+	if (outputWidth == inputWidth && outputHeight == inputHeight)
+	{
+		for (int y = 0; y < inputHeight; y++)
+		{
+			channelSums(input.row(y), input.channels);
+			unsigned char* out = output + (size_t)y * outputWidth;
+			int x = useSimd ? divideBy3_sse41(rowSums.data(), inputWidth, out) : 0;
+			for (; x < inputWidth; x++)
+				out[x] = (unsigned char)(rowSums[x] / 3);
+		}
+		return true;
+	}
+
+	for (int y = 0; y < outputHeight; y++)
+	{
+		for (int sy = blockY0[y]; sy < blockY1[y]; sy++)
+		{
+			channelSums(input.row(sy), input.channels);
+			bool firstRow = sy == blockY0[y];
+			int x = useSimd ? addRow_sse41(rowSums.data(), inputWidth, blockSums.data(), firstRow) : 0;
+			for (; x < inputWidth; x++)
+				blockSums[x] = firstRow ? rowSums[x] : blockSums[x] + rowSums[x];
+		}
+
+		int rows = blockY1[y] - blockY0[y];
+		unsigned char* out = output + (size_t)y * outputWidth;
+		for (int x = 0; x < outputWidth; x++)
+		{
+			uint32_t sum = 0;
+			for (int sx = blockX0[x]; sx < blockX1[x]; sx++)
+				sum += blockSums[sx];
+			out[x] = (unsigned char)(sum / (uint32_t)(3 * rows * (blockX1[x] - blockX0[x])));
+		}
+	}
+	return true;
+}
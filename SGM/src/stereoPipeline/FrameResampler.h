@@ -0,0 +1,43 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "ImageView.h"
+#include <vector>
+#include <stdint.h>
+
+// Gray scale (r + g + b) / 3 of an RGB or RGBA image at the same or a lower resolution.  Each output pixel is the
+// average of the block of input pixels it covers, the sum of their channels divided by 3 times their count and
+// rounded down.  Images with fewer than 3 channels are taken to be gray already.  The channel sums, the division by
+// 3 and the sums over the rows of a block use SSE4.1 when the cpu has it, the sums over the columns of a block are
+// scalar, and both give the same result.  Initialize allocates the block tables and the row buffers, after that
+// Resample does not allocate.
+class CFrameResampler
+{
+private:
+	int							inputWidth, inputHeight;
+	int							outputWidth, outputHeight;
+	bool						useSimd;
+
+	// input columns [blockX0[x], blockX1[x]) and rows [blockY0[y], blockY1[y]) make up output pixel (x, y)
+	std::vector<int>			blockX0, blockX1, blockY0, blockY1;
+	std::vector<uint16_t>		rowSums;		// r + g + b of each pixel of an input row
+	std::vector<uint32_t>		blockSums;		// rowSums added up over the rows of a block
+
+	void						channelSums(const unsigned char* row, int channels);
+
+public:
+	CFrameResampler();
+
+	void						Initialize(int inputWidth, int inputHeight, int outputWidth, int outputHeight);
+	void						CleanUp();
+
+	// output holds outputWidth * outputHeight pixels.  Returns false if input is not inputWidth x inputHeight.  Uses
+	// the row buffers, so one call at a time.
+	bool						Resample(const ImageView& input, unsigned char* output);
+
+	// use SSE4.1 if the cpu supports it, returns whether it is used
+	bool						SetSimd(bool simd);
+	bool						GetSimd() const { return useSimd; }
+};
@@ -0,0 +1,36 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <stddef.h>
+
+// An 8 bit image somewhere in memory that CStateStereo reads but does not own, e.g. the buffer of an ImageResponse.
+// stride is the distance from one row to the next in bytes, channels the bytes per pixel: 1 for gray scale, 3 for
+// RGB and 4 for RGBA.
+struct ImageView
+{
+	const unsigned char*	data;
+	int						width, height, stride, channels;
+
+	ImageView() : data(NULL), width(0), height(0), stride(0), channels(0) {}
+	ImageView(const unsigned char* _data, int _width, int _height, int _stride, int _channels)
+		: data(_data), width(_width), height(_height), stride(_stride), channels(_channels) {}
+
+	const unsigned char* row(int y) const { return data + (size_t)y * stride; }
+};
+
+// A map CStateStereo owns, valid until the next frame or CleanUp.  stride is in elements.
+template <typename T>
+struct MapView
+{
+	const T*				data;
+	int						width, height, stride;
+
+	MapView() : data(NULL), width(0), height(0), stride(0) {}
+	MapView(const T* _data, int _width, int _height, int _stride)
+		: data(_data), width(_width), height(_height), stride(_stride) {}
+
+	const T* row(int y) const { return data + (size_t)y * stride; }
+	const T& operator()(int x, int y) const { return data[(size_t)y * stride + x]; }
+};
@@ -19,7 +19,7 @@ struct SGMOptions
     int minDisparity;
     int maxDisparity;
 	int numDirections;				// 4 or 8
-	int doSequential;               // do sequential message passing (or horizontal and vertical in parallel).
+	int doSequential;               // do sequential message passing (or each path in parallel over its scanlines).
 	int doVis;						// if 1, then output visualization.
 	int doOut;						// if 1, then write output
 	float smoothness;
@@ -27,6 +27,8 @@ struct SGMOptions
 	float penalty2;
 	float alpha;
 	int doSubPixRefinement;
+	int tileRows;					// process bands of this many rows with 8 bit costs to save memory, 0 for the whole image at once
+	int tileHalo;					// rows above and below a band the vertical paths start from
 
 	SGMOptions()
     {
@@ -46,6 +48,8 @@ struct SGMOptions
 		alpha = 10.0;
 		onlyStereo = 0;
 		doSubPixRefinement = 1;
+		tileRows = 0;
+		tileHalo = 16;
 	}
 
     void Print()
@@ -65,6 +69,8 @@ struct SGMOptions
 		wprintf(L"   doOut = %d\n", doOut);
 		wprintf(L"   onlyStereo = %d\n", onlyStereo);
 		wprintf(L"   doSubPixRefinement = %d\n", doSubPixRefinement);
+		wprintf(L"   tileRows = %d\n", tileRows);
+		wprintf(L"   tileHalo = %d\n", tileHalo);
 		printf("*********************************************************\n\n\n");
     }
 
@@ -9,15 +9,19 @@
 #include <ctime>       /* clock_t, clock, CLOCKS_PER_SEC */
 
 CStateStereo::CStateStereo()
+	: sgmStereo(NULL)
 {
 }
 
 CStateStereo::~CStateStereo()
 {
+	CleanUp();
 }
 
 void CStateStereo::Initialize(SGMOptions& params, int m, int n)
 {
+	CleanUp();
+
     inputFrameWidth = n;
     inputFrameHeight = m;
 
@@ -51,8 +55,12 @@ void CStateStereo::Initialize(SGMOptions& params, int m, int n)
     
     printf("process at %d x %d resolution, ndisps = %d\n", processingFrameWidth, processingFrameHeight, ndisps);
 
-	dispMap = new float[processingFrameWidth * processingFrameHeight];
-	confMap = new unsigned char[processingFrameWidth * processingFrameHeight];
+	int nP = processingFrameWidth * processingFrameHeight;
+	grayLeft.assign(nP, 0);
+	grayRight.assign(nP, 0);
+	dispMap.assign(nP, FLT_MAX);
+	confMap.assign(nP, 0);
+	resampler.Initialize(inputFrameWidth, inputFrameHeight, processingFrameWidth, processingFrameHeight);
 
 	sgmStereo = new SGMStereo(processingFrameWidth, processingFrameHeight, -maxDisp, -minDisp, params.numDirections, params.sgmConfidenceThreshold,
 		params.doSubPixRefinement,
@@ -61,6 +69,8 @@ void CStateStereo::Initialize(SGMOptions& params, int m, int n)
 		params.penalty2,
 		params.alpha,
 		params.doSequential);
+	if (params.tileRows > 0)
+		sgmStereo->setTiling(params.tileRows, params.tileHalo);
 }
 
 void CStateStereo::CleanUp()
@@ -68,46 +78,82 @@ void CStateStereo::CleanUp()
 	if (sgmStereo != NULL)
 	{
 		sgmStereo->free();
+		delete sgmStereo;
+		sgmStereo = NULL;
 	}
+	resampler.CleanUp();
+	std::vector<unsigned char>().swap(grayLeft);
+	std::vector<unsigned char>().swap(grayRight);
+	std::vector<float>().swap(dispMap);
+	std::vector<unsigned char>().swap(confMap);
 }
 
-void CStateStereo::ProcessFrameAirSim(int frameCounter, float& dtime, const std::vector<uint8_t>& left_image, const std::vector<uint8_t>& right_image)
+ImageView CStateStereo::InputView(const std::vector<uint8_t>& image) const
 {
-	unsigned char *iL, *iR;
+	int nP = inputFrameWidth * inputFrameHeight;
+	int channels = nP > 0 ? (int)image.size() / nP : 0;
+	if (channels == 0 || image.size() != (size_t)nP * channels)
+		return ImageView();
+	return ImageView(image.data(), inputFrameWidth, inputFrameHeight, inputFrameWidth * channels, channels);
+}
 
-	// sgm stereo
-	if (processingFrameWidth != inputFrameWidth || processingFrameHeight != inputFrameHeight)
+bool CStateStereo::PrepareFrame(const ImageView& left, const ImageView& right, unsigned char* iL, unsigned char* iR)
+{
+	if (!resampler.Resample(left, iL) || !resampler.Resample(right, iR))
 	{
-		printf("[ERROR]: Frame resolution = (%d x %d) is not equal to initialization ...\n", processingFrameWidth, processingFrameHeight);
+		printf("[ERROR]: Frame resolution (%d x %d and %d x %d) does not match the initialized one (%d x %d) ...\n",
+			left.width, left.height, right.width, right.height, inputFrameWidth, inputFrameHeight);
+		return false;
 	}
+	return true;
+}
 
-	int nP = processingFrameWidth * processingFrameHeight;
-	iL = new unsigned char[nP];
-	iR = new unsigned char[nP];
+bool CStateStereo::PrepareFrame(const std::vector<uint8_t>& left_image, const std::vector<uint8_t>& right_image, unsigned char* iL, unsigned char* iR)
+{
+	return PrepareFrame(InputView(left_image), InputView(right_image), iL, iR);
+}
 
-    int channels = (int)left_image.size()/nP;
+void CStateStereo::ProcessFrameGray(unsigned char* iL, unsigned char* iR)
+{
+	sgmStereo->Run(iL, iR, dispMap.data(), confMap.data());
+}
 
-	for (int i = 0; i < nP; i++)
-	{
-        {
-            int idx = channels*i;
-			iL[i] = (left_image[idx] + left_image[idx+1] + left_image[idx+2]) / 3;
-			iR[i] = (right_image[idx] + right_image[idx+1] + right_image[idx+2]) / 3;
-		}
-	}
+bool CStateStereo::ProcessFrame(const ImageView& left, const ImageView& right)
+{
+	if (!PrepareFrame(left, right, grayLeft.data(), grayRight.data()))
+		return false;
+	ProcessFrameGray(grayLeft.data(), grayRight.data());
+	return true;
+}
+
+void CStateStereo::ProcessFrameAirSim(int frameCounter, float& dtime, const ImageView& left, const ImageView& right)
+{
+	if (!PrepareFrame(left, right, grayLeft.data(), grayRight.data()))
+		return;
 
     std::clock_t start;
     start = std::clock();
 
-	sgmStereo->Run(iL, iR, dispMap, confMap);
+	ProcessFrameGray(grayLeft.data(), grayRight.data());
     float duration = ( std::clock() - start ) / (float) CLOCKS_PER_SEC;
 	dtime += duration;
 
 	printf("Frame %06d:	%5.1f ms, Average fps: %lf\n", frameCounter, duration*1000, 1.0 / (dtime / double(frameCounter+1)));
+}
+
+void CStateStereo::ProcessFrameAirSim(int frameCounter, float& dtime, const std::vector<uint8_t>& left_image, const std::vector<uint8_t>& right_image)
+{
+	ProcessFrameAirSim(frameCounter, dtime, InputView(left_image), InputView(right_image));
+}
 
-	delete[] iL;
-	delete[] iR;
+MapView<float> CStateStereo::GetDisparity() const
+{
+	return MapView<float>(dispMap.data(), processingFrameWidth, processingFrameHeight, processingFrameWidth);
+}
 
+MapView<unsigned char> CStateStereo::GetConfidence() const
+{
+	return MapView<unsigned char>(confMap.data(), processingFrameWidth, processingFrameHeight, processingFrameWidth);
 }
 
 
@@ -7,7 +7,10 @@
 
 #include "../sgmstereo/sgmstereo.h"
 #include "SGMOptions.h"
+#include "ImageView.h"
+#include "FrameResampler.h"
 #include <vector>
+#include <stdint.h>
 
 class CStateStereo
 {
@@ -21,6 +24,14 @@ private:
 	int							confThreshold;
 
 	SGMStereo *					sgmStereo;
+
+	// allocated by Initialize and reused by every frame
+	CFrameResampler				resampler;
+	std::vector<unsigned char>	grayLeft, grayRight;
+	std::vector<float>			dispMap;
+	std::vector<unsigned char>	confMap;
+
+	ImageView					InputView(const std::vector<uint8_t>& image) const;
     
 public:
 	
@@ -30,10 +41,21 @@ public:
 	~CStateStereo();
 	void						Initialize(SGMOptions& params, int m = 144, int n = 256);
     void						CleanUp();
+	// images at input resolution, as views or packed in vectors.  Returns false if they are not.
+	bool						ProcessFrame(const ImageView& left, const ImageView& right);
+    void                        ProcessFrameAirSim(int frameCounter, float& dtime, const ImageView& left, const ImageView& right);
     void                        ProcessFrameAirSim(int frameCounter, float& dtime, const std::vector<uint8_t>& left_image, const std::vector<uint8_t>& right_image);
+	// gray scale left and right images at processing resolution from images at input resolution, iL and iR hold
+	// processingFrameWidth * processingFrameHeight pixels.  Does not touch the SGM state, so it can run on another
+	// thread than ProcessFrameGray, but one PrepareFrame at a time.  Returns false if the images are not at input
+	// resolution.
+	bool						PrepareFrame(const ImageView& left, const ImageView& right, unsigned char* iL, unsigned char* iR);
+	bool						PrepareFrame(const std::vector<uint8_t>& left_image, const std::vector<uint8_t>& right_image, unsigned char* iL, unsigned char* iR);
+	// stereo on images from PrepareFrame, the result goes to the disparity and confidence maps
+	void						ProcessFrameGray(unsigned char* iL, unsigned char* iR);
 	float						GetLeftDisparity(float x, float y);
 
-	float*						dispMap;
-	unsigned char*				confMap;
-
+	// disparity and confidence of the last frame at processing resolution, FLT_MAX where there is no disparity
+	MapView<float>				GetDisparity() const;
+	MapView<unsigned char>		GetConfidence() const;
 };
\ No newline at end of file
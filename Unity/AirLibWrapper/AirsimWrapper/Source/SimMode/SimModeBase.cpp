@@ -73,6 +73,13 @@ void SimModeBase::continueForTime(double seconds)
 	throw std::domain_error("continueForTime is not implemented by SimMode");
 }
 
+void SimModeBase::step(unsigned int steps)
+{
+	//should be overridden by derived class
+	unused(steps);
+	throw std::domain_error("step is not implemented by SimMode");
+}
+
 void SimModeBase::setTimeOfDay(bool is_enabled, const std::string& start_datetime, bool is_start_datetime_dst,
     float celestial_clock_speed, float update_interval_secs, bool move_sun)
 {
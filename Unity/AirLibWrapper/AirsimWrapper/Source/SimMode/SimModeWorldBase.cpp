@@ -20,8 +20,11 @@ void SimModeWorldBase::initializeForPlay()
 
 	std::unique_ptr<PhysicsEngineBase> physics_engine = createPhysicsEngine();
 	physics_engine_ = physics_engine.get();
+	//how long before each physics tick the loop stops sleeping and spins instead
+	uint64_t spin_window_nanos = static_cast<uint64_t>(msr::airlib::Settings::singleton().getInt("PhysicsLoopSpinWindowMicros",
+		static_cast<int>(common_utils::ScheduledExecutor::kDefaultSpinWindowNanos / 1000))) * 1000;
 	physics_world_.reset(new msr::airlib::PhysicsWorld(std::move(physics_engine),
-		vehicles, getPhysicsLoopPeriod()));
+		vehicles, getPhysicsLoopPeriod(), false, true, spin_window_nanos));
 }
 
 void SimModeWorldBase::EndPlay()
@@ -64,13 +67,26 @@ std::unique_ptr<SimModeWorldBase::PhysicsEngineBase> SimModeWorldBase::createPhy
 		msr::airlib::Settings fast_phys_settings;
 		if (msr::airlib::Settings::singleton().getChild("FastPhysicsEngine", fast_phys_settings)) 
 		{
-			physics_engine.reset(new msr::airlib::FastPhysicsEngine(fast_phys_settings.getBool("EnableGroundLock", true)));
+			physics_engine.reset(new msr::airlib::FastPhysicsEngine(fast_phys_settings.getBool("EnableGroundLock", true),
+				static_cast<unsigned int>(fast_phys_settings.getInt("ThreadCount", 1))));
 		}
 		else 
 		{
 			physics_engine.reset(new msr::airlib::FastPhysicsEngine());
 		}
 	}
+	else if (physics_engine_name == "BatchPhysicsEngine")
+	{
+		msr::airlib::Settings batch_phys_settings;
+		if (msr::airlib::Settings::singleton().getChild("BatchPhysicsEngine", batch_phys_settings))
+		{
+			physics_engine.reset(new msr::airlib::BatchPhysicsEngine(batch_phys_settings.getBool("EnableGroundLock", true)));
+		}
+		else
+		{
+			physics_engine.reset(new msr::airlib::BatchPhysicsEngine());
+		}
+	}
 	else 
 	{
 		physics_engine.reset();
@@ -94,6 +110,11 @@ void SimModeWorldBase::continueForTime(double seconds)
 	physics_world_->continueForTime(seconds);
 }
 
+void SimModeWorldBase::step(unsigned int steps)
+{
+	physics_world_->step(steps);
+}
+
 void SimModeWorldBase::updateDebugReport(msr::airlib::StateReporterWrapper& debug_reporter)
 {
 	unused(debug_reporter);
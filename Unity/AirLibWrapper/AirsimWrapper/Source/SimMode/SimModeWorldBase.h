@@ -2,6 +2,7 @@
 
 #include "SimModeBase.h"
 #include "physics/FastPhysicsEngine.hpp"
+#include "physics/BatchPhysicsEngine.hpp"
 #include "physics/PhysicsWorld.hpp"
 
 class SimModeWorldBase : public SimModeBase
@@ -35,6 +36,7 @@ public:
 	virtual bool isPaused() const override;
 	virtual void pause(bool is_paused) override;
 	virtual void continueForTime(double seconds) override;
+	virtual void step(unsigned int steps) override;
 
 private:
 	std::unique_ptr<msr::airlib::PhysicsWorld> physics_world_;
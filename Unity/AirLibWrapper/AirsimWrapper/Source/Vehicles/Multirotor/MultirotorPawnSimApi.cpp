@@ -27,6 +27,7 @@ void MultirotorPawnSimApi::initialize()
     //setup physics vehicle
     phys_vehicle_ = std::unique_ptr<MultiRotor>(new MultiRotor(vehicle_params_.get(), vehicle_api_.get(),
         getKinematics(), getEnvironment()));
+    phys_vehicle_->setProfilerName(getVehicleName());
     rotor_count_ = phys_vehicle_->wrenchVertexCount();
     rotor_info_.assign(rotor_count_, RotorInfo());
 
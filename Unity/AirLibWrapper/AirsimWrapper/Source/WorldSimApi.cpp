@@ -30,6 +30,11 @@ void WorldSimApi::continueForTime(double seconds)
 	simmode_->continueForTime(seconds);
 }
 
+void WorldSimApi::step(unsigned int steps)
+{
+	simmode_->step(steps);
+}
+
 void WorldSimApi::setTimeOfDay(bool is_enabled, const std::string& start_datetime, bool is_start_datetime_dst,
     float celestial_clock_speed, float update_interval_secs, bool move_sun)
 {
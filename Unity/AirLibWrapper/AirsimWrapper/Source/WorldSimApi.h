@@ -16,6 +16,7 @@ public:
 	virtual void reset() override;
 	virtual void pause(bool is_paused) override;
 	virtual void continueForTime(double seconds) override;
+	virtual void step(unsigned int steps) override;
         virtual void setTimeOfDay(bool is_enabled, const std::string& start_datetime, bool is_start_datetime_dst,
             float celestial_clock_speed, float update_interval_secs, bool move_sun);
 
@@ -224,6 +224,13 @@ void ASimModeBase::continueForTime(double seconds)
     throw std::domain_error("continueForTime is not implemented by SimMode");
 }
 
+void ASimModeBase::step(unsigned int steps)
+{
+    //should be overridden by derived class
+    unused(steps);
+    throw std::domain_error("step is not implemented by SimMode");
+}
+
 std::unique_ptr<msr::airlib::ApiServerBase> ASimModeBase::createApiServer() const
 {
     //this will be the case when compilation with RPCLIB is disabled or simmode doesn't support APIs
@@ -642,7 +649,9 @@ void ASimModeBase::drawLidarDebugPoints()
                 if (lidar != nullptr && lidar->getParams().draw_debug_points) {
                     lidar_draw_debug_points_ = true;
 
-                    msr::airlib::LidarData lidar_data = lidar->getOutput();
+                    // hold on to the published scan instead of copying the point cloud every frame
+                    std::shared_ptr<const msr::airlib::LidarData> lidar_output = lidar->getOutput();
+                    const msr::airlib::LidarData& lidar_data = *lidar_output;
 
                     if (lidar_data.point_cloud.size() < 3)
                         return;
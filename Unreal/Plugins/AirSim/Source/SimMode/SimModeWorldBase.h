@@ -5,6 +5,7 @@
 #include <vector>
 #include "api/VehicleSimApiBase.hpp"
 #include "physics/FastPhysicsEngine.hpp"
+#include "physics/BatchPhysicsEngine.hpp"
 #include "physics/World.hpp"
 #include "physics/PhysicsWorld.hpp"
 #include "common/StateReporterWrapper.hpp"
@@ -30,6 +31,7 @@ public:
     virtual bool isPaused() const override;
     virtual void pause(bool is_paused) override;
     virtual void continueForTime(double seconds) override;
+    virtual void step(unsigned int steps) override;
 
 protected:
     void startAsyncUpdator();
@@ -42,10 +42,8 @@ void UnrealLidarSensor::createLasers()
 
 // returns a point-cloud for the tick
 void UnrealLidarSensor::getPointCloud(const msr::airlib::Pose& lidar_pose, const msr::airlib::Pose& vehicle_pose,
-    const msr::airlib::TTimeDelta delta_time, msr::airlib::vector<msr::airlib::real_T>& point_cloud)
+    const msr::airlib::TTimeDelta delta_time, msr::airlib::LidarData& output)
 {
-    point_cloud.clear();
-
     msr::airlib::LidarSimpleParams params = getParams();
     const auto number_of_lasers = params.number_of_channels;
 
@@ -71,6 +69,14 @@ void UnrealLidarSensor::getPointCloud(const msr::airlib::Pose& lidar_pose, const
     const float angle_distance_of_tick = params.horizontal_rotation_frequency * 360.0f * delta_time;
     const float angle_distance_of_laser_measure = angle_distance_of_tick / points_to_scan_with_one_laser;
 
+    // reserve for the worst case so the buffer reused by LidarSimple doesn't grow while scanning
+    const uint32 max_points = points_to_scan_with_one_laser * number_of_lasers;
+    output.point_cloud.reserve(max_points * 3);
+    if (params.include_ring)
+        output.ring.reserve(max_points);
+    if (params.include_time_offset)
+        output.time_offset.reserve(max_points);
+
     // normalize FOV start/end
     const float laser_start = std::fmod(360.0f + params.horizontal_FOV_start, 360.0f);
     const float laser_end = std::fmod(360.0f + params.horizontal_FOV_end, 360.0f);
@@ -92,9 +98,16 @@ void UnrealLidarSensor::getPointCloud(const msr::airlib::Pose& lidar_pose, const
             // shoot laser and get the impact point, if any
             if (shootLaser(lidar_pose, vehicle_pose, laser, horizontal_angle, vertical_angle, params, point))
             {
-                point_cloud.emplace_back(point.x());
-                point_cloud.emplace_back(point.y());
-                point_cloud.emplace_back(point.z());
+                output.point_cloud.emplace_back(point.x());
+                output.point_cloud.emplace_back(point.y());
+                output.point_cloud.emplace_back(point.z());
+
+                if (params.include_ring)
+                    output.ring.emplace_back(static_cast<uint16_t>(laser));
+                // points are spread evenly over the tick and output is stamped at its end
+                if (params.include_time_offset)
+                    output.time_offset.emplace_back(-static_cast<float>(delta_time) *
+                        (1.0f - static_cast<float>(i) / points_to_scan_with_one_laser));
             }
         }
     }
@@ -21,7 +21,7 @@ public:
 
 protected:
     virtual void getPointCloud(const msr::airlib::Pose& lidar_pose, const msr::airlib::Pose& vehicle_pose,
-        msr::airlib::TTimeDelta delta_time, msr::airlib::vector<msr::airlib::real_T>& point_cloud) override;
+        msr::airlib::TTimeDelta delta_time, msr::airlib::LidarData& output) override;
 
 private:
     using Vector3r = msr::airlib::Vector3r;
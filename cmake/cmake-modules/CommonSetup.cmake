@@ -2,6 +2,10 @@
 
 macro(CommonTargetLink)
     target_link_libraries(${PROJECT_NAME} ${CMAKE_THREAD_LIBS_INIT})
+    IF(UNIX AND NOT APPLE)
+        #shm_open for SharedImageRing needs librt on older glibc
+        target_link_libraries(${PROJECT_NAME} rt)
+    ENDIF()
     #target_link_libraries(c++abi)
 endmacro(CommonTargetLink)
 